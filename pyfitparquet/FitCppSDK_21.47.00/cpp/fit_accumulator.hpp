@@ -31,6 +31,7 @@ class Accumulator
       void Set(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum, const FIT_UINT32 value );
 
    private:
+      friend class Decode; // Checkpoint serialization
       std::vector<AccumulatedField> fields;
 };
 
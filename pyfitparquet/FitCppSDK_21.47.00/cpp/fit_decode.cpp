@@ -16,10 +16,12 @@
 
 
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include "fit_decode.hpp"
 #include "fit_crc.hpp"
+#include "fit_simd.hpp"
 #include "fit_factory.hpp"
 #include "fit_mesg_listener.hpp"
 #include "fit_developer_data_id_mesg.hpp"
@@ -35,6 +37,7 @@ const FIT_UINT8 Decode::DevFieldIndexOffset = 2;
 Decode::Decode()
     : mesgListener(NULL)
     , mesgDefinitionListener(NULL)
+    , expansionListener(NULL)
 {
     for (int i=0; i<FIT_MAX_LOCAL_MESGS; i++)
     {
@@ -48,9 +51,12 @@ Decode::Decode()
     invalidDataSize = FIT_FALSE;
     file = NULL;
     currentByteOffset = 0;
+    readFileSize = 0;
     bytesRead = 0;
     currentByteIndex = 0;
     suppressComponentExpansion = FIT_FALSE;
+    timestamp = 0;
+    lastTimeOffset = 0;
 }
 
 FIT_BOOL Decode::IsFIT(std::istream &file)
@@ -177,20 +183,23 @@ void Decode::IncompleteStream()
 FIT_BOOL Decode::Read(std::istream* file)
 {
     FIT_BOOL status = FIT_TRUE;
-    FIT_UINT32 fileSize = 0;
 
     this->file = file;
     currentByteOffset = 0;
     descriptions.clear();
     developers.clear();
 
+    // Not carried over from a previous pass (e.g. CheckIntegrity)
+    accumulator = Accumulator();
+    timestamp = 0;
+
     // Read out the size of the file
     file->seekg(0, file->end);
-    fileSize = (FIT_UINT32)file->tellg();
+    readFileSize = (FIT_UINT32)file->tellg();
     // Ensure the read starts at the beginning of the file
     file->seekg(0, file->beg);
 
-    while ( ( currentByteOffset < fileSize ) && ( status == FIT_TRUE ) )
+    while ( ( currentByteOffset < readFileSize ) && ( status == FIT_TRUE ) )
     {
         InitRead(*file, FIT_FALSE);
         status = Resume();
@@ -229,6 +238,19 @@ void Decode::Pause(void)
     pause = FIT_TRUE;
 }
 
+FIT_BOOL Decode::ResumeRead(void)
+{
+    FIT_BOOL status = Resume();
+
+    while ( ( currentByteOffset < readFileSize ) && ( status == FIT_TRUE ) )
+    {
+        InitRead(*file, FIT_FALSE);
+        status = Resume();
+    }
+
+    return status;
+}
+
 FIT_BOOL Decode::Resume(void)
 {
     pause = FIT_FALSE;
@@ -254,37 +276,7 @@ FIT_BOOL Decode::Resume(void)
                     break;
 
                 case RETURN_MESG:
-                    if (mesg.GetNum() == FIT_MESG_NUM_DEVELOPER_DATA_ID)
-                    {
-                        DeveloperDataIdMesg devIdMesg(mesg);
-                        FIT_UINT8 index = devIdMesg.GetDeveloperDataIndex();
-                        developers[index] = devIdMesg;
-                        descriptions[index] = std::unordered_map<FIT_UINT8, FieldDescriptionMesg>();
-                    }
-                    else if (mesg.GetNum() == FIT_MESG_NUM_FIELD_DESCRIPTION)
-                    {
-                        FieldDescriptionMesg descMesg(mesg);
-                        FIT_UINT8 index = descMesg.GetDeveloperDataIndex();
-                        FIT_UINT8 fldNum = descMesg.GetFieldDefinitionNumber();
-
-                        try
-                        {
-                            descriptions.at(index)[fldNum] = descMesg;
-
-                            if ( descriptionListener )
-                                descriptionListener->OnDeveloperFieldDescription
-                                    (
-                                    DeveloperFieldDescription( descMesg, developers[index] )
-                                    );
-                        }
-                        catch (std::out_of_range)
-                        {
-                            // Description without a Developer Data Id Message
-                        }
-                    }
-
-                    if (mesgListener)
-                        mesgListener->OnMesg(mesg);
+                    DispatchMesg();
                     break;
 
                 case RETURN_MESG_DEF:
@@ -305,6 +297,10 @@ FIT_BOOL Decode::Resume(void)
             currentByteOffset++;
         }
         currentByteIndex = 0;
+
+        // Paused by the buffer's last byte: Resume() reads the next buffer
+        if (pause)
+            return FIT_FALSE;
     } while ( file->good() );
 
     if ((streamIsComplete == FIT_TRUE) && (skipHeader == FIT_FALSE))
@@ -355,6 +351,41 @@ FIT_BOOL Decode::Resume(void)
     }
 }
 
+void Decode::DispatchMesg(void)
+{
+    if (mesg.GetNum() == FIT_MESG_NUM_DEVELOPER_DATA_ID)
+    {
+        DeveloperDataIdMesg devIdMesg(mesg);
+        FIT_UINT8 index = devIdMesg.GetDeveloperDataIndex();
+        developers[index] = devIdMesg;
+        descriptions[index] = std::unordered_map<FIT_UINT8, FieldDescriptionMesg>();
+    }
+    else if (mesg.GetNum() == FIT_MESG_NUM_FIELD_DESCRIPTION)
+    {
+        FieldDescriptionMesg descMesg(mesg);
+        FIT_UINT8 index = descMesg.GetDeveloperDataIndex();
+        FIT_UINT8 fldNum = descMesg.GetFieldDefinitionNumber();
+
+        try
+        {
+            descriptions.at(index)[fldNum] = descMesg;
+
+            if ( descriptionListener )
+                descriptionListener->OnDeveloperFieldDescription
+                    (
+                    DeveloperFieldDescription( descMesg, developers[index] )
+                    );
+        }
+        catch (std::out_of_range)
+        {
+            // Description without a Developer Data Id Message
+        }
+    }
+
+    if (mesgListener)
+        mesgListener->OnMesg(mesg);
+}
+
 FIT_BOOL Decode::getInvalidDataSize(void)
 {
     return invalidDataSize;
@@ -365,6 +396,617 @@ void Decode::setInvalidDataSize(FIT_BOOL value)
     invalidDataSize = value;
 }
 
+// Messages the scan must decode: those expanding accumulated components
+// (accumulator state), developer data (definitions) and file_id
+static FIT_BOOL IsScanDecoded(FIT_UINT16 mesgNum, const MesgDefinition& defn)
+{
+    if ((mesgNum == FIT_MESG_NUM_FILE_ID) || (mesgNum == FIT_MESG_NUM_DEVELOPER_DATA_ID) ||
+        (mesgNum == FIT_MESG_NUM_FIELD_DESCRIPTION))
+        return FIT_TRUE;
+
+    for (const FieldDefinition& fldDefn : defn.GetFields())
+    {
+        const Profile::FIELD* field = Profile::GetField(mesgNum, fldDefn.GetNum());
+        if (field == NULL)
+            continue;
+
+        for (FIT_UINT16 i = 0; i < field->numComponents; i++)
+            if (field->components[i].accumulate)
+                return FIT_TRUE;
+
+        for (FIT_UINT16 i = 0; i < field->numSubFields; i++)
+            for (FIT_UINT16 j = 0; j < field->subFields[i].numComponents; j++)
+                if (field->subFields[i].components[j].accumulate)
+                    return FIT_TRUE;
+    }
+    return FIT_FALSE;
+}
+
+std::vector<Decode::Checkpoint> Decode::Scan(std::istream &file, FIT_UINT32 chunkBytes, MesgListener* mesgListener)
+{
+    std::vector<Checkpoint> checkpoints;
+    std::vector<char> block(65536);
+    FIT_UINT32 blockBytes = 0;
+    FIT_UINT32 blockIndex = 0;
+    FIT_UINT8 data;
+
+    auto nextByte = [&]() -> FIT_UINT8
+    {
+        if (blockIndex == blockBytes)
+        {
+            file.read(block.data(), block.size());
+            blockBytes = (FIT_UINT32)file.gcount();
+            blockIndex = 0;
+
+            if (blockBytes == 0)
+            {
+                std::ostringstream message;
+                message << "FIT decode error: Unexpected end of input stream at byte: " << currentByteOffset;
+                throw RuntimeException(message.str());
+            }
+        }
+        currentByteOffset++;
+        return (FIT_UINT8)block[blockIndex++];
+    };
+
+    this->file = &file;
+    this->mesgListener = mesgListener;
+    this->mesgDefinitionListener = NULL;
+    this->descriptionListener = NULL;
+    currentByteOffset = 0;
+    descriptions.clear();
+    developers.clear();
+    accumulator = Accumulator();
+    timestamp = 0;
+    file.clear();
+    InitRead(file);
+
+    // File header (sets fileDataSize)
+    while (state == STATE_FILE_HDR)
+    {
+        ReadByte(nextByte());
+    }
+
+    // Records, without CRC accounting
+    FIT_UINT32 recordsEnd = currentByteOffset + fileDataSize;
+    FIT_BOOL savedSkipHeader = skipHeader;
+    FIT_BOOL decodeLocal[FIT_MAX_LOCAL_MESGS] = {FIT_FALSE};
+    skipHeader = FIT_TRUE;
+    fileBytesLeft = 3;
+
+    try
+    {
+        FIT_UINT32 nextCheckpoint = currentByteOffset;
+        while (currentByteOffset < recordsEnd)
+        {
+            if (currentByteOffset >= nextCheckpoint)
+            {
+                checkpoints.push_back(SaveCheckpoint(currentByteOffset));
+                nextCheckpoint = currentByteOffset + chunkBytes;
+            }
+
+            data = nextByte();
+            FIT_BOOL compressed = ((data & FIT_HDR_TIME_REC_BIT) != 0);
+            localMesgIndex = compressed ? ((data & FIT_HDR_TIME_TYPE_MASK) >> FIT_HDR_TIME_TYPE_SHIFT) : (data & FIT_HDR_TYPE_MASK);
+            MesgDefinition& defn = localMesgDefs[localMesgIndex];
+
+            if (!compressed && ((data & FIT_HDR_TYPE_DEF_BIT) != 0))
+            {
+                // Definition: decoded as usual
+                while (ReadByte(data) != RETURN_MESG_DEF)
+                {
+                    data = nextByte();
+                }
+                decodeLocal[localMesgIndex] = IsScanDecoded(defn.GetNum(), defn);
+            }
+            else if (decodeLocal[localMesgIndex] || (defn.GetNum() == FIT_MESG_NUM_INVALID))
+            {
+                while (ReadByte(data) != RETURN_MESG)
+                {
+                    data = nextByte();
+                }
+                DispatchMesg();
+            }
+            else
+            {
+                // Skipped data record: only timestamp and accumulated fields are read
+                if (compressed)
+                {
+                    FIT_UINT8 timeOffset = data & FIT_HDR_TIME_OFFSET_MASK;
+                    timestamp += (timeOffset - lastTimeOffset) & FIT_HDR_TIME_OFFSET_MASK;
+                    lastTimeOffset = timeOffset;
+                }
+
+                for (const FieldDefinition& fldDefn : defn.GetFields())
+                {
+                    for (FIT_UINT8 i = 0; i < fldDefn.GetSize(); i++)
+                    {
+                        fieldData[i] = nextByte();
+                    }
+                    ScanField(defn.GetNum(), fldDefn);
+                }
+
+                for (const DeveloperFieldDefinition& devDefn : defn.GetDevFields())
+                {
+                    for (FIT_UINT8 i = 0; i < devDefn.GetSize(); i++)
+                    {
+                        nextByte();
+                    }
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        skipHeader = savedSkipHeader;
+        throw;
+    }
+
+    skipHeader = savedSkipHeader;
+    state = STATE_RECORD;
+    checkpoints.push_back(SaveCheckpoint(currentByteOffset));
+    return checkpoints;
+}
+
+FIT_BOOL Decode::Read(std::istream &file, MesgListener& mesgListener, const Checkpoint& start, FIT_UINT32 endOffset)
+{
+    FIT_BOOL savedSkipHeader = skipHeader;
+
+    RestoreCheckpoint(start);
+    this->file = &file;
+    this->mesgListener = &mesgListener;
+    this->mesgDefinitionListener = NULL;
+    this->descriptionListener = NULL;
+    skipHeader = FIT_TRUE;
+    fileBytesLeft = 3;
+    state = STATE_RECORD;
+
+    file.clear();
+    if (start.byteOffset == 0)
+    {
+        FIT_UINT32 recordsEnd;
+        currentByteOffset = ReadRecordsRange(file, recordsEnd);
+    }
+    else
+    {
+        currentByteOffset = start.byteOffset;
+    }
+    file.seekg(currentByteOffset, file.beg);
+
+    try
+    {
+        while (currentByteOffset < endOffset)
+        {
+            file.read(buffer, std::min<FIT_UINT32>(BufferSize, endOffset - currentByteOffset));
+            bytesRead = (FIT_UINT32)file.gcount();
+
+            if (bytesRead == 0)
+            {
+                std::ostringstream message;
+                message << "FIT decode error: Unexpected end of input stream at byte: " << currentByteOffset;
+                throw RuntimeException(message.str());
+            }
+
+            for (currentByteIndex = 0; currentByteIndex < bytesRead; currentByteIndex++)
+            {
+                if (ReadByte((FIT_UINT8)buffer[currentByteIndex]) == RETURN_MESG)
+                    DispatchMesg();
+                currentByteOffset++;
+            }
+        }
+    }
+    catch (...)
+    {
+        skipHeader = savedSkipHeader;
+        throw;
+    }
+
+    skipHeader = savedSkipHeader;
+    bytesRead = 0;
+    currentByteIndex = 0;
+    return (state == STATE_RECORD);
+}
+
+FIT_UINT32 Decode::GetByteOffset(void) const
+{
+    return currentByteOffset;
+}
+
+void Decode::SetExpansionListener(ExpansionListener* listener)
+{
+    expansionListener = listener;
+}
+
+FIT_UINT32 Decode::FindRecordsEnd(std::istream &file, const Checkpoint& start, FIT_UINT32 endOffset)
+{
+    std::vector<char> block;
+    FIT_UINT32 blockOffset;
+    FIT_UINT32 recordOffset;
+    FIT_UINT32 recordsEnd;
+    FIT_UINT32 dataSizes[FIT_MAX_LOCAL_MESGS];
+    FIT_BOOL defined[FIT_MAX_LOCAL_MESGS];
+
+    file.clear();
+    recordOffset = ReadRecordsRange(file, recordsEnd);
+    if (start.byteOffset != 0)
+        recordOffset = start.byteOffset;
+    endOffset = std::min(endOffset, recordsEnd);
+
+    for (int i = 0; i < FIT_MAX_LOCAL_MESGS; i++)
+    {
+        const MesgDefinition& defn = start.localMesgDefs[i];
+        defined[i] = (defn.GetNum() != FIT_MESG_NUM_INVALID);
+        dataSizes[i] = 0;
+        for (const FieldDefinition& fldDefn : defn.GetFields())
+            dataSizes[i] += fldDefn.GetSize();
+        for (const DeveloperFieldDefinition& devDefn : defn.GetDevFields())
+            dataSizes[i] += devDefn.GetSize();
+    }
+
+    // Ensures bytes [recordOffset, recordOffset + size) are buffered
+    blockOffset = recordOffset;
+    file.seekg(blockOffset, file.beg);
+    auto available = [&](FIT_UINT32 size) -> FIT_BOOL
+    {
+        if ((FIT_UINT64)recordOffset + size > endOffset)
+            return FIT_FALSE;
+
+        FIT_UINT32 needed = recordOffset + size - blockOffset;
+        if (needed > block.size())
+        {
+            FIT_UINT32 keep = recordOffset - blockOffset;
+            block.erase(block.begin(), block.begin() + keep);
+            blockOffset = recordOffset;
+
+            FIT_UINT32 bytes = (FIT_UINT32)block.size();
+            block.resize(std::max<FIT_UINT32>(size, std::min<FIT_UINT32>(65536, endOffset - blockOffset)));
+            file.read(block.data() + bytes, block.size() - bytes);
+            block.resize(bytes + (FIT_UINT32)file.gcount());
+        }
+        return (recordOffset + size - blockOffset <= block.size());
+    };
+    auto byteAt = [&](FIT_UINT32 index) -> FIT_UINT8
+    {
+        return (FIT_UINT8)block[recordOffset - blockOffset + index];
+    };
+
+    while (available(1))
+    {
+        FIT_UINT8 header = byteAt(0);
+        FIT_UINT32 size;
+
+        if (((header & FIT_HDR_TIME_REC_BIT) == 0) && ((header & FIT_HDR_TYPE_DEF_BIT) != 0))
+        {
+            // Definition: 6 fixed bytes, fields, then developer fields
+            if (!available(6))
+                break;
+            FIT_UINT8 numFields = byteAt(5);
+            size = 6 + 3 * numFields;
+            FIT_UINT32 dataSize = 0;
+            if (!available(size))
+                break;
+            for (FIT_UINT8 i = 0; i < numFields; i++)
+                dataSize += byteAt(6 + 3 * i + 1);
+
+            if ((header & FIT_HDR_DEV_FIELD_BIT) != 0)
+            {
+                if (!available(size + 1))
+                    break;
+                FIT_UINT8 numDevFields = byteAt(size);
+                size += 1 + 3 * numDevFields;
+                if (!available(size))
+                    break;
+                for (FIT_UINT8 i = 0; i < numDevFields; i++)
+                    dataSize += byteAt(size - 3 * (numDevFields - i) + 1);
+            }
+
+            FIT_UINT8 local = header & FIT_HDR_TYPE_MASK;
+            defined[local] = FIT_TRUE;
+            dataSizes[local] = dataSize;
+        }
+        else
+        {
+            FIT_UINT8 local = ((header & FIT_HDR_TIME_REC_BIT) != 0) ?
+                ((header & FIT_HDR_TIME_TYPE_MASK) >> FIT_HDR_TIME_TYPE_SHIFT) : (header & FIT_HDR_TYPE_MASK);
+            if (!defined[local])
+                break;
+            size = 1 + dataSizes[local];
+            if (!available(size))
+                break;
+        }
+        recordOffset += size;
+    }
+
+    file.clear();
+    return recordOffset;
+}
+
+Decode::Checkpoint Decode::GetCheckpoint(void) const
+{
+    return SaveCheckpoint(currentByteOffset);
+}
+
+// Checkpoint blobs: little endian scalars, then developer data and
+// definitions as FIT records (see ReplayRecords)
+static const char CheckpointMagic[] = "FITCKPT";
+static const FIT_UINT8 CheckpointVersion = 1;
+
+static void PutUInt(std::string& blob, FIT_UINT32 value, int size)
+{
+    for (int i = 0; i < size; i++)
+        blob.push_back((char)((value >> (8 * i)) & 0xFF));
+}
+
+static FIT_UINT32 GetUInt(const std::string& blob, size_t& offset, int size)
+{
+    if (offset + size > blob.size())
+        throw RuntimeException("FIT checkpoint error: Truncated checkpoint");
+
+    FIT_UINT32 value = 0;
+    for (int i = 0; i < size; i++)
+        value |= (FIT_UINT32)(FIT_UINT8)blob[offset++] << (8 * i);
+    return value;
+}
+
+std::string Decode::SerializeCheckpoint(const Checkpoint& checkpoint)
+{
+    std::string blob(CheckpointMagic, sizeof(CheckpointMagic) - 1);
+    blob.push_back((char)CheckpointVersion);
+    PutUInt(blob, checkpoint.byteOffset, 4);
+    PutUInt(blob, checkpoint.timestamp, 4);
+    PutUInt(blob, checkpoint.lastTimeOffset, 1);
+
+    PutUInt(blob, (FIT_UINT32)checkpoint.accumulator.fields.size(), 2);
+    for (const AccumulatedField& field : checkpoint.accumulator.fields)
+    {
+        PutUInt(blob, field.mesgNum, 2);
+        PutUInt(blob, field.destFieldNum, 1);
+        PutUInt(blob, field.lastValue, 4);
+        PutUInt(blob, field.accumulatedValue, 4);
+    }
+
+    // Developer data ids, each followed by its field descriptions
+    std::ostringstream developerRecords;
+    for (const auto& developer : checkpoint.developers)
+    {
+        std::vector<Mesg> mesgs = {developer.second};
+        auto descs = checkpoint.descriptions.find(developer.first);
+        if (descs != checkpoint.descriptions.end())
+            for (const auto& desc : descs->second)
+                mesgs.push_back(desc.second);
+
+        for (Mesg& mesg : mesgs)
+        {
+            mesg.SetLocalNum(0);
+            MesgDefinition defn(mesg);
+            defn.Write(developerRecords);
+            mesg.Write(developerRecords, &defn);
+        }
+    }
+
+    // Local message definitions, in their original architecture
+    std::string definitionRecords;
+    for (int i = 0; i < FIT_MAX_LOCAL_MESGS; i++)
+    {
+        const MesgDefinition& defn = checkpoint.localMesgDefs[i];
+        if (defn.GetNum() == FIT_MESG_NUM_INVALID)
+            continue;
+
+        FIT_BOOL hasDevFields = !defn.GetDevFields().empty();
+        FIT_BOOL bigEndian = (checkpoint.archs[i] == FIT_ARCH_ENDIAN_BIG);
+        definitionRecords.push_back((char)(FIT_HDR_TYPE_DEF_BIT | (hasDevFields ? FIT_HDR_DEV_FIELD_BIT : 0) | i));
+        definitionRecords.push_back(0);
+        definitionRecords.push_back((char)checkpoint.archs[i]);
+        definitionRecords.push_back((char)(bigEndian ? (defn.GetNum() >> 8) : defn.GetNum()));
+        definitionRecords.push_back((char)(bigEndian ? defn.GetNum() : (defn.GetNum() >> 8)));
+        definitionRecords.push_back((char)defn.GetFields().size());
+        for (const FieldDefinition& fldDefn : defn.GetFields())
+        {
+            definitionRecords.push_back((char)fldDefn.GetNum());
+            definitionRecords.push_back((char)fldDefn.GetSize());
+            definitionRecords.push_back((char)fldDefn.GetType());
+        }
+
+        if (hasDevFields)
+        {
+            definitionRecords.push_back((char)defn.GetDevFields().size());
+            for (const DeveloperFieldDefinition& devDefn : defn.GetDevFields())
+            {
+                definitionRecords.push_back((char)devDefn.GetNum());
+                definitionRecords.push_back((char)devDefn.GetSize());
+                definitionRecords.push_back((char)devDefn.GetDeveloperDataIndex());
+            }
+        }
+    }
+
+    for (const std::string& records : {developerRecords.str(), definitionRecords})
+    {
+        PutUInt(blob, (FIT_UINT32)records.size(), 4);
+        blob += records;
+    }
+    return blob;
+}
+
+Decode::Checkpoint Decode::DeserializeCheckpoint(const std::string& blob)
+{
+    size_t offset = sizeof(CheckpointMagic);
+    if ((blob.compare(0, sizeof(CheckpointMagic) - 1, CheckpointMagic) != 0) ||
+        (blob.size() < offset) || ((FIT_UINT8)blob[offset - 1] != CheckpointVersion))
+        throw RuntimeException("FIT checkpoint error: Not a FIT checkpoint or unsupported version");
+
+    FIT_UINT32 byteOffset = GetUInt(blob, offset, 4);
+    FIT_UINT32 checkpointTimestamp = GetUInt(blob, offset, 4);
+    FIT_UINT8 checkpointTimeOffset = (FIT_UINT8)GetUInt(blob, offset, 1);
+
+    Accumulator checkpointAccumulator;
+    FIT_UINT32 numAccumulated = GetUInt(blob, offset, 2);
+    for (FIT_UINT32 i = 0; i < numAccumulated; i++)
+    {
+        FIT_UINT16 mesgNum = (FIT_UINT16)GetUInt(blob, offset, 2);
+        AccumulatedField field(mesgNum, (FIT_UINT8)GetUInt(blob, offset, 1));
+        field.lastValue = GetUInt(blob, offset, 4);
+        field.accumulatedValue = GetUInt(blob, offset, 4);
+        checkpointAccumulator.fields.push_back(field);
+    }
+
+    this->mesgListener = NULL;
+    this->mesgDefinitionListener = NULL;
+    this->descriptionListener = NULL;
+    developers.clear();
+    descriptions.clear();
+
+    // Developer data first: definitions resolve developer fields against it
+    for (int section = 0; section < 2; section++)
+    {
+        FIT_UINT32 size = GetUInt(blob, offset, 4);
+        if (offset + size > blob.size())
+            throw RuntimeException("FIT checkpoint error: Truncated checkpoint");
+
+        for (int i = 0; i < FIT_MAX_LOCAL_MESGS; i++)
+        {
+            localMesgDefs[i] = MesgDefinition();
+            localMesgDefs[i].SetLocalNum((FIT_UINT8)i);
+        }
+        ReplayRecords(blob.substr(offset, size));
+        offset += size;
+    }
+
+    timestamp = checkpointTimestamp;
+    lastTimeOffset = checkpointTimeOffset;
+    accumulator = checkpointAccumulator;
+    currentByteOffset = byteOffset;
+    return SaveCheckpoint(byteOffset);
+}
+
+// Decodes complete FIT records (no file header or CRC) into the decoder state
+void Decode::ReplayRecords(const std::string& records)
+{
+    FIT_BOOL savedSkipHeader = skipHeader;
+    skipHeader = FIT_TRUE;
+    fileBytesLeft = 3;
+    state = STATE_RECORD;
+
+    try
+    {
+        for (char data : records)
+        {
+            if (ReadByte((FIT_UINT8)data) == RETURN_MESG)
+                DispatchMesg();
+        }
+    }
+    catch (const RuntimeException& e)
+    {
+        skipHeader = savedSkipHeader;
+        throw RuntimeException(std::string("FIT checkpoint error: ") + e.what());
+    }
+
+    skipHeader = savedSkipHeader;
+    if (state != STATE_RECORD)
+        throw RuntimeException("FIT checkpoint error: Incomplete checkpoint record");
+}
+
+// Reads the file header; returns the records start offset and sets recordsEnd
+// (unbounded while the header data size is unset, e.g. during a recording)
+FIT_UINT32 Decode::ReadRecordsRange(std::istream &file, FIT_UINT32& recordsEnd)
+{
+    char header[FIT_HEADER_SIZE_NO_CRC];
+    file.seekg(0, file.beg);
+    file.read(header, FIT_HEADER_SIZE_NO_CRC);
+    if ((file.gcount() != FIT_HEADER_SIZE_NO_CRC) || ((FIT_UINT8)header[0] < FIT_HEADER_SIZE_NO_CRC) ||
+        (std::string(header + 8, 4) != ".FIT"))
+    {
+        file.clear();
+        throw RuntimeException("FIT decode error: File header invalid. File is not FIT.");
+    }
+
+    FIT_UINT32 headerSize = (FIT_UINT8)header[0];
+    FIT_UINT32 dataSize = 0;
+    for (int i = 0; i < 4; i++)
+        dataSize |= (FIT_UINT32)(FIT_UINT8)header[4 + i] << (8 * i);
+
+    recordsEnd = (dataSize == 0) ? 0xFFFFFFFF : headerSize + dataSize;
+    return headerSize;
+}
+
+// Reads a skipped field as ReadByte would, for its timestamp/accumulator updates only
+void Decode::ScanField(FIT_UINT16 mesgNum, const FieldDefinition& fldDefn)
+{
+    FIT_UINT8 baseType = fldDefn.GetType() & FIT_BASE_TYPE_NUM_MASK;
+    if (baseType >= FIT_BASE_TYPES)
+        return;
+
+    if (fldDefn.GetNum() != FIT_FIELD_NUM_TIMESTAMP)
+    {
+        const Profile::FIELD* profileField = Profile::GetField(mesgNum, fldDefn.GetNum());
+        if ((profileField == NULL) || !profileField->isAccumulated)
+            return;
+    }
+
+    UpdateEndianness(fldDefn.GetType(), fldDefn.GetSize());
+
+    Field field(mesgNum, fldDefn.GetNum());
+    if (!field.IsValid())
+        return;
+
+    FIT_BOOL read = FIT_TRUE;
+    if ( field.GetType() != fldDefn.GetType() )
+    {
+        FIT_UINT8 typeSize = baseTypeSizes[baseType];
+        FIT_UINT8 profileSize = fit::baseTypeSizes[( field.GetType() & FIT_BASE_TYPE_NUM_MASK )];
+        if ( typeSize < profileSize )
+            field.SetBaseType( fldDefn.GetType() );
+        else if ( typeSize != profileSize )
+            read = FIT_FALSE;
+    }
+
+    if ( read )
+        field.Read(&fieldData, fldDefn.GetSize());
+
+    if (fldDefn.GetNum() == FIT_FIELD_NUM_TIMESTAMP)
+    {
+        timestamp = field.GetUINT32Value();
+        lastTimeOffset = (FIT_UINT8)(timestamp & FIT_HDR_TIME_OFFSET_MASK);
+    }
+
+    // No containing (accumulating) fields here: those messages are decoded
+    if ( field.GetIsAccumulated() )
+    {
+        for (FIT_UINT8 i = 0; i < field.GetNumValues(); i++)
+            accumulator.Set(mesgNum, field.GetNum(), (FIT_UINT32)field.GetRawValue(i));
+    }
+}
+
+Decode::Checkpoint Decode::SaveCheckpoint(FIT_UINT32 byteOffset) const
+{
+    Checkpoint checkpoint;
+    checkpoint.byteOffset = byteOffset;
+    for (int i = 0; i < FIT_MAX_LOCAL_MESGS; i++)
+    {
+        checkpoint.localMesgDefs[i] = localMesgDefs[i];
+        checkpoint.archs[i] = archs[i];
+    }
+    checkpoint.timestamp = timestamp;
+    checkpoint.lastTimeOffset = lastTimeOffset;
+    checkpoint.accumulator = accumulator;
+    checkpoint.developers = developers;
+    checkpoint.descriptions = descriptions;
+    return checkpoint;
+}
+
+void Decode::RestoreCheckpoint(const Checkpoint& checkpoint)
+{
+    for (int i = 0; i < FIT_MAX_LOCAL_MESGS; i++)
+    {
+        localMesgDefs[i] = checkpoint.localMesgDefs[i];
+        archs[i] = checkpoint.archs[i];
+    }
+    timestamp = checkpoint.timestamp;
+    lastTimeOffset = checkpoint.lastTimeOffset;
+    accumulator = checkpoint.accumulator;
+    developers = checkpoint.developers;
+    descriptions = checkpoint.descriptions;
+}
+
 void Decode::InitRead(std::istream &file)
 {
     InitRead(file, FIT_TRUE);
@@ -394,21 +1036,12 @@ void Decode::InitRead(std::istream &file, FIT_BOOL startOfFile)
 void Decode::UpdateEndianness(FIT_UINT8 type, FIT_UINT8 size)
 {
     FIT_UINT8 typeSize = baseTypeSizes[type & FIT_BASE_TYPE_NUM_MASK];
-    FIT_UINT8 numElements = size / typeSize;
 
     if (((type & FIT_BASE_TYPE_ENDIAN_FLAG) != 0) &&
         ((archs[localMesgIndex] & FIT_ARCH_ENDIAN_MASK) != FIT_ARCH_ENDIAN_LITTLE))
     {
         // Swap the bytes for each element.
-        for (int element = 0; element < numElements; element++)
-        {
-            for (int i = 0; i < (typeSize / 2); i++)
-            {
-                FIT_UINT8 tmp = fieldData[element * typeSize + i];
-                fieldData[element * typeSize + i] = fieldData[element * typeSize + typeSize - i - 1];
-                fieldData[element * typeSize + typeSize - i - 1] = tmp;
-            }
-        }
+        Simd::SwapBytes(fieldData, size, typeSize);
     }
 }
 
@@ -873,6 +1506,8 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data)
             if (fieldIndex >= localMesgDefs[localMesgIndex].GetFields().size())
             {
                 // Now that the entire message is decoded we may evaluate subfields and expand components
+                if ((expansionListener != NULL) && !suppressComponentExpansion)
+                    expansionListener->OnExpansion(FIT_TRUE);
                 for (FIT_UINT16 i=0; i<mesg.GetNumFields(); i++)
                 {
                     FIT_UINT16 activeSubField = mesg.GetActiveSubFieldIndexByFieldIndex(i);
@@ -894,6 +1529,8 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data)
                         }
                     }
                 }
+                if ((expansionListener != NULL) && !suppressComponentExpansion)
+                    expansionListener->OnExpansion(FIT_FALSE);
 
                 if (localMesgDefs[localMesgIndex].GetDevFields().size() != 0)
                 {
@@ -971,6 +1608,9 @@ void Decode::ExpandComponents(Field* containingField, const Profile::FIELD_COMPO
     FIT_UINT16 offset = 0;
     FIT_UINT16 i;
 
+    // mesg.AddField() below may reallocate the field containingField points into
+    const Field containing(*containingField);
+
     for (i = 0; i < numComponents; i++)
     {
         const Profile::FIELD_COMPONENT* component = &components[i];
@@ -988,7 +1628,7 @@ void Decode::ExpandComponents(Field* containingField, const Profile::FIELD_COMPO
 
             if (componentField.IsSignedInteger())
             {
-                signedBitsValue = containingField->GetBitsSignedValue(offset, component->bits);
+                signedBitsValue = containing.GetBitsSignedValue(offset, component->bits);
 
                 if (signedBitsValue == FIT_SINT32_INVALID)
                     break; // No more data for components.
@@ -998,7 +1638,7 @@ void Decode::ExpandComponents(Field* containingField, const Profile::FIELD_COMPO
             }
             else
             {
-                bitsValue = containingField->GetBitsValue(offset, component->bits);
+                bitsValue = containing.GetBitsValue(offset, component->bits);
 
                 if (bitsValue == FIT_UINT32_INVALID)
                     break; // No more data for components.
@@ -21,6 +21,7 @@
 #include <iosfwd>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "fit.hpp"
 #include "fit_accumulator.hpp"
 #include "fit_field.hpp"
@@ -34,6 +35,17 @@
 
 namespace fit
 {
+///////////////////////////////////////////////////////////////////////
+// Notified before and after the component expansion of each decoded
+// message, e.g. to time it (see Decode::SetExpansionListener()).
+///////////////////////////////////////////////////////////////////////
+class ExpansionListener
+{
+public:
+    virtual ~ExpansionListener() {}
+    virtual void OnExpansion(FIT_BOOL begin) = 0;
+};
+
 class Decode
 {
 public:
@@ -126,6 +138,13 @@ public:
     // Returns true if finished reading file.
     ///////////////////////////////////////////////////////////////////////
 
+    FIT_BOOL ResumeRead(void);
+    ///////////////////////////////////////////////////////////////////////
+    // Resumes a Read() paused by a listener (see Pause()), continuing into
+    // chained FIT files as Read() does.
+    // Returns true if finished reading the stream, false if paused again.
+    ///////////////////////////////////////////////////////////////////////
+
     FIT_BOOL getInvalidDataSize(void);
     ///////////////////////////////////////////////////////////////////////
     // Returns the invalid data size flag.
@@ -139,6 +158,95 @@ public:
     //    value             The value to set the flag to.
     ///////////////////////////////////////////////////////////////////////
 
+    ///////////////////////////////////////////////////////////////////////
+    // Decoder state at a record boundary: local message definitions,
+    // compressed timestamp base, accumulated values and developer data.
+    // Decoding may restart from it mid-file (see Scan() and Read()).
+    ///////////////////////////////////////////////////////////////////////
+    struct Checkpoint
+    {
+        FIT_UINT32 byteOffset; // File offset of the next record
+        MesgDefinition localMesgDefs[FIT_MAX_LOCAL_MESGS];
+        FIT_UINT8 archs[FIT_MAX_LOCAL_MESGS];
+        FIT_UINT32 timestamp;
+        FIT_UINT8 lastTimeOffset;
+        Accumulator accumulator;
+        std::unordered_map<FIT_UINT8, DeveloperDataIdMesg> developers;
+        std::unordered_map<FIT_UINT8, std::unordered_map<FIT_UINT8, FieldDescriptionMesg>> descriptions;
+    };
+
+    std::vector<Checkpoint> Scan(std::istream &file, FIT_UINT32 chunkBytes, MesgListener* mesgListener);
+    ///////////////////////////////////////////////////////////////////////
+    // Pre-scans the records of a (single) FIT file for chunk boundaries.
+    // Data records are skipped by their definition sizes, reading only the
+    // timestamp and accumulated fields. Messages which expand accumulated
+    // components, file_id and developer data messages are fully decoded.
+    // Does not check CRC (see CheckIntegrity).
+    // Parameters:
+    //    file             Pointer to file to read.
+    //    chunkBytes       Minimum bytes between checkpoints.
+    //    mesgListener     Receives the fully decoded messages (may be NULL).
+    // Returns a checkpoint at the first record, then one at the first record
+    // boundary at least chunkBytes after the previous checkpoint, and one at
+    // the end of the records (chunk i spans checkpoints i to i+1).
+    ///////////////////////////////////////////////////////////////////////
+
+    FIT_BOOL Read(std::istream &file, MesgListener& mesgListener, const Checkpoint& start, FIT_UINT32 endOffset);
+    ///////////////////////////////////////////////////////////////////////
+    // Reads the records of a FIT binary file from a checkpoint up to a
+    // record boundary. Does not check CRC. A checkpoint at byte 0 (from a
+    // decoder which has not read yet) starts after the file header.
+    // Parameters:
+    //    file             Pointer to file to read.
+    //    mesgListener     Message listener
+    //    start            Checkpoint to restore (see Scan()).
+    //    endOffset        File offset to stop at (e.g. the next checkpoint).
+    // Returns true if endOffset was reached on a record boundary.
+    ///////////////////////////////////////////////////////////////////////
+
+    FIT_UINT32 FindRecordsEnd(std::istream &file, const Checkpoint& start, FIT_UINT32 endOffset);
+    ///////////////////////////////////////////////////////////////////////
+    // Walks record headers and definitions from a checkpoint, e.g. over a
+    // file still being written.
+    // Parameters:
+    //    file             Pointer to file to read.
+    //    start            Checkpoint to walk from.
+    //    endOffset        File offset not to walk past (e.g. file size).
+    // Returns the offset after the last complete record before endOffset.
+    ///////////////////////////////////////////////////////////////////////
+
+    Checkpoint GetCheckpoint(void) const;
+    ///////////////////////////////////////////////////////////////////////
+    // Returns the decoder state at the current byte offset. Only valid
+    // between records, e.g. after Read(file, mesgListener, start, endOffset).
+    ///////////////////////////////////////////////////////////////////////
+
+    static std::string SerializeCheckpoint(const Checkpoint& checkpoint);
+    ///////////////////////////////////////////////////////////////////////
+    // Serializes a checkpoint to a compact binary blob. Developer data id
+    // and field description messages are embedded as FIT records.
+    ///////////////////////////////////////////////////////////////////////
+
+    Checkpoint DeserializeCheckpoint(const std::string& blob);
+    ///////////////////////////////////////////////////////////////////////
+    // Restores a checkpoint from SerializeCheckpoint(). Developer field
+    // definitions are resolved against the restored developer data.
+    // Throws RuntimeException on a malformed blob.
+    ///////////////////////////////////////////////////////////////////////
+
+    FIT_UINT32 GetByteOffset(void) const;
+    ///////////////////////////////////////////////////////////////////////
+    // Returns the file offset of the byte being decoded (the last byte of
+    // the message during MesgListener callbacks).
+    ///////////////////////////////////////////////////////////////////////
+
+    void SetExpansionListener(ExpansionListener* listener);
+    ///////////////////////////////////////////////////////////////////////
+    // Sets a listener notified around component expansion (NULL: none).
+    // Parameters:
+    //    listener         Expansion listener.
+    ///////////////////////////////////////////////////////////////////////
+
 private:
     typedef enum
     {
@@ -200,6 +308,7 @@ private:
     MesgListener* mesgListener;
     MesgDefinitionListener* mesgDefinitionListener;
     DeveloperFieldDescriptionListener* descriptionListener;
+    ExpansionListener* expansionListener;
     FIT_BOOL pause;
     std::string headerException;
     FIT_BOOL skipHeader;
@@ -207,6 +316,7 @@ private:
     FIT_BOOL invalidDataSize;
     FIT_BOOL suppressComponentExpansion;
     FIT_UINT32 currentByteOffset;
+    FIT_UINT32 readFileSize;
     std::unordered_map<FIT_UINT8, DeveloperDataIdMesg> developers;
     std::unordered_map<FIT_UINT8, std::unordered_map<FIT_UINT8, FieldDescriptionMesg>> descriptions;
     FIT_UINT32 currentByteIndex;
@@ -217,6 +327,12 @@ private:
     void InitRead(std::istream &file, FIT_BOOL startOfFile);
     void UpdateEndianness(FIT_UINT8 type, FIT_UINT8 size);
     RETURN ReadByte(FIT_UINT8 data);
+    void DispatchMesg(void);
+    void ScanField(FIT_UINT16 mesgNum, const FieldDefinition& fldDefn);
+    Checkpoint SaveCheckpoint(FIT_UINT32 byteOffset) const;
+    void RestoreCheckpoint(const Checkpoint& checkpoint);
+    FIT_UINT32 ReadRecordsRange(std::istream &file, FIT_UINT32& recordsEnd);
+    void ReplayRecords(const std::string& records);
     void ExpandComponents(Field* containingField, const Profile::FIELD_COMPONENT* components, FIT_UINT16 numComponents);
     FIT_BOOL Read(std::istream* file);
 };
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <sstream>
 #include "fit_field_base.hpp"
+#include "fit_simd.hpp"
 #include "fit_mesg.hpp"
 #include "fit_unicode.hpp"
 
@@ -1051,7 +1052,6 @@ void FieldBase::SetSTRINGValue(const FIT_WSTRING& value, const FIT_UINT8 fieldAr
 FIT_BOOL FieldBase::Read(const void *data, const FIT_UINT8 size)
 {
     FIT_UINT8 bytesLeft = size;
-    FIT_UINT8 typeSize = baseTypeSizes[GetType() & FIT_BASE_TYPE_NUM_MASK];
     FIT_BYTE *byteData = (FIT_BYTE *) data;
 
     values.clear();
@@ -1102,18 +1102,10 @@ FIT_BOOL FieldBase::Read(const void *data, const FIT_UINT8 size)
 
         default:
         {
-            int bytes = bytesLeft;
-            FIT_BYTE *point = byteData;
-
-            while (bytes > 0)
+            // Keep the array unless every element is invalid
+            if (!Simd::IsAllInvalid(byteData, bytesLeft, GetType()))
             {
-                if (memcmp(point, baseTypeInvalids[GetType() & FIT_BASE_TYPE_NUM_MASK], typeSize) != 0)
-                {
-                    values.insert(values.end(), byteData, byteData + bytesLeft);
-                    break;
-                }
-                point += typeSize;
-                bytes -= typeSize;
+                values.insert(values.end(), byteData, byteData + bytesLeft);
             }
         }
             break;
@@ -1151,7 +1143,7 @@ FIT_BOOL FieldBase::IsValueValid( const FIT_UINT8 fieldArrayIndex, const FIT_UIN
     {
         FIT_UINT8 baseTypeSize = baseTypeSizes[type & FIT_BASE_TYPE_NUM_MASK];
         const FIT_UINT8* invalid = baseTypeInvalids[type & FIT_BASE_TYPE_NUM_MASK];
-        FIT_UINT8* data = new FIT_UINT8[baseTypeSize];
+        FIT_UINT8 data[sizeof(FIT_UINT64)]; // Largest base type
 
         FIT_BOOL readSuccess = GetMemoryValue( fieldArrayIndex, data, baseTypeSize );
 
@@ -1160,7 +1152,6 @@ FIT_BOOL FieldBase::IsValueValid( const FIT_UINT8 fieldArrayIndex, const FIT_UIN
         {
             isValid = ( memcmp( invalid, data, baseTypeSize ) != 0 );
         }
-        delete[] data;
     }
 
     return isValid;
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// Vectorized helpers for array field decoding (not part of the Garmin SDK).
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "fit_simd.hpp"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSSE3__)
+    #include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define FIT_SIMD_SSE2
+#endif
+
+namespace fit
+{
+
+// Fills a 32 byte block with repeated copies of the type's invalid value
+static void FillInvalidPattern(FIT_UINT8 pattern[32], FIT_UINT8 type, FIT_UINT8 typeSize)
+{
+    const FIT_UINT8 *invalid = baseTypeInvalids[type & FIT_BASE_TYPE_NUM_MASK];
+    for (int i = 0; i < 32; i++)
+        pattern[i] = invalid[i % typeSize];
+}
+
+FIT_BOOL Simd::IsAllInvalid(const FIT_UINT8 *data, FIT_UINT32 size, FIT_UINT8 type)
+{
+    FIT_UINT8 typeSize = baseTypeSizes[type & FIT_BASE_TYPE_NUM_MASK];
+    if (typeSize == 0 || (32 % typeSize) != 0)
+        return FIT_FALSE;
+
+    FIT_UINT8 pattern[32];
+    FillInvalidPattern(pattern, type, typeSize);
+    FIT_UINT32 offset = 0;
+
+#if defined(__AVX2__)
+    const __m256i vinvalid = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pattern));
+    for (; offset + 32 <= size; offset += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, vinvalid)) != -1)
+            return FIT_FALSE;
+    }
+#endif
+
+#if defined(__AVX2__) || defined(__SSSE3__) || defined(FIT_SIMD_SSE2)
+    // 16 is a multiple of every base type size, so the pattern phase is preserved
+    const __m128i vinvalid16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pattern));
+    for (; offset + 16 <= size; offset += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, vinvalid16)) != 0xFFFF)
+            return FIT_FALSE;
+    }
+#endif
+
+    // Scalar tail (or entire array without SIMD support)
+    for (; offset < size; offset++)
+    {
+        if (data[offset] != pattern[offset % typeSize])
+            return FIT_FALSE;
+    }
+
+    return FIT_TRUE;
+}
+
+void Simd::SwapBytes(FIT_UINT8 *data, FIT_UINT32 size, FIT_UINT8 typeSize)
+{
+    if (typeSize < 2)
+        return;
+
+    FIT_UINT32 numElements = size / typeSize;
+    FIT_UINT32 offset = 0;
+
+    if ((typeSize == 2) || (typeSize == 4) || (typeSize == 8))
+    {
+#if defined(__AVX2__) || defined(__SSSE3__)
+        // Per-lane shuffle mask reversing each element's bytes
+        FIT_UINT8 mask[16];
+        for (int i = 0; i < 16; i++)
+            mask[i] = static_cast<FIT_UINT8>((i / typeSize) * typeSize + (typeSize - 1 - (i % typeSize)));
+        const __m128i vmask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask));
+
+    #if defined(__AVX2__)
+        const __m256i vmask256 = _mm256_broadcastsi128_si256(vmask);
+        for (; offset + 32 <= numElements * typeSize; offset += 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + offset), _mm256_shuffle_epi8(v, vmask256));
+        }
+    #endif
+        for (; offset + 16 <= numElements * typeSize; offset += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(data + offset), _mm_shuffle_epi8(v, vmask));
+        }
+#elif defined(FIT_SIMD_SSE2)
+        // SSE2 has no byte shuffle: swap bytes within 16-bit words, then
+        // swap words within 32-bit and 32-bit halves within 64-bit elements
+        for (; offset + 16 <= numElements * typeSize; offset += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+            v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+            if (typeSize >= 4)
+            {
+                v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+                v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            }
+            if (typeSize == 8)
+                v = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(data + offset), v);
+        }
+#endif
+    }
+
+    // Scalar tail (or entire array without SIMD support)
+    for (; offset + typeSize <= numElements * typeSize; offset += typeSize)
+    {
+        for (int i = 0; i < (typeSize / 2); i++)
+        {
+            FIT_UINT8 tmp = data[offset + i];
+            data[offset + i] = data[offset + typeSize - i - 1];
+            data[offset + typeSize - i - 1] = tmp;
+        }
+    }
+}
+
+} // namespace fit
@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////////////////
+// Vectorized helpers for array field decoding (not part of the Garmin SDK).
+// AVX2/SSE2 paths are selected at compile time, with a portable scalar
+// fallback used for tails and non-x86 targets.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#if !defined(FIT_SIMD_HPP)
+#define FIT_SIMD_HPP
+
+#include "fit.hpp"
+
+namespace fit
+{
+
+class Simd
+{
+   public:
+      // True if every typeSize-wide element in data[0..size) equals the base
+      // type's invalid value (a trailing partial element is compared as a prefix)
+      static FIT_BOOL IsAllInvalid(const FIT_UINT8 *data, FIT_UINT32 size, FIT_UINT8 type);
+
+      // Reverses the byte order of each typeSize-wide element in place
+      static void SwapBytes(FIT_UINT8 *data, FIT_UINT32 size, FIT_UINT8 typeSize);
+};
+
+} // namespace fit
+
+#endif // !defined(FIT_SIMD_HPP)
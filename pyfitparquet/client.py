@@ -0,0 +1,86 @@
+import os, json, socket, argparse
+
+
+# Client of a fittransformer --serve daemon (newline-delimited JSON over a Unix socket).
+# Imports neither pandas nor pyarrow, so short-lived jobs skip their startup cost.
+class FitDaemonClient:
+#{
+    PIPELINE_DEPTH = 64
+
+    def __init__(self, socket_path, timeout=None):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.settimeout(timeout)
+        self.sock.connect(socket_path)
+        self.reader = self.sock.makefile('rb')
+        self.next_id = 0
+
+    def __enter__(self): return self
+    def __exit__(self, *exc): self.close()
+
+    def close(self):
+        self.reader.close()
+        self.sock.close()
+
+    # Converts source (.fit[.gz|.zst] or .zip) to parquet (by default beside source), returns
+    # the response dict: status, parquet, seconds and stats (TransformStats JSON), or error
+    def convert(self, source, parquet=None, collect_stats=False):
+        return self.convert_many([(source, parquet)], collect_stats)[0]
+
+    # Pipelines several (source, parquet) conversions on this connection, responses in order
+    def convert_many(self, jobs, collect_stats=False):
+    #{
+        requests = []
+        for source, parquet in jobs:
+            request = {'op': 'convert', 'source': os.path.abspath(source), 'collect_stats': collect_stats}
+            if parquet is not None: request['parquet'] = os.path.abspath(parquet)
+            requests.append(request)
+        return self._request(requests)
+    #}
+
+    # Re-parse the daemon's config (once in-flight jobs finish)
+    def reload(self): return self._request([{'op': 'reload'}])[0]
+
+    # Daemon counters: transformers, busy, connections, jobs, failed_jobs, busy/uptime seconds
+    def stats(self): return self._request([{'op': 'stats'}])[0]
+
+    def ping(self): return self._request([{'op': 'ping'}])[0]
+
+    def shutdown(self): return self._request([{'op': 'shutdown'}])[0]
+
+    # Sends requests PIPELINE_DEPTH at a time (unread responses can't fill the socket buffers)
+    def _request(self, requests):
+    #{
+        responses = []
+        for i in range(0, len(requests), self.PIPELINE_DEPTH):
+            batch = requests[i:i + self.PIPELINE_DEPTH]
+            for request in batch:
+                request['id'] = self.next_id
+                self.next_id += 1
+            self.sock.sendall(b''.join(json.dumps(r).encode() + b'\n' for r in batch))
+
+            for request in batch:
+                line = self.reader.readline()
+                if not line: raise ConnectionError('fittransformer daemon closed the connection')
+                responses.append(json.loads(line))
+        return responses
+    #}
+#}
+
+if __name__ == "__main__":
+#{
+    parser = argparse.ArgumentParser()
+    parser.add_argument('SOCKET', help='socket of a fittransformer --serve daemon')
+    parser.add_argument('SOURCE_FILE', nargs='*', help='.fit[.gz|.zst] or .zip files to convert')
+    parser.add_argument('-P', metavar='PARQUET_DIR', help='parquet output dir (defaults: beside each source)')
+    parser.add_argument('--op', choices=['reload', 'stats', 'ping', 'shutdown'], help='send op instead')
+    args = parser.parse_args()
+
+    with FitDaemonClient(args.SOCKET) as client:
+        if args.op: responses = [getattr(client, args.op)()]
+        else:
+            parquet = lambda source: None if args.P is None else os.path.join(args.P,
+                os.path.basename(source).split('.')[0] + ('' if source.lower().endswith('.zip') else '.parquet'))
+            responses = client.convert_many([(s, parquet(s)) for s in args.SOURCE_FILE])
+        for response in responses: print(json.dumps(response))
+    exit(0 if all(r['status'] == 0 for r in responses) else 1)
+#}
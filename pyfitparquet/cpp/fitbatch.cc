@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <arrow/api.h>
+#include <arrow/io/api.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/exception.h>
+
+#include "boost/filesystem.hpp"
+#include "fitbatch.h"
+#include "fitsource.h"
+#include "fittransformer.h"
+#include "config.h"
+
+
+static std::shared_ptr<arrow::Schema> _manifest_schema()
+{
+    return arrow::schema({arrow::field("source_uri", arrow::utf8()), arrow::field("size", arrow::int64()),
+        arrow::field("mtime_ns", arrow::int64()), arrow::field("content_hash", arrow::utf8()),
+        arrow::field("config_hash", arrow::utf8()), arrow::field("parquet_file", arrow::utf8())});
+}
+
+static std::string _hex(std::uint64_t hash)
+{
+    char digest[17];
+    std::snprintf(digest, sizeof(digest), "%016llx", static_cast<unsigned long long>(hash));
+    return digest;
+}
+
+// Size and mtime (ns, as Python's st_mtime_ns) of a source file
+static void _stat_source(const boost::filesystem::path& fname, ManifestRow& row)
+{
+    struct stat fstatus;
+    if (::stat(fname.c_str(), &fstatus) != 0) throw std::runtime_error("ERROR unable to stat: " + fname.string());
+    row.size = fstatus.st_size;
+    #if defined(__APPLE__)
+    row.mtime_ns = fstatus.st_mtimespec.tv_sec * 1000000000LL + fstatus.st_mtimespec.tv_nsec;
+    #else
+    row.mtime_ns = fstatus.st_mtim.tv_sec * 1000000000LL + fstatus.st_mtim.tv_nsec;
+    #endif
+}
+
+static bool _is_zip(const boost::filesystem::path& fname)
+{
+    return fname.extension() == ".zip" || fname.extension() == ".ZIP";
+}
+
+// Shard manifest name, _manifest_<i>of<n>.parquet
+static std::string _shard_manifest(const ShardSpec& shard)
+{
+    return SHARD_MANIFEST_PREFIX + std::to_string(shard.index) + "of" + std::to_string(shard.count) + ".parquet";
+}
+
+bool parse_shard(const std::string& spec, ShardSpec& shard)
+{
+    std::istringstream spec_stream(spec);
+    char separator = 0;
+    if (!(spec_stream >> shard.index >> separator >> shard.count) || separator != '/' ||
+        !(spec_stream >> std::ws).eof()) return false;
+    return shard.count > 0 && shard.index >= 0 && shard.index < shard.count;
+}
+
+int shard_of(const std::string& source_fname, int count)
+{
+    std::string name = boost::filesystem::path(source_fname).filename().string();
+    return static_cast<int>(XXH3_64bits(name.data(), name.size()) % static_cast<std::uint64_t>(count));
+}
+
+int batch_to_parquet(const std::string& data_dir, const std::string& parquet_dir, const ShardSpec& shard)
+{
+    int status = 1;
+
+    try {
+        std::vector<boost::filesystem::path> fnames;
+        boost::filesystem::path pdata = boost::filesystem::absolute(data_dir);
+        for (boost::filesystem::directory_iterator it(pdata), end; it != end; ++it)
+            if (boost::filesystem::is_regular_file(it->status())) fnames.push_back((it->path()).lexically_normal());
+        std::sort(fnames.begin(), fnames.end());
+        boost::filesystem::create_directories(parquet_dir);
+
+        // Sources of this shard, zip archives expanded to their FIT members (rows[source_rows[i]]
+        // is the manifest row of sources[i])
+        std::vector<ManifestRow> rows;
+        std::vector<FitSource> sources;
+        std::vector<std::string> parquet_fnames;
+        std::vector<size_t> source_rows;
+        std::string config_hash = CONFIG.hash();
+        std::int64_t shard_bytes = 0, failed = 0;
+
+        for (const boost::filesystem::path& fname : fnames) {
+            std::string name = fname.filename().string();
+            if ((fit_stem(name).empty() && !_is_zip(fname)) || shard_of(name, shard.count) != shard.index) continue;
+
+            try {
+                ManifestRow row;
+                row.source_uri = fname.string();
+                _stat_source(fname, row);
+                row.content_hash = _hex(content_hash(fname.string()));
+                row.config_hash = config_hash;
+
+                if (_is_zip(fname)) {
+                    row.parquet_file = fname.stem().string();
+                    boost::filesystem::path zip_dir = boost::filesystem::path(parquet_dir) / row.parquet_file;
+                    for (const auto& member : list_zip_fit_members(fname.string())) {
+                        boost::filesystem::path pparquet = zip_dir / (member.second + output_extension());
+                        boost::filesystem::create_directories(pparquet.parent_path());
+                        sources.emplace_back(fname.string(), member.first);
+                        parquet_fnames.push_back(pparquet.string());
+                        source_rows.push_back(rows.size());
+                    }
+                    boost::filesystem::create_directories(zip_dir);
+                }
+                else {
+                    row.parquet_file = fit_stem(name) + output_extension();
+                    sources.emplace_back(fname.string());
+                    parquet_fnames.push_back((boost::filesystem::path(parquet_dir) / row.parquet_file).string());
+                    source_rows.push_back(rows.size());
+                }
+                shard_bytes += row.size;
+                rows.push_back(row);
+            }
+            catch (const std::exception& e) { std::cerr << e.what() << std::endl; failed += 1; }
+        }
+
+        int nthreads = CONFIG.exists("batch_threads") ? std::stoi(CONFIG["batch_threads"]) : 0;
+        std::vector<bool> converted = FitTransformer::convert_sources(sources, parquet_fnames, nthreads);
+
+        // Sources (zip: any member) that failed are left out of the manifest
+        std::vector<bool> row_converted(rows.size(), true);
+        for (size_t i = 0; i < sources.size(); ++i) if (!converted[i]) row_converted[source_rows[i]] = false;
+        std::vector<ManifestRow> manifest;
+        for (size_t r = 0; r < rows.size(); ++r) {
+            if (row_converted[r]) manifest.push_back(rows[r]);
+            else failed += 1;
+        }
+
+        write_manifest((boost::filesystem::path(parquet_dir) / _shard_manifest(shard)).string(), manifest);
+        std::cout << "Shard " << shard.index << "/" << shard.count << ": converted " << manifest.size()
+            << " of " << (manifest.size() + failed) << " sources ("
+            << shard_bytes << " bytes)" << std::endl;
+
+        status = (failed > 0) ? 1 : 0;
+        if (shard.count == 1 && merge_manifests(parquet_dir) != 0) status = 1;
+    }
+    catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+
+    return status;
+}
+
+int merge_manifests(const std::string& parquet_dir)
+{
+    int status = 1;
+
+    try {
+        // Shard manifests by index, all of one shard count
+        std::map<int, boost::filesystem::path> shard_manifests;
+        int count = 0;
+        std::string prefix = SHARD_MANIFEST_PREFIX;
+        for (boost::filesystem::directory_iterator it(parquet_dir), end; it != end; ++it) {
+            std::string name = it->path().filename().string();
+            ShardSpec shard;
+            if (name.compare(0, prefix.size(), prefix) != 0 || it->path().extension() != ".parquet") continue;
+            std::string spec = it->path().stem().string().substr(prefix.size());
+            size_t of = spec.find("of");
+            if (of == std::string::npos || !parse_shard(spec.replace(of, 2, "/"), shard) ||
+                _shard_manifest(shard) != name) continue;
+
+            if (count != 0 && shard.count != count) throw std::runtime_error(
+                "ERROR shard manifests of different shard counts in: " + parquet_dir);
+            count = shard.count;
+            shard_manifests[shard.index] = it->path();
+        }
+        if (shard_manifests.empty()) throw std::runtime_error("ERROR no shard manifests in: " + parquet_dir);
+        if (static_cast<int>(shard_manifests.size()) != count) throw std::runtime_error("ERROR missing shard manifests (" +
+            std::to_string(shard_manifests.size()) + " of " + std::to_string(count) + ") in: " + parquet_dir);
+
+        // Existing rows, replaced by the shards' rows of the same source
+        boost::filesystem::path pmanifest = boost::filesystem::path(parquet_dir) / MANIFEST_FNAME;
+        std::map<std::string, ManifestRow> merged;
+        if (boost::filesystem::exists(pmanifest))
+            for (const ManifestRow& row : read_manifest(pmanifest.string())) merged[row.source_uri] = row;
+        for (const auto& spair : shard_manifests)
+            for (const ManifestRow& row : read_manifest(spair.second.string())) merged[row.source_uri] = row;
+
+        std::vector<ManifestRow> rows;
+        for (const auto& mpair : merged) rows.push_back(mpair.second);
+        write_manifest(pmanifest.string(), rows);
+        for (const auto& spair : shard_manifests) boost::filesystem::remove(spair.second);
+
+        std::cout << "Merged " << shard_manifests.size() << " shard manifests: " << rows.size()
+            << " sources in " << pmanifest.string() << std::endl;
+        status = 0;
+    }
+    catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+
+    return status;
+}
+
+std::vector<ManifestRow> read_manifest(const std::string& manifest_fname)
+{
+    std::shared_ptr<arrow::io::ReadableFile> infile;
+    PARQUET_ASSIGN_OR_THROW(infile, arrow::io::ReadableFile::Open(manifest_fname));
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    PARQUET_ASSIGN_OR_THROW(reader, parquet::arrow::OpenFile(infile, arrow::default_memory_pool()));
+    std::shared_ptr<arrow::Table> table;
+    PARQUET_ASSIGN_OR_THROW(table, reader->ReadTable());
+    PARQUET_ASSIGN_OR_THROW(table, table->CombineChunks());
+
+    // Columns by manifest field, checked against the manifest schema
+    std::shared_ptr<arrow::Schema> schema = _manifest_schema();
+    std::vector<std::shared_ptr<arrow::Array>> columns;
+    for (const std::shared_ptr<arrow::Field>& field : schema->fields()) {
+        std::shared_ptr<arrow::ChunkedArray> column = table->GetColumnByName(field->name());
+        if (column == nullptr || !column->type()->Equals(field->type()))
+            throw std::runtime_error("ERROR not a conversion manifest: " + manifest_fname);
+        columns.push_back(column->num_chunks() > 0 ? column->chunk(0) : nullptr);
+    }
+
+    std::vector<ManifestRow> rows(table->num_rows());
+    for (std::int64_t r = 0; r < table->num_rows(); ++r) {
+        rows[r].source_uri = std::static_pointer_cast<arrow::StringArray>(columns[0])->GetString(r);
+        rows[r].size = std::static_pointer_cast<arrow::Int64Array>(columns[1])->Value(r);
+        rows[r].mtime_ns = std::static_pointer_cast<arrow::Int64Array>(columns[2])->Value(r);
+        rows[r].content_hash = std::static_pointer_cast<arrow::StringArray>(columns[3])->GetString(r);
+        rows[r].config_hash = std::static_pointer_cast<arrow::StringArray>(columns[4])->GetString(r);
+        rows[r].parquet_file = std::static_pointer_cast<arrow::StringArray>(columns[5])->GetString(r);
+    }
+    return rows;
+}
+
+// Written to a temporary file renamed over manifest_fname, so readers never see a partial manifest
+void write_manifest(const std::string& manifest_fname, const std::vector<ManifestRow>& rows)
+{
+    arrow::StringBuilder source_uri, content_hash, config_hash, parquet_file;
+    arrow::Int64Builder size, mtime_ns;
+    for (const ManifestRow& row : rows) {
+        PARQUET_THROW_NOT_OK(source_uri.Append(row.source_uri));
+        PARQUET_THROW_NOT_OK(size.Append(row.size));
+        PARQUET_THROW_NOT_OK(mtime_ns.Append(row.mtime_ns));
+        PARQUET_THROW_NOT_OK(content_hash.Append(row.content_hash));
+        PARQUET_THROW_NOT_OK(config_hash.Append(row.config_hash));
+        PARQUET_THROW_NOT_OK(parquet_file.Append(row.parquet_file));
+    }
+
+    std::vector<std::shared_ptr<arrow::Array>> columns(6);
+    PARQUET_THROW_NOT_OK(source_uri.Finish(&columns[0]));
+    PARQUET_THROW_NOT_OK(size.Finish(&columns[1]));
+    PARQUET_THROW_NOT_OK(mtime_ns.Finish(&columns[2]));
+    PARQUET_THROW_NOT_OK(content_hash.Finish(&columns[3]));
+    PARQUET_THROW_NOT_OK(config_hash.Finish(&columns[4]));
+    PARQUET_THROW_NOT_OK(parquet_file.Finish(&columns[5]));
+    std::shared_ptr<arrow::Table> table = arrow::Table::Make(_manifest_schema(), columns);
+
+    std::string tmp_fname = manifest_fname + ".tmp";
+    std::shared_ptr<arrow::io::FileOutputStream> outfile;
+    PARQUET_ASSIGN_OR_THROW(outfile, arrow::io::FileOutputStream::Open(tmp_fname));
+    PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(*table, arrow::default_memory_pool(), outfile,
+        std::max<std::int64_t>(table->num_rows(), 1)));
+    PARQUET_THROW_NOT_OK(outfile->Close());
+    boost::filesystem::rename(tmp_fname, manifest_fname);
+}
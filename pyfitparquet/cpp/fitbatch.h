@@ -0,0 +1,53 @@
+#if !defined(FITBATCH_H)
+#define FITBATCH_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define MANIFEST_FNAME "_manifest.parquet" // Conversion manifest of a parquet dir (see transformer.py)
+#define SHARD_MANIFEST_PREFIX "_manifest_" // Shard manifests: _manifest_<i>of<n>.parquet
+
+
+// Conversion manifest row, as also written by PyFitParquet incremental runs
+struct ManifestRow
+{
+    std::string source_uri;
+    std::int64_t size = 0;
+    std::int64_t mtime_ns = 0;
+    std::string content_hash; // XXH3 of the source file (16 hex digits), see content_hash()
+    std::string config_hash; // Config::hash() at conversion
+    std::string parquet_file; // Output file (zip: directory), relative to the parquet dir
+};
+
+// Shard index of count (--shard <index>/<count>)
+struct ShardSpec
+{
+    int index = 0;
+    int count = 1;
+};
+
+// Parses "i/n" (0 <= i < n), false if malformed
+bool parse_shard(const std::string& spec, ShardSpec& shard);
+
+// Shard of a source file, by hash of its base name (hosts mounting the corpus at other
+// paths agree, and sources are assigned independently of the rest of the listing)
+int shard_of(const std::string& source_fname, int count);
+
+// Batch mode: converts the FIT sources of data_dir (.fit[.gz|.zst], and .zip archives to
+// <parquet_dir>/<zip stem>/<member dirs>/) assigned to shard into parquet_dir, on up to batch_threads
+// (config) threads, then writes the shard's manifest (unsharded: merged into the manifest).
+// Returns 0 if all sources of the shard converted
+int batch_to_parquet(const std::string& data_dir, const std::string& parquet_dir,
+                     const ShardSpec& shard = ShardSpec());
+
+// Merges the shard manifests of parquet_dir, over its manifest if any (rows of a source
+// replaced), into its manifest, and removes them. Fails, merging nothing, unless the
+// shard manifests are all shards of one count. Returns 0 on success
+int merge_manifests(const std::string& parquet_dir);
+
+// Manifest file I/O (Parquet), throw std::runtime_error on error
+std::vector<ManifestRow> read_manifest(const std::string& manifest_fname);
+void write_manifest(const std::string& manifest_fname, const std::vector<ManifestRow>& rows);
+
+#endif // defined(FITBATCH_H)
@@ -0,0 +1,377 @@
+#include <benchmark/benchmark.h>
+#include <boost/property_tree/json_parser.hpp>
+#include <arrow/util/byte_size.h>
+#include <iomanip>
+#include <sstream>
+#include <unistd.h>
+
+#include "fit_crc.hpp"
+#include "fit_decode.hpp"
+#include "fit_record_mesg.hpp"
+
+#include "fittransformer.h"
+#include "fitgen.h"
+#include "fitenums.h"
+#include "config.h"
+
+// Decoder and transformer benchmarks (Google Benchmark). Microbenchmarks run on a
+// synthetic activity generated in memory (fitgen.h); end-to-end FIT => Parquet throughput
+// (MB/s, rows/s) runs on the FIT files/dirs given, else on the synthetic activity. Standard
+// --benchmark_* flags apply (e.g. --benchmark_out=<json>); --baseline=<json> compares
+// real times with an earlier --benchmark_out run, failing above --max_regression.
+
+#define SYNTHETIC_SECONDS 36000 // Synthetic activity: 10 hours of 1Hz records, hrv and laps
+#define MAX_REGRESSION 0.10 // Default --max_regression (fraction of baseline real time)
+
+// Private FitTransformer stages (friend)
+class FitBench
+{
+public:
+
+    // Initializes the transformer as if file_id had just been decoded
+    static void begin(FitTransformer& transformer, const fit::FileIdMesg& file_id) {
+        transformer.source_filename = "synthetic.fit";
+        transformer.source_file_uri = "synthetic.fit";
+        transformer._init_from_config(transformer.colflags, transformer.excludeflags, transformer.builders);
+        transformer._set_file_id(file_id);
+    }
+
+    // Drops staged rows
+    static std::int64_t clear(FitTransformer& transformer) {
+        for (auto bpair : transformer.builders) bpair.second->Reset();
+        std::int64_t nrows = transformer.staged_rows;
+        transformer.staged_rows = 0;
+        return nrows;
+    }
+
+    static void write_table(FitTransformer& transformer, const std::shared_ptr<arrow::Table>& table,
+                            const std::string& parquet_fname) {
+        transformer._write_table(transformer._slice_row_groups(table), parquet_fname);
+    }
+};
+
+struct MesgCollector : public fit::MesgListener
+{
+    std::vector<fit::Mesg> mesgs;
+    void OnMesg(fit::Mesg& mesg) override { mesgs.push_back(mesg); }
+};
+
+struct NullListener : public fit::MesgListener
+{
+    void OnMesg(fit::Mesg&) override { }
+};
+
+// Accumulates component expansion time (see BM_ExpandComponents)
+struct ExpansionTimer : public fit::ExpansionListener
+{
+    std::chrono::steady_clock::time_point tstart;
+    double seconds = 0.0;
+    void OnExpansion(FIT_BOOL begin) override {
+        if (begin) tstart = std::chrono::steady_clock::now();
+        else seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - tstart).count();
+    }
+};
+
+// Synthetic activity (file bytes, decoded mesgs, as a file for end-to-end runs)
+struct Synthetic
+{
+    std::string fit_bytes;
+    std::vector<fit::Mesg> mesgs;
+    std::string fit_fname;
+};
+
+static std::string _encode_activity()
+{
+    GenOptions options;
+    options.duration_seconds = SYNTHETIC_SECONDS;
+    options.hrv = true;
+    std::stringstream fit_stream(std::ios::in | std::ios::out | std::ios::binary);
+    write_synthetic_fit(options, fit_stream);
+    return fit_stream.str();
+}
+
+static const Synthetic& _synthetic()
+{
+    static Synthetic synthetic;
+    if (!synthetic.fit_bytes.empty()) return synthetic;
+
+    synthetic.fit_bytes = _encode_activity();
+    std::istringstream fit_stream(synthetic.fit_bytes, std::ios::in | std::ios::binary);
+    MesgCollector collector;
+    fit::Decode().Read(fit_stream, collector);
+    synthetic.mesgs = collector.mesgs;
+
+    path pfit = temp_directory_path() / unique_path("fitbench-%%%%-%%%%.fit");
+    std::ofstream fit_fhandle(pfit.string(), std::ios::out | std::ios::binary);
+    fit_fhandle.write(synthetic.fit_bytes.data(), synthetic.fit_bytes.size());
+    synthetic.fit_fname = pfit.string();
+    return synthetic;
+}
+
+static void BM_Crc16(benchmark::State& state)
+{
+    const std::string& fit_bytes = _synthetic().fit_bytes;
+    for (auto _ : state) benchmark::DoNotOptimize(fit::CRC::Calc16(fit_bytes.data(), fit_bytes.size()));
+    state.SetBytesProcessed(state.iterations() * fit_bytes.size());
+}
+BENCHMARK(BM_Crc16);
+
+// Decode::ReadByte over the record stream, without component expansion
+static void BM_DecodeRecords(benchmark::State& state)
+{
+    std::istringstream fit_stream(_synthetic().fit_bytes, std::ios::in | std::ios::binary);
+    NullListener listener;
+    for (auto _ : state) {
+        fit_stream.clear();
+        fit_stream.seekg(0);
+        fit::Decode decoder;
+        decoder.SuppressComponentExpansion();
+        decoder.Read(fit_stream, listener);
+    }
+    state.SetBytesProcessed(state.iterations() * _synthetic().fit_bytes.size());
+}
+BENCHMARK(BM_DecodeRecords)->Unit(benchmark::kMillisecond);
+
+// Component expansion only (timed by an ExpansionListener while decoding)
+static void BM_ExpandComponents(benchmark::State& state)
+{
+    std::istringstream fit_stream(_synthetic().fit_bytes, std::ios::in | std::ios::binary);
+    NullListener listener;
+    for (auto _ : state) {
+        fit_stream.clear();
+        fit_stream.seekg(0);
+        fit::Decode decoder;
+        ExpansionTimer timer;
+        decoder.SetExpansionListener(&timer);
+        decoder.Read(fit_stream, listener);
+        state.SetIterationTime(timer.seconds);
+    }
+    state.SetItemsProcessed(state.iterations() * _synthetic().mesgs.size());
+}
+BENCHMARK(BM_ExpandComponents)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+// Config cold start: locate, read and parse parquet_config.yml (as on first use)
+static void BM_ConfigColdStart(benchmark::State& state)
+{
+    for (auto _ : state) benchmark::DoNotOptimize(CONFIG.reset(true));
+}
+BENCHMARK(BM_ConfigColdStart)->Unit(benchmark::kMicrosecond);
+
+// reset_from_config with an unchanged config: locate and read, parse skipped
+static void BM_ConfigReset(benchmark::State& state)
+{
+    for (auto _ : state) benchmark::DoNotOptimize(CONFIG.reset());
+}
+BENCHMARK(BM_ConfigReset)->Unit(benchmark::kMicrosecond);
+
+static void BM_ProfileGetMesg(benchmark::State& state)
+{
+    const FIT_UINT16 mesg_nums[] = {FIT_MESG_NUM_FILE_ID, FIT_MESG_NUM_RECORD, FIT_MESG_NUM_HRV,
+        FIT_MESG_NUM_EVENT, FIT_MESG_NUM_LAP, FIT_MESG_NUM_SESSION, FIT_MESG_NUM_DEVICE_INFO};
+    for (auto _ : state)
+        for (FIT_UINT16 mesg_num : mesg_nums) benchmark::DoNotOptimize(fit::Profile::GetMesg(mesg_num));
+    state.SetItemsProcessed(state.iterations() * sizeof(mesg_nums) / sizeof(mesg_nums[0]));
+}
+BENCHMARK(BM_ProfileGetMesg);
+
+static void BM_EnumName(benchmark::State& state)
+{
+    const FIT_UINT16 mesg_nums[] = {FIT_MESG_NUM_FILE_ID, FIT_MESG_NUM_EVENT, FIT_MESG_NUM_SESSION, FIT_MESG_NUM_DEVICE_INFO};
+    for (auto _ : state)
+        for (FIT_UINT16 mesg_num : mesg_nums) {
+            fit::Profile::Type etype = fit_enum_field_type(mesg_num, 1);
+            benchmark::DoNotOptimize(fit_enum_name(etype, FIT_MANUFACTURER_GARMIN));
+            benchmark::DoNotOptimize(fit_enum_name(fit::Profile::Type::GarminProduct, FIT_GARMIN_PRODUCT_EDGE_530));
+        }
+    state.SetItemsProcessed(state.iterations() * 2 * sizeof(mesg_nums) / sizeof(mesg_nums[0]));
+}
+BENCHMARK(BM_EnumName);
+
+static void BM_MesgConstruct(benchmark::State& state)
+{
+    for (auto _ : state) {
+        fit::Mesg mesg(FIT_MESG_NUM_RECORD);
+        benchmark::DoNotOptimize(mesg);
+    }
+}
+BENCHMARK(BM_MesgConstruct);
+
+static void BM_FieldConstruct(benchmark::State& state)
+{
+    for (auto _ : state) {
+        fit::Field field(FIT_MESG_NUM_RECORD, fit::RecordMesg::FieldDefNum::HeartRate);
+        benchmark::DoNotOptimize(field);
+    }
+}
+BENCHMARK(BM_FieldConstruct);
+
+// FieldBase::GetSTRINGValue over every decoded field value
+static void BM_GetSTRINGValue(benchmark::State& state)
+{
+    std::vector<fit::Mesg> mesgs = _synthetic().mesgs;
+    std::int64_t nvalues = 0;
+    for (auto _ : state) {
+        for (fit::Mesg& mesg : mesgs) {
+            for (int i = 0; i < mesg.GetNumFields(); ++i) {
+                const fit::Field* field = mesg.GetFieldByIndex(i);
+                for (FIT_UINT8 j = 0; j < field->GetNumValues(); ++j) {
+                    benchmark::DoNotOptimize(field->GetSTRINGValue(j));
+                    nvalues += 1;
+                }
+            }
+        }
+    }
+    state.SetItemsProcessed(nvalues);
+}
+BENCHMARK(BM_GetSTRINGValue)->Unit(benchmark::kMillisecond);
+
+// FitTransformer::OnMesg (stringification and builder appends), rows per second
+static void BM_OnMesgAppend(benchmark::State& state)
+{
+    std::vector<fit::Mesg> mesgs = _synthetic().mesgs;
+    FitTransformer transformer;
+    FitBench::begin(transformer, fit::FileIdMesg(mesgs.front()));
+
+    std::int64_t nrows = 0;
+    for (auto _ : state) {
+        for (fit::Mesg& mesg : mesgs) transformer.OnMesg(mesg);
+        state.PauseTiming();
+        nrows += FitBench::clear(transformer);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(nrows);
+}
+BENCHMARK(BM_OnMesgAppend)->Unit(benchmark::kMillisecond);
+
+// Parquet encode, compress and write of the decoded synthetic table
+static void BM_WriteParquet(benchmark::State& state)
+{
+    FitTransformer transformer;
+    std::shared_ptr<arrow::Table> table = transformer.fit_to_table(_synthetic().fit_fname.c_str());
+    FitBench::begin(transformer, fit::FileIdMesg(_synthetic().mesgs.front()));
+    path pparquet = temp_directory_path() / unique_path("fitbench-%%%%-%%%%.parquet");
+
+    for (auto _ : state) FitBench::write_table(transformer, table, pparquet.string());
+    state.SetBytesProcessed(state.iterations() * arrow::util::TotalBufferSize(*table));
+    state.SetItemsProcessed(state.iterations() * table->num_rows());
+    remove(pparquet);
+}
+BENCHMARK(BM_WriteParquet)->Unit(benchmark::kMillisecond);
+
+// End-to-end fit_to_parquet: FIT MB/s and rows/s
+static void BM_FitToParquet(benchmark::State& state, const std::string& fit_fname)
+{
+    path pparquet = temp_directory_path() / unique_path("fitbench-%%%%-%%%%.parquet");
+    FitTransformer transformer;
+    std::int64_t nrows = 0;
+    for (auto _ : state) {
+        if (transformer.fit_to_parquet(fit_fname.c_str(), pparquet.string().c_str()) != 0) {
+            state.SkipWithError("fit_to_parquet failed");
+            break;
+        }
+        nrows += transformer.get_stats().rows;
+    }
+    state.SetBytesProcessed(state.iterations() * file_size(fit_fname));
+    state.counters["rows_per_second"] = benchmark::Counter(nrows, benchmark::Counter::kIsRate);
+
+    boost::system::error_code ec;
+    remove(pparquet, ec);
+    remove(pparquet.parent_path() / (pparquet.stem().string() + "_highrate.parquet"), ec);
+}
+
+// Console reporter keeping each run's real time (ns) for the baseline comparison
+class BaselineReporter : public benchmark::ConsoleReporter
+{
+public:
+
+    std::map<std::string, double> real_ns;
+
+    // Colors only on a terminal
+    BaselineReporter() : benchmark::ConsoleReporter(isatty(STDOUT_FILENO) ? OO_Defaults : OO_Tabular) { }
+
+    void ReportRuns(const std::vector<Run>& runs) override {
+        for (const Run& run : runs)
+            if (!run.error_occurred) real_ns[run.benchmark_name()] =
+                run.GetAdjustedRealTime() / benchmark::GetTimeUnitMultiplier(run.time_unit) * 1e9;
+        benchmark::ConsoleReporter::ReportRuns(runs);
+    }
+};
+
+static double _unit_ns(const std::string& time_unit)
+{
+    if (time_unit == "s") return 1e9;
+    else if (time_unit == "ms") return 1e6;
+    else if (time_unit == "us") return 1e3;
+    return 1.0;
+}
+
+// Compares real times with a --benchmark_out JSON baseline; false if any regressed
+static bool _compare_baseline(const std::map<std::string, double>& real_ns, const std::string& baseline_fname,
+                              double max_regression)
+{
+    boost::property_tree::ptree baseline;
+    boost::property_tree::read_json(baseline_fname, baseline);
+
+    bool passed = true;
+    std::cout << std::endl << "Baseline " << baseline_fname << " (max regression "
+        << max_regression * 100 << "%)" << std::endl << std::endl;
+    std::cout << std::left << std::setw(48) << "benchmark" << std::right << std::setw(14) << "baseline_ns"
+        << std::setw(14) << "real_ns" << std::setw(10) << "change" << std::endl;
+    for (const auto& bpair : baseline.get_child("benchmarks")) {
+        const boost::property_tree::ptree& bench = bpair.second;
+        auto run = real_ns.find(bench.get<std::string>("name"));
+        if (run == real_ns.end()) continue;
+
+        double base_ns = bench.get<double>("real_time") * _unit_ns(bench.get<std::string>("time_unit", "ns"));
+        double change = run->second / base_ns - 1.0;
+        bool regressed = (change > max_regression);
+        passed = passed && !regressed;
+        std::cout << std::left << std::setw(48) << run->first << std::right << std::fixed << std::setprecision(0)
+            << std::setw(14) << base_ns << std::setw(14) << run->second << std::setprecision(1)
+            << std::setw(9) << change * 100 << "%" << (regressed ? "  REGRESSED" : "") << std::endl;
+    }
+    return passed;
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::Initialize(&argc, argv);
+
+    // Remaining args: --baseline=, --max_regression=, FIT files/dirs
+    std::string baseline_fname;
+    double max_regression = MAX_REGRESSION;
+    std::vector<std::string> fit_files;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.compare(0, 11, "--baseline=") == 0) baseline_fname = arg.substr(11);
+        else if (arg.compare(0, 17, "--max_regression=") == 0) max_regression = std::stod(arg.substr(17));
+        else if (is_directory(arg)) {
+            for (const directory_entry& e : directory_iterator(arg)) {
+                std::string ext = e.path().extension().string();
+                if (ext == ".fit" || ext == ".FIT") fit_files.push_back(e.path().string());
+            }
+        }
+        else if (exists(arg)) fit_files.push_back(arg);
+        else {
+            std::cerr << "Usage: fitbench [--benchmark_...] [--baseline=<json>] [--max_regression=F]"
+                << " [<fitfile|fitdir> ...]" << std::endl;
+            return 1;
+        }
+    }
+    std::sort(fit_files.begin(), fit_files.end());
+
+    if (fit_files.empty()) benchmark::RegisterBenchmark("BM_FitToParquet/synthetic",
+        [](benchmark::State& state) { BM_FitToParquet(state, _synthetic().fit_fname); })->Unit(benchmark::kMillisecond);
+    for (const std::string& fit_fname : fit_files)
+        benchmark::RegisterBenchmark(("BM_FitToParquet/" + path(fit_fname).filename().string()).c_str(),
+            BM_FitToParquet, fit_fname)->Unit(benchmark::kMillisecond);
+
+    BaselineReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    boost::system::error_code ec;
+    if (!_synthetic().fit_fname.empty()) remove(_synthetic().fit_fname, ec);
+    if (!baseline_fname.empty() && !_compare_baseline(reporter.real_ns, baseline_fname, max_regression)) return 1;
+    return 0;
+}
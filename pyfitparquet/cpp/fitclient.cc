@@ -0,0 +1,76 @@
+// Thin client of the fittransformer --serve daemon (see fitdaemon.h): sends one
+// request and prints the response line. Links nothing but libc, so it starts fast.
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+static std::string _json_string(const std::string& s)
+{
+    std::string json = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') json += '\\';
+        json += c;
+    }
+    return json + "\"";
+}
+
+static int _usage()
+{
+    std::cerr << "Usage: fitclient <socket> convert <source> [<parquet>] [--stats]" << std::endl
+        << "       fitclient <socket> reload|stats|ping|shutdown" << std::endl;
+    return 1;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3) return _usage();
+    std::string socket_path = argv[1], op = argv[2];
+
+    std::ostringstream request;
+    request << "{\"op\": " << _json_string(op);
+    if (op == "convert") {
+        if (argc < 4 || argc > 6) return _usage();
+        request << ", \"source\": " << _json_string(argv[3]);
+        for (int i = 4; i < argc; ++i) {
+            if (std::string(argv[i]) == "--stats") request << ", \"collect_stats\": true";
+            else request << ", \"parquet\": " << _json_string(argv[i]);
+        }
+    }
+    else if (argc != 3) return _usage();
+    request << "}\n";
+
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0) {
+        std::cerr << "ERROR unable to connect to " << socket_path << ": " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+
+    std::string data = request.str(), response;
+    bool ok = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(data.size());
+    char buffer[4096];
+    while (ok && response.find('\n') == std::string::npos) {
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        response.append(buffer, n);
+    }
+    ::close(fd);
+
+    if (response.empty()) {
+        std::cerr << "ERROR no response from " << socket_path << std::endl;
+        return 1;
+    }
+    std::cout << response;
+    return (response.find("\"status\": 0") != std::string::npos) ? 0 : 1;
+}
@@ -0,0 +1,282 @@
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "boost/filesystem.hpp"
+#include "fitdaemon.h"
+#include "fittransformer.h"
+#include "config.h"
+
+
+// Set by SIGINT/SIGTERM: the daemon stops accepting, finishes in-flight jobs and returns
+static volatile std::sig_atomic_t daemon_interrupted = 0;
+static void _on_daemon_signal(int) { daemon_interrupted = 1; }
+
+// JSON string literal of s (paths and error messages)
+static std::string _json_string(const std::string& s)
+{
+    std::ostringstream json;
+    json << '"';
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\') json << '\\' << c;
+        else if (c == '\n') json << "\\n";
+        else if (c < 0x20) json << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+        else json << c;
+    }
+    json << '"';
+    return json.str();
+}
+
+// Default output of a source: <dir>/<stem>.parquet (a.fit.gz: a.parquet; .arrow for Arrow 
+// IPC output), zip: <dir>/<stem>/
+static std::string _default_parquet(const std::string& source)
+{
+    boost::filesystem::path psource(source);
+    if (!compression_extension(source).empty()) psource = psource.parent_path() / psource.stem();
+    if (psource.extension() == ".zip" || psource.extension() == ".ZIP")
+        return (psource.parent_path() / psource.stem()).string();
+    return (psource.parent_path() / psource.stem()).string() + output_extension();
+}
+
+static bool _is_zip(const std::string& source)
+{
+    std::string ext = boost::filesystem::path(source).extension().string();
+    return ext == ".zip" || ext == ".ZIP";
+}
+
+// Writes all of data, false if the client went away
+static bool _send_all(int fd, const std::string& data)
+{
+    for (size_t sent = 0; sent < data.size(); ) {
+        ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        sent += n;
+    }
+    return true;
+}
+
+
+FitDaemon::FitDaemon(const std::string& socket_path, int nthreads) :
+    socket_path(socket_path), listen_fd(-1), stopping(false), started(std::chrono::steady_clock::now()),
+    nthreads(nthreads > 0 ? nthreads : std::max<int>(std::thread::hardware_concurrency(), 1)),
+    jobs(0), failed_jobs(0), busy_micros(0)
+{
+    // Transformers construct (and parse config) once, here
+    for (size_t t = 0; t < this->nthreads; ++t) idle.emplace_back(new FitTransformer());
+}
+
+FitDaemon::~FitDaemon()
+{
+    if (listen_fd >= 0) { ::close(listen_fd); ::unlink(socket_path.c_str()); }
+}
+
+int FitDaemon::serve()
+{
+    int status = 1;
+    auto prev_sigint = std::signal(SIGINT, _on_daemon_signal);
+    auto prev_sigterm = std::signal(SIGTERM, _on_daemon_signal);
+
+    try {
+        _listen();
+        std::cerr << "fittransformer serving on " << socket_path << " (" << nthreads << " transformers)" << std::endl;
+
+        while (!stopping && !daemon_interrupted) {
+            struct pollfd pfd = {listen_fd, POLLIN, 0};
+            if (::poll(&pfd, 1, DAEMON_POLL_MS) <= 0 || !(pfd.revents & POLLIN)) continue;
+
+            int fd = ::accept(listen_fd, nullptr, nullptr);
+            if (fd < 0) continue;
+            std::lock_guard<std::mutex> lock(connection_mutex);
+            connection_fds.push_back(fd);
+            std::thread(&FitDaemon::_serve_connection, this, fd).detach();
+        }
+        status = 0;
+    }
+    catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+
+    // Wake connections blocked on reads; jobs in flight complete and respond first
+    stopping = true;
+    {
+        std::unique_lock<std::mutex> lock(connection_mutex);
+        for (int fd : connection_fds) ::shutdown(fd, SHUT_RD);
+        connection_cv.wait(lock, [this]() { return connection_fds.empty(); });
+    }
+
+    std::signal(SIGINT, prev_sigint);
+    std::signal(SIGTERM, prev_sigterm);
+    return status;
+}
+
+void FitDaemon::_listen()
+{
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path))
+        throw std::runtime_error("ERROR socket path too long: " + socket_path);
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    // A socket file left by a daemon that did not shut down is replaced, a live one is not
+    int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    bool live = probe >= 0 && ::connect(probe, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0;
+    if (probe >= 0) ::close(probe);
+    if (live) throw std::runtime_error("ERROR a daemon is already serving on: " + socket_path);
+    ::unlink(socket_path.c_str());
+
+    listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0 || ::bind(listen_fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listen_fd, DAEMON_BACKLOG) != 0) {
+        int err = errno;
+        if (listen_fd >= 0) { ::close(listen_fd); listen_fd = -1; }
+        throw std::runtime_error("ERROR unable to listen on " + socket_path + ": " + std::strerror(err));
+    }
+}
+
+void FitDaemon::_serve_connection(int fd)
+{
+    std::string pending;
+    char buffer[4096];
+    bool open = true;
+
+    while (open) {
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        pending.append(buffer, n);
+
+        size_t start = 0;
+        for (size_t eol = pending.find('\n'); eol != std::string::npos; eol = pending.find('\n', start)) {
+            std::string response = _respond(pending.substr(start, eol - start)) + "\n";
+            start = eol + 1;
+            if (!_send_all(fd, response)) { open = false; break; }
+        }
+        pending.erase(0, start);
+
+        if (pending.size() > DAEMON_MAX_REQUEST_BYTES) {
+            _send_all(fd, "{\"status\": 1, \"error\": \"request too long\"}\n");
+            break;
+        }
+    }
+
+    // Notified once this thread is gone, so serve() may return and the daemon be destroyed
+    std::unique_lock<std::mutex> lock(connection_mutex);
+    connection_fds.erase(std::find(connection_fds.begin(), connection_fds.end(), fd));
+    ::close(fd);
+    std::notify_all_at_thread_exit(connection_cv, std::move(lock));
+}
+
+std::string FitDaemon::_respond(const std::string& request)
+{
+    std::string id, body;
+    try {
+        boost::property_tree::ptree ptree;
+        std::istringstream request_stream(request);
+        boost::property_tree::read_json(request_stream, ptree);
+
+        // Echoed as given: numbers stay numbers, anything else is a string
+        id = ptree.get<std::string>("id", "");
+        if (!id.empty() && id.find_first_not_of("0123456789") != std::string::npos) id = _json_string(id);
+
+        std::string op = ptree.get<std::string>("op", "convert");
+        if (op == "convert") body = _convert(ptree.get<std::string>("source"),
+            ptree.get<std::string>("parquet", ""), ptree.get<bool>("collect_stats", false));
+        else if (op == "reload") body = _reload();
+        else if (op == "stats") body = _daemon_stats();
+        else if (op == "ping") body = "\"status\": 0";
+        else if (op == "shutdown") { stopping = true; body = "\"status\": 0"; }
+        else throw std::runtime_error("ERROR unknown op: " + op);
+    }
+    catch (const std::exception& e) { body = "\"status\": 1, \"error\": " + _json_string(e.what()); }
+
+    return "{" + (id.empty() ? std::string() : "\"id\": " + id + ", ") + body + "}";
+}
+
+std::string FitDaemon::_convert(const std::string& source, std::string parquet, bool collect_stats)
+{
+    if (stopping) throw std::runtime_error("ERROR daemon is shutting down");
+
+    // Default output resolved holding a transformer: CONFIG (output_format) isn't re-parsed meanwhile
+    std::unique_ptr<FitTransformer> transformer = _acquire();
+    if (parquet.empty()) parquet = _default_parquet(source);
+    auto tstart = std::chrono::steady_clock::now();
+    std::string error;
+
+    if (_is_zip(source)) {
+        if (transformer->zip_to_parquet(source.c_str(), parquet.c_str()) != 0)
+            error = "ERROR zip members failed to convert, see daemon log: " + source;
+    }
+    else {
+        // The error is returned to the client
+        transformer->set_collect_stats(collect_stats);
+        transformer->fit_to_parquet(source.c_str(), parquet.c_str(), error);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tstart).count();
+    std::string stats = _is_zip(source) ? std::string() : transformer->get_stats().to_json();
+    _release(std::move(transformer));
+
+    jobs += 1;
+    busy_micros += static_cast<std::int64_t>(seconds * 1e6);
+    if (!error.empty()) { failed_jobs += 1; return "\"status\": 1, \"error\": " + _json_string(error); }
+
+    std::ostringstream body;
+    body << "\"status\": 0, \"parquet\": " << _json_string(parquet) << ", \"seconds\": " << seconds;
+    if (!stats.empty()) {
+        std::replace(stats.begin(), stats.end(), '\n', ' '); // One response per line
+        body << ", \"stats\": " << stats;
+    }
+    return body.str();
+}
+
+// Takes every transformer, so no job runs while CONFIG is re-parsed
+std::string FitDaemon::_reload()
+{
+    std::lock_guard<std::mutex> reload_lock(reload_mutex);
+    std::vector<std::unique_ptr<FitTransformer>> all;
+    while (all.size() < nthreads) all.push_back(_acquire());
+    for (auto& transformer : all) transformer->reset_from_config();
+
+    std::string body = "\"status\": 0, \"config\": " + _json_string(CONFIG.config_path().string());
+    for (auto& transformer : all) _release(std::move(transformer));
+    return body;
+}
+
+std::string FitDaemon::_daemon_stats()
+{
+    size_t nidle, nconnections;
+    { std::lock_guard<std::mutex> lock(pool_mutex); nidle = idle.size(); }
+    { std::lock_guard<std::mutex> lock(connection_mutex); nconnections = connection_fds.size(); }
+
+    std::ostringstream body;
+    body << "\"status\": 0, \"transformers\": " << nthreads << ", \"busy\": " << (nthreads - nidle)
+        << ", \"connections\": " << nconnections << ", \"jobs\": " << jobs << ", \"failed_jobs\": "
+        << failed_jobs << ", \"busy_seconds\": " << busy_micros / 1e6 << ", \"uptime_seconds\": "
+        << std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return body.str();
+}
+
+std::unique_ptr<FitTransformer> FitDaemon::_acquire()
+{
+    std::unique_lock<std::mutex> lock(pool_mutex);
+    pool_cv.wait(lock, [this]() { return !idle.empty(); });
+    std::unique_ptr<FitTransformer> transformer = std::move(idle.back());
+    idle.pop_back();
+    return transformer;
+}
+
+void FitDaemon::_release(std::unique_ptr<FitTransformer> transformer)
+{
+    { std::lock_guard<std::mutex> lock(pool_mutex); idle.push_back(std::move(transformer)); }
+    pool_cv.notify_one();
+}
@@ -0,0 +1,78 @@
+#if !defined(FITDAEMON_H)
+#define FITDAEMON_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define DAEMON_POLL_MS 200 // Accept loop wakeup, to notice shutdown/signals
+#define DAEMON_BACKLOG 128 // Pending connections on the socket
+#define DAEMON_MAX_REQUEST_BYTES 65536 // Longest request line accepted
+
+class FitTransformer;
+
+
+// Conversion daemon (fittransformer --serve): keeps a pool of warmed transformers
+// and the parsed config between requests, served over a Unix domain socket.
+//
+// Protocol: newline-delimited JSON, one response line per request line, in order
+// per connection. Connections are served concurrently, conversions run on at most
+// nthreads transformers at a time.
+//
+//   {"op": "convert", "source": "a.fit", "parquet": "a.parquet", "collect_stats": true, "id": 7}
+//   {"id": 7, "status": 0, "parquet": "a.parquet", "seconds": 0.012, "stats": {...}}
+//
+// ops: convert (source .fit[.gz|.zst] or .zip, parquet defaults beside the source),
+// reload (re-parse config once in-flight jobs finish), stats (daemon counters), ping,
+// and shutdown. Failed requests respond with status 1 and an error string.
+class FitDaemon
+{
+public:
+
+    FitDaemon(const std::string& socket_path, int nthreads = 0);
+    ~FitDaemon();
+
+    // Serves until a shutdown request, SIGINT or SIGTERM. Returns 0 on clean shutdown
+    int serve();
+
+private:
+
+    std::string socket_path;
+    int listen_fd;
+    std::atomic<bool> stopping;
+    std::chrono::steady_clock::time_point started;
+
+    // Idle transformers (all nthreads when no job runs)
+    std::vector<std::unique_ptr<FitTransformer>> idle;
+    size_t nthreads;
+    std::mutex pool_mutex;
+    std::condition_variable pool_cv;
+
+    std::mutex reload_mutex;
+
+    // Open client connections, one detached thread each (shut down on stop, to wake reads)
+    std::vector<int> connection_fds;
+    std::mutex connection_mutex;
+    std::condition_variable connection_cv;
+
+    std::atomic<std::int64_t> jobs;
+    std::atomic<std::int64_t> failed_jobs;
+    std::atomic<std::int64_t> busy_micros;
+
+    void _listen();
+    void _serve_connection(int fd);
+    std::string _respond(const std::string& request);
+    std::string _convert(const std::string& source, std::string parquet, bool collect_stats);
+    std::string _reload();
+    std::string _daemon_stats();
+
+    std::unique_ptr<FitTransformer> _acquire();
+    void _release(std::unique_ptr<FitTransformer> transformer);
+};
+
+#endif // defined(FITDAEMON_H)
@@ -0,0 +1,2431 @@
+// Generated by genenums.py from fit_profile.hpp/.cpp, do not edit
+#if !defined(FITENUMS_H)
+#define FITENUMS_H
+
+#include "fit_profile.hpp"
+
+// Name of an enumerated value: the #define suffix of fit_profile.hpp (FIT_SPORT_RUNNING
+// is "RUNNING"). Per type, names are sorted by value, indexed directly when dense.
+struct FitEnumName { FIT_UINT32 value; const char* name; };
+struct FitEnumTable { const FitEnumName* names; FIT_UINT16 count; };
+
+// Table of a profile type (count 0 if the type is not enumerated)
+inline const FitEnumTable& fit_enum_table(fit::Profile::Type type)
+{
+    static const FitEnumName file_names[] = {
+        {FIT_FILE_DEVICE, "DEVICE"}, {FIT_FILE_SETTINGS, "SETTINGS"},
+        {FIT_FILE_SPORT, "SPORT"}, {FIT_FILE_ACTIVITY, "ACTIVITY"},
+        {FIT_FILE_WORKOUT, "WORKOUT"}, {FIT_FILE_COURSE, "COURSE"},
+        {FIT_FILE_SCHEDULES, "SCHEDULES"}, {FIT_FILE_WEIGHT, "WEIGHT"},
+        {FIT_FILE_TOTALS, "TOTALS"}, {FIT_FILE_GOALS, "GOALS"},
+        {FIT_FILE_BLOOD_PRESSURE, "BLOOD_PRESSURE"}, {FIT_FILE_MONITORING_A, "MONITORING_A"},
+        {FIT_FILE_ACTIVITY_SUMMARY, "ACTIVITY_SUMMARY"}, {FIT_FILE_MONITORING_DAILY, "MONITORING_DAILY"},
+        {FIT_FILE_MONITORING_B, "MONITORING_B"}, {FIT_FILE_SEGMENT, "SEGMENT"},
+        {FIT_FILE_SEGMENT_LIST, "SEGMENT_LIST"}, {FIT_FILE_EXD_CONFIGURATION, "EXD_CONFIGURATION"},
+        {FIT_FILE_MFG_RANGE_MIN, "MFG_RANGE_MIN"}, {FIT_FILE_MFG_RANGE_MAX, "MFG_RANGE_MAX"},
+        {FIT_FILE_INVALID, "INVALID"},
+    };
+    static const FitEnumName mesg_num_names[] = {
+        {FIT_MESG_NUM_FILE_ID, "FILE_ID"}, {FIT_MESG_NUM_CAPABILITIES, "CAPABILITIES"},
+        {FIT_MESG_NUM_DEVICE_SETTINGS, "DEVICE_SETTINGS"}, {FIT_MESG_NUM_USER_PROFILE, "USER_PROFILE"},
+        {FIT_MESG_NUM_HRM_PROFILE, "HRM_PROFILE"}, {FIT_MESG_NUM_SDM_PROFILE, "SDM_PROFILE"},
+        {FIT_MESG_NUM_BIKE_PROFILE, "BIKE_PROFILE"}, {FIT_MESG_NUM_ZONES_TARGET, "ZONES_TARGET"},
+        {FIT_MESG_NUM_HR_ZONE, "HR_ZONE"}, {FIT_MESG_NUM_POWER_ZONE, "POWER_ZONE"},
+        {FIT_MESG_NUM_MET_ZONE, "MET_ZONE"}, {FIT_MESG_NUM_SPORT, "SPORT"},
+        {FIT_MESG_NUM_GOAL, "GOAL"}, {FIT_MESG_NUM_SESSION, "SESSION"},
+        {FIT_MESG_NUM_LAP, "LAP"}, {FIT_MESG_NUM_RECORD, "RECORD"},
+        {FIT_MESG_NUM_EVENT, "EVENT"}, {FIT_MESG_NUM_DEVICE_INFO, "DEVICE_INFO"},
+        {FIT_MESG_NUM_WORKOUT, "WORKOUT"}, {FIT_MESG_NUM_WORKOUT_STEP, "WORKOUT_STEP"},
+        {FIT_MESG_NUM_SCHEDULE, "SCHEDULE"}, {FIT_MESG_NUM_WEIGHT_SCALE, "WEIGHT_SCALE"},
+        {FIT_MESG_NUM_COURSE, "COURSE"}, {FIT_MESG_NUM_COURSE_POINT, "COURSE_POINT"},
+        {FIT_MESG_NUM_TOTALS, "TOTALS"}, {FIT_MESG_NUM_ACTIVITY, "ACTIVITY"},
+        {FIT_MESG_NUM_SOFTWARE, "SOFTWARE"}, {FIT_MESG_NUM_FILE_CAPABILITIES, "FILE_CAPABILITIES"},
+        {FIT_MESG_NUM_MESG_CAPABILITIES, "MESG_CAPABILITIES"}, {FIT_MESG_NUM_FIELD_CAPABILITIES, "FIELD_CAPABILITIES"},
+        {FIT_MESG_NUM_FILE_CREATOR, "FILE_CREATOR"}, {FIT_MESG_NUM_BLOOD_PRESSURE, "BLOOD_PRESSURE"},
+        {FIT_MESG_NUM_SPEED_ZONE, "SPEED_ZONE"}, {FIT_MESG_NUM_MONITORING, "MONITORING"},
+        {FIT_MESG_NUM_TRAINING_FILE, "TRAINING_FILE"}, {FIT_MESG_NUM_HRV, "HRV"},
+        {FIT_MESG_NUM_ANT_RX, "ANT_RX"}, {FIT_MESG_NUM_ANT_TX, "ANT_TX"},
+        {FIT_MESG_NUM_ANT_CHANNEL_ID, "ANT_CHANNEL_ID"}, {FIT_MESG_NUM_LENGTH, "LENGTH"},
+        {FIT_MESG_NUM_MONITORING_INFO, "MONITORING_INFO"}, {FIT_MESG_NUM_PAD, "PAD"},
+        {FIT_MESG_NUM_SLAVE_DEVICE, "SLAVE_DEVICE"}, {FIT_MESG_NUM_CONNECTIVITY, "CONNECTIVITY"},
+        {FIT_MESG_NUM_WEATHER_CONDITIONS, "WEATHER_CONDITIONS"}, {FIT_MESG_NUM_WEATHER_ALERT, "WEATHER_ALERT"},
+        {FIT_MESG_NUM_CADENCE_ZONE, "CADENCE_ZONE"}, {FIT_MESG_NUM_HR, "HR"},
+        {FIT_MESG_NUM_SEGMENT_LAP, "SEGMENT_LAP"}, {FIT_MESG_NUM_MEMO_GLOB, "MEMO_GLOB"},
+        {FIT_MESG_NUM_SEGMENT_ID, "SEGMENT_ID"}, {FIT_MESG_NUM_SEGMENT_LEADERBOARD_ENTRY, "SEGMENT_LEADERBOARD_ENTRY"},
+        {FIT_MESG_NUM_SEGMENT_POINT, "SEGMENT_POINT"}, {FIT_MESG_NUM_SEGMENT_FILE, "SEGMENT_FILE"},
+        {FIT_MESG_NUM_WORKOUT_SESSION, "WORKOUT_SESSION"}, {FIT_MESG_NUM_WATCHFACE_SETTINGS, "WATCHFACE_SETTINGS"},
+        {FIT_MESG_NUM_GPS_METADATA, "GPS_METADATA"}, {FIT_MESG_NUM_CAMERA_EVENT, "CAMERA_EVENT"},
+        {FIT_MESG_NUM_TIMESTAMP_CORRELATION, "TIMESTAMP_CORRELATION"}, {FIT_MESG_NUM_GYROSCOPE_DATA, "GYROSCOPE_DATA"},
+        {FIT_MESG_NUM_ACCELEROMETER_DATA, "ACCELEROMETER_DATA"}, {FIT_MESG_NUM_THREE_D_SENSOR_CALIBRATION, "THREE_D_SENSOR_CALIBRATION"},
+        {FIT_MESG_NUM_VIDEO_FRAME, "VIDEO_FRAME"}, {FIT_MESG_NUM_OBDII_DATA, "OBDII_DATA"},
+        {FIT_MESG_NUM_NMEA_SENTENCE, "NMEA_SENTENCE"}, {FIT_MESG_NUM_AVIATION_ATTITUDE, "AVIATION_ATTITUDE"},
+        {FIT_MESG_NUM_VIDEO, "VIDEO"}, {FIT_MESG_NUM_VIDEO_TITLE, "VIDEO_TITLE"},
+        {FIT_MESG_NUM_VIDEO_DESCRIPTION, "VIDEO_DESCRIPTION"}, {FIT_MESG_NUM_VIDEO_CLIP, "VIDEO_CLIP"},
+        {FIT_MESG_NUM_OHR_SETTINGS, "OHR_SETTINGS"}, {FIT_MESG_NUM_EXD_SCREEN_CONFIGURATION, "EXD_SCREEN_CONFIGURATION"},
+        {FIT_MESG_NUM_EXD_DATA_FIELD_CONFIGURATION, "EXD_DATA_FIELD_CONFIGURATION"}, {FIT_MESG_NUM_EXD_DATA_CONCEPT_CONFIGURATION, "EXD_DATA_CONCEPT_CONFIGURATION"},
+        {FIT_MESG_NUM_FIELD_DESCRIPTION, "FIELD_DESCRIPTION"}, {FIT_MESG_NUM_DEVELOPER_DATA_ID, "DEVELOPER_DATA_ID"},
+        {FIT_MESG_NUM_MAGNETOMETER_DATA, "MAGNETOMETER_DATA"}, {FIT_MESG_NUM_BAROMETER_DATA, "BAROMETER_DATA"},
+        {FIT_MESG_NUM_ONE_D_SENSOR_CALIBRATION, "ONE_D_SENSOR_CALIBRATION"}, {FIT_MESG_NUM_SET, "SET"},
+        {FIT_MESG_NUM_STRESS_LEVEL, "STRESS_LEVEL"}, {FIT_MESG_NUM_DIVE_SETTINGS, "DIVE_SETTINGS"},
+        {FIT_MESG_NUM_DIVE_GAS, "DIVE_GAS"}, {FIT_MESG_NUM_DIVE_ALARM, "DIVE_ALARM"},
+        {FIT_MESG_NUM_EXERCISE_TITLE, "EXERCISE_TITLE"}, {FIT_MESG_NUM_DIVE_SUMMARY, "DIVE_SUMMARY"},
+        {FIT_MESG_NUM_JUMP, "JUMP"}, {FIT_MESG_NUM_CLIMB_PRO, "CLIMB_PRO"},
+        {FIT_MESG_NUM_MFG_RANGE_MIN, "MFG_RANGE_MIN"}, {FIT_MESG_NUM_MFG_RANGE_MAX, "MFG_RANGE_MAX"},
+        {FIT_MESG_NUM_INVALID, "INVALID"},
+    };
+    static const FitEnumName checksum_names[] = {
+        {FIT_CHECKSUM_CLEAR, "CLEAR"}, {FIT_CHECKSUM_OK, "OK"},
+        {FIT_CHECKSUM_INVALID, "INVALID"},
+    };
+    static const FitEnumName file_flags_names[] = {
+        {FIT_FILE_FLAGS_INVALID, "INVALID"}, {FIT_FILE_FLAGS_READ, "READ"},
+        {FIT_FILE_FLAGS_WRITE, "WRITE"}, {FIT_FILE_FLAGS_ERASE, "ERASE"},
+    };
+    static const FitEnumName mesg_count_names[] = {
+        {FIT_MESG_COUNT_NUM_PER_FILE, "NUM_PER_FILE"}, {FIT_MESG_COUNT_MAX_PER_FILE, "MAX_PER_FILE"},
+        {FIT_MESG_COUNT_MAX_PER_FILE_TYPE, "MAX_PER_FILE_TYPE"}, {FIT_MESG_COUNT_INVALID, "INVALID"},
+    };
+    static const FitEnumName device_index_names[] = {
+        {FIT_DEVICE_INDEX_CREATOR, "CREATOR"}, {FIT_DEVICE_INDEX_INVALID, "INVALID"},
+    };
+    static const FitEnumName gender_names[] = {
+        {FIT_GENDER_FEMALE, "FEMALE"}, {FIT_GENDER_MALE, "MALE"},
+        {FIT_GENDER_INVALID, "INVALID"},
+    };
+    static const FitEnumName language_names[] = {
+        {FIT_LANGUAGE_ENGLISH, "ENGLISH"}, {FIT_LANGUAGE_FRENCH, "FRENCH"},
+        {FIT_LANGUAGE_ITALIAN, "ITALIAN"}, {FIT_LANGUAGE_GERMAN, "GERMAN"},
+        {FIT_LANGUAGE_SPANISH, "SPANISH"}, {FIT_LANGUAGE_CROATIAN, "CROATIAN"},
+        {FIT_LANGUAGE_CZECH, "CZECH"}, {FIT_LANGUAGE_DANISH, "DANISH"},
+        {FIT_LANGUAGE_DUTCH, "DUTCH"}, {FIT_LANGUAGE_FINNISH, "FINNISH"},
+        {FIT_LANGUAGE_GREEK, "GREEK"}, {FIT_LANGUAGE_HUNGARIAN, "HUNGARIAN"},
+        {FIT_LANGUAGE_NORWEGIAN, "NORWEGIAN"}, {FIT_LANGUAGE_POLISH, "POLISH"},
+        {FIT_LANGUAGE_PORTUGUESE, "PORTUGUESE"}, {FIT_LANGUAGE_SLOVAKIAN, "SLOVAKIAN"},
+        {FIT_LANGUAGE_SLOVENIAN, "SLOVENIAN"}, {FIT_LANGUAGE_SWEDISH, "SWEDISH"},
+        {FIT_LANGUAGE_RUSSIAN, "RUSSIAN"}, {FIT_LANGUAGE_TURKISH, "TURKISH"},
+        {FIT_LANGUAGE_LATVIAN, "LATVIAN"}, {FIT_LANGUAGE_UKRAINIAN, "UKRAINIAN"},
+        {FIT_LANGUAGE_ARABIC, "ARABIC"}, {FIT_LANGUAGE_FARSI, "FARSI"},
+        {FIT_LANGUAGE_BULGARIAN, "BULGARIAN"}, {FIT_LANGUAGE_ROMANIAN, "ROMANIAN"},
+        {FIT_LANGUAGE_CHINESE, "CHINESE"}, {FIT_LANGUAGE_JAPANESE, "JAPANESE"},
+        {FIT_LANGUAGE_KOREAN, "KOREAN"}, {FIT_LANGUAGE_TAIWANESE, "TAIWANESE"},
+        {FIT_LANGUAGE_THAI, "THAI"}, {FIT_LANGUAGE_HEBREW, "HEBREW"},
+        {FIT_LANGUAGE_BRAZILIAN_PORTUGUESE, "BRAZILIAN_PORTUGUESE"}, {FIT_LANGUAGE_INDONESIAN, "INDONESIAN"},
+        {FIT_LANGUAGE_MALAYSIAN, "MALAYSIAN"}, {FIT_LANGUAGE_VIETNAMESE, "VIETNAMESE"},
+        {FIT_LANGUAGE_BURMESE, "BURMESE"}, {FIT_LANGUAGE_MONGOLIAN, "MONGOLIAN"},
+        {FIT_LANGUAGE_CUSTOM, "CUSTOM"}, {FIT_LANGUAGE_INVALID, "INVALID"},
+    };
+    static const FitEnumName language_bits_0_names[] = {
+        {FIT_LANGUAGE_BITS_0_INVALID, "INVALID"}, {FIT_LANGUAGE_BITS_0_ENGLISH, "ENGLISH"},
+        {FIT_LANGUAGE_BITS_0_FRENCH, "FRENCH"}, {FIT_LANGUAGE_BITS_0_ITALIAN, "ITALIAN"},
+        {FIT_LANGUAGE_BITS_0_GERMAN, "GERMAN"}, {FIT_LANGUAGE_BITS_0_SPANISH, "SPANISH"},
+        {FIT_LANGUAGE_BITS_0_CROATIAN, "CROATIAN"}, {FIT_LANGUAGE_BITS_0_CZECH, "CZECH"},
+        {FIT_LANGUAGE_BITS_0_DANISH, "DANISH"},
+    };
+    static const FitEnumName language_bits_1_names[] = {
+        {FIT_LANGUAGE_BITS_1_INVALID, "INVALID"}, {FIT_LANGUAGE_BITS_1_DUTCH, "DUTCH"},
+        {FIT_LANGUAGE_BITS_1_FINNISH, "FINNISH"}, {FIT_LANGUAGE_BITS_1_GREEK, "GREEK"},
+        {FIT_LANGUAGE_BITS_1_HUNGARIAN, "HUNGARIAN"}, {FIT_LANGUAGE_BITS_1_NORWEGIAN, "NORWEGIAN"},
+        {FIT_LANGUAGE_BITS_1_POLISH, "POLISH"}, {FIT_LANGUAGE_BITS_1_PORTUGUESE, "PORTUGUESE"},
+        {FIT_LANGUAGE_BITS_1_SLOVAKIAN, "SLOVAKIAN"},
+    };
+    static const FitEnumName language_bits_2_names[] = {
+        {FIT_LANGUAGE_BITS_2_INVALID, "INVALID"}, {FIT_LANGUAGE_BITS_2_SLOVENIAN, "SLOVENIAN"},
+        {FIT_LANGUAGE_BITS_2_SWEDISH, "SWEDISH"}, {FIT_LANGUAGE_BITS_2_RUSSIAN, "RUSSIAN"},
+        {FIT_LANGUAGE_BITS_2_TURKISH, "TURKISH"}, {FIT_LANGUAGE_BITS_2_LATVIAN, "LATVIAN"},
+        {FIT_LANGUAGE_BITS_2_UKRAINIAN, "UKRAINIAN"}, {FIT_LANGUAGE_BITS_2_ARABIC, "ARABIC"},
+        {FIT_LANGUAGE_BITS_2_FARSI, "FARSI"},
+    };
+    static const FitEnumName language_bits_3_names[] = {
+        {FIT_LANGUAGE_BITS_3_INVALID, "INVALID"}, {FIT_LANGUAGE_BITS_3_BULGARIAN, "BULGARIAN"},
+        {FIT_LANGUAGE_BITS_3_ROMANIAN, "ROMANIAN"}, {FIT_LANGUAGE_BITS_3_CHINESE, "CHINESE"},
+        {FIT_LANGUAGE_BITS_3_JAPANESE, "JAPANESE"}, {FIT_LANGUAGE_BITS_3_KOREAN, "KOREAN"},
+        {FIT_LANGUAGE_BITS_3_TAIWANESE, "TAIWANESE"}, {FIT_LANGUAGE_BITS_3_THAI, "THAI"},
+        {FIT_LANGUAGE_BITS_3_HEBREW, "HEBREW"},
+    };
+    static const FitEnumName language_bits_4_names[] = {
+        {FIT_LANGUAGE_BITS_4_INVALID, "INVALID"}, {FIT_LANGUAGE_BITS_4_BRAZILIAN_PORTUGUESE, "BRAZILIAN_PORTUGUESE"},
+        {FIT_LANGUAGE_BITS_4_INDONESIAN, "INDONESIAN"}, {FIT_LANGUAGE_BITS_4_MALAYSIAN, "MALAYSIAN"},
+        {FIT_LANGUAGE_BITS_4_VIETNAMESE, "VIETNAMESE"}, {FIT_LANGUAGE_BITS_4_BURMESE, "BURMESE"},
+        {FIT_LANGUAGE_BITS_4_MONGOLIAN, "MONGOLIAN"},
+    };
+    static const FitEnumName time_zone_names[] = {
+        {FIT_TIME_ZONE_ALMATY, "ALMATY"}, {FIT_TIME_ZONE_BANGKOK, "BANGKOK"},
+        {FIT_TIME_ZONE_BOMBAY, "BOMBAY"}, {FIT_TIME_ZONE_BRASILIA, "BRASILIA"},
+        {FIT_TIME_ZONE_CAIRO, "CAIRO"}, {FIT_TIME_ZONE_CAPE_VERDE_IS, "CAPE_VERDE_IS"},
+        {FIT_TIME_ZONE_DARWIN, "DARWIN"}, {FIT_TIME_ZONE_ENIWETOK, "ENIWETOK"},
+        {FIT_TIME_ZONE_FIJI, "FIJI"}, {FIT_TIME_ZONE_HONG_KONG, "HONG_KONG"},
+        {FIT_TIME_ZONE_ISLAMABAD, "ISLAMABAD"}, {FIT_TIME_ZONE_KABUL, "KABUL"},
+        {FIT_TIME_ZONE_MAGADAN, "MAGADAN"}, {FIT_TIME_ZONE_MID_ATLANTIC, "MID_ATLANTIC"},
+        {FIT_TIME_ZONE_MOSCOW, "MOSCOW"}, {FIT_TIME_ZONE_MUSCAT, "MUSCAT"},
+        {FIT_TIME_ZONE_NEWFOUNDLAND, "NEWFOUNDLAND"}, {FIT_TIME_ZONE_SAMOA, "SAMOA"},
+        {FIT_TIME_ZONE_SYDNEY, "SYDNEY"}, {FIT_TIME_ZONE_TEHRAN, "TEHRAN"},
+        {FIT_TIME_ZONE_TOKYO, "TOKYO"}, {FIT_TIME_ZONE_US_ALASKA, "US_ALASKA"},
+        {FIT_TIME_ZONE_US_ATLANTIC, "US_ATLANTIC"}, {FIT_TIME_ZONE_US_CENTRAL, "US_CENTRAL"},
+        {FIT_TIME_ZONE_US_EASTERN, "US_EASTERN"}, {FIT_TIME_ZONE_US_HAWAII, "US_HAWAII"},
+        {FIT_TIME_ZONE_US_MOUNTAIN, "US_MOUNTAIN"}, {FIT_TIME_ZONE_US_PACIFIC, "US_PACIFIC"},
+        {FIT_TIME_ZONE_OTHER, "OTHER"}, {FIT_TIME_ZONE_AUCKLAND, "AUCKLAND"},
+        {FIT_TIME_ZONE_KATHMANDU, "KATHMANDU"}, {FIT_TIME_ZONE_EUROPE_WESTERN_WET, "EUROPE_WESTERN_WET"},
+        {FIT_TIME_ZONE_EUROPE_CENTRAL_CET, "EUROPE_CENTRAL_CET"}, {FIT_TIME_ZONE_EUROPE_EASTERN_EET, "EUROPE_EASTERN_EET"},
+        {FIT_TIME_ZONE_JAKARTA, "JAKARTA"}, {FIT_TIME_ZONE_PERTH, "PERTH"},
+        {FIT_TIME_ZONE_ADELAIDE, "ADELAIDE"}, {FIT_TIME_ZONE_BRISBANE, "BRISBANE"},
+        {FIT_TIME_ZONE_TASMANIA, "TASMANIA"}, {FIT_TIME_ZONE_ICELAND, "ICELAND"},
+        {FIT_TIME_ZONE_AMSTERDAM, "AMSTERDAM"}, {FIT_TIME_ZONE_ATHENS, "ATHENS"},
+        {FIT_TIME_ZONE_BARCELONA, "BARCELONA"}, {FIT_TIME_ZONE_BERLIN, "BERLIN"},
+        {FIT_TIME_ZONE_BRUSSELS, "BRUSSELS"}, {FIT_TIME_ZONE_BUDAPEST, "BUDAPEST"},
+        {FIT_TIME_ZONE_COPENHAGEN, "COPENHAGEN"}, {FIT_TIME_ZONE_DUBLIN, "DUBLIN"},
+        {FIT_TIME_ZONE_HELSINKI, "HELSINKI"}, {FIT_TIME_ZONE_LISBON, "LISBON"},
+        {FIT_TIME_ZONE_LONDON, "LONDON"}, {FIT_TIME_ZONE_MADRID, "MADRID"},
+        {FIT_TIME_ZONE_MUNICH, "MUNICH"}, {FIT_TIME_ZONE_OSLO, "OSLO"},
+        {FIT_TIME_ZONE_PARIS, "PARIS"}, {FIT_TIME_ZONE_PRAGUE, "PRAGUE"},
+        {FIT_TIME_ZONE_REYKJAVIK, "REYKJAVIK"}, {FIT_TIME_ZONE_ROME, "ROME"},
+        {FIT_TIME_ZONE_STOCKHOLM, "STOCKHOLM"}, {FIT_TIME_ZONE_VIENNA, "VIENNA"},
+        {FIT_TIME_ZONE_WARSAW, "WARSAW"}, {FIT_TIME_ZONE_ZURICH, "ZURICH"},
+        {FIT_TIME_ZONE_QUEBEC, "QUEBEC"}, {FIT_TIME_ZONE_ONTARIO, "ONTARIO"},
+        {FIT_TIME_ZONE_MANITOBA, "MANITOBA"}, {FIT_TIME_ZONE_SASKATCHEWAN, "SASKATCHEWAN"},
+        {FIT_TIME_ZONE_ALBERTA, "ALBERTA"}, {FIT_TIME_ZONE_BRITISH_COLUMBIA, "BRITISH_COLUMBIA"},
+        {FIT_TIME_ZONE_BOISE, "BOISE"}, {FIT_TIME_ZONE_BOSTON, "BOSTON"},
+        {FIT_TIME_ZONE_CHICAGO, "CHICAGO"}, {FIT_TIME_ZONE_DALLAS, "DALLAS"},
+        {FIT_TIME_ZONE_DENVER, "DENVER"}, {FIT_TIME_ZONE_KANSAS_CITY, "KANSAS_CITY"},
+        {FIT_TIME_ZONE_LAS_VEGAS, "LAS_VEGAS"}, {FIT_TIME_ZONE_LOS_ANGELES, "LOS_ANGELES"},
+        {FIT_TIME_ZONE_MIAMI, "MIAMI"}, {FIT_TIME_ZONE_MINNEAPOLIS, "MINNEAPOLIS"},
+        {FIT_TIME_ZONE_NEW_YORK, "NEW_YORK"}, {FIT_TIME_ZONE_NEW_ORLEANS, "NEW_ORLEANS"},
+        {FIT_TIME_ZONE_PHOENIX, "PHOENIX"}, {FIT_TIME_ZONE_SANTA_FE, "SANTA_FE"},
+        {FIT_TIME_ZONE_SEATTLE, "SEATTLE"}, {FIT_TIME_ZONE_WASHINGTON_DC, "WASHINGTON_DC"},
+        {FIT_TIME_ZONE_US_ARIZONA, "US_ARIZONA"}, {FIT_TIME_ZONE_CHITA, "CHITA"},
+        {FIT_TIME_ZONE_EKATERINBURG, "EKATERINBURG"}, {FIT_TIME_ZONE_IRKUTSK, "IRKUTSK"},
+        {FIT_TIME_ZONE_KALININGRAD, "KALININGRAD"}, {FIT_TIME_ZONE_KRASNOYARSK, "KRASNOYARSK"},
+        {FIT_TIME_ZONE_NOVOSIBIRSK, "NOVOSIBIRSK"}, {FIT_TIME_ZONE_PETROPAVLOVSK_KAMCHATSKIY, "PETROPAVLOVSK_KAMCHATSKIY"},
+        {FIT_TIME_ZONE_SAMARA, "SAMARA"}, {FIT_TIME_ZONE_VLADIVOSTOK, "VLADIVOSTOK"},
+        {FIT_TIME_ZONE_MEXICO_CENTRAL, "MEXICO_CENTRAL"}, {FIT_TIME_ZONE_MEXICO_MOUNTAIN, "MEXICO_MOUNTAIN"},
+        {FIT_TIME_ZONE_MEXICO_PACIFIC, "MEXICO_PACIFIC"}, {FIT_TIME_ZONE_CAPE_TOWN, "CAPE_TOWN"},
+        {FIT_TIME_ZONE_WINKHOEK, "WINKHOEK"}, {FIT_TIME_ZONE_LAGOS, "LAGOS"},
+        {FIT_TIME_ZONE_RIYAHD, "RIYAHD"}, {FIT_TIME_ZONE_VENEZUELA, "VENEZUELA"},
+        {FIT_TIME_ZONE_AUSTRALIA_LH, "AUSTRALIA_LH"}, {FIT_TIME_ZONE_SANTIAGO, "SANTIAGO"},
+        {FIT_TIME_ZONE_MANUAL, "MANUAL"}, {FIT_TIME_ZONE_AUTOMATIC, "AUTOMATIC"},
+        {FIT_TIME_ZONE_INVALID, "INVALID"},
+    };
+    static const FitEnumName display_measure_names[] = {
+        {FIT_DISPLAY_MEASURE_METRIC, "METRIC"}, {FIT_DISPLAY_MEASURE_STATUTE, "STATUTE"},
+        {FIT_DISPLAY_MEASURE_NAUTICAL, "NAUTICAL"}, {FIT_DISPLAY_MEASURE_INVALID, "INVALID"},
+    };
+    static const FitEnumName display_heart_names[] = {
+        {FIT_DISPLAY_HEART_BPM, "BPM"}, {FIT_DISPLAY_HEART_MAX, "MAX"},
+        {FIT_DISPLAY_HEART_RESERVE, "RESERVE"}, {FIT_DISPLAY_HEART_INVALID, "INVALID"},
+    };
+    static const FitEnumName display_power_names[] = {
+        {FIT_DISPLAY_POWER_WATTS, "WATTS"}, {FIT_DISPLAY_POWER_PERCENT_FTP, "PERCENT_FTP"},
+        {FIT_DISPLAY_POWER_INVALID, "INVALID"},
+    };
+    static const FitEnumName display_position_names[] = {
+        {FIT_DISPLAY_POSITION_DEGREE, "DEGREE"}, {FIT_DISPLAY_POSITION_DEGREE_MINUTE, "DEGREE_MINUTE"},
+        {FIT_DISPLAY_POSITION_DEGREE_MINUTE_SECOND, "DEGREE_MINUTE_SECOND"}, {FIT_DISPLAY_POSITION_AUSTRIAN_GRID, "AUSTRIAN_GRID"},
+        {FIT_DISPLAY_POSITION_BRITISH_GRID, "BRITISH_GRID"}, {FIT_DISPLAY_POSITION_DUTCH_GRID, "DUTCH_GRID"},
+        {FIT_DISPLAY_POSITION_HUNGARIAN_GRID, "HUNGARIAN_GRID"}, {FIT_DISPLAY_POSITION_FINNISH_GRID, "FINNISH_GRID"},
+        {FIT_DISPLAY_POSITION_GERMAN_GRID, "GERMAN_GRID"}, {FIT_DISPLAY_POSITION_ICELANDIC_GRID, "ICELANDIC_GRID"},
+        {FIT_DISPLAY_POSITION_INDONESIAN_EQUATORIAL, "INDONESIAN_EQUATORIAL"}, {FIT_DISPLAY_POSITION_INDONESIAN_IRIAN, "INDONESIAN_IRIAN"},
+        {FIT_DISPLAY_POSITION_INDONESIAN_SOUTHERN, "INDONESIAN_SOUTHERN"}, {FIT_DISPLAY_POSITION_INDIA_ZONE_0, "INDIA_ZONE_0"},
+        {FIT_DISPLAY_POSITION_INDIA_ZONE_IA, "INDIA_ZONE_IA"}, {FIT_DISPLAY_POSITION_INDIA_ZONE_IB, "INDIA_ZONE_IB"},
+        {FIT_DISPLAY_POSITION_INDIA_ZONE_IIA, "INDIA_ZONE_IIA"}, {FIT_DISPLAY_POSITION_INDIA_ZONE_IIB, "INDIA_ZONE_IIB"},
+        {FIT_DISPLAY_POSITION_INDIA_ZONE_IIIA, "INDIA_ZONE_IIIA"}, {FIT_DISPLAY_POSITION_INDIA_ZONE_IIIB, "INDIA_ZONE_IIIB"},
+        {FIT_DISPLAY_POSITION_INDIA_ZONE_IVA, "INDIA_ZONE_IVA"}, {FIT_DISPLAY_POSITION_INDIA_ZONE_IVB, "INDIA_ZONE_IVB"},
+        {FIT_DISPLAY_POSITION_IRISH_TRANSVERSE, "IRISH_TRANSVERSE"}, {FIT_DISPLAY_POSITION_IRISH_GRID, "IRISH_GRID"},
+        {FIT_DISPLAY_POSITION_LORAN, "LORAN"}, {FIT_DISPLAY_POSITION_MAIDENHEAD_GRID, "MAIDENHEAD_GRID"},
+        {FIT_DISPLAY_POSITION_MGRS_GRID, "MGRS_GRID"}, {FIT_DISPLAY_POSITION_NEW_ZEALAND_GRID, "NEW_ZEALAND_GRID"},
+        {FIT_DISPLAY_POSITION_NEW_ZEALAND_TRANSVERSE, "NEW_ZEALAND_TRANSVERSE"}, {FIT_DISPLAY_POSITION_QATAR_GRID, "QATAR_GRID"},
+        {FIT_DISPLAY_POSITION_MODIFIED_SWEDISH_GRID, "MODIFIED_SWEDISH_GRID"}, {FIT_DISPLAY_POSITION_SWEDISH_GRID, "SWEDISH_GRID"},
+        {FIT_DISPLAY_POSITION_SOUTH_AFRICAN_GRID, "SOUTH_AFRICAN_GRID"}, {FIT_DISPLAY_POSITION_SWISS_GRID, "SWISS_GRID"},
+        {FIT_DISPLAY_POSITION_TAIWAN_GRID, "TAIWAN_GRID"}, {FIT_DISPLAY_POSITION_UNITED_STATES_GRID, "UNITED_STATES_GRID"},
+        {FIT_DISPLAY_POSITION_UTM_UPS_GRID, "UTM_UPS_GRID"}, {FIT_DISPLAY_POSITION_WEST_MALAYAN, "WEST_MALAYAN"},
+        {FIT_DISPLAY_POSITION_BORNEO_RSO, "BORNEO_RSO"}, {FIT_DISPLAY_POSITION_ESTONIAN_GRID, "ESTONIAN_GRID"},
+        {FIT_DISPLAY_POSITION_LATVIAN_GRID, "LATVIAN_GRID"}, {FIT_DISPLAY_POSITION_SWEDISH_REF_99_GRID, "SWEDISH_REF_99_GRID"},
+        {FIT_DISPLAY_POSITION_INVALID, "INVALID"},
+    };
+    static const FitEnumName switch_names[] = {
+        {FIT_SWITCH_OFF, "OFF"}, {FIT_SWITCH_ON, "ON"},
+        {FIT_SWITCH_AUTO, "AUTO"}, {FIT_SWITCH_INVALID, "INVALID"},
+    };
+    static const FitEnumName sport_names[] = {
+        {FIT_SPORT_GENERIC, "GENERIC"}, {FIT_SPORT_RUNNING, "RUNNING"},
+        {FIT_SPORT_CYCLING, "CYCLING"}, {FIT_SPORT_TRANSITION, "TRANSITION"},
+        {FIT_SPORT_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"}, {FIT_SPORT_SWIMMING, "SWIMMING"},
+        {FIT_SPORT_BASKETBALL, "BASKETBALL"}, {FIT_SPORT_SOCCER, "SOCCER"},
+        {FIT_SPORT_TENNIS, "TENNIS"}, {FIT_SPORT_AMERICAN_FOOTBALL, "AMERICAN_FOOTBALL"},
+        {FIT_SPORT_TRAINING, "TRAINING"}, {FIT_SPORT_WALKING, "WALKING"},
+        {FIT_SPORT_CROSS_COUNTRY_SKIING, "CROSS_COUNTRY_SKIING"}, {FIT_SPORT_ALPINE_SKIING, "ALPINE_SKIING"},
+        {FIT_SPORT_SNOWBOARDING, "SNOWBOARDING"}, {FIT_SPORT_ROWING, "ROWING"},
+        {FIT_SPORT_MOUNTAINEERING, "MOUNTAINEERING"}, {FIT_SPORT_HIKING, "HIKING"},
+        {FIT_SPORT_MULTISPORT, "MULTISPORT"}, {FIT_SPORT_PADDLING, "PADDLING"},
+        {FIT_SPORT_FLYING, "FLYING"}, {FIT_SPORT_E_BIKING, "E_BIKING"},
+        {FIT_SPORT_MOTORCYCLING, "MOTORCYCLING"}, {FIT_SPORT_BOATING, "BOATING"},
+        {FIT_SPORT_DRIVING, "DRIVING"}, {FIT_SPORT_GOLF, "GOLF"},
+        {FIT_SPORT_HANG_GLIDING, "HANG_GLIDING"}, {FIT_SPORT_HORSEBACK_RIDING, "HORSEBACK_RIDING"},
+        {FIT_SPORT_HUNTING, "HUNTING"}, {FIT_SPORT_FISHING, "FISHING"},
+        {FIT_SPORT_INLINE_SKATING, "INLINE_SKATING"}, {FIT_SPORT_ROCK_CLIMBING, "ROCK_CLIMBING"},
+        {FIT_SPORT_SAILING, "SAILING"}, {FIT_SPORT_ICE_SKATING, "ICE_SKATING"},
+        {FIT_SPORT_SKY_DIVING, "SKY_DIVING"}, {FIT_SPORT_SNOWSHOEING, "SNOWSHOEING"},
+        {FIT_SPORT_SNOWMOBILING, "SNOWMOBILING"}, {FIT_SPORT_STAND_UP_PADDLEBOARDING, "STAND_UP_PADDLEBOARDING"},
+        {FIT_SPORT_SURFING, "SURFING"}, {FIT_SPORT_WAKEBOARDING, "WAKEBOARDING"},
+        {FIT_SPORT_WATER_SKIING, "WATER_SKIING"}, {FIT_SPORT_KAYAKING, "KAYAKING"},
+        {FIT_SPORT_RAFTING, "RAFTING"}, {FIT_SPORT_WINDSURFING, "WINDSURFING"},
+        {FIT_SPORT_KITESURFING, "KITESURFING"}, {FIT_SPORT_TACTICAL, "TACTICAL"},
+        {FIT_SPORT_JUMPMASTER, "JUMPMASTER"}, {FIT_SPORT_BOXING, "BOXING"},
+        {FIT_SPORT_FLOOR_CLIMBING, "FLOOR_CLIMBING"}, {FIT_SPORT_DIVING, "DIVING"},
+        {FIT_SPORT_ALL, "ALL"}, {FIT_SPORT_INVALID, "INVALID"},
+    };
+    static const FitEnumName sport_bits_0_names[] = {
+        {FIT_SPORT_BITS_0_INVALID, "INVALID"}, {FIT_SPORT_BITS_0_GENERIC, "GENERIC"},
+        {FIT_SPORT_BITS_0_RUNNING, "RUNNING"}, {FIT_SPORT_BITS_0_CYCLING, "CYCLING"},
+        {FIT_SPORT_BITS_0_TRANSITION, "TRANSITION"}, {FIT_SPORT_BITS_0_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"},
+        {FIT_SPORT_BITS_0_SWIMMING, "SWIMMING"}, {FIT_SPORT_BITS_0_BASKETBALL, "BASKETBALL"},
+        {FIT_SPORT_BITS_0_SOCCER, "SOCCER"},
+    };
+    static const FitEnumName sport_bits_1_names[] = {
+        {FIT_SPORT_BITS_1_INVALID, "INVALID"}, {FIT_SPORT_BITS_1_TENNIS, "TENNIS"},
+        {FIT_SPORT_BITS_1_AMERICAN_FOOTBALL, "AMERICAN_FOOTBALL"}, {FIT_SPORT_BITS_1_TRAINING, "TRAINING"},
+        {FIT_SPORT_BITS_1_WALKING, "WALKING"}, {FIT_SPORT_BITS_1_CROSS_COUNTRY_SKIING, "CROSS_COUNTRY_SKIING"},
+        {FIT_SPORT_BITS_1_ALPINE_SKIING, "ALPINE_SKIING"}, {FIT_SPORT_BITS_1_SNOWBOARDING, "SNOWBOARDING"},
+        {FIT_SPORT_BITS_1_ROWING, "ROWING"},
+    };
+    static const FitEnumName sport_bits_2_names[] = {
+        {FIT_SPORT_BITS_2_INVALID, "INVALID"}, {FIT_SPORT_BITS_2_MOUNTAINEERING, "MOUNTAINEERING"},
+        {FIT_SPORT_BITS_2_HIKING, "HIKING"}, {FIT_SPORT_BITS_2_MULTISPORT, "MULTISPORT"},
+        {FIT_SPORT_BITS_2_PADDLING, "PADDLING"}, {FIT_SPORT_BITS_2_FLYING, "FLYING"},
+        {FIT_SPORT_BITS_2_E_BIKING, "E_BIKING"}, {FIT_SPORT_BITS_2_MOTORCYCLING, "MOTORCYCLING"},
+        {FIT_SPORT_BITS_2_BOATING, "BOATING"},
+    };
+    static const FitEnumName sport_bits_3_names[] = {
+        {FIT_SPORT_BITS_3_INVALID, "INVALID"}, {FIT_SPORT_BITS_3_DRIVING, "DRIVING"},
+        {FIT_SPORT_BITS_3_GOLF, "GOLF"}, {FIT_SPORT_BITS_3_HANG_GLIDING, "HANG_GLIDING"},
+        {FIT_SPORT_BITS_3_HORSEBACK_RIDING, "HORSEBACK_RIDING"}, {FIT_SPORT_BITS_3_HUNTING, "HUNTING"},
+        {FIT_SPORT_BITS_3_FISHING, "FISHING"}, {FIT_SPORT_BITS_3_INLINE_SKATING, "INLINE_SKATING"},
+        {FIT_SPORT_BITS_3_ROCK_CLIMBING, "ROCK_CLIMBING"},
+    };
+    static const FitEnumName sport_bits_4_names[] = {
+        {FIT_SPORT_BITS_4_INVALID, "INVALID"}, {FIT_SPORT_BITS_4_SAILING, "SAILING"},
+        {FIT_SPORT_BITS_4_ICE_SKATING, "ICE_SKATING"}, {FIT_SPORT_BITS_4_SKY_DIVING, "SKY_DIVING"},
+        {FIT_SPORT_BITS_4_SNOWSHOEING, "SNOWSHOEING"}, {FIT_SPORT_BITS_4_SNOWMOBILING, "SNOWMOBILING"},
+        {FIT_SPORT_BITS_4_STAND_UP_PADDLEBOARDING, "STAND_UP_PADDLEBOARDING"}, {FIT_SPORT_BITS_4_SURFING, "SURFING"},
+        {FIT_SPORT_BITS_4_WAKEBOARDING, "WAKEBOARDING"},
+    };
+    static const FitEnumName sport_bits_5_names[] = {
+        {FIT_SPORT_BITS_5_INVALID, "INVALID"}, {FIT_SPORT_BITS_5_WATER_SKIING, "WATER_SKIING"},
+        {FIT_SPORT_BITS_5_KAYAKING, "KAYAKING"}, {FIT_SPORT_BITS_5_RAFTING, "RAFTING"},
+        {FIT_SPORT_BITS_5_WINDSURFING, "WINDSURFING"}, {FIT_SPORT_BITS_5_KITESURFING, "KITESURFING"},
+        {FIT_SPORT_BITS_5_TACTICAL, "TACTICAL"}, {FIT_SPORT_BITS_5_JUMPMASTER, "JUMPMASTER"},
+        {FIT_SPORT_BITS_5_BOXING, "BOXING"},
+    };
+    static const FitEnumName sport_bits_6_names[] = {
+        {FIT_SPORT_BITS_6_INVALID, "INVALID"}, {FIT_SPORT_BITS_6_FLOOR_CLIMBING, "FLOOR_CLIMBING"},
+    };
+    static const FitEnumName sub_sport_names[] = {
+        {FIT_SUB_SPORT_GENERIC, "GENERIC"}, {FIT_SUB_SPORT_TREADMILL, "TREADMILL"},
+        {FIT_SUB_SPORT_STREET, "STREET"}, {FIT_SUB_SPORT_TRAIL, "TRAIL"},
+        {FIT_SUB_SPORT_TRACK, "TRACK"}, {FIT_SUB_SPORT_SPIN, "SPIN"},
+        {FIT_SUB_SPORT_INDOOR_CYCLING, "INDOOR_CYCLING"}, {FIT_SUB_SPORT_ROAD, "ROAD"},
+        {FIT_SUB_SPORT_MOUNTAIN, "MOUNTAIN"}, {FIT_SUB_SPORT_DOWNHILL, "DOWNHILL"},
+        {FIT_SUB_SPORT_RECUMBENT, "RECUMBENT"}, {FIT_SUB_SPORT_CYCLOCROSS, "CYCLOCROSS"},
+        {FIT_SUB_SPORT_HAND_CYCLING, "HAND_CYCLING"}, {FIT_SUB_SPORT_TRACK_CYCLING, "TRACK_CYCLING"},
+        {FIT_SUB_SPORT_INDOOR_ROWING, "INDOOR_ROWING"}, {FIT_SUB_SPORT_ELLIPTICAL, "ELLIPTICAL"},
+        {FIT_SUB_SPORT_STAIR_CLIMBING, "STAIR_CLIMBING"}, {FIT_SUB_SPORT_LAP_SWIMMING, "LAP_SWIMMING"},
+        {FIT_SUB_SPORT_OPEN_WATER, "OPEN_WATER"}, {FIT_SUB_SPORT_FLEXIBILITY_TRAINING, "FLEXIBILITY_TRAINING"},
+        {FIT_SUB_SPORT_STRENGTH_TRAINING, "STRENGTH_TRAINING"}, {FIT_SUB_SPORT_WARM_UP, "WARM_UP"},
+        {FIT_SUB_SPORT_MATCH, "MATCH"}, {FIT_SUB_SPORT_EXERCISE, "EXERCISE"},
+        {FIT_SUB_SPORT_CHALLENGE, "CHALLENGE"}, {FIT_SUB_SPORT_INDOOR_SKIING, "INDOOR_SKIING"},
+        {FIT_SUB_SPORT_CARDIO_TRAINING, "CARDIO_TRAINING"}, {FIT_SUB_SPORT_INDOOR_WALKING, "INDOOR_WALKING"},
+        {FIT_SUB_SPORT_E_BIKE_FITNESS, "E_BIKE_FITNESS"}, {FIT_SUB_SPORT_BMX, "BMX"},
+        {FIT_SUB_SPORT_CASUAL_WALKING, "CASUAL_WALKING"}, {FIT_SUB_SPORT_SPEED_WALKING, "SPEED_WALKING"},
+        {FIT_SUB_SPORT_BIKE_TO_RUN_TRANSITION, "BIKE_TO_RUN_TRANSITION"}, {FIT_SUB_SPORT_RUN_TO_BIKE_TRANSITION, "RUN_TO_BIKE_TRANSITION"},
+        {FIT_SUB_SPORT_SWIM_TO_BIKE_TRANSITION, "SWIM_TO_BIKE_TRANSITION"}, {FIT_SUB_SPORT_ATV, "ATV"},
+        {FIT_SUB_SPORT_MOTOCROSS, "MOTOCROSS"}, {FIT_SUB_SPORT_BACKCOUNTRY, "BACKCOUNTRY"},
+        {FIT_SUB_SPORT_RESORT, "RESORT"}, {FIT_SUB_SPORT_RC_DRONE, "RC_DRONE"},
+        {FIT_SUB_SPORT_WINGSUIT, "WINGSUIT"}, {FIT_SUB_SPORT_WHITEWATER, "WHITEWATER"},
+        {FIT_SUB_SPORT_SKATE_SKIING, "SKATE_SKIING"}, {FIT_SUB_SPORT_YOGA, "YOGA"},
+        {FIT_SUB_SPORT_PILATES, "PILATES"}, {FIT_SUB_SPORT_INDOOR_RUNNING, "INDOOR_RUNNING"},
+        {FIT_SUB_SPORT_GRAVEL_CYCLING, "GRAVEL_CYCLING"}, {FIT_SUB_SPORT_E_BIKE_MOUNTAIN, "E_BIKE_MOUNTAIN"},
+        {FIT_SUB_SPORT_COMMUTING, "COMMUTING"}, {FIT_SUB_SPORT_MIXED_SURFACE, "MIXED_SURFACE"},
+        {FIT_SUB_SPORT_NAVIGATE, "NAVIGATE"}, {FIT_SUB_SPORT_TRACK_ME, "TRACK_ME"},
+        {FIT_SUB_SPORT_MAP, "MAP"}, {FIT_SUB_SPORT_SINGLE_GAS_DIVING, "SINGLE_GAS_DIVING"},
+        {FIT_SUB_SPORT_MULTI_GAS_DIVING, "MULTI_GAS_DIVING"}, {FIT_SUB_SPORT_GAUGE_DIVING, "GAUGE_DIVING"},
+        {FIT_SUB_SPORT_APNEA_DIVING, "APNEA_DIVING"}, {FIT_SUB_SPORT_APNEA_HUNTING, "APNEA_HUNTING"},
+        {FIT_SUB_SPORT_VIRTUAL_ACTIVITY, "VIRTUAL_ACTIVITY"}, {FIT_SUB_SPORT_OBSTACLE, "OBSTACLE"},
+        {FIT_SUB_SPORT_ALL, "ALL"}, {FIT_SUB_SPORT_INVALID, "INVALID"},
+    };
+    static const FitEnumName sport_event_names[] = {
+        {FIT_SPORT_EVENT_UNCATEGORIZED, "UNCATEGORIZED"}, {FIT_SPORT_EVENT_GEOCACHING, "GEOCACHING"},
+        {FIT_SPORT_EVENT_FITNESS, "FITNESS"}, {FIT_SPORT_EVENT_RECREATION, "RECREATION"},
+        {FIT_SPORT_EVENT_RACE, "RACE"}, {FIT_SPORT_EVENT_SPECIAL_EVENT, "SPECIAL_EVENT"},
+        {FIT_SPORT_EVENT_TRAINING, "TRAINING"}, {FIT_SPORT_EVENT_TRANSPORTATION, "TRANSPORTATION"},
+        {FIT_SPORT_EVENT_TOURING, "TOURING"}, {FIT_SPORT_EVENT_INVALID, "INVALID"},
+    };
+    static const FitEnumName activity_names[] = {
+        {FIT_ACTIVITY_MANUAL, "MANUAL"}, {FIT_ACTIVITY_AUTO_MULTI_SPORT, "AUTO_MULTI_SPORT"},
+        {FIT_ACTIVITY_INVALID, "INVALID"},
+    };
+    static const FitEnumName intensity_names[] = {
+        {FIT_INTENSITY_ACTIVE, "ACTIVE"}, {FIT_INTENSITY_REST, "REST"},
+        {FIT_INTENSITY_WARMUP, "WARMUP"}, {FIT_INTENSITY_COOLDOWN, "COOLDOWN"},
+        {FIT_INTENSITY_RECOVERY, "RECOVERY"}, {FIT_INTENSITY_INTERVAL, "INTERVAL"},
+        {FIT_INTENSITY_OTHER, "OTHER"}, {FIT_INTENSITY_INVALID, "INVALID"},
+    };
+    static const FitEnumName session_trigger_names[] = {
+        {FIT_SESSION_TRIGGER_ACTIVITY_END, "ACTIVITY_END"}, {FIT_SESSION_TRIGGER_MANUAL, "MANUAL"},
+        {FIT_SESSION_TRIGGER_AUTO_MULTI_SPORT, "AUTO_MULTI_SPORT"}, {FIT_SESSION_TRIGGER_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"},
+        {FIT_SESSION_TRIGGER_INVALID, "INVALID"},
+    };
+    static const FitEnumName autolap_trigger_names[] = {
+        {FIT_AUTOLAP_TRIGGER_TIME, "TIME"}, {FIT_AUTOLAP_TRIGGER_DISTANCE, "DISTANCE"},
+        {FIT_AUTOLAP_TRIGGER_POSITION_START, "POSITION_START"}, {FIT_AUTOLAP_TRIGGER_POSITION_LAP, "POSITION_LAP"},
+        {FIT_AUTOLAP_TRIGGER_POSITION_WAYPOINT, "POSITION_WAYPOINT"}, {FIT_AUTOLAP_TRIGGER_POSITION_MARKED, "POSITION_MARKED"},
+        {FIT_AUTOLAP_TRIGGER_OFF, "OFF"}, {FIT_AUTOLAP_TRIGGER_INVALID, "INVALID"},
+    };
+    static const FitEnumName lap_trigger_names[] = {
+        {FIT_LAP_TRIGGER_MANUAL, "MANUAL"}, {FIT_LAP_TRIGGER_TIME, "TIME"},
+        {FIT_LAP_TRIGGER_DISTANCE, "DISTANCE"}, {FIT_LAP_TRIGGER_POSITION_START, "POSITION_START"},
+        {FIT_LAP_TRIGGER_POSITION_LAP, "POSITION_LAP"}, {FIT_LAP_TRIGGER_POSITION_WAYPOINT, "POSITION_WAYPOINT"},
+        {FIT_LAP_TRIGGER_POSITION_MARKED, "POSITION_MARKED"}, {FIT_LAP_TRIGGER_SESSION_END, "SESSION_END"},
+        {FIT_LAP_TRIGGER_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"}, {FIT_LAP_TRIGGER_INVALID, "INVALID"},
+    };
+    static const FitEnumName time_mode_names[] = {
+        {FIT_TIME_MODE_HOUR12, "HOUR12"}, {FIT_TIME_MODE_HOUR24, "HOUR24"},
+        {FIT_TIME_MODE_MILITARY, "MILITARY"}, {FIT_TIME_MODE_HOUR_12_WITH_SECONDS, "HOUR_12_WITH_SECONDS"},
+        {FIT_TIME_MODE_HOUR_24_WITH_SECONDS, "HOUR_24_WITH_SECONDS"}, {FIT_TIME_MODE_UTC, "UTC"},
+        {FIT_TIME_MODE_INVALID, "INVALID"},
+    };
+    static const FitEnumName backlight_mode_names[] = {
+        {FIT_BACKLIGHT_MODE_OFF, "OFF"}, {FIT_BACKLIGHT_MODE_MANUAL, "MANUAL"},
+        {FIT_BACKLIGHT_MODE_KEY_AND_MESSAGES, "KEY_AND_MESSAGES"}, {FIT_BACKLIGHT_MODE_AUTO_BRIGHTNESS, "AUTO_BRIGHTNESS"},
+        {FIT_BACKLIGHT_MODE_SMART_NOTIFICATIONS, "SMART_NOTIFICATIONS"}, {FIT_BACKLIGHT_MODE_KEY_AND_MESSAGES_NIGHT, "KEY_AND_MESSAGES_NIGHT"},
+        {FIT_BACKLIGHT_MODE_KEY_AND_MESSAGES_AND_SMART_NOTIFICATIONS, "KEY_AND_MESSAGES_AND_SMART_NOTIFICATIONS"}, {FIT_BACKLIGHT_MODE_INVALID, "INVALID"},
+    };
+    static const FitEnumName date_mode_names[] = {
+        {FIT_DATE_MODE_DAY_MONTH, "DAY_MONTH"}, {FIT_DATE_MODE_MONTH_DAY, "MONTH_DAY"},
+        {FIT_DATE_MODE_INVALID, "INVALID"},
+    };
+    static const FitEnumName event_names[] = {
+        {FIT_EVENT_TIMER, "TIMER"}, {FIT_EVENT_WORKOUT, "WORKOUT"},
+        {FIT_EVENT_WORKOUT_STEP, "WORKOUT_STEP"}, {FIT_EVENT_POWER_DOWN, "POWER_DOWN"},
+        {FIT_EVENT_POWER_UP, "POWER_UP"}, {FIT_EVENT_OFF_COURSE, "OFF_COURSE"},
+        {FIT_EVENT_SESSION, "SESSION"}, {FIT_EVENT_LAP, "LAP"},
+        {FIT_EVENT_COURSE_POINT, "COURSE_POINT"}, {FIT_EVENT_BATTERY, "BATTERY"},
+        {FIT_EVENT_VIRTUAL_PARTNER_PACE, "VIRTUAL_PARTNER_PACE"}, {FIT_EVENT_HR_HIGH_ALERT, "HR_HIGH_ALERT"},
+        {FIT_EVENT_HR_LOW_ALERT, "HR_LOW_ALERT"}, {FIT_EVENT_SPEED_HIGH_ALERT, "SPEED_HIGH_ALERT"},
+        {FIT_EVENT_SPEED_LOW_ALERT, "SPEED_LOW_ALERT"}, {FIT_EVENT_CAD_HIGH_ALERT, "CAD_HIGH_ALERT"},
+        {FIT_EVENT_CAD_LOW_ALERT, "CAD_LOW_ALERT"}, {FIT_EVENT_POWER_HIGH_ALERT, "POWER_HIGH_ALERT"},
+        {FIT_EVENT_POWER_LOW_ALERT, "POWER_LOW_ALERT"}, {FIT_EVENT_RECOVERY_HR, "RECOVERY_HR"},
+        {FIT_EVENT_BATTERY_LOW, "BATTERY_LOW"}, {FIT_EVENT_TIME_DURATION_ALERT, "TIME_DURATION_ALERT"},
+        {FIT_EVENT_DISTANCE_DURATION_ALERT, "DISTANCE_DURATION_ALERT"}, {FIT_EVENT_CALORIE_DURATION_ALERT, "CALORIE_DURATION_ALERT"},
+        {FIT_EVENT_ACTIVITY, "ACTIVITY"}, {FIT_EVENT_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"},
+        {FIT_EVENT_LENGTH, "LENGTH"}, {FIT_EVENT_USER_MARKER, "USER_MARKER"},
+        {FIT_EVENT_SPORT_POINT, "SPORT_POINT"}, {FIT_EVENT_CALIBRATION, "CALIBRATION"},
+        {FIT_EVENT_FRONT_GEAR_CHANGE, "FRONT_GEAR_CHANGE"}, {FIT_EVENT_REAR_GEAR_CHANGE, "REAR_GEAR_CHANGE"},
+        {FIT_EVENT_RIDER_POSITION_CHANGE, "RIDER_POSITION_CHANGE"}, {FIT_EVENT_ELEV_HIGH_ALERT, "ELEV_HIGH_ALERT"},
+        {FIT_EVENT_ELEV_LOW_ALERT, "ELEV_LOW_ALERT"}, {FIT_EVENT_COMM_TIMEOUT, "COMM_TIMEOUT"},
+        {FIT_EVENT_RADAR_THREAT_ALERT, "RADAR_THREAT_ALERT"}, {FIT_EVENT_INVALID, "INVALID"},
+    };
+    static const FitEnumName event_type_names[] = {
+        {FIT_EVENT_TYPE_START, "START"}, {FIT_EVENT_TYPE_STOP, "STOP"},
+        {FIT_EVENT_TYPE_CONSECUTIVE_DEPRECIATED, "CONSECUTIVE_DEPRECIATED"}, {FIT_EVENT_TYPE_MARKER, "MARKER"},
+        {FIT_EVENT_TYPE_STOP_ALL, "STOP_ALL"}, {FIT_EVENT_TYPE_BEGIN_DEPRECIATED, "BEGIN_DEPRECIATED"},
+        {FIT_EVENT_TYPE_END_DEPRECIATED, "END_DEPRECIATED"}, {FIT_EVENT_TYPE_END_ALL_DEPRECIATED, "END_ALL_DEPRECIATED"},
+        {FIT_EVENT_TYPE_STOP_DISABLE, "STOP_DISABLE"}, {FIT_EVENT_TYPE_STOP_DISABLE_ALL, "STOP_DISABLE_ALL"},
+        {FIT_EVENT_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName timer_trigger_names[] = {
+        {FIT_TIMER_TRIGGER_MANUAL, "MANUAL"}, {FIT_TIMER_TRIGGER_AUTO, "AUTO"},
+        {FIT_TIMER_TRIGGER_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"}, {FIT_TIMER_TRIGGER_INVALID, "INVALID"},
+    };
+    static const FitEnumName fitness_equipment_state_names[] = {
+        {FIT_FITNESS_EQUIPMENT_STATE_READY, "READY"}, {FIT_FITNESS_EQUIPMENT_STATE_IN_USE, "IN_USE"},
+        {FIT_FITNESS_EQUIPMENT_STATE_PAUSED, "PAUSED"}, {FIT_FITNESS_EQUIPMENT_STATE_UNKNOWN, "UNKNOWN"},
+        {FIT_FITNESS_EQUIPMENT_STATE_INVALID, "INVALID"},
+    };
+    static const FitEnumName tone_names[] = {
+        {FIT_TONE_OFF, "OFF"}, {FIT_TONE_TONE, "TONE"},
+        {FIT_TONE_VIBRATE, "VIBRATE"}, {FIT_TONE_TONE_AND_VIBRATE, "TONE_AND_VIBRATE"},
+        {FIT_TONE_INVALID, "INVALID"},
+    };
+    static const FitEnumName autoscroll_names[] = {
+        {FIT_AUTOSCROLL_NONE, "NONE"}, {FIT_AUTOSCROLL_SLOW, "SLOW"},
+        {FIT_AUTOSCROLL_MEDIUM, "MEDIUM"}, {FIT_AUTOSCROLL_FAST, "FAST"},
+        {FIT_AUTOSCROLL_INVALID, "INVALID"},
+    };
+    static const FitEnumName activity_class_names[] = {
+        {FIT_ACTIVITY_CLASS_LEVEL_MAX, "LEVEL_MAX"}, {FIT_ACTIVITY_CLASS_LEVEL, "LEVEL"},
+        {FIT_ACTIVITY_CLASS_ATHLETE, "ATHLETE"}, {FIT_ACTIVITY_CLASS_INVALID, "INVALID"},
+    };
+    static const FitEnumName hr_zone_calc_names[] = {
+        {FIT_HR_ZONE_CALC_CUSTOM, "CUSTOM"}, {FIT_HR_ZONE_CALC_PERCENT_MAX_HR, "PERCENT_MAX_HR"},
+        {FIT_HR_ZONE_CALC_PERCENT_HRR, "PERCENT_HRR"}, {FIT_HR_ZONE_CALC_INVALID, "INVALID"},
+    };
+    static const FitEnumName pwr_zone_calc_names[] = {
+        {FIT_PWR_ZONE_CALC_CUSTOM, "CUSTOM"}, {FIT_PWR_ZONE_CALC_PERCENT_FTP, "PERCENT_FTP"},
+        {FIT_PWR_ZONE_CALC_INVALID, "INVALID"},
+    };
+    static const FitEnumName wkt_step_duration_names[] = {
+        {FIT_WKT_STEP_DURATION_TIME, "TIME"}, {FIT_WKT_STEP_DURATION_DISTANCE, "DISTANCE"},
+        {FIT_WKT_STEP_DURATION_HR_LESS_THAN, "HR_LESS_THAN"}, {FIT_WKT_STEP_DURATION_HR_GREATER_THAN, "HR_GREATER_THAN"},
+        {FIT_WKT_STEP_DURATION_CALORIES, "CALORIES"}, {FIT_WKT_STEP_DURATION_OPEN, "OPEN"},
+        {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_STEPS_CMPLT, "REPEAT_UNTIL_STEPS_CMPLT"}, {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_TIME, "REPEAT_UNTIL_TIME"},
+        {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_DISTANCE, "REPEAT_UNTIL_DISTANCE"}, {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_CALORIES, "REPEAT_UNTIL_CALORIES"},
+        {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_HR_LESS_THAN, "REPEAT_UNTIL_HR_LESS_THAN"}, {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_HR_GREATER_THAN, "REPEAT_UNTIL_HR_GREATER_THAN"},
+        {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_POWER_LESS_THAN, "REPEAT_UNTIL_POWER_LESS_THAN"}, {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_POWER_GREATER_THAN, "REPEAT_UNTIL_POWER_GREATER_THAN"},
+        {FIT_WKT_STEP_DURATION_POWER_LESS_THAN, "POWER_LESS_THAN"}, {FIT_WKT_STEP_DURATION_POWER_GREATER_THAN, "POWER_GREATER_THAN"},
+        {FIT_WKT_STEP_DURATION_TRAINING_PEAKS_TSS, "TRAINING_PEAKS_TSS"}, {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_POWER_LAST_LAP_LESS_THAN, "REPEAT_UNTIL_POWER_LAST_LAP_LESS_THAN"},
+        {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_MAX_POWER_LAST_LAP_LESS_THAN, "REPEAT_UNTIL_MAX_POWER_LAST_LAP_LESS_THAN"}, {FIT_WKT_STEP_DURATION_POWER_3S_LESS_THAN, "POWER_3S_LESS_THAN"},
+        {FIT_WKT_STEP_DURATION_POWER_10S_LESS_THAN, "POWER_10S_LESS_THAN"}, {FIT_WKT_STEP_DURATION_POWER_30S_LESS_THAN, "POWER_30S_LESS_THAN"},
+        {FIT_WKT_STEP_DURATION_POWER_3S_GREATER_THAN, "POWER_3S_GREATER_THAN"}, {FIT_WKT_STEP_DURATION_POWER_10S_GREATER_THAN, "POWER_10S_GREATER_THAN"},
+        {FIT_WKT_STEP_DURATION_POWER_30S_GREATER_THAN, "POWER_30S_GREATER_THAN"}, {FIT_WKT_STEP_DURATION_POWER_LAP_LESS_THAN, "POWER_LAP_LESS_THAN"},
+        {FIT_WKT_STEP_DURATION_POWER_LAP_GREATER_THAN, "POWER_LAP_GREATER_THAN"}, {FIT_WKT_STEP_DURATION_REPEAT_UNTIL_TRAINING_PEAKS_TSS, "REPEAT_UNTIL_TRAINING_PEAKS_TSS"},
+        {FIT_WKT_STEP_DURATION_REPETITION_TIME, "REPETITION_TIME"}, {FIT_WKT_STEP_DURATION_REPS, "REPS"},
+        {FIT_WKT_STEP_DURATION_TIME_ONLY, "TIME_ONLY"}, {FIT_WKT_STEP_DURATION_INVALID, "INVALID"},
+    };
+    static const FitEnumName wkt_step_target_names[] = {
+        {FIT_WKT_STEP_TARGET_SPEED, "SPEED"}, {FIT_WKT_STEP_TARGET_HEART_RATE, "HEART_RATE"},
+        {FIT_WKT_STEP_TARGET_OPEN, "OPEN"}, {FIT_WKT_STEP_TARGET_CADENCE, "CADENCE"},
+        {FIT_WKT_STEP_TARGET_POWER, "POWER"}, {FIT_WKT_STEP_TARGET_GRADE, "GRADE"},
+        {FIT_WKT_STEP_TARGET_RESISTANCE, "RESISTANCE"}, {FIT_WKT_STEP_TARGET_POWER_3S, "POWER_3S"},
+        {FIT_WKT_STEP_TARGET_POWER_10S, "POWER_10S"}, {FIT_WKT_STEP_TARGET_POWER_30S, "POWER_30S"},
+        {FIT_WKT_STEP_TARGET_POWER_LAP, "POWER_LAP"}, {FIT_WKT_STEP_TARGET_SWIM_STROKE, "SWIM_STROKE"},
+        {FIT_WKT_STEP_TARGET_SPEED_LAP, "SPEED_LAP"}, {FIT_WKT_STEP_TARGET_HEART_RATE_LAP, "HEART_RATE_LAP"},
+        {FIT_WKT_STEP_TARGET_INVALID, "INVALID"},
+    };
+    static const FitEnumName goal_names[] = {
+        {FIT_GOAL_TIME, "TIME"}, {FIT_GOAL_DISTANCE, "DISTANCE"},
+        {FIT_GOAL_CALORIES, "CALORIES"}, {FIT_GOAL_FREQUENCY, "FREQUENCY"},
+        {FIT_GOAL_STEPS, "STEPS"}, {FIT_GOAL_ASCENT, "ASCENT"},
+        {FIT_GOAL_ACTIVE_MINUTES, "ACTIVE_MINUTES"}, {FIT_GOAL_INVALID, "INVALID"},
+    };
+    static const FitEnumName goal_recurrence_names[] = {
+        {FIT_GOAL_RECURRENCE_OFF, "OFF"}, {FIT_GOAL_RECURRENCE_DAILY, "DAILY"},
+        {FIT_GOAL_RECURRENCE_WEEKLY, "WEEKLY"}, {FIT_GOAL_RECURRENCE_MONTHLY, "MONTHLY"},
+        {FIT_GOAL_RECURRENCE_YEARLY, "YEARLY"}, {FIT_GOAL_RECURRENCE_CUSTOM, "CUSTOM"},
+        {FIT_GOAL_RECURRENCE_INVALID, "INVALID"},
+    };
+    static const FitEnumName goal_source_names[] = {
+        {FIT_GOAL_SOURCE_AUTO, "AUTO"}, {FIT_GOAL_SOURCE_COMMUNITY, "COMMUNITY"},
+        {FIT_GOAL_SOURCE_USER, "USER"}, {FIT_GOAL_SOURCE_INVALID, "INVALID"},
+    };
+    static const FitEnumName schedule_names[] = {
+        {FIT_SCHEDULE_WORKOUT, "WORKOUT"}, {FIT_SCHEDULE_COURSE, "COURSE"},
+        {FIT_SCHEDULE_INVALID, "INVALID"},
+    };
+    static const FitEnumName course_point_names[] = {
+        {FIT_COURSE_POINT_GENERIC, "GENERIC"}, {FIT_COURSE_POINT_SUMMIT, "SUMMIT"},
+        {FIT_COURSE_POINT_VALLEY, "VALLEY"}, {FIT_COURSE_POINT_WATER, "WATER"},
+        {FIT_COURSE_POINT_FOOD, "FOOD"}, {FIT_COURSE_POINT_DANGER, "DANGER"},
+        {FIT_COURSE_POINT_LEFT, "LEFT"}, {FIT_COURSE_POINT_RIGHT, "RIGHT"},
+        {FIT_COURSE_POINT_STRAIGHT, "STRAIGHT"}, {FIT_COURSE_POINT_FIRST_AID, "FIRST_AID"},
+        {FIT_COURSE_POINT_FOURTH_CATEGORY, "FOURTH_CATEGORY"}, {FIT_COURSE_POINT_THIRD_CATEGORY, "THIRD_CATEGORY"},
+        {FIT_COURSE_POINT_SECOND_CATEGORY, "SECOND_CATEGORY"}, {FIT_COURSE_POINT_FIRST_CATEGORY, "FIRST_CATEGORY"},
+        {FIT_COURSE_POINT_HORS_CATEGORY, "HORS_CATEGORY"}, {FIT_COURSE_POINT_SPRINT, "SPRINT"},
+        {FIT_COURSE_POINT_LEFT_FORK, "LEFT_FORK"}, {FIT_COURSE_POINT_RIGHT_FORK, "RIGHT_FORK"},
+        {FIT_COURSE_POINT_MIDDLE_FORK, "MIDDLE_FORK"}, {FIT_COURSE_POINT_SLIGHT_LEFT, "SLIGHT_LEFT"},
+        {FIT_COURSE_POINT_SHARP_LEFT, "SHARP_LEFT"}, {FIT_COURSE_POINT_SLIGHT_RIGHT, "SLIGHT_RIGHT"},
+        {FIT_COURSE_POINT_SHARP_RIGHT, "SHARP_RIGHT"}, {FIT_COURSE_POINT_U_TURN, "U_TURN"},
+        {FIT_COURSE_POINT_SEGMENT_START, "SEGMENT_START"}, {FIT_COURSE_POINT_SEGMENT_END, "SEGMENT_END"},
+        {FIT_COURSE_POINT_INVALID, "INVALID"},
+    };
+    static const FitEnumName manufacturer_names[] = {
+        {FIT_MANUFACTURER_GARMIN, "GARMIN"}, {FIT_MANUFACTURER_GARMIN_FR405_ANTFS, "GARMIN_FR405_ANTFS"},
+        {FIT_MANUFACTURER_ZEPHYR, "ZEPHYR"}, {FIT_MANUFACTURER_DAYTON, "DAYTON"},
+        {FIT_MANUFACTURER_IDT, "IDT"}, {FIT_MANUFACTURER_SRM, "SRM"},
+        {FIT_MANUFACTURER_QUARQ, "QUARQ"}, {FIT_MANUFACTURER_IBIKE, "IBIKE"},
+        {FIT_MANUFACTURER_SARIS, "SARIS"}, {FIT_MANUFACTURER_SPARK_HK, "SPARK_HK"},
+        {FIT_MANUFACTURER_TANITA, "TANITA"}, {FIT_MANUFACTURER_ECHOWELL, "ECHOWELL"},
+        {FIT_MANUFACTURER_DYNASTREAM_OEM, "DYNASTREAM_OEM"}, {FIT_MANUFACTURER_NAUTILUS, "NAUTILUS"},
+        {FIT_MANUFACTURER_DYNASTREAM, "DYNASTREAM"}, {FIT_MANUFACTURER_TIMEX, "TIMEX"},
+        {FIT_MANUFACTURER_METRIGEAR, "METRIGEAR"}, {FIT_MANUFACTURER_XELIC, "XELIC"},
+        {FIT_MANUFACTURER_BEURER, "BEURER"}, {FIT_MANUFACTURER_CARDIOSPORT, "CARDIOSPORT"},
+        {FIT_MANUFACTURER_A_AND_D, "A_AND_D"}, {FIT_MANUFACTURER_HMM, "HMM"},
+        {FIT_MANUFACTURER_SUUNTO, "SUUNTO"}, {FIT_MANUFACTURER_THITA_ELEKTRONIK, "THITA_ELEKTRONIK"},
+        {FIT_MANUFACTURER_GPULSE, "GPULSE"}, {FIT_MANUFACTURER_CLEAN_MOBILE, "CLEAN_MOBILE"},
+        {FIT_MANUFACTURER_PEDAL_BRAIN, "PEDAL_BRAIN"}, {FIT_MANUFACTURER_PEAKSWARE, "PEAKSWARE"},
+        {FIT_MANUFACTURER_SAXONAR, "SAXONAR"}, {FIT_MANUFACTURER_LEMOND_FITNESS, "LEMOND_FITNESS"},
+        {FIT_MANUFACTURER_DEXCOM, "DEXCOM"}, {FIT_MANUFACTURER_WAHOO_FITNESS, "WAHOO_FITNESS"},
+        {FIT_MANUFACTURER_OCTANE_FITNESS, "OCTANE_FITNESS"}, {FIT_MANUFACTURER_ARCHINOETICS, "ARCHINOETICS"},
+        {FIT_MANUFACTURER_THE_HURT_BOX, "THE_HURT_BOX"}, {FIT_MANUFACTURER_CITIZEN_SYSTEMS, "CITIZEN_SYSTEMS"},
+        {FIT_MANUFACTURER_MAGELLAN, "MAGELLAN"}, {FIT_MANUFACTURER_OSYNCE, "OSYNCE"},
+        {FIT_MANUFACTURER_HOLUX, "HOLUX"}, {FIT_MANUFACTURER_CONCEPT2, "CONCEPT2"},
+        {FIT_MANUFACTURER_ONE_GIANT_LEAP, "ONE_GIANT_LEAP"}, {FIT_MANUFACTURER_ACE_SENSOR, "ACE_SENSOR"},
+        {FIT_MANUFACTURER_BRIM_BROTHERS, "BRIM_BROTHERS"}, {FIT_MANUFACTURER_XPLOVA, "XPLOVA"},
+        {FIT_MANUFACTURER_PERCEPTION_DIGITAL, "PERCEPTION_DIGITAL"}, {FIT_MANUFACTURER_BF1SYSTEMS, "BF1SYSTEMS"},
+        {FIT_MANUFACTURER_PIONEER, "PIONEER"}, {FIT_MANUFACTURER_SPANTEC, "SPANTEC"},
+        {FIT_MANUFACTURER_METALOGICS, "METALOGICS"}, {FIT_MANUFACTURER_4IIIIS, "4IIIIS"},
+        {FIT_MANUFACTURER_SEIKO_EPSON, "SEIKO_EPSON"}, {FIT_MANUFACTURER_SEIKO_EPSON_OEM, "SEIKO_EPSON_OEM"},
+        {FIT_MANUFACTURER_IFOR_POWELL, "IFOR_POWELL"}, {FIT_MANUFACTURER_MAXWELL_GUIDER, "MAXWELL_GUIDER"},
+        {FIT_MANUFACTURER_STAR_TRAC, "STAR_TRAC"}, {FIT_MANUFACTURER_BREAKAWAY, "BREAKAWAY"},
+        {FIT_MANUFACTURER_ALATECH_TECHNOLOGY_LTD, "ALATECH_TECHNOLOGY_LTD"}, {FIT_MANUFACTURER_MIO_TECHNOLOGY_EUROPE, "MIO_TECHNOLOGY_EUROPE"},
+        {FIT_MANUFACTURER_ROTOR, "ROTOR"}, {FIT_MANUFACTURER_GEONAUTE, "GEONAUTE"},
+        {FIT_MANUFACTURER_ID_BIKE, "ID_BIKE"}, {FIT_MANUFACTURER_SPECIALIZED, "SPECIALIZED"},
+        {FIT_MANUFACTURER_WTEK, "WTEK"}, {FIT_MANUFACTURER_PHYSICAL_ENTERPRISES, "PHYSICAL_ENTERPRISES"},
+        {FIT_MANUFACTURER_NORTH_POLE_ENGINEERING, "NORTH_POLE_ENGINEERING"}, {FIT_MANUFACTURER_BKOOL, "BKOOL"},
+        {FIT_MANUFACTURER_CATEYE, "CATEYE"}, {FIT_MANUFACTURER_STAGES_CYCLING, "STAGES_CYCLING"},
+        {FIT_MANUFACTURER_SIGMASPORT, "SIGMASPORT"}, {FIT_MANUFACTURER_TOMTOM, "TOMTOM"},
+        {FIT_MANUFACTURER_PERIPEDAL, "PERIPEDAL"}, {FIT_MANUFACTURER_WATTBIKE, "WATTBIKE"},
+        {FIT_MANUFACTURER_MOXY, "MOXY"}, {FIT_MANUFACTURER_CICLOSPORT, "CICLOSPORT"},
+        {FIT_MANUFACTURER_POWERBAHN, "POWERBAHN"}, {FIT_MANUFACTURER_ACORN_PROJECTS_APS, "ACORN_PROJECTS_APS"},
+        {FIT_MANUFACTURER_LIFEBEAM, "LIFEBEAM"}, {FIT_MANUFACTURER_BONTRAGER, "BONTRAGER"},
+        {FIT_MANUFACTURER_WELLGO, "WELLGO"}, {FIT_MANUFACTURER_SCOSCHE, "SCOSCHE"},
+        {FIT_MANUFACTURER_MAGURA, "MAGURA"}, {FIT_MANUFACTURER_WOODWAY, "WOODWAY"},
+        {FIT_MANUFACTURER_ELITE, "ELITE"}, {FIT_MANUFACTURER_NIELSEN_KELLERMAN, "NIELSEN_KELLERMAN"},
+        {FIT_MANUFACTURER_DK_CITY, "DK_CITY"}, {FIT_MANUFACTURER_TACX, "TACX"},
+        {FIT_MANUFACTURER_DIRECTION_TECHNOLOGY, "DIRECTION_TECHNOLOGY"}, {FIT_MANUFACTURER_MAGTONIC, "MAGTONIC"},
+        {FIT_MANUFACTURER_1PARTCARBON, "1PARTCARBON"}, {FIT_MANUFACTURER_INSIDE_RIDE_TECHNOLOGIES, "INSIDE_RIDE_TECHNOLOGIES"},
+        {FIT_MANUFACTURER_SOUND_OF_MOTION, "SOUND_OF_MOTION"}, {FIT_MANUFACTURER_STRYD, "STRYD"},
+        {FIT_MANUFACTURER_ICG, "ICG"}, {FIT_MANUFACTURER_MIPULSE, "MIPULSE"},
+        {FIT_MANUFACTURER_BSX_ATHLETICS, "BSX_ATHLETICS"}, {FIT_MANUFACTURER_LOOK, "LOOK"},
+        {FIT_MANUFACTURER_CAMPAGNOLO_SRL, "CAMPAGNOLO_SRL"}, {FIT_MANUFACTURER_BODY_BIKE_SMART, "BODY_BIKE_SMART"},
+        {FIT_MANUFACTURER_PRAXISWORKS, "PRAXISWORKS"}, {FIT_MANUFACTURER_LIMITS_TECHNOLOGY, "LIMITS_TECHNOLOGY"},
+        {FIT_MANUFACTURER_TOPACTION_TECHNOLOGY, "TOPACTION_TECHNOLOGY"}, {FIT_MANUFACTURER_COSINUSS, "COSINUSS"},
+        {FIT_MANUFACTURER_FITCARE, "FITCARE"}, {FIT_MANUFACTURER_MAGENE, "MAGENE"},
+        {FIT_MANUFACTURER_GIANT_MANUFACTURING_CO, "GIANT_MANUFACTURING_CO"}, {FIT_MANUFACTURER_TIGRASPORT, "TIGRASPORT"},
+        {FIT_MANUFACTURER_SALUTRON, "SALUTRON"}, {FIT_MANUFACTURER_TECHNOGYM, "TECHNOGYM"},
+        {FIT_MANUFACTURER_BRYTON_SENSORS, "BRYTON_SENSORS"}, {FIT_MANUFACTURER_LATITUDE_LIMITED, "LATITUDE_LIMITED"},
+        {FIT_MANUFACTURER_SOARING_TECHNOLOGY, "SOARING_TECHNOLOGY"}, {FIT_MANUFACTURER_IGPSPORT, "IGPSPORT"},
+        {FIT_MANUFACTURER_THINKRIDER, "THINKRIDER"}, {FIT_MANUFACTURER_GOPHER_SPORT, "GOPHER_SPORT"},
+        {FIT_MANUFACTURER_WATERROWER, "WATERROWER"}, {FIT_MANUFACTURER_ORANGETHEORY, "ORANGETHEORY"},
+        {FIT_MANUFACTURER_INPEAK, "INPEAK"}, {FIT_MANUFACTURER_KINETIC, "KINETIC"},
+        {FIT_MANUFACTURER_JOHNSON_HEALTH_TECH, "JOHNSON_HEALTH_TECH"}, {FIT_MANUFACTURER_POLAR_ELECTRO, "POLAR_ELECTRO"},
+        {FIT_MANUFACTURER_SEESENSE, "SEESENSE"}, {FIT_MANUFACTURER_NCI_TECHNOLOGY, "NCI_TECHNOLOGY"},
+        {FIT_MANUFACTURER_IQSQUARE, "IQSQUARE"}, {FIT_MANUFACTURER_LEOMO, "LEOMO"},
+        {FIT_MANUFACTURER_IFIT_COM, "IFIT_COM"}, {FIT_MANUFACTURER_COROS_BYTE, "COROS_BYTE"},
+        {FIT_MANUFACTURER_VERSA_DESIGN, "VERSA_DESIGN"}, {FIT_MANUFACTURER_CHILEAF, "CHILEAF"},
+        {FIT_MANUFACTURER_CYCPLUS, "CYCPLUS"}, {FIT_MANUFACTURER_GRAVAA_BYTE, "GRAVAA_BYTE"},
+        {FIT_MANUFACTURER_SIGEYI, "SIGEYI"}, {FIT_MANUFACTURER_DEVELOPMENT, "DEVELOPMENT"},
+        {FIT_MANUFACTURER_HEALTHANDLIFE, "HEALTHANDLIFE"}, {FIT_MANUFACTURER_LEZYNE, "LEZYNE"},
+        {FIT_MANUFACTURER_SCRIBE_LABS, "SCRIBE_LABS"}, {FIT_MANUFACTURER_ZWIFT, "ZWIFT"},
+        {FIT_MANUFACTURER_WATTEAM, "WATTEAM"}, {FIT_MANUFACTURER_RECON, "RECON"},
+        {FIT_MANUFACTURER_FAVERO_ELECTRONICS, "FAVERO_ELECTRONICS"}, {FIT_MANUFACTURER_DYNOVELO, "DYNOVELO"},
+        {FIT_MANUFACTURER_STRAVA, "STRAVA"}, {FIT_MANUFACTURER_PRECOR, "PRECOR"},
+        {FIT_MANUFACTURER_BRYTON, "BRYTON"}, {FIT_MANUFACTURER_SRAM, "SRAM"},
+        {FIT_MANUFACTURER_NAVMAN, "NAVMAN"}, {FIT_MANUFACTURER_COBI, "COBI"},
+        {FIT_MANUFACTURER_SPIVI, "SPIVI"}, {FIT_MANUFACTURER_MIO_MAGELLAN, "MIO_MAGELLAN"},
+        {FIT_MANUFACTURER_EVESPORTS, "EVESPORTS"}, {FIT_MANUFACTURER_SENSITIVUS_GAUGE, "SENSITIVUS_GAUGE"},
+        {FIT_MANUFACTURER_PODOON, "PODOON"}, {FIT_MANUFACTURER_LIFE_TIME_FITNESS, "LIFE_TIME_FITNESS"},
+        {FIT_MANUFACTURER_FALCO_E_MOTORS, "FALCO_E_MOTORS"}, {FIT_MANUFACTURER_MINOURA, "MINOURA"},
+        {FIT_MANUFACTURER_CYCLIQ, "CYCLIQ"}, {FIT_MANUFACTURER_LUXOTTICA, "LUXOTTICA"},
+        {FIT_MANUFACTURER_TRAINER_ROAD, "TRAINER_ROAD"}, {FIT_MANUFACTURER_THE_SUFFERFEST, "THE_SUFFERFEST"},
+        {FIT_MANUFACTURER_FULLSPEEDAHEAD, "FULLSPEEDAHEAD"}, {FIT_MANUFACTURER_VIRTUALTRAINING, "VIRTUALTRAINING"},
+        {FIT_MANUFACTURER_FEEDBACKSPORTS, "FEEDBACKSPORTS"}, {FIT_MANUFACTURER_OMATA, "OMATA"},
+        {FIT_MANUFACTURER_VDO, "VDO"}, {FIT_MANUFACTURER_MAGNETICDAYS, "MAGNETICDAYS"},
+        {FIT_MANUFACTURER_HAMMERHEAD, "HAMMERHEAD"}, {FIT_MANUFACTURER_KINETIC_BY_KURT, "KINETIC_BY_KURT"},
+        {FIT_MANUFACTURER_SHAPELOG, "SHAPELOG"}, {FIT_MANUFACTURER_DABUZIDUO, "DABUZIDUO"},
+        {FIT_MANUFACTURER_JETBLACK, "JETBLACK"}, {FIT_MANUFACTURER_COROS, "COROS"},
+        {FIT_MANUFACTURER_VIRTUGO, "VIRTUGO"}, {FIT_MANUFACTURER_VELOSENSE, "VELOSENSE"},
+        {FIT_MANUFACTURER_CYCLIGENTINC, "CYCLIGENTINC"}, {FIT_MANUFACTURER_TRAILFORKS, "TRAILFORKS"},
+        {FIT_MANUFACTURER_MAHLE_EBIKEMOTION, "MAHLE_EBIKEMOTION"}, {FIT_MANUFACTURER_NURVV, "NURVV"},
+        {FIT_MANUFACTURER_MICROPROGRAM, "MICROPROGRAM"}, {FIT_MANUFACTURER_ZONE5CLOUD, "ZONE5CLOUD"},
+        {FIT_MANUFACTURER_GREENTEG, "GREENTEG"}, {FIT_MANUFACTURER_YAMAHA_MOTORS, "YAMAHA_MOTORS"},
+        {FIT_MANUFACTURER_WHOOP, "WHOOP"}, {FIT_MANUFACTURER_GRAVAA, "GRAVAA"},
+        {FIT_MANUFACTURER_ONELAP, "ONELAP"}, {FIT_MANUFACTURER_MONARK_EXERCISE, "MONARK_EXERCISE"},
+        {FIT_MANUFACTURER_FORM, "FORM"}, {FIT_MANUFACTURER_DECATHLON, "DECATHLON"},
+        {FIT_MANUFACTURER_ACTIGRAPHCORP, "ACTIGRAPHCORP"}, {FIT_MANUFACTURER_INVALID, "INVALID"},
+    };
+    static const FitEnumName garmin_product_names[] = {
+        {FIT_GARMIN_PRODUCT_HRM1, "HRM1"}, {FIT_GARMIN_PRODUCT_AXH01, "AXH01"},
+        {FIT_GARMIN_PRODUCT_AXB01, "AXB01"}, {FIT_GARMIN_PRODUCT_AXB02, "AXB02"},
+        {FIT_GARMIN_PRODUCT_HRM2SS, "HRM2SS"}, {FIT_GARMIN_PRODUCT_DSI_ALF02, "DSI_ALF02"},
+        {FIT_GARMIN_PRODUCT_HRM3SS, "HRM3SS"}, {FIT_GARMIN_PRODUCT_HRM_RUN_SINGLE_BYTE_PRODUCT_ID, "HRM_RUN_SINGLE_BYTE_PRODUCT_ID"},
+        {FIT_GARMIN_PRODUCT_BSM, "BSM"}, {FIT_GARMIN_PRODUCT_BCM, "BCM"},
+        {FIT_GARMIN_PRODUCT_AXS01, "AXS01"}, {FIT_GARMIN_PRODUCT_HRM_TRI_SINGLE_BYTE_PRODUCT_ID, "HRM_TRI_SINGLE_BYTE_PRODUCT_ID"},
+        {FIT_GARMIN_PRODUCT_HRM4_RUN_SINGLE_BYTE_PRODUCT_ID, "HRM4_RUN_SINGLE_BYTE_PRODUCT_ID"}, {FIT_GARMIN_PRODUCT_FR225_SINGLE_BYTE_PRODUCT_ID, "FR225_SINGLE_BYTE_PRODUCT_ID"},
+        {FIT_GARMIN_PRODUCT_GEN3_BSM_SINGLE_BYTE_PRODUCT_ID, "GEN3_BSM_SINGLE_BYTE_PRODUCT_ID"}, {FIT_GARMIN_PRODUCT_GEN3_BCM_SINGLE_BYTE_PRODUCT_ID, "GEN3_BCM_SINGLE_BYTE_PRODUCT_ID"},
+        {FIT_GARMIN_PRODUCT_FR301_CHINA, "FR301_CHINA"}, {FIT_GARMIN_PRODUCT_FR301_JAPAN, "FR301_JAPAN"},
+        {FIT_GARMIN_PRODUCT_FR301_KOREA, "FR301_KOREA"}, {FIT_GARMIN_PRODUCT_FR301_TAIWAN, "FR301_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_FR405, "FR405"}, {FIT_GARMIN_PRODUCT_FR50, "FR50"},
+        {FIT_GARMIN_PRODUCT_FR405_JAPAN, "FR405_JAPAN"}, {FIT_GARMIN_PRODUCT_FR60, "FR60"},
+        {FIT_GARMIN_PRODUCT_DSI_ALF01, "DSI_ALF01"}, {FIT_GARMIN_PRODUCT_FR310XT, "FR310XT"},
+        {FIT_GARMIN_PRODUCT_EDGE500, "EDGE500"}, {FIT_GARMIN_PRODUCT_FR110, "FR110"},
+        {FIT_GARMIN_PRODUCT_EDGE800, "EDGE800"}, {FIT_GARMIN_PRODUCT_EDGE500_TAIWAN, "EDGE500_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_EDGE500_JAPAN, "EDGE500_JAPAN"}, {FIT_GARMIN_PRODUCT_CHIRP, "CHIRP"},
+        {FIT_GARMIN_PRODUCT_FR110_JAPAN, "FR110_JAPAN"}, {FIT_GARMIN_PRODUCT_EDGE200, "EDGE200"},
+        {FIT_GARMIN_PRODUCT_FR910XT, "FR910XT"}, {FIT_GARMIN_PRODUCT_EDGE800_TAIWAN, "EDGE800_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_EDGE800_JAPAN, "EDGE800_JAPAN"}, {FIT_GARMIN_PRODUCT_ALF04, "ALF04"},
+        {FIT_GARMIN_PRODUCT_FR610, "FR610"}, {FIT_GARMIN_PRODUCT_FR210_JAPAN, "FR210_JAPAN"},
+        {FIT_GARMIN_PRODUCT_VECTOR_SS, "VECTOR_SS"}, {FIT_GARMIN_PRODUCT_VECTOR_CP, "VECTOR_CP"},
+        {FIT_GARMIN_PRODUCT_EDGE800_CHINA, "EDGE800_CHINA"}, {FIT_GARMIN_PRODUCT_EDGE500_CHINA, "EDGE500_CHINA"},
+        {FIT_GARMIN_PRODUCT_APPROACH_G10, "APPROACH_G10"}, {FIT_GARMIN_PRODUCT_FR610_JAPAN, "FR610_JAPAN"},
+        {FIT_GARMIN_PRODUCT_EDGE500_KOREA, "EDGE500_KOREA"}, {FIT_GARMIN_PRODUCT_FR70, "FR70"},
+        {FIT_GARMIN_PRODUCT_FR310XT_4T, "FR310XT_4T"}, {FIT_GARMIN_PRODUCT_AMX, "AMX"},
+        {FIT_GARMIN_PRODUCT_FR10, "FR10"}, {FIT_GARMIN_PRODUCT_EDGE800_KOREA, "EDGE800_KOREA"},
+        {FIT_GARMIN_PRODUCT_SWIM, "SWIM"}, {FIT_GARMIN_PRODUCT_FR910XT_CHINA, "FR910XT_CHINA"},
+        {FIT_GARMIN_PRODUCT_FENIX, "FENIX"}, {FIT_GARMIN_PRODUCT_EDGE200_TAIWAN, "EDGE200_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_EDGE510, "EDGE510"}, {FIT_GARMIN_PRODUCT_EDGE810, "EDGE810"},
+        {FIT_GARMIN_PRODUCT_TEMPE, "TEMPE"}, {FIT_GARMIN_PRODUCT_FR910XT_JAPAN, "FR910XT_JAPAN"},
+        {FIT_GARMIN_PRODUCT_FR620, "FR620"}, {FIT_GARMIN_PRODUCT_FR220, "FR220"},
+        {FIT_GARMIN_PRODUCT_FR910XT_KOREA, "FR910XT_KOREA"}, {FIT_GARMIN_PRODUCT_FR10_JAPAN, "FR10_JAPAN"},
+        {FIT_GARMIN_PRODUCT_EDGE810_JAPAN, "EDGE810_JAPAN"}, {FIT_GARMIN_PRODUCT_VIRB_ELITE, "VIRB_ELITE"},
+        {FIT_GARMIN_PRODUCT_EDGE_TOURING, "EDGE_TOURING"}, {FIT_GARMIN_PRODUCT_EDGE510_JAPAN, "EDGE510_JAPAN"},
+        {FIT_GARMIN_PRODUCT_HRM_TRI, "HRM_TRI"}, {FIT_GARMIN_PRODUCT_HRM_RUN, "HRM_RUN"},
+        {FIT_GARMIN_PRODUCT_FR920XT, "FR920XT"}, {FIT_GARMIN_PRODUCT_EDGE510_ASIA, "EDGE510_ASIA"},
+        {FIT_GARMIN_PRODUCT_EDGE810_CHINA, "EDGE810_CHINA"}, {FIT_GARMIN_PRODUCT_EDGE810_TAIWAN, "EDGE810_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_EDGE1000, "EDGE1000"}, {FIT_GARMIN_PRODUCT_VIVO_FIT, "VIVO_FIT"},
+        {FIT_GARMIN_PRODUCT_VIRB_REMOTE, "VIRB_REMOTE"}, {FIT_GARMIN_PRODUCT_VIVO_KI, "VIVO_KI"},
+        {FIT_GARMIN_PRODUCT_FR15, "FR15"}, {FIT_GARMIN_PRODUCT_VIVO_ACTIVE, "VIVO_ACTIVE"},
+        {FIT_GARMIN_PRODUCT_EDGE510_KOREA, "EDGE510_KOREA"}, {FIT_GARMIN_PRODUCT_FR620_JAPAN, "FR620_JAPAN"},
+        {FIT_GARMIN_PRODUCT_FR620_CHINA, "FR620_CHINA"}, {FIT_GARMIN_PRODUCT_FR220_JAPAN, "FR220_JAPAN"},
+        {FIT_GARMIN_PRODUCT_FR220_CHINA, "FR220_CHINA"}, {FIT_GARMIN_PRODUCT_APPROACH_S6, "APPROACH_S6"},
+        {FIT_GARMIN_PRODUCT_VIVO_SMART, "VIVO_SMART"}, {FIT_GARMIN_PRODUCT_FENIX2, "FENIX2"},
+        {FIT_GARMIN_PRODUCT_EPIX, "EPIX"}, {FIT_GARMIN_PRODUCT_FENIX3, "FENIX3"},
+        {FIT_GARMIN_PRODUCT_EDGE1000_TAIWAN, "EDGE1000_TAIWAN"}, {FIT_GARMIN_PRODUCT_EDGE1000_JAPAN, "EDGE1000_JAPAN"},
+        {FIT_GARMIN_PRODUCT_FR15_JAPAN, "FR15_JAPAN"}, {FIT_GARMIN_PRODUCT_EDGE520, "EDGE520"},
+        {FIT_GARMIN_PRODUCT_EDGE1000_CHINA, "EDGE1000_CHINA"}, {FIT_GARMIN_PRODUCT_FR620_RUSSIA, "FR620_RUSSIA"},
+        {FIT_GARMIN_PRODUCT_FR220_RUSSIA, "FR220_RUSSIA"}, {FIT_GARMIN_PRODUCT_VECTOR_S, "VECTOR_S"},
+        {FIT_GARMIN_PRODUCT_EDGE1000_KOREA, "EDGE1000_KOREA"}, {FIT_GARMIN_PRODUCT_FR920XT_TAIWAN, "FR920XT_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_FR920XT_CHINA, "FR920XT_CHINA"}, {FIT_GARMIN_PRODUCT_FR920XT_JAPAN, "FR920XT_JAPAN"},
+        {FIT_GARMIN_PRODUCT_VIRBX, "VIRBX"}, {FIT_GARMIN_PRODUCT_VIVO_SMART_APAC, "VIVO_SMART_APAC"},
+        {FIT_GARMIN_PRODUCT_ETREX_TOUCH, "ETREX_TOUCH"}, {FIT_GARMIN_PRODUCT_EDGE25, "EDGE25"},
+        {FIT_GARMIN_PRODUCT_FR25, "FR25"}, {FIT_GARMIN_PRODUCT_VIVO_FIT2, "VIVO_FIT2"},
+        {FIT_GARMIN_PRODUCT_FR225, "FR225"}, {FIT_GARMIN_PRODUCT_FR630, "FR630"},
+        {FIT_GARMIN_PRODUCT_FR230, "FR230"}, {FIT_GARMIN_PRODUCT_FR735XT, "FR735XT"},
+        {FIT_GARMIN_PRODUCT_VIVO_ACTIVE_APAC, "VIVO_ACTIVE_APAC"}, {FIT_GARMIN_PRODUCT_VECTOR_2, "VECTOR_2"},
+        {FIT_GARMIN_PRODUCT_VECTOR_2S, "VECTOR_2S"}, {FIT_GARMIN_PRODUCT_VIRBXE, "VIRBXE"},
+        {FIT_GARMIN_PRODUCT_FR620_TAIWAN, "FR620_TAIWAN"}, {FIT_GARMIN_PRODUCT_FR220_TAIWAN, "FR220_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_TRUSWING, "TRUSWING"}, {FIT_GARMIN_PRODUCT_D2AIRVENU, "D2AIRVENU"},
+        {FIT_GARMIN_PRODUCT_FENIX3_CHINA, "FENIX3_CHINA"}, {FIT_GARMIN_PRODUCT_FENIX3_TWN, "FENIX3_TWN"},
+        {FIT_GARMIN_PRODUCT_VARIA_HEADLIGHT, "VARIA_HEADLIGHT"}, {FIT_GARMIN_PRODUCT_VARIA_TAILLIGHT_OLD, "VARIA_TAILLIGHT_OLD"},
+        {FIT_GARMIN_PRODUCT_EDGE_EXPLORE_1000, "EDGE_EXPLORE_1000"}, {FIT_GARMIN_PRODUCT_FR225_ASIA, "FR225_ASIA"},
+        {FIT_GARMIN_PRODUCT_VARIA_RADAR_TAILLIGHT, "VARIA_RADAR_TAILLIGHT"}, {FIT_GARMIN_PRODUCT_VARIA_RADAR_DISPLAY, "VARIA_RADAR_DISPLAY"},
+        {FIT_GARMIN_PRODUCT_EDGE20, "EDGE20"}, {FIT_GARMIN_PRODUCT_EDGE520_ASIA, "EDGE520_ASIA"},
+        {FIT_GARMIN_PRODUCT_EDGE520_JAPAN, "EDGE520_JAPAN"}, {FIT_GARMIN_PRODUCT_D2_BRAVO, "D2_BRAVO"},
+        {FIT_GARMIN_PRODUCT_APPROACH_S20, "APPROACH_S20"}, {FIT_GARMIN_PRODUCT_VIVO_SMART2, "VIVO_SMART2"},
+        {FIT_GARMIN_PRODUCT_EDGE1000_THAI, "EDGE1000_THAI"}, {FIT_GARMIN_PRODUCT_VARIA_REMOTE, "VARIA_REMOTE"},
+        {FIT_GARMIN_PRODUCT_EDGE25_ASIA, "EDGE25_ASIA"}, {FIT_GARMIN_PRODUCT_EDGE25_JPN, "EDGE25_JPN"},
+        {FIT_GARMIN_PRODUCT_EDGE20_ASIA, "EDGE20_ASIA"}, {FIT_GARMIN_PRODUCT_APPROACH_X40, "APPROACH_X40"},
+        {FIT_GARMIN_PRODUCT_FENIX3_JAPAN, "FENIX3_JAPAN"}, {FIT_GARMIN_PRODUCT_VIVO_SMART_EMEA, "VIVO_SMART_EMEA"},
+        {FIT_GARMIN_PRODUCT_FR630_ASIA, "FR630_ASIA"}, {FIT_GARMIN_PRODUCT_FR630_JPN, "FR630_JPN"},
+        {FIT_GARMIN_PRODUCT_FR230_JPN, "FR230_JPN"}, {FIT_GARMIN_PRODUCT_HRM4_RUN, "HRM4_RUN"},
+        {FIT_GARMIN_PRODUCT_EPIX_JAPAN, "EPIX_JAPAN"}, {FIT_GARMIN_PRODUCT_VIVO_ACTIVE_HR, "VIVO_ACTIVE_HR"},
+        {FIT_GARMIN_PRODUCT_VIVO_SMART_GPS_HR, "VIVO_SMART_GPS_HR"}, {FIT_GARMIN_PRODUCT_VIVO_SMART_HR, "VIVO_SMART_HR"},
+        {FIT_GARMIN_PRODUCT_VIVO_SMART_HR_ASIA, "VIVO_SMART_HR_ASIA"}, {FIT_GARMIN_PRODUCT_VIVO_SMART_GPS_HR_ASIA, "VIVO_SMART_GPS_HR_ASIA"},
+        {FIT_GARMIN_PRODUCT_VIVO_MOVE, "VIVO_MOVE"}, {FIT_GARMIN_PRODUCT_VARIA_TAILLIGHT, "VARIA_TAILLIGHT"},
+        {FIT_GARMIN_PRODUCT_FR235_JAPAN, "FR235_JAPAN"}, {FIT_GARMIN_PRODUCT_VARIA_VISION, "VARIA_VISION"},
+        {FIT_GARMIN_PRODUCT_VIVO_FIT3, "VIVO_FIT3"}, {FIT_GARMIN_PRODUCT_FENIX3_KOREA, "FENIX3_KOREA"},
+        {FIT_GARMIN_PRODUCT_FENIX3_SEA, "FENIX3_SEA"}, {FIT_GARMIN_PRODUCT_FENIX3_HR, "FENIX3_HR"},
+        {FIT_GARMIN_PRODUCT_VIRB_ULTRA_30, "VIRB_ULTRA_30"}, {FIT_GARMIN_PRODUCT_INDEX_SMART_SCALE, "INDEX_SMART_SCALE"},
+        {FIT_GARMIN_PRODUCT_FR235, "FR235"}, {FIT_GARMIN_PRODUCT_FENIX3_CHRONOS, "FENIX3_CHRONOS"},
+        {FIT_GARMIN_PRODUCT_OREGON7XX, "OREGON7XX"}, {FIT_GARMIN_PRODUCT_RINO7XX, "RINO7XX"},
+        {FIT_GARMIN_PRODUCT_EPIX_KOREA, "EPIX_KOREA"}, {FIT_GARMIN_PRODUCT_FENIX3_HR_CHN, "FENIX3_HR_CHN"},
+        {FIT_GARMIN_PRODUCT_FENIX3_HR_TWN, "FENIX3_HR_TWN"}, {FIT_GARMIN_PRODUCT_FENIX3_HR_JPN, "FENIX3_HR_JPN"},
+        {FIT_GARMIN_PRODUCT_FENIX3_HR_SEA, "FENIX3_HR_SEA"}, {FIT_GARMIN_PRODUCT_FENIX3_HR_KOR, "FENIX3_HR_KOR"},
+        {FIT_GARMIN_PRODUCT_NAUTIX, "NAUTIX"}, {FIT_GARMIN_PRODUCT_VIVO_ACTIVE_HR_APAC, "VIVO_ACTIVE_HR_APAC"},
+        {FIT_GARMIN_PRODUCT_OREGON7XX_WW, "OREGON7XX_WW"}, {FIT_GARMIN_PRODUCT_EDGE_820, "EDGE_820"},
+        {FIT_GARMIN_PRODUCT_EDGE_EXPLORE_820, "EDGE_EXPLORE_820"}, {FIT_GARMIN_PRODUCT_FR735XT_APAC, "FR735XT_APAC"},
+        {FIT_GARMIN_PRODUCT_FR735XT_JAPAN, "FR735XT_JAPAN"}, {FIT_GARMIN_PRODUCT_FENIX5S, "FENIX5S"},
+        {FIT_GARMIN_PRODUCT_D2_BRAVO_TITANIUM, "D2_BRAVO_TITANIUM"}, {FIT_GARMIN_PRODUCT_VARIA_UT800, "VARIA_UT800"},
+        {FIT_GARMIN_PRODUCT_RUNNING_DYNAMICS_POD, "RUNNING_DYNAMICS_POD"}, {FIT_GARMIN_PRODUCT_EDGE_820_CHINA, "EDGE_820_CHINA"},
+        {FIT_GARMIN_PRODUCT_EDGE_820_JAPAN, "EDGE_820_JAPAN"}, {FIT_GARMIN_PRODUCT_FENIX5X, "FENIX5X"},
+        {FIT_GARMIN_PRODUCT_VIVO_FIT_JR, "VIVO_FIT_JR"}, {FIT_GARMIN_PRODUCT_VIVO_SMART3, "VIVO_SMART3"},
+        {FIT_GARMIN_PRODUCT_VIVO_SPORT, "VIVO_SPORT"}, {FIT_GARMIN_PRODUCT_EDGE_820_TAIWAN, "EDGE_820_TAIWAN"},
+        {FIT_GARMIN_PRODUCT_EDGE_820_KOREA, "EDGE_820_KOREA"}, {FIT_GARMIN_PRODUCT_EDGE_820_SEA, "EDGE_820_SEA"},
+        {FIT_GARMIN_PRODUCT_FR35_HEBREW, "FR35_HEBREW"}, {FIT_GARMIN_PRODUCT_APPROACH_S60, "APPROACH_S60"},
+        {FIT_GARMIN_PRODUCT_FR35_APAC, "FR35_APAC"}, {FIT_GARMIN_PRODUCT_FR35_JAPAN, "FR35_JAPAN"},
+        {FIT_GARMIN_PRODUCT_FENIX3_CHRONOS_ASIA, "FENIX3_CHRONOS_ASIA"}, {FIT_GARMIN_PRODUCT_VIRB_360, "VIRB_360"},
+        {FIT_GARMIN_PRODUCT_FR935, "FR935"}, {FIT_GARMIN_PRODUCT_FENIX5, "FENIX5"},
+        {FIT_GARMIN_PRODUCT_VIVOACTIVE3, "VIVOACTIVE3"}, {FIT_GARMIN_PRODUCT_EDGE_1030, "EDGE_1030"},
+        {FIT_GARMIN_PRODUCT_FR235_CHINA_NFC, "FR235_CHINA_NFC"}, {FIT_GARMIN_PRODUCT_FORETREX_601_701, "FORETREX_601_701"},
+        {FIT_GARMIN_PRODUCT_VIVO_MOVE_HR, "VIVO_MOVE_HR"}, {FIT_GARMIN_PRODUCT_FENIX5_ASIA, "FENIX5_ASIA"},
+        {FIT_GARMIN_PRODUCT_FENIX5S_ASIA, "FENIX5S_ASIA"}, {FIT_GARMIN_PRODUCT_FENIX5X_ASIA, "FENIX5X_ASIA"},
+        {FIT_GARMIN_PRODUCT_APPROACH_Z80, "APPROACH_Z80"}, {FIT_GARMIN_PRODUCT_FR35_KOREA, "FR35_KOREA"},
+        {FIT_GARMIN_PRODUCT_D2CHARLIE, "D2CHARLIE"}, {FIT_GARMIN_PRODUCT_VIVO_SMART3_APAC, "VIVO_SMART3_APAC"},
+        {FIT_GARMIN_PRODUCT_VIVO_SPORT_APAC, "VIVO_SPORT_APAC"}, {FIT_GARMIN_PRODUCT_FR935_ASIA, "FR935_ASIA"},
+        {FIT_GARMIN_PRODUCT_DESCENT, "DESCENT"}, {FIT_GARMIN_PRODUCT_FR645, "FR645"},
+        {FIT_GARMIN_PRODUCT_FR645M, "FR645M"}, {FIT_GARMIN_PRODUCT_FR30, "FR30"},
+        {FIT_GARMIN_PRODUCT_FENIX5S_PLUS, "FENIX5S_PLUS"}, {FIT_GARMIN_PRODUCT_EDGE_130, "EDGE_130"},
+        {FIT_GARMIN_PRODUCT_EDGE_1030_ASIA, "EDGE_1030_ASIA"}, {FIT_GARMIN_PRODUCT_VIVOSMART_4, "VIVOSMART_4"},
+        {FIT_GARMIN_PRODUCT_VIVO_MOVE_HR_ASIA, "VIVO_MOVE_HR_ASIA"}, {FIT_GARMIN_PRODUCT_APPROACH_X10, "APPROACH_X10"},
+        {FIT_GARMIN_PRODUCT_FR30_ASIA, "FR30_ASIA"}, {FIT_GARMIN_PRODUCT_VIVOACTIVE3M_W, "VIVOACTIVE3M_W"},
+        {FIT_GARMIN_PRODUCT_FR645_ASIA, "FR645_ASIA"}, {FIT_GARMIN_PRODUCT_FR645M_ASIA, "FR645M_ASIA"},
+        {FIT_GARMIN_PRODUCT_EDGE_EXPLORE, "EDGE_EXPLORE"}, {FIT_GARMIN_PRODUCT_GPSMAP66, "GPSMAP66"},
+        {FIT_GARMIN_PRODUCT_APPROACH_S10, "APPROACH_S10"}, {FIT_GARMIN_PRODUCT_VIVOACTIVE3M_L, "VIVOACTIVE3M_L"},
+        {FIT_GARMIN_PRODUCT_APPROACH_G80, "APPROACH_G80"}, {FIT_GARMIN_PRODUCT_EDGE_130_ASIA, "EDGE_130_ASIA"},
+        {FIT_GARMIN_PRODUCT_EDGE_1030_BONTRAGER, "EDGE_1030_BONTRAGER"}, {FIT_GARMIN_PRODUCT_FENIX5_PLUS, "FENIX5_PLUS"},
+        {FIT_GARMIN_PRODUCT_FENIX5X_PLUS, "FENIX5X_PLUS"}, {FIT_GARMIN_PRODUCT_EDGE_520_PLUS, "EDGE_520_PLUS"},
+        {FIT_GARMIN_PRODUCT_FR945, "FR945"}, {FIT_GARMIN_PRODUCT_EDGE_530, "EDGE_530"},
+        {FIT_GARMIN_PRODUCT_EDGE_830, "EDGE_830"}, {FIT_GARMIN_PRODUCT_INSTINCT_ESPORTS, "INSTINCT_ESPORTS"},
+        {FIT_GARMIN_PRODUCT_FENIX5S_PLUS_APAC, "FENIX5S_PLUS_APAC"}, {FIT_GARMIN_PRODUCT_FENIX5X_PLUS_APAC, "FENIX5X_PLUS_APAC"},
+        {FIT_GARMIN_PRODUCT_EDGE_520_PLUS_APAC, "EDGE_520_PLUS_APAC"}, {FIT_GARMIN_PRODUCT_FR235L_ASIA, "FR235L_ASIA"},
+        {FIT_GARMIN_PRODUCT_FR245_ASIA, "FR245_ASIA"}, {FIT_GARMIN_PRODUCT_VIVO_ACTIVE3M_APAC, "VIVO_ACTIVE3M_APAC"},
+        {FIT_GARMIN_PRODUCT_GEN3_BSM, "GEN3_BSM"}, {FIT_GARMIN_PRODUCT_GEN3_BCM, "GEN3_BCM"},
+        {FIT_GARMIN_PRODUCT_VIVO_SMART4_ASIA, "VIVO_SMART4_ASIA"}, {FIT_GARMIN_PRODUCT_VIVOACTIVE4_SMALL, "VIVOACTIVE4_SMALL"},
+        {FIT_GARMIN_PRODUCT_VIVOACTIVE4_LARGE, "VIVOACTIVE4_LARGE"}, {FIT_GARMIN_PRODUCT_VENU, "VENU"},
+        {FIT_GARMIN_PRODUCT_MARQ_DRIVER, "MARQ_DRIVER"}, {FIT_GARMIN_PRODUCT_MARQ_AVIATOR, "MARQ_AVIATOR"},
+        {FIT_GARMIN_PRODUCT_MARQ_CAPTAIN, "MARQ_CAPTAIN"}, {FIT_GARMIN_PRODUCT_MARQ_COMMANDER, "MARQ_COMMANDER"},
+        {FIT_GARMIN_PRODUCT_MARQ_EXPEDITION, "MARQ_EXPEDITION"}, {FIT_GARMIN_PRODUCT_MARQ_ATHLETE, "MARQ_ATHLETE"},
+        {FIT_GARMIN_PRODUCT_DESCENT_MK2, "DESCENT_MK2"}, {FIT_GARMIN_PRODUCT_FENIX6S_SPORT, "FENIX6S_SPORT"},
+        {FIT_GARMIN_PRODUCT_FENIX6S, "FENIX6S"}, {FIT_GARMIN_PRODUCT_FENIX6_SPORT, "FENIX6_SPORT"},
+        {FIT_GARMIN_PRODUCT_FENIX6, "FENIX6"}, {FIT_GARMIN_PRODUCT_FENIX6X, "FENIX6X"},
+        {FIT_GARMIN_PRODUCT_HRM_DUAL, "HRM_DUAL"}, {FIT_GARMIN_PRODUCT_VIVO_MOVE3_PREMIUM, "VIVO_MOVE3_PREMIUM"},
+        {FIT_GARMIN_PRODUCT_APPROACH_S40, "APPROACH_S40"}, {FIT_GARMIN_PRODUCT_FR245M_ASIA, "FR245M_ASIA"},
+        {FIT_GARMIN_PRODUCT_EDGE_530_APAC, "EDGE_530_APAC"}, {FIT_GARMIN_PRODUCT_EDGE_830_APAC, "EDGE_830_APAC"},
+        {FIT_GARMIN_PRODUCT_VIVO_MOVE3, "VIVO_MOVE3"}, {FIT_GARMIN_PRODUCT_VIVO_ACTIVE4_SMALL_ASIA, "VIVO_ACTIVE4_SMALL_ASIA"},
+        {FIT_GARMIN_PRODUCT_VIVO_ACTIVE4_LARGE_ASIA, "VIVO_ACTIVE4_LARGE_ASIA"}, {FIT_GARMIN_PRODUCT_VIVO_ACTIVE4_OLED_ASIA, "VIVO_ACTIVE4_OLED_ASIA"},
+        {FIT_GARMIN_PRODUCT_SWIM2, "SWIM2"}, {FIT_GARMIN_PRODUCT_MARQ_DRIVER_ASIA, "MARQ_DRIVER_ASIA"},
+        {FIT_GARMIN_PRODUCT_MARQ_AVIATOR_ASIA, "MARQ_AVIATOR_ASIA"}, {FIT_GARMIN_PRODUCT_VIVO_MOVE3_ASIA, "VIVO_MOVE3_ASIA"},
+        {FIT_GARMIN_PRODUCT_FR945_ASIA, "FR945_ASIA"}, {FIT_GARMIN_PRODUCT_VIVO_ACTIVE3T_CHN, "VIVO_ACTIVE3T_CHN"},
+        {FIT_GARMIN_PRODUCT_MARQ_CAPTAIN_ASIA, "MARQ_CAPTAIN_ASIA"}, {FIT_GARMIN_PRODUCT_MARQ_COMMANDER_ASIA, "MARQ_COMMANDER_ASIA"},
+        {FIT_GARMIN_PRODUCT_MARQ_EXPEDITION_ASIA, "MARQ_EXPEDITION_ASIA"}, {FIT_GARMIN_PRODUCT_MARQ_ATHLETE_ASIA, "MARQ_ATHLETE_ASIA"},
+        {FIT_GARMIN_PRODUCT_FR45_ASIA, "FR45_ASIA"}, {FIT_GARMIN_PRODUCT_VIVOACTIVE3_DAIMLER, "VIVOACTIVE3_DAIMLER"},
+        {FIT_GARMIN_PRODUCT_FENIX6S_SPORT_ASIA, "FENIX6S_SPORT_ASIA"}, {FIT_GARMIN_PRODUCT_FENIX6S_ASIA, "FENIX6S_ASIA"},
+        {FIT_GARMIN_PRODUCT_FENIX6_SPORT_ASIA, "FENIX6_SPORT_ASIA"}, {FIT_GARMIN_PRODUCT_FENIX6_ASIA, "FENIX6_ASIA"},
+        {FIT_GARMIN_PRODUCT_FENIX6X_ASIA, "FENIX6X_ASIA"}, {FIT_GARMIN_PRODUCT_EDGE_130_PLUS, "EDGE_130_PLUS"},
+        {FIT_GARMIN_PRODUCT_EDGE_1030_PLUS, "EDGE_1030_PLUS"}, {FIT_GARMIN_PRODUCT_FR745, "FR745"},
+        {FIT_GARMIN_PRODUCT_VENUSQ, "VENUSQ"}, {FIT_GARMIN_PRODUCT_MARQ_ADVENTURER, "MARQ_ADVENTURER"},
+        {FIT_GARMIN_PRODUCT_SWIM2_APAC, "SWIM2_APAC"}, {FIT_GARMIN_PRODUCT_MARQ_ADVENTURER_ASIA, "MARQ_ADVENTURER_ASIA"},
+        {FIT_GARMIN_PRODUCT_DESCENT_MK2_ASIA, "DESCENT_MK2_ASIA"}, {FIT_GARMIN_PRODUCT_VENU_DAIMLER_ASIA, "VENU_DAIMLER_ASIA"},
+        {FIT_GARMIN_PRODUCT_MARQ_GOLFER, "MARQ_GOLFER"}, {FIT_GARMIN_PRODUCT_VENU_DAIMLER, "VENU_DAIMLER"},
+        {FIT_GARMIN_PRODUCT_FR745_ASIA, "FR745_ASIA"}, {FIT_GARMIN_PRODUCT_EDGE_1030_PLUS_ASIA, "EDGE_1030_PLUS_ASIA"},
+        {FIT_GARMIN_PRODUCT_EDGE_130_PLUS_ASIA, "EDGE_130_PLUS_ASIA"}, {FIT_GARMIN_PRODUCT_VENUSQ_ASIA, "VENUSQ_ASIA"},
+        {FIT_GARMIN_PRODUCT_MARQ_GOLFER_ASIA, "MARQ_GOLFER_ASIA"}, {FIT_GARMIN_PRODUCT_VENU2PLUS, "VENU2PLUS"},
+        {FIT_GARMIN_PRODUCT_SDM4, "SDM4"}, {FIT_GARMIN_PRODUCT_EDGE_REMOTE, "EDGE_REMOTE"},
+        {FIT_GARMIN_PRODUCT_TRAINING_CENTER, "TRAINING_CENTER"}, {FIT_GARMIN_PRODUCT_TACX_TRAINING_APP_WIN, "TACX_TRAINING_APP_WIN"},
+        {FIT_GARMIN_PRODUCT_TACX_TRAINING_APP_MAC, "TACX_TRAINING_APP_MAC"}, {FIT_GARMIN_PRODUCT_TACX_TRAINING_APP_ANDROID, "TACX_TRAINING_APP_ANDROID"},
+        {FIT_GARMIN_PRODUCT_TACX_TRAINING_APP_IOS, "TACX_TRAINING_APP_IOS"}, {FIT_GARMIN_PRODUCT_TACX_TRAINING_APP_LEGACY, "TACX_TRAINING_APP_LEGACY"},
+        {FIT_GARMIN_PRODUCT_CONNECTIQ_SIMULATOR, "CONNECTIQ_SIMULATOR"}, {FIT_GARMIN_PRODUCT_ANDROID_ANTPLUS_PLUGIN, "ANDROID_ANTPLUS_PLUGIN"},
+        {FIT_GARMIN_PRODUCT_CONNECT, "CONNECT"}, {FIT_GARMIN_PRODUCT_INVALID, "INVALID"},
+    };
+    static const FitEnumName antplus_device_type_names[] = {
+        {FIT_ANTPLUS_DEVICE_TYPE_ANTFS, "ANTFS"}, {FIT_ANTPLUS_DEVICE_TYPE_BIKE_POWER, "BIKE_POWER"},
+        {FIT_ANTPLUS_DEVICE_TYPE_ENVIRONMENT_SENSOR_LEGACY, "ENVIRONMENT_SENSOR_LEGACY"}, {FIT_ANTPLUS_DEVICE_TYPE_MULTI_SPORT_SPEED_DISTANCE, "MULTI_SPORT_SPEED_DISTANCE"},
+        {FIT_ANTPLUS_DEVICE_TYPE_CONTROL, "CONTROL"}, {FIT_ANTPLUS_DEVICE_TYPE_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"},
+        {FIT_ANTPLUS_DEVICE_TYPE_BLOOD_PRESSURE, "BLOOD_PRESSURE"}, {FIT_ANTPLUS_DEVICE_TYPE_GEOCACHE_NODE, "GEOCACHE_NODE"},
+        {FIT_ANTPLUS_DEVICE_TYPE_LIGHT_ELECTRIC_VEHICLE, "LIGHT_ELECTRIC_VEHICLE"}, {FIT_ANTPLUS_DEVICE_TYPE_ENV_SENSOR, "ENV_SENSOR"},
+        {FIT_ANTPLUS_DEVICE_TYPE_RACQUET, "RACQUET"}, {FIT_ANTPLUS_DEVICE_TYPE_CONTROL_HUB, "CONTROL_HUB"},
+        {FIT_ANTPLUS_DEVICE_TYPE_MUSCLE_OXYGEN, "MUSCLE_OXYGEN"}, {FIT_ANTPLUS_DEVICE_TYPE_BIKE_LIGHT_MAIN, "BIKE_LIGHT_MAIN"},
+        {FIT_ANTPLUS_DEVICE_TYPE_BIKE_LIGHT_SHARED, "BIKE_LIGHT_SHARED"}, {FIT_ANTPLUS_DEVICE_TYPE_EXD, "EXD"},
+        {FIT_ANTPLUS_DEVICE_TYPE_BIKE_RADAR, "BIKE_RADAR"}, {FIT_ANTPLUS_DEVICE_TYPE_BIKE_AERO, "BIKE_AERO"},
+        {FIT_ANTPLUS_DEVICE_TYPE_WEIGHT_SCALE, "WEIGHT_SCALE"}, {FIT_ANTPLUS_DEVICE_TYPE_HEART_RATE, "HEART_RATE"},
+        {FIT_ANTPLUS_DEVICE_TYPE_BIKE_SPEED_CADENCE, "BIKE_SPEED_CADENCE"}, {FIT_ANTPLUS_DEVICE_TYPE_BIKE_CADENCE, "BIKE_CADENCE"},
+        {FIT_ANTPLUS_DEVICE_TYPE_BIKE_SPEED, "BIKE_SPEED"}, {FIT_ANTPLUS_DEVICE_TYPE_STRIDE_SPEED_DISTANCE, "STRIDE_SPEED_DISTANCE"},
+        {FIT_ANTPLUS_DEVICE_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName ant_network_names[] = {
+        {FIT_ANT_NETWORK_PUBLIC, "PUBLIC"}, {FIT_ANT_NETWORK_ANTPLUS, "ANTPLUS"},
+        {FIT_ANT_NETWORK_ANTFS, "ANTFS"}, {FIT_ANT_NETWORK_PRIVATE, "PRIVATE"},
+        {FIT_ANT_NETWORK_INVALID, "INVALID"},
+    };
+    static const FitEnumName workout_capabilities_names[] = {
+        {FIT_WORKOUT_CAPABILITIES_INVALID, "INVALID"}, {FIT_WORKOUT_CAPABILITIES_INTERVAL, "INTERVAL"},
+        {FIT_WORKOUT_CAPABILITIES_CUSTOM, "CUSTOM"}, {FIT_WORKOUT_CAPABILITIES_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"},
+        {FIT_WORKOUT_CAPABILITIES_FIRSTBEAT, "FIRSTBEAT"}, {FIT_WORKOUT_CAPABILITIES_NEW_LEAF, "NEW_LEAF"},
+        {FIT_WORKOUT_CAPABILITIES_TCX, "TCX"}, {FIT_WORKOUT_CAPABILITIES_SPEED, "SPEED"},
+        {FIT_WORKOUT_CAPABILITIES_HEART_RATE, "HEART_RATE"}, {FIT_WORKOUT_CAPABILITIES_DISTANCE, "DISTANCE"},
+        {FIT_WORKOUT_CAPABILITIES_CADENCE, "CADENCE"}, {FIT_WORKOUT_CAPABILITIES_POWER, "POWER"},
+        {FIT_WORKOUT_CAPABILITIES_GRADE, "GRADE"}, {FIT_WORKOUT_CAPABILITIES_RESISTANCE, "RESISTANCE"},
+        {FIT_WORKOUT_CAPABILITIES_PROTECTED, "PROTECTED"},
+    };
+    static const FitEnumName battery_status_names[] = {
+        {FIT_BATTERY_STATUS_NEW, "NEW"}, {FIT_BATTERY_STATUS_GOOD, "GOOD"},
+        {FIT_BATTERY_STATUS_OK, "OK"}, {FIT_BATTERY_STATUS_LOW, "LOW"},
+        {FIT_BATTERY_STATUS_CRITICAL, "CRITICAL"}, {FIT_BATTERY_STATUS_CHARGING, "CHARGING"},
+        {FIT_BATTERY_STATUS_UNKNOWN, "UNKNOWN"}, {FIT_BATTERY_STATUS_INVALID, "INVALID"},
+    };
+    static const FitEnumName hr_type_names[] = {
+        {FIT_HR_TYPE_NORMAL, "NORMAL"}, {FIT_HR_TYPE_IRREGULAR, "IRREGULAR"},
+        {FIT_HR_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName course_capabilities_names[] = {
+        {FIT_COURSE_CAPABILITIES_INVALID, "INVALID"}, {FIT_COURSE_CAPABILITIES_PROCESSED, "PROCESSED"},
+        {FIT_COURSE_CAPABILITIES_VALID, "VALID"}, {FIT_COURSE_CAPABILITIES_TIME, "TIME"},
+        {FIT_COURSE_CAPABILITIES_DISTANCE, "DISTANCE"}, {FIT_COURSE_CAPABILITIES_POSITION, "POSITION"},
+        {FIT_COURSE_CAPABILITIES_HEART_RATE, "HEART_RATE"}, {FIT_COURSE_CAPABILITIES_POWER, "POWER"},
+        {FIT_COURSE_CAPABILITIES_CADENCE, "CADENCE"}, {FIT_COURSE_CAPABILITIES_TRAINING, "TRAINING"},
+        {FIT_COURSE_CAPABILITIES_NAVIGATION, "NAVIGATION"}, {FIT_COURSE_CAPABILITIES_BIKEWAY, "BIKEWAY"},
+    };
+    static const FitEnumName bp_status_names[] = {
+        {FIT_BP_STATUS_NO_ERROR, "NO_ERROR"}, {FIT_BP_STATUS_ERROR_INCOMPLETE_DATA, "ERROR_INCOMPLETE_DATA"},
+        {FIT_BP_STATUS_ERROR_NO_MEASUREMENT, "ERROR_NO_MEASUREMENT"}, {FIT_BP_STATUS_ERROR_DATA_OUT_OF_RANGE, "ERROR_DATA_OUT_OF_RANGE"},
+        {FIT_BP_STATUS_ERROR_IRREGULAR_HEART_RATE, "ERROR_IRREGULAR_HEART_RATE"}, {FIT_BP_STATUS_INVALID, "INVALID"},
+    };
+    static const FitEnumName swim_stroke_names[] = {
+        {FIT_SWIM_STROKE_FREESTYLE, "FREESTYLE"}, {FIT_SWIM_STROKE_BACKSTROKE, "BACKSTROKE"},
+        {FIT_SWIM_STROKE_BREASTSTROKE, "BREASTSTROKE"}, {FIT_SWIM_STROKE_BUTTERFLY, "BUTTERFLY"},
+        {FIT_SWIM_STROKE_DRILL, "DRILL"}, {FIT_SWIM_STROKE_MIXED, "MIXED"},
+        {FIT_SWIM_STROKE_IM, "IM"}, {FIT_SWIM_STROKE_INVALID, "INVALID"},
+    };
+    static const FitEnumName activity_type_names[] = {
+        {FIT_ACTIVITY_TYPE_GENERIC, "GENERIC"}, {FIT_ACTIVITY_TYPE_RUNNING, "RUNNING"},
+        {FIT_ACTIVITY_TYPE_CYCLING, "CYCLING"}, {FIT_ACTIVITY_TYPE_TRANSITION, "TRANSITION"},
+        {FIT_ACTIVITY_TYPE_FITNESS_EQUIPMENT, "FITNESS_EQUIPMENT"}, {FIT_ACTIVITY_TYPE_SWIMMING, "SWIMMING"},
+        {FIT_ACTIVITY_TYPE_WALKING, "WALKING"}, {FIT_ACTIVITY_TYPE_SEDENTARY, "SEDENTARY"},
+        {FIT_ACTIVITY_TYPE_ALL, "ALL"}, {FIT_ACTIVITY_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName activity_subtype_names[] = {
+        {FIT_ACTIVITY_SUBTYPE_GENERIC, "GENERIC"}, {FIT_ACTIVITY_SUBTYPE_TREADMILL, "TREADMILL"},
+        {FIT_ACTIVITY_SUBTYPE_STREET, "STREET"}, {FIT_ACTIVITY_SUBTYPE_TRAIL, "TRAIL"},
+        {FIT_ACTIVITY_SUBTYPE_TRACK, "TRACK"}, {FIT_ACTIVITY_SUBTYPE_SPIN, "SPIN"},
+        {FIT_ACTIVITY_SUBTYPE_INDOOR_CYCLING, "INDOOR_CYCLING"}, {FIT_ACTIVITY_SUBTYPE_ROAD, "ROAD"},
+        {FIT_ACTIVITY_SUBTYPE_MOUNTAIN, "MOUNTAIN"}, {FIT_ACTIVITY_SUBTYPE_DOWNHILL, "DOWNHILL"},
+        {FIT_ACTIVITY_SUBTYPE_RECUMBENT, "RECUMBENT"}, {FIT_ACTIVITY_SUBTYPE_CYCLOCROSS, "CYCLOCROSS"},
+        {FIT_ACTIVITY_SUBTYPE_HAND_CYCLING, "HAND_CYCLING"}, {FIT_ACTIVITY_SUBTYPE_TRACK_CYCLING, "TRACK_CYCLING"},
+        {FIT_ACTIVITY_SUBTYPE_INDOOR_ROWING, "INDOOR_ROWING"}, {FIT_ACTIVITY_SUBTYPE_ELLIPTICAL, "ELLIPTICAL"},
+        {FIT_ACTIVITY_SUBTYPE_STAIR_CLIMBING, "STAIR_CLIMBING"}, {FIT_ACTIVITY_SUBTYPE_LAP_SWIMMING, "LAP_SWIMMING"},
+        {FIT_ACTIVITY_SUBTYPE_OPEN_WATER, "OPEN_WATER"}, {FIT_ACTIVITY_SUBTYPE_ALL, "ALL"},
+        {FIT_ACTIVITY_SUBTYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName activity_level_names[] = {
+        {FIT_ACTIVITY_LEVEL_LOW, "LOW"}, {FIT_ACTIVITY_LEVEL_MEDIUM, "MEDIUM"},
+        {FIT_ACTIVITY_LEVEL_HIGH, "HIGH"}, {FIT_ACTIVITY_LEVEL_INVALID, "INVALID"},
+    };
+    static const FitEnumName side_names[] = {
+        {FIT_SIDE_RIGHT, "RIGHT"}, {FIT_SIDE_LEFT, "LEFT"},
+        {FIT_SIDE_INVALID, "INVALID"},
+    };
+    static const FitEnumName length_type_names[] = {
+        {FIT_LENGTH_TYPE_IDLE, "IDLE"}, {FIT_LENGTH_TYPE_ACTIVE, "ACTIVE"},
+        {FIT_LENGTH_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName day_of_week_names[] = {
+        {FIT_DAY_OF_WEEK_SUNDAY, "SUNDAY"}, {FIT_DAY_OF_WEEK_MONDAY, "MONDAY"},
+        {FIT_DAY_OF_WEEK_TUESDAY, "TUESDAY"}, {FIT_DAY_OF_WEEK_WEDNESDAY, "WEDNESDAY"},
+        {FIT_DAY_OF_WEEK_THURSDAY, "THURSDAY"}, {FIT_DAY_OF_WEEK_FRIDAY, "FRIDAY"},
+        {FIT_DAY_OF_WEEK_SATURDAY, "SATURDAY"}, {FIT_DAY_OF_WEEK_INVALID, "INVALID"},
+    };
+    static const FitEnumName connectivity_capabilities_names[] = {
+        {FIT_CONNECTIVITY_CAPABILITIES_INVALID, "INVALID"}, {FIT_CONNECTIVITY_CAPABILITIES_BLUETOOTH, "BLUETOOTH"},
+        {FIT_CONNECTIVITY_CAPABILITIES_BLUETOOTH_LE, "BLUETOOTH_LE"}, {FIT_CONNECTIVITY_CAPABILITIES_ANT, "ANT"},
+        {FIT_CONNECTIVITY_CAPABILITIES_ACTIVITY_UPLOAD, "ACTIVITY_UPLOAD"}, {FIT_CONNECTIVITY_CAPABILITIES_COURSE_DOWNLOAD, "COURSE_DOWNLOAD"},
+        {FIT_CONNECTIVITY_CAPABILITIES_WORKOUT_DOWNLOAD, "WORKOUT_DOWNLOAD"}, {FIT_CONNECTIVITY_CAPABILITIES_LIVE_TRACK, "LIVE_TRACK"},
+        {FIT_CONNECTIVITY_CAPABILITIES_WEATHER_CONDITIONS, "WEATHER_CONDITIONS"}, {FIT_CONNECTIVITY_CAPABILITIES_WEATHER_ALERTS, "WEATHER_ALERTS"},
+        {FIT_CONNECTIVITY_CAPABILITIES_GPS_EPHEMERIS_DOWNLOAD, "GPS_EPHEMERIS_DOWNLOAD"}, {FIT_CONNECTIVITY_CAPABILITIES_EXPLICIT_ARCHIVE, "EXPLICIT_ARCHIVE"},
+        {FIT_CONNECTIVITY_CAPABILITIES_SETUP_INCOMPLETE, "SETUP_INCOMPLETE"}, {FIT_CONNECTIVITY_CAPABILITIES_CONTINUE_SYNC_AFTER_SOFTWARE_UPDATE, "CONTINUE_SYNC_AFTER_SOFTWARE_UPDATE"},
+        {FIT_CONNECTIVITY_CAPABILITIES_CONNECT_IQ_APP_DOWNLOAD, "CONNECT_IQ_APP_DOWNLOAD"}, {FIT_CONNECTIVITY_CAPABILITIES_GOLF_COURSE_DOWNLOAD, "GOLF_COURSE_DOWNLOAD"},
+        {FIT_CONNECTIVITY_CAPABILITIES_DEVICE_INITIATES_SYNC, "DEVICE_INITIATES_SYNC"}, {FIT_CONNECTIVITY_CAPABILITIES_CONNECT_IQ_WATCH_APP_DOWNLOAD, "CONNECT_IQ_WATCH_APP_DOWNLOAD"},
+        {FIT_CONNECTIVITY_CAPABILITIES_CONNECT_IQ_WIDGET_DOWNLOAD, "CONNECT_IQ_WIDGET_DOWNLOAD"}, {FIT_CONNECTIVITY_CAPABILITIES_CONNECT_IQ_WATCH_FACE_DOWNLOAD, "CONNECT_IQ_WATCH_FACE_DOWNLOAD"},
+        {FIT_CONNECTIVITY_CAPABILITIES_CONNECT_IQ_DATA_FIELD_DOWNLOAD, "CONNECT_IQ_DATA_FIELD_DOWNLOAD"}, {FIT_CONNECTIVITY_CAPABILITIES_CONNECT_IQ_APP_MANAGMENT, "CONNECT_IQ_APP_MANAGMENT"},
+        {FIT_CONNECTIVITY_CAPABILITIES_SWING_SENSOR, "SWING_SENSOR"}, {FIT_CONNECTIVITY_CAPABILITIES_SWING_SENSOR_REMOTE, "SWING_SENSOR_REMOTE"},
+        {FIT_CONNECTIVITY_CAPABILITIES_INCIDENT_DETECTION, "INCIDENT_DETECTION"}, {FIT_CONNECTIVITY_CAPABILITIES_AUDIO_PROMPTS, "AUDIO_PROMPTS"},
+        {FIT_CONNECTIVITY_CAPABILITIES_WIFI_VERIFICATION, "WIFI_VERIFICATION"}, {FIT_CONNECTIVITY_CAPABILITIES_TRUE_UP, "TRUE_UP"},
+        {FIT_CONNECTIVITY_CAPABILITIES_FIND_MY_WATCH, "FIND_MY_WATCH"}, {FIT_CONNECTIVITY_CAPABILITIES_REMOTE_MANUAL_SYNC, "REMOTE_MANUAL_SYNC"},
+        {FIT_CONNECTIVITY_CAPABILITIES_LIVE_TRACK_AUTO_START, "LIVE_TRACK_AUTO_START"}, {FIT_CONNECTIVITY_CAPABILITIES_LIVE_TRACK_MESSAGING, "LIVE_TRACK_MESSAGING"},
+        {FIT_CONNECTIVITY_CAPABILITIES_INSTANT_INPUT, "INSTANT_INPUT"},
+    };
+    static const FitEnumName weather_report_names[] = {
+        {FIT_WEATHER_REPORT_CURRENT, "CURRENT"}, {FIT_WEATHER_REPORT_FORECAST, "FORECAST"},
+        {FIT_WEATHER_REPORT_DAILY_FORECAST, "DAILY_FORECAST"}, {FIT_WEATHER_REPORT_INVALID, "INVALID"},
+    };
+    static const FitEnumName weather_status_names[] = {
+        {FIT_WEATHER_STATUS_CLEAR, "CLEAR"}, {FIT_WEATHER_STATUS_PARTLY_CLOUDY, "PARTLY_CLOUDY"},
+        {FIT_WEATHER_STATUS_MOSTLY_CLOUDY, "MOSTLY_CLOUDY"}, {FIT_WEATHER_STATUS_RAIN, "RAIN"},
+        {FIT_WEATHER_STATUS_SNOW, "SNOW"}, {FIT_WEATHER_STATUS_WINDY, "WINDY"},
+        {FIT_WEATHER_STATUS_THUNDERSTORMS, "THUNDERSTORMS"}, {FIT_WEATHER_STATUS_WINTRY_MIX, "WINTRY_MIX"},
+        {FIT_WEATHER_STATUS_FOG, "FOG"}, {FIT_WEATHER_STATUS_HAZY, "HAZY"},
+        {FIT_WEATHER_STATUS_HAIL, "HAIL"}, {FIT_WEATHER_STATUS_SCATTERED_SHOWERS, "SCATTERED_SHOWERS"},
+        {FIT_WEATHER_STATUS_SCATTERED_THUNDERSTORMS, "SCATTERED_THUNDERSTORMS"}, {FIT_WEATHER_STATUS_UNKNOWN_PRECIPITATION, "UNKNOWN_PRECIPITATION"},
+        {FIT_WEATHER_STATUS_LIGHT_RAIN, "LIGHT_RAIN"}, {FIT_WEATHER_STATUS_HEAVY_RAIN, "HEAVY_RAIN"},
+        {FIT_WEATHER_STATUS_LIGHT_SNOW, "LIGHT_SNOW"}, {FIT_WEATHER_STATUS_HEAVY_SNOW, "HEAVY_SNOW"},
+        {FIT_WEATHER_STATUS_LIGHT_RAIN_SNOW, "LIGHT_RAIN_SNOW"}, {FIT_WEATHER_STATUS_HEAVY_RAIN_SNOW, "HEAVY_RAIN_SNOW"},
+        {FIT_WEATHER_STATUS_CLOUDY, "CLOUDY"}, {FIT_WEATHER_STATUS_INVALID, "INVALID"},
+    };
+    static const FitEnumName weather_severity_names[] = {
+        {FIT_WEATHER_SEVERITY_UNKNOWN, "UNKNOWN"}, {FIT_WEATHER_SEVERITY_WARNING, "WARNING"},
+        {FIT_WEATHER_SEVERITY_WATCH, "WATCH"}, {FIT_WEATHER_SEVERITY_ADVISORY, "ADVISORY"},
+        {FIT_WEATHER_SEVERITY_STATEMENT, "STATEMENT"}, {FIT_WEATHER_SEVERITY_INVALID, "INVALID"},
+    };
+    static const FitEnumName weather_severe_type_names[] = {
+        {FIT_WEATHER_SEVERE_TYPE_UNSPECIFIED, "UNSPECIFIED"}, {FIT_WEATHER_SEVERE_TYPE_TORNADO, "TORNADO"},
+        {FIT_WEATHER_SEVERE_TYPE_TSUNAMI, "TSUNAMI"}, {FIT_WEATHER_SEVERE_TYPE_HURRICANE, "HURRICANE"},
+        {FIT_WEATHER_SEVERE_TYPE_EXTREME_WIND, "EXTREME_WIND"}, {FIT_WEATHER_SEVERE_TYPE_TYPHOON, "TYPHOON"},
+        {FIT_WEATHER_SEVERE_TYPE_INLAND_HURRICANE, "INLAND_HURRICANE"}, {FIT_WEATHER_SEVERE_TYPE_HURRICANE_FORCE_WIND, "HURRICANE_FORCE_WIND"},
+        {FIT_WEATHER_SEVERE_TYPE_WATERSPOUT, "WATERSPOUT"}, {FIT_WEATHER_SEVERE_TYPE_SEVERE_THUNDERSTORM, "SEVERE_THUNDERSTORM"},
+        {FIT_WEATHER_SEVERE_TYPE_WRECKHOUSE_WINDS, "WRECKHOUSE_WINDS"}, {FIT_WEATHER_SEVERE_TYPE_LES_SUETES_WIND, "LES_SUETES_WIND"},
+        {FIT_WEATHER_SEVERE_TYPE_AVALANCHE, "AVALANCHE"}, {FIT_WEATHER_SEVERE_TYPE_FLASH_FLOOD, "FLASH_FLOOD"},
+        {FIT_WEATHER_SEVERE_TYPE_TROPICAL_STORM, "TROPICAL_STORM"}, {FIT_WEATHER_SEVERE_TYPE_INLAND_TROPICAL_STORM, "INLAND_TROPICAL_STORM"},
+        {FIT_WEATHER_SEVERE_TYPE_BLIZZARD, "BLIZZARD"}, {FIT_WEATHER_SEVERE_TYPE_ICE_STORM, "ICE_STORM"},
+        {FIT_WEATHER_SEVERE_TYPE_FREEZING_RAIN, "FREEZING_RAIN"}, {FIT_WEATHER_SEVERE_TYPE_DEBRIS_FLOW, "DEBRIS_FLOW"},
+        {FIT_WEATHER_SEVERE_TYPE_FLASH_FREEZE, "FLASH_FREEZE"}, {FIT_WEATHER_SEVERE_TYPE_DUST_STORM, "DUST_STORM"},
+        {FIT_WEATHER_SEVERE_TYPE_HIGH_WIND, "HIGH_WIND"}, {FIT_WEATHER_SEVERE_TYPE_WINTER_STORM, "WINTER_STORM"},
+        {FIT_WEATHER_SEVERE_TYPE_HEAVY_FREEZING_SPRAY, "HEAVY_FREEZING_SPRAY"}, {FIT_WEATHER_SEVERE_TYPE_EXTREME_COLD, "EXTREME_COLD"},
+        {FIT_WEATHER_SEVERE_TYPE_WIND_CHILL, "WIND_CHILL"}, {FIT_WEATHER_SEVERE_TYPE_COLD_WAVE, "COLD_WAVE"},
+        {FIT_WEATHER_SEVERE_TYPE_HEAVY_SNOW_ALERT, "HEAVY_SNOW_ALERT"}, {FIT_WEATHER_SEVERE_TYPE_LAKE_EFFECT_BLOWING_SNOW, "LAKE_EFFECT_BLOWING_SNOW"},
+        {FIT_WEATHER_SEVERE_TYPE_SNOW_SQUALL, "SNOW_SQUALL"}, {FIT_WEATHER_SEVERE_TYPE_LAKE_EFFECT_SNOW, "LAKE_EFFECT_SNOW"},
+        {FIT_WEATHER_SEVERE_TYPE_WINTER_WEATHER, "WINTER_WEATHER"}, {FIT_WEATHER_SEVERE_TYPE_SLEET, "SLEET"},
+        {FIT_WEATHER_SEVERE_TYPE_SNOWFALL, "SNOWFALL"}, {FIT_WEATHER_SEVERE_TYPE_SNOW_AND_BLOWING_SNOW, "SNOW_AND_BLOWING_SNOW"},
+        {FIT_WEATHER_SEVERE_TYPE_BLOWING_SNOW, "BLOWING_SNOW"}, {FIT_WEATHER_SEVERE_TYPE_SNOW_ALERT, "SNOW_ALERT"},
+        {FIT_WEATHER_SEVERE_TYPE_ARCTIC_OUTFLOW, "ARCTIC_OUTFLOW"}, {FIT_WEATHER_SEVERE_TYPE_FREEZING_DRIZZLE, "FREEZING_DRIZZLE"},
+        {FIT_WEATHER_SEVERE_TYPE_STORM, "STORM"}, {FIT_WEATHER_SEVERE_TYPE_STORM_SURGE, "STORM_SURGE"},
+        {FIT_WEATHER_SEVERE_TYPE_RAINFALL, "RAINFALL"}, {FIT_WEATHER_SEVERE_TYPE_AREAL_FLOOD, "AREAL_FLOOD"},
+        {FIT_WEATHER_SEVERE_TYPE_COASTAL_FLOOD, "COASTAL_FLOOD"}, {FIT_WEATHER_SEVERE_TYPE_LAKESHORE_FLOOD, "LAKESHORE_FLOOD"},
+        {FIT_WEATHER_SEVERE_TYPE_EXCESSIVE_HEAT, "EXCESSIVE_HEAT"}, {FIT_WEATHER_SEVERE_TYPE_HEAT, "HEAT"},
+        {FIT_WEATHER_SEVERE_TYPE_WEATHER, "WEATHER"}, {FIT_WEATHER_SEVERE_TYPE_HIGH_HEAT_AND_HUMIDITY, "HIGH_HEAT_AND_HUMIDITY"},
+        {FIT_WEATHER_SEVERE_TYPE_HUMIDEX_AND_HEALTH, "HUMIDEX_AND_HEALTH"}, {FIT_WEATHER_SEVERE_TYPE_HUMIDEX, "HUMIDEX"},
+        {FIT_WEATHER_SEVERE_TYPE_GALE, "GALE"}, {FIT_WEATHER_SEVERE_TYPE_FREEZING_SPRAY, "FREEZING_SPRAY"},
+        {FIT_WEATHER_SEVERE_TYPE_SPECIAL_MARINE, "SPECIAL_MARINE"}, {FIT_WEATHER_SEVERE_TYPE_SQUALL, "SQUALL"},
+        {FIT_WEATHER_SEVERE_TYPE_STRONG_WIND, "STRONG_WIND"}, {FIT_WEATHER_SEVERE_TYPE_LAKE_WIND, "LAKE_WIND"},
+        {FIT_WEATHER_SEVERE_TYPE_MARINE_WEATHER, "MARINE_WEATHER"}, {FIT_WEATHER_SEVERE_TYPE_WIND, "WIND"},
+        {FIT_WEATHER_SEVERE_TYPE_SMALL_CRAFT_HAZARDOUS_SEAS, "SMALL_CRAFT_HAZARDOUS_SEAS"}, {FIT_WEATHER_SEVERE_TYPE_HAZARDOUS_SEAS, "HAZARDOUS_SEAS"},
+        {FIT_WEATHER_SEVERE_TYPE_SMALL_CRAFT, "SMALL_CRAFT"}, {FIT_WEATHER_SEVERE_TYPE_SMALL_CRAFT_WINDS, "SMALL_CRAFT_WINDS"},
+        {FIT_WEATHER_SEVERE_TYPE_SMALL_CRAFT_ROUGH_BAR, "SMALL_CRAFT_ROUGH_BAR"}, {FIT_WEATHER_SEVERE_TYPE_HIGH_WATER_LEVEL, "HIGH_WATER_LEVEL"},
+        {FIT_WEATHER_SEVERE_TYPE_ASHFALL, "ASHFALL"}, {FIT_WEATHER_SEVERE_TYPE_FREEZING_FOG, "FREEZING_FOG"},
+        {FIT_WEATHER_SEVERE_TYPE_DENSE_FOG, "DENSE_FOG"}, {FIT_WEATHER_SEVERE_TYPE_DENSE_SMOKE, "DENSE_SMOKE"},
+        {FIT_WEATHER_SEVERE_TYPE_BLOWING_DUST, "BLOWING_DUST"}, {FIT_WEATHER_SEVERE_TYPE_HARD_FREEZE, "HARD_FREEZE"},
+        {FIT_WEATHER_SEVERE_TYPE_FREEZE, "FREEZE"}, {FIT_WEATHER_SEVERE_TYPE_FROST, "FROST"},
+        {FIT_WEATHER_SEVERE_TYPE_FIRE_WEATHER, "FIRE_WEATHER"}, {FIT_WEATHER_SEVERE_TYPE_FLOOD, "FLOOD"},
+        {FIT_WEATHER_SEVERE_TYPE_RIP_TIDE, "RIP_TIDE"}, {FIT_WEATHER_SEVERE_TYPE_HIGH_SURF, "HIGH_SURF"},
+        {FIT_WEATHER_SEVERE_TYPE_SMOG, "SMOG"}, {FIT_WEATHER_SEVERE_TYPE_AIR_QUALITY, "AIR_QUALITY"},
+        {FIT_WEATHER_SEVERE_TYPE_BRISK_WIND, "BRISK_WIND"}, {FIT_WEATHER_SEVERE_TYPE_AIR_STAGNATION, "AIR_STAGNATION"},
+        {FIT_WEATHER_SEVERE_TYPE_LOW_WATER, "LOW_WATER"}, {FIT_WEATHER_SEVERE_TYPE_HYDROLOGICAL, "HYDROLOGICAL"},
+        {FIT_WEATHER_SEVERE_TYPE_SPECIAL_WEATHER, "SPECIAL_WEATHER"}, {FIT_WEATHER_SEVERE_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName stroke_type_names[] = {
+        {FIT_STROKE_TYPE_NO_EVENT, "NO_EVENT"}, {FIT_STROKE_TYPE_OTHER, "OTHER"},
+        {FIT_STROKE_TYPE_SERVE, "SERVE"}, {FIT_STROKE_TYPE_FOREHAND, "FOREHAND"},
+        {FIT_STROKE_TYPE_BACKHAND, "BACKHAND"}, {FIT_STROKE_TYPE_SMASH, "SMASH"},
+        {FIT_STROKE_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName body_location_names[] = {
+        {FIT_BODY_LOCATION_LEFT_LEG, "LEFT_LEG"}, {FIT_BODY_LOCATION_LEFT_CALF, "LEFT_CALF"},
+        {FIT_BODY_LOCATION_LEFT_SHIN, "LEFT_SHIN"}, {FIT_BODY_LOCATION_LEFT_HAMSTRING, "LEFT_HAMSTRING"},
+        {FIT_BODY_LOCATION_LEFT_QUAD, "LEFT_QUAD"}, {FIT_BODY_LOCATION_LEFT_GLUTE, "LEFT_GLUTE"},
+        {FIT_BODY_LOCATION_RIGHT_LEG, "RIGHT_LEG"}, {FIT_BODY_LOCATION_RIGHT_CALF, "RIGHT_CALF"},
+        {FIT_BODY_LOCATION_RIGHT_SHIN, "RIGHT_SHIN"}, {FIT_BODY_LOCATION_RIGHT_HAMSTRING, "RIGHT_HAMSTRING"},
+        {FIT_BODY_LOCATION_RIGHT_QUAD, "RIGHT_QUAD"}, {FIT_BODY_LOCATION_RIGHT_GLUTE, "RIGHT_GLUTE"},
+        {FIT_BODY_LOCATION_TORSO_BACK, "TORSO_BACK"}, {FIT_BODY_LOCATION_LEFT_LOWER_BACK, "LEFT_LOWER_BACK"},
+        {FIT_BODY_LOCATION_LEFT_UPPER_BACK, "LEFT_UPPER_BACK"}, {FIT_BODY_LOCATION_RIGHT_LOWER_BACK, "RIGHT_LOWER_BACK"},
+        {FIT_BODY_LOCATION_RIGHT_UPPER_BACK, "RIGHT_UPPER_BACK"}, {FIT_BODY_LOCATION_TORSO_FRONT, "TORSO_FRONT"},
+        {FIT_BODY_LOCATION_LEFT_ABDOMEN, "LEFT_ABDOMEN"}, {FIT_BODY_LOCATION_LEFT_CHEST, "LEFT_CHEST"},
+        {FIT_BODY_LOCATION_RIGHT_ABDOMEN, "RIGHT_ABDOMEN"}, {FIT_BODY_LOCATION_RIGHT_CHEST, "RIGHT_CHEST"},
+        {FIT_BODY_LOCATION_LEFT_ARM, "LEFT_ARM"}, {FIT_BODY_LOCATION_LEFT_SHOULDER, "LEFT_SHOULDER"},
+        {FIT_BODY_LOCATION_LEFT_BICEP, "LEFT_BICEP"}, {FIT_BODY_LOCATION_LEFT_TRICEP, "LEFT_TRICEP"},
+        {FIT_BODY_LOCATION_LEFT_BRACHIORADIALIS, "LEFT_BRACHIORADIALIS"}, {FIT_BODY_LOCATION_LEFT_FOREARM_EXTENSORS, "LEFT_FOREARM_EXTENSORS"},
+        {FIT_BODY_LOCATION_RIGHT_ARM, "RIGHT_ARM"}, {FIT_BODY_LOCATION_RIGHT_SHOULDER, "RIGHT_SHOULDER"},
+        {FIT_BODY_LOCATION_RIGHT_BICEP, "RIGHT_BICEP"}, {FIT_BODY_LOCATION_RIGHT_TRICEP, "RIGHT_TRICEP"},
+        {FIT_BODY_LOCATION_RIGHT_BRACHIORADIALIS, "RIGHT_BRACHIORADIALIS"}, {FIT_BODY_LOCATION_RIGHT_FOREARM_EXTENSORS, "RIGHT_FOREARM_EXTENSORS"},
+        {FIT_BODY_LOCATION_NECK, "NECK"}, {FIT_BODY_LOCATION_THROAT, "THROAT"},
+        {FIT_BODY_LOCATION_WAIST_MID_BACK, "WAIST_MID_BACK"}, {FIT_BODY_LOCATION_WAIST_FRONT, "WAIST_FRONT"},
+        {FIT_BODY_LOCATION_WAIST_LEFT, "WAIST_LEFT"}, {FIT_BODY_LOCATION_WAIST_RIGHT, "WAIST_RIGHT"},
+        {FIT_BODY_LOCATION_INVALID, "INVALID"},
+    };
+    static const FitEnumName segment_lap_status_names[] = {
+        {FIT_SEGMENT_LAP_STATUS_END, "END"}, {FIT_SEGMENT_LAP_STATUS_FAIL, "FAIL"},
+        {FIT_SEGMENT_LAP_STATUS_INVALID, "INVALID"},
+    };
+    static const FitEnumName segment_leaderboard_type_names[] = {
+        {FIT_SEGMENT_LEADERBOARD_TYPE_OVERALL, "OVERALL"}, {FIT_SEGMENT_LEADERBOARD_TYPE_PERSONAL_BEST, "PERSONAL_BEST"},
+        {FIT_SEGMENT_LEADERBOARD_TYPE_CONNECTIONS, "CONNECTIONS"}, {FIT_SEGMENT_LEADERBOARD_TYPE_GROUP, "GROUP"},
+        {FIT_SEGMENT_LEADERBOARD_TYPE_CHALLENGER, "CHALLENGER"}, {FIT_SEGMENT_LEADERBOARD_TYPE_KOM, "KOM"},
+        {FIT_SEGMENT_LEADERBOARD_TYPE_QOM, "QOM"}, {FIT_SEGMENT_LEADERBOARD_TYPE_PR, "PR"},
+        {FIT_SEGMENT_LEADERBOARD_TYPE_GOAL, "GOAL"}, {FIT_SEGMENT_LEADERBOARD_TYPE_RIVAL, "RIVAL"},
+        {FIT_SEGMENT_LEADERBOARD_TYPE_CLUB_LEADER, "CLUB_LEADER"}, {FIT_SEGMENT_LEADERBOARD_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName segment_delete_status_names[] = {
+        {FIT_SEGMENT_DELETE_STATUS_DO_NOT_DELETE, "DO_NOT_DELETE"}, {FIT_SEGMENT_DELETE_STATUS_DELETE_ONE, "DELETE_ONE"},
+        {FIT_SEGMENT_DELETE_STATUS_DELETE_ALL, "DELETE_ALL"}, {FIT_SEGMENT_DELETE_STATUS_INVALID, "INVALID"},
+    };
+    static const FitEnumName segment_selection_type_names[] = {
+        {FIT_SEGMENT_SELECTION_TYPE_STARRED, "STARRED"}, {FIT_SEGMENT_SELECTION_TYPE_SUGGESTED, "SUGGESTED"},
+        {FIT_SEGMENT_SELECTION_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName source_type_names[] = {
+        {FIT_SOURCE_TYPE_ANT, "ANT"}, {FIT_SOURCE_TYPE_ANTPLUS, "ANTPLUS"},
+        {FIT_SOURCE_TYPE_BLUETOOTH, "BLUETOOTH"}, {FIT_SOURCE_TYPE_BLUETOOTH_LOW_ENERGY, "BLUETOOTH_LOW_ENERGY"},
+        {FIT_SOURCE_TYPE_WIFI, "WIFI"}, {FIT_SOURCE_TYPE_LOCAL, "LOCAL"},
+        {FIT_SOURCE_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName display_orientation_names[] = {
+        {FIT_DISPLAY_ORIENTATION_AUTO, "AUTO"}, {FIT_DISPLAY_ORIENTATION_PORTRAIT, "PORTRAIT"},
+        {FIT_DISPLAY_ORIENTATION_LANDSCAPE, "LANDSCAPE"}, {FIT_DISPLAY_ORIENTATION_PORTRAIT_FLIPPED, "PORTRAIT_FLIPPED"},
+        {FIT_DISPLAY_ORIENTATION_LANDSCAPE_FLIPPED, "LANDSCAPE_FLIPPED"}, {FIT_DISPLAY_ORIENTATION_INVALID, "INVALID"},
+    };
+    static const FitEnumName workout_equipment_names[] = {
+        {FIT_WORKOUT_EQUIPMENT_NONE, "NONE"}, {FIT_WORKOUT_EQUIPMENT_SWIM_FINS, "SWIM_FINS"},
+        {FIT_WORKOUT_EQUIPMENT_SWIM_KICKBOARD, "SWIM_KICKBOARD"}, {FIT_WORKOUT_EQUIPMENT_SWIM_PADDLES, "SWIM_PADDLES"},
+        {FIT_WORKOUT_EQUIPMENT_SWIM_PULL_BUOY, "SWIM_PULL_BUOY"}, {FIT_WORKOUT_EQUIPMENT_SWIM_SNORKEL, "SWIM_SNORKEL"},
+        {FIT_WORKOUT_EQUIPMENT_INVALID, "INVALID"},
+    };
+    static const FitEnumName watchface_mode_names[] = {
+        {FIT_WATCHFACE_MODE_DIGITAL, "DIGITAL"}, {FIT_WATCHFACE_MODE_ANALOG, "ANALOG"},
+        {FIT_WATCHFACE_MODE_CONNECT_IQ, "CONNECT_IQ"}, {FIT_WATCHFACE_MODE_DISABLED, "DISABLED"},
+        {FIT_WATCHFACE_MODE_INVALID, "INVALID"},
+    };
+    static const FitEnumName digital_watchface_layout_names[] = {
+        {FIT_DIGITAL_WATCHFACE_LAYOUT_TRADITIONAL, "TRADITIONAL"}, {FIT_DIGITAL_WATCHFACE_LAYOUT_MODERN, "MODERN"},
+        {FIT_DIGITAL_WATCHFACE_LAYOUT_BOLD, "BOLD"}, {FIT_DIGITAL_WATCHFACE_LAYOUT_INVALID, "INVALID"},
+    };
+    static const FitEnumName analog_watchface_layout_names[] = {
+        {FIT_ANALOG_WATCHFACE_LAYOUT_MINIMAL, "MINIMAL"}, {FIT_ANALOG_WATCHFACE_LAYOUT_TRADITIONAL, "TRADITIONAL"},
+        {FIT_ANALOG_WATCHFACE_LAYOUT_MODERN, "MODERN"}, {FIT_ANALOG_WATCHFACE_LAYOUT_INVALID, "INVALID"},
+    };
+    static const FitEnumName rider_position_type_names[] = {
+        {FIT_RIDER_POSITION_TYPE_SEATED, "SEATED"}, {FIT_RIDER_POSITION_TYPE_STANDING, "STANDING"},
+        {FIT_RIDER_POSITION_TYPE_TRANSITION_TO_SEATED, "TRANSITION_TO_SEATED"}, {FIT_RIDER_POSITION_TYPE_TRANSITION_TO_STANDING, "TRANSITION_TO_STANDING"},
+        {FIT_RIDER_POSITION_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName power_phase_type_names[] = {
+        {FIT_POWER_PHASE_TYPE_POWER_PHASE_START_ANGLE, "POWER_PHASE_START_ANGLE"}, {FIT_POWER_PHASE_TYPE_POWER_PHASE_END_ANGLE, "POWER_PHASE_END_ANGLE"},
+        {FIT_POWER_PHASE_TYPE_POWER_PHASE_ARC_LENGTH, "POWER_PHASE_ARC_LENGTH"}, {FIT_POWER_PHASE_TYPE_POWER_PHASE_CENTER, "POWER_PHASE_CENTER"},
+        {FIT_POWER_PHASE_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName camera_event_type_names[] = {
+        {FIT_CAMERA_EVENT_TYPE_VIDEO_START, "VIDEO_START"}, {FIT_CAMERA_EVENT_TYPE_VIDEO_SPLIT, "VIDEO_SPLIT"},
+        {FIT_CAMERA_EVENT_TYPE_VIDEO_END, "VIDEO_END"}, {FIT_CAMERA_EVENT_TYPE_PHOTO_TAKEN, "PHOTO_TAKEN"},
+        {FIT_CAMERA_EVENT_TYPE_VIDEO_SECOND_STREAM_START, "VIDEO_SECOND_STREAM_START"}, {FIT_CAMERA_EVENT_TYPE_VIDEO_SECOND_STREAM_SPLIT, "VIDEO_SECOND_STREAM_SPLIT"},
+        {FIT_CAMERA_EVENT_TYPE_VIDEO_SECOND_STREAM_END, "VIDEO_SECOND_STREAM_END"}, {FIT_CAMERA_EVENT_TYPE_VIDEO_SPLIT_START, "VIDEO_SPLIT_START"},
+        {FIT_CAMERA_EVENT_TYPE_VIDEO_SECOND_STREAM_SPLIT_START, "VIDEO_SECOND_STREAM_SPLIT_START"}, {FIT_CAMERA_EVENT_TYPE_VIDEO_PAUSE, "VIDEO_PAUSE"},
+        {FIT_CAMERA_EVENT_TYPE_VIDEO_SECOND_STREAM_PAUSE, "VIDEO_SECOND_STREAM_PAUSE"}, {FIT_CAMERA_EVENT_TYPE_VIDEO_RESUME, "VIDEO_RESUME"},
+        {FIT_CAMERA_EVENT_TYPE_VIDEO_SECOND_STREAM_RESUME, "VIDEO_SECOND_STREAM_RESUME"}, {FIT_CAMERA_EVENT_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName sensor_type_names[] = {
+        {FIT_SENSOR_TYPE_ACCELEROMETER, "ACCELEROMETER"}, {FIT_SENSOR_TYPE_GYROSCOPE, "GYROSCOPE"},
+        {FIT_SENSOR_TYPE_COMPASS, "COMPASS"}, {FIT_SENSOR_TYPE_BAROMETER, "BAROMETER"},
+        {FIT_SENSOR_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName bike_light_network_config_type_names[] = {
+        {FIT_BIKE_LIGHT_NETWORK_CONFIG_TYPE_AUTO, "AUTO"}, {FIT_BIKE_LIGHT_NETWORK_CONFIG_TYPE_INDIVIDUAL, "INDIVIDUAL"},
+        {FIT_BIKE_LIGHT_NETWORK_CONFIG_TYPE_HIGH_VISIBILITY, "HIGH_VISIBILITY"}, {FIT_BIKE_LIGHT_NETWORK_CONFIG_TYPE_TRAIL, "TRAIL"},
+        {FIT_BIKE_LIGHT_NETWORK_CONFIG_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName comm_timeout_type_names[] = {
+        {FIT_COMM_TIMEOUT_TYPE_WILDCARD_PAIRING_TIMEOUT, "WILDCARD_PAIRING_TIMEOUT"}, {FIT_COMM_TIMEOUT_TYPE_PAIRING_TIMEOUT, "PAIRING_TIMEOUT"},
+        {FIT_COMM_TIMEOUT_TYPE_CONNECTION_LOST, "CONNECTION_LOST"}, {FIT_COMM_TIMEOUT_TYPE_CONNECTION_TIMEOUT, "CONNECTION_TIMEOUT"},
+        {FIT_COMM_TIMEOUT_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName camera_orientation_type_names[] = {
+        {FIT_CAMERA_ORIENTATION_TYPE_CAMERA_ORIENTATION_0, "CAMERA_ORIENTATION_0"}, {FIT_CAMERA_ORIENTATION_TYPE_CAMERA_ORIENTATION_90, "CAMERA_ORIENTATION_90"},
+        {FIT_CAMERA_ORIENTATION_TYPE_CAMERA_ORIENTATION_180, "CAMERA_ORIENTATION_180"}, {FIT_CAMERA_ORIENTATION_TYPE_CAMERA_ORIENTATION_270, "CAMERA_ORIENTATION_270"},
+        {FIT_CAMERA_ORIENTATION_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName attitude_stage_names[] = {
+        {FIT_ATTITUDE_STAGE_FAILED, "FAILED"}, {FIT_ATTITUDE_STAGE_ALIGNING, "ALIGNING"},
+        {FIT_ATTITUDE_STAGE_DEGRADED, "DEGRADED"}, {FIT_ATTITUDE_STAGE_VALID, "VALID"},
+        {FIT_ATTITUDE_STAGE_INVALID, "INVALID"},
+    };
+    static const FitEnumName attitude_validity_names[] = {
+        {FIT_ATTITUDE_VALIDITY_TRACK_ANGLE_HEADING_VALID, "TRACK_ANGLE_HEADING_VALID"}, {FIT_ATTITUDE_VALIDITY_PITCH_VALID, "PITCH_VALID"},
+        {FIT_ATTITUDE_VALIDITY_ROLL_VALID, "ROLL_VALID"}, {FIT_ATTITUDE_VALIDITY_LATERAL_BODY_ACCEL_VALID, "LATERAL_BODY_ACCEL_VALID"},
+        {FIT_ATTITUDE_VALIDITY_NORMAL_BODY_ACCEL_VALID, "NORMAL_BODY_ACCEL_VALID"}, {FIT_ATTITUDE_VALIDITY_TURN_RATE_VALID, "TURN_RATE_VALID"},
+        {FIT_ATTITUDE_VALIDITY_HW_FAIL, "HW_FAIL"}, {FIT_ATTITUDE_VALIDITY_MAG_INVALID, "MAG_INVALID"},
+        {FIT_ATTITUDE_VALIDITY_NO_GPS, "NO_GPS"}, {FIT_ATTITUDE_VALIDITY_GPS_INVALID, "GPS_INVALID"},
+        {FIT_ATTITUDE_VALIDITY_SOLUTION_COASTING, "SOLUTION_COASTING"}, {FIT_ATTITUDE_VALIDITY_TRUE_TRACK_ANGLE, "TRUE_TRACK_ANGLE"},
+        {FIT_ATTITUDE_VALIDITY_MAGNETIC_HEADING, "MAGNETIC_HEADING"}, {FIT_ATTITUDE_VALIDITY_INVALID, "INVALID"},
+    };
+    static const FitEnumName auto_sync_frequency_names[] = {
+        {FIT_AUTO_SYNC_FREQUENCY_NEVER, "NEVER"}, {FIT_AUTO_SYNC_FREQUENCY_OCCASIONALLY, "OCCASIONALLY"},
+        {FIT_AUTO_SYNC_FREQUENCY_FREQUENT, "FREQUENT"}, {FIT_AUTO_SYNC_FREQUENCY_ONCE_A_DAY, "ONCE_A_DAY"},
+        {FIT_AUTO_SYNC_FREQUENCY_REMOTE, "REMOTE"}, {FIT_AUTO_SYNC_FREQUENCY_INVALID, "INVALID"},
+    };
+    static const FitEnumName exd_layout_names[] = {
+        {FIT_EXD_LAYOUT_FULL_SCREEN, "FULL_SCREEN"}, {FIT_EXD_LAYOUT_HALF_VERTICAL, "HALF_VERTICAL"},
+        {FIT_EXD_LAYOUT_HALF_HORIZONTAL, "HALF_HORIZONTAL"}, {FIT_EXD_LAYOUT_HALF_VERTICAL_RIGHT_SPLIT, "HALF_VERTICAL_RIGHT_SPLIT"},
+        {FIT_EXD_LAYOUT_HALF_HORIZONTAL_BOTTOM_SPLIT, "HALF_HORIZONTAL_BOTTOM_SPLIT"}, {FIT_EXD_LAYOUT_FULL_QUARTER_SPLIT, "FULL_QUARTER_SPLIT"},
+        {FIT_EXD_LAYOUT_HALF_VERTICAL_LEFT_SPLIT, "HALF_VERTICAL_LEFT_SPLIT"}, {FIT_EXD_LAYOUT_HALF_HORIZONTAL_TOP_SPLIT, "HALF_HORIZONTAL_TOP_SPLIT"},
+        {FIT_EXD_LAYOUT_DYNAMIC, "DYNAMIC"}, {FIT_EXD_LAYOUT_INVALID, "INVALID"},
+    };
+    static const FitEnumName exd_display_type_names[] = {
+        {FIT_EXD_DISPLAY_TYPE_NUMERICAL, "NUMERICAL"}, {FIT_EXD_DISPLAY_TYPE_SIMPLE, "SIMPLE"},
+        {FIT_EXD_DISPLAY_TYPE_GRAPH, "GRAPH"}, {FIT_EXD_DISPLAY_TYPE_BAR, "BAR"},
+        {FIT_EXD_DISPLAY_TYPE_CIRCLE_GRAPH, "CIRCLE_GRAPH"}, {FIT_EXD_DISPLAY_TYPE_VIRTUAL_PARTNER, "VIRTUAL_PARTNER"},
+        {FIT_EXD_DISPLAY_TYPE_BALANCE, "BALANCE"}, {FIT_EXD_DISPLAY_TYPE_STRING_LIST, "STRING_LIST"},
+        {FIT_EXD_DISPLAY_TYPE_STRING, "STRING"}, {FIT_EXD_DISPLAY_TYPE_SIMPLE_DYNAMIC_ICON, "SIMPLE_DYNAMIC_ICON"},
+        {FIT_EXD_DISPLAY_TYPE_GAUGE, "GAUGE"}, {FIT_EXD_DISPLAY_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName exd_data_units_names[] = {
+        {FIT_EXD_DATA_UNITS_NO_UNITS, "NO_UNITS"}, {FIT_EXD_DATA_UNITS_LAPS, "LAPS"},
+        {FIT_EXD_DATA_UNITS_MILES_PER_HOUR, "MILES_PER_HOUR"}, {FIT_EXD_DATA_UNITS_KILOMETERS_PER_HOUR, "KILOMETERS_PER_HOUR"},
+        {FIT_EXD_DATA_UNITS_FEET_PER_HOUR, "FEET_PER_HOUR"}, {FIT_EXD_DATA_UNITS_METERS_PER_HOUR, "METERS_PER_HOUR"},
+        {FIT_EXD_DATA_UNITS_DEGREES_CELSIUS, "DEGREES_CELSIUS"}, {FIT_EXD_DATA_UNITS_DEGREES_FARENHEIT, "DEGREES_FARENHEIT"},
+        {FIT_EXD_DATA_UNITS_ZONE, "ZONE"}, {FIT_EXD_DATA_UNITS_GEAR, "GEAR"},
+        {FIT_EXD_DATA_UNITS_RPM, "RPM"}, {FIT_EXD_DATA_UNITS_BPM, "BPM"},
+        {FIT_EXD_DATA_UNITS_DEGREES, "DEGREES"}, {FIT_EXD_DATA_UNITS_MILLIMETERS, "MILLIMETERS"},
+        {FIT_EXD_DATA_UNITS_METERS, "METERS"}, {FIT_EXD_DATA_UNITS_KILOMETERS, "KILOMETERS"},
+        {FIT_EXD_DATA_UNITS_FEET, "FEET"}, {FIT_EXD_DATA_UNITS_YARDS, "YARDS"},
+        {FIT_EXD_DATA_UNITS_KILOFEET, "KILOFEET"}, {FIT_EXD_DATA_UNITS_MILES, "MILES"},
+        {FIT_EXD_DATA_UNITS_TIME, "TIME"}, {FIT_EXD_DATA_UNITS_ENUM_TURN_TYPE, "ENUM_TURN_TYPE"},
+        {FIT_EXD_DATA_UNITS_PERCENT, "PERCENT"}, {FIT_EXD_DATA_UNITS_WATTS, "WATTS"},
+        {FIT_EXD_DATA_UNITS_WATTS_PER_KILOGRAM, "WATTS_PER_KILOGRAM"}, {FIT_EXD_DATA_UNITS_ENUM_BATTERY_STATUS, "ENUM_BATTERY_STATUS"},
+        {FIT_EXD_DATA_UNITS_ENUM_BIKE_LIGHT_BEAM_ANGLE_MODE, "ENUM_BIKE_LIGHT_BEAM_ANGLE_MODE"}, {FIT_EXD_DATA_UNITS_ENUM_BIKE_LIGHT_BATTERY_STATUS, "ENUM_BIKE_LIGHT_BATTERY_STATUS"},
+        {FIT_EXD_DATA_UNITS_ENUM_BIKE_LIGHT_NETWORK_CONFIG_TYPE, "ENUM_BIKE_LIGHT_NETWORK_CONFIG_TYPE"}, {FIT_EXD_DATA_UNITS_LIGHTS, "LIGHTS"},
+        {FIT_EXD_DATA_UNITS_SECONDS, "SECONDS"}, {FIT_EXD_DATA_UNITS_MINUTES, "MINUTES"},
+        {FIT_EXD_DATA_UNITS_HOURS, "HOURS"}, {FIT_EXD_DATA_UNITS_CALORIES, "CALORIES"},
+        {FIT_EXD_DATA_UNITS_KILOJOULES, "KILOJOULES"}, {FIT_EXD_DATA_UNITS_MILLISECONDS, "MILLISECONDS"},
+        {FIT_EXD_DATA_UNITS_SECOND_PER_MILE, "SECOND_PER_MILE"}, {FIT_EXD_DATA_UNITS_SECOND_PER_KILOMETER, "SECOND_PER_KILOMETER"},
+        {FIT_EXD_DATA_UNITS_CENTIMETER, "CENTIMETER"}, {FIT_EXD_DATA_UNITS_ENUM_COURSE_POINT, "ENUM_COURSE_POINT"},
+        {FIT_EXD_DATA_UNITS_BRADIANS, "BRADIANS"}, {FIT_EXD_DATA_UNITS_ENUM_SPORT, "ENUM_SPORT"},
+        {FIT_EXD_DATA_UNITS_INCHES_HG, "INCHES_HG"}, {FIT_EXD_DATA_UNITS_MM_HG, "MM_HG"},
+        {FIT_EXD_DATA_UNITS_MBARS, "MBARS"}, {FIT_EXD_DATA_UNITS_HECTO_PASCALS, "HECTO_PASCALS"},
+        {FIT_EXD_DATA_UNITS_FEET_PER_MIN, "FEET_PER_MIN"}, {FIT_EXD_DATA_UNITS_METERS_PER_MIN, "METERS_PER_MIN"},
+        {FIT_EXD_DATA_UNITS_METERS_PER_SEC, "METERS_PER_SEC"}, {FIT_EXD_DATA_UNITS_EIGHT_CARDINAL, "EIGHT_CARDINAL"},
+        {FIT_EXD_DATA_UNITS_INVALID, "INVALID"},
+    };
+    static const FitEnumName exd_qualifiers_names[] = {
+        {FIT_EXD_QUALIFIERS_NO_QUALIFIER, "NO_QUALIFIER"}, {FIT_EXD_QUALIFIERS_INSTANTANEOUS, "INSTANTANEOUS"},
+        {FIT_EXD_QUALIFIERS_AVERAGE, "AVERAGE"}, {FIT_EXD_QUALIFIERS_LAP, "LAP"},
+        {FIT_EXD_QUALIFIERS_MAXIMUM, "MAXIMUM"}, {FIT_EXD_QUALIFIERS_MAXIMUM_AVERAGE, "MAXIMUM_AVERAGE"},
+        {FIT_EXD_QUALIFIERS_MAXIMUM_LAP, "MAXIMUM_LAP"}, {FIT_EXD_QUALIFIERS_LAST_LAP, "LAST_LAP"},
+        {FIT_EXD_QUALIFIERS_AVERAGE_LAP, "AVERAGE_LAP"}, {FIT_EXD_QUALIFIERS_TO_DESTINATION, "TO_DESTINATION"},
+        {FIT_EXD_QUALIFIERS_TO_GO, "TO_GO"}, {FIT_EXD_QUALIFIERS_TO_NEXT, "TO_NEXT"},
+        {FIT_EXD_QUALIFIERS_NEXT_COURSE_POINT, "NEXT_COURSE_POINT"}, {FIT_EXD_QUALIFIERS_TOTAL, "TOTAL"},
+        {FIT_EXD_QUALIFIERS_THREE_SECOND_AVERAGE, "THREE_SECOND_AVERAGE"}, {FIT_EXD_QUALIFIERS_TEN_SECOND_AVERAGE, "TEN_SECOND_AVERAGE"},
+        {FIT_EXD_QUALIFIERS_THIRTY_SECOND_AVERAGE, "THIRTY_SECOND_AVERAGE"}, {FIT_EXD_QUALIFIERS_PERCENT_MAXIMUM, "PERCENT_MAXIMUM"},
+        {FIT_EXD_QUALIFIERS_PERCENT_MAXIMUM_AVERAGE, "PERCENT_MAXIMUM_AVERAGE"}, {FIT_EXD_QUALIFIERS_LAP_PERCENT_MAXIMUM, "LAP_PERCENT_MAXIMUM"},
+        {FIT_EXD_QUALIFIERS_ELAPSED, "ELAPSED"}, {FIT_EXD_QUALIFIERS_SUNRISE, "SUNRISE"},
+        {FIT_EXD_QUALIFIERS_SUNSET, "SUNSET"}, {FIT_EXD_QUALIFIERS_COMPARED_TO_VIRTUAL_PARTNER, "COMPARED_TO_VIRTUAL_PARTNER"},
+        {FIT_EXD_QUALIFIERS_MAXIMUM_24H, "MAXIMUM_24H"}, {FIT_EXD_QUALIFIERS_MINIMUM_24H, "MINIMUM_24H"},
+        {FIT_EXD_QUALIFIERS_MINIMUM, "MINIMUM"}, {FIT_EXD_QUALIFIERS_FIRST, "FIRST"},
+        {FIT_EXD_QUALIFIERS_SECOND, "SECOND"}, {FIT_EXD_QUALIFIERS_THIRD, "THIRD"},
+        {FIT_EXD_QUALIFIERS_SHIFTER, "SHIFTER"}, {FIT_EXD_QUALIFIERS_LAST_SPORT, "LAST_SPORT"},
+        {FIT_EXD_QUALIFIERS_MOVING, "MOVING"}, {FIT_EXD_QUALIFIERS_STOPPED, "STOPPED"},
+        {FIT_EXD_QUALIFIERS_ESTIMATED_TOTAL, "ESTIMATED_TOTAL"}, {FIT_EXD_QUALIFIERS_ZONE_9, "ZONE_9"},
+        {FIT_EXD_QUALIFIERS_ZONE_8, "ZONE_8"}, {FIT_EXD_QUALIFIERS_ZONE_7, "ZONE_7"},
+        {FIT_EXD_QUALIFIERS_ZONE_6, "ZONE_6"}, {FIT_EXD_QUALIFIERS_ZONE_5, "ZONE_5"},
+        {FIT_EXD_QUALIFIERS_ZONE_4, "ZONE_4"}, {FIT_EXD_QUALIFIERS_ZONE_3, "ZONE_3"},
+        {FIT_EXD_QUALIFIERS_ZONE_2, "ZONE_2"}, {FIT_EXD_QUALIFIERS_ZONE_1, "ZONE_1"},
+        {FIT_EXD_QUALIFIERS_INVALID, "INVALID"},
+    };
+    static const FitEnumName exd_descriptors_names[] = {
+        {FIT_EXD_DESCRIPTORS_BIKE_LIGHT_BATTERY_STATUS, "BIKE_LIGHT_BATTERY_STATUS"}, {FIT_EXD_DESCRIPTORS_BEAM_ANGLE_STATUS, "BEAM_ANGLE_STATUS"},
+        {FIT_EXD_DESCRIPTORS_BATERY_LEVEL, "BATERY_LEVEL"}, {FIT_EXD_DESCRIPTORS_LIGHT_NETWORK_MODE, "LIGHT_NETWORK_MODE"},
+        {FIT_EXD_DESCRIPTORS_NUMBER_LIGHTS_CONNECTED, "NUMBER_LIGHTS_CONNECTED"}, {FIT_EXD_DESCRIPTORS_CADENCE, "CADENCE"},
+        {FIT_EXD_DESCRIPTORS_DISTANCE, "DISTANCE"}, {FIT_EXD_DESCRIPTORS_ESTIMATED_TIME_OF_ARRIVAL, "ESTIMATED_TIME_OF_ARRIVAL"},
+        {FIT_EXD_DESCRIPTORS_HEADING, "HEADING"}, {FIT_EXD_DESCRIPTORS_TIME, "TIME"},
+        {FIT_EXD_DESCRIPTORS_BATTERY_LEVEL, "BATTERY_LEVEL"}, {FIT_EXD_DESCRIPTORS_TRAINER_RESISTANCE, "TRAINER_RESISTANCE"},
+        {FIT_EXD_DESCRIPTORS_TRAINER_TARGET_POWER, "TRAINER_TARGET_POWER"}, {FIT_EXD_DESCRIPTORS_TIME_SEATED, "TIME_SEATED"},
+        {FIT_EXD_DESCRIPTORS_TIME_STANDING, "TIME_STANDING"}, {FIT_EXD_DESCRIPTORS_ELEVATION, "ELEVATION"},
+        {FIT_EXD_DESCRIPTORS_GRADE, "GRADE"}, {FIT_EXD_DESCRIPTORS_ASCENT, "ASCENT"},
+        {FIT_EXD_DESCRIPTORS_DESCENT, "DESCENT"}, {FIT_EXD_DESCRIPTORS_VERTICAL_SPEED, "VERTICAL_SPEED"},
+        {FIT_EXD_DESCRIPTORS_DI2_BATTERY_LEVEL, "DI2_BATTERY_LEVEL"}, {FIT_EXD_DESCRIPTORS_FRONT_GEAR, "FRONT_GEAR"},
+        {FIT_EXD_DESCRIPTORS_REAR_GEAR, "REAR_GEAR"}, {FIT_EXD_DESCRIPTORS_GEAR_RATIO, "GEAR_RATIO"},
+        {FIT_EXD_DESCRIPTORS_HEART_RATE, "HEART_RATE"}, {FIT_EXD_DESCRIPTORS_HEART_RATE_ZONE, "HEART_RATE_ZONE"},
+        {FIT_EXD_DESCRIPTORS_TIME_IN_HEART_RATE_ZONE, "TIME_IN_HEART_RATE_ZONE"}, {FIT_EXD_DESCRIPTORS_HEART_RATE_RESERVE, "HEART_RATE_RESERVE"},
+        {FIT_EXD_DESCRIPTORS_CALORIES, "CALORIES"}, {FIT_EXD_DESCRIPTORS_GPS_ACCURACY, "GPS_ACCURACY"},
+        {FIT_EXD_DESCRIPTORS_GPS_SIGNAL_STRENGTH, "GPS_SIGNAL_STRENGTH"}, {FIT_EXD_DESCRIPTORS_TEMPERATURE, "TEMPERATURE"},
+        {FIT_EXD_DESCRIPTORS_TIME_OF_DAY, "TIME_OF_DAY"}, {FIT_EXD_DESCRIPTORS_BALANCE, "BALANCE"},
+        {FIT_EXD_DESCRIPTORS_PEDAL_SMOOTHNESS, "PEDAL_SMOOTHNESS"}, {FIT_EXD_DESCRIPTORS_POWER, "POWER"},
+        {FIT_EXD_DESCRIPTORS_FUNCTIONAL_THRESHOLD_POWER, "FUNCTIONAL_THRESHOLD_POWER"}, {FIT_EXD_DESCRIPTORS_INTENSITY_FACTOR, "INTENSITY_FACTOR"},
+        {FIT_EXD_DESCRIPTORS_WORK, "WORK"}, {FIT_EXD_DESCRIPTORS_POWER_RATIO, "POWER_RATIO"},
+        {FIT_EXD_DESCRIPTORS_NORMALIZED_POWER, "NORMALIZED_POWER"}, {FIT_EXD_DESCRIPTORS_TRAINING_STRESS_SCORE, "TRAINING_STRESS_SCORE"},
+        {FIT_EXD_DESCRIPTORS_TIME_ON_ZONE, "TIME_ON_ZONE"}, {FIT_EXD_DESCRIPTORS_SPEED, "SPEED"},
+        {FIT_EXD_DESCRIPTORS_LAPS, "LAPS"}, {FIT_EXD_DESCRIPTORS_REPS, "REPS"},
+        {FIT_EXD_DESCRIPTORS_WORKOUT_STEP, "WORKOUT_STEP"}, {FIT_EXD_DESCRIPTORS_COURSE_DISTANCE, "COURSE_DISTANCE"},
+        {FIT_EXD_DESCRIPTORS_NAVIGATION_DISTANCE, "NAVIGATION_DISTANCE"}, {FIT_EXD_DESCRIPTORS_COURSE_ESTIMATED_TIME_OF_ARRIVAL, "COURSE_ESTIMATED_TIME_OF_ARRIVAL"},
+        {FIT_EXD_DESCRIPTORS_NAVIGATION_ESTIMATED_TIME_OF_ARRIVAL, "NAVIGATION_ESTIMATED_TIME_OF_ARRIVAL"}, {FIT_EXD_DESCRIPTORS_COURSE_TIME, "COURSE_TIME"},
+        {FIT_EXD_DESCRIPTORS_NAVIGATION_TIME, "NAVIGATION_TIME"}, {FIT_EXD_DESCRIPTORS_COURSE_HEADING, "COURSE_HEADING"},
+        {FIT_EXD_DESCRIPTORS_NAVIGATION_HEADING, "NAVIGATION_HEADING"}, {FIT_EXD_DESCRIPTORS_POWER_ZONE, "POWER_ZONE"},
+        {FIT_EXD_DESCRIPTORS_TORQUE_EFFECTIVENESS, "TORQUE_EFFECTIVENESS"}, {FIT_EXD_DESCRIPTORS_TIMER_TIME, "TIMER_TIME"},
+        {FIT_EXD_DESCRIPTORS_POWER_WEIGHT_RATIO, "POWER_WEIGHT_RATIO"}, {FIT_EXD_DESCRIPTORS_LEFT_PLATFORM_CENTER_OFFSET, "LEFT_PLATFORM_CENTER_OFFSET"},
+        {FIT_EXD_DESCRIPTORS_RIGHT_PLATFORM_CENTER_OFFSET, "RIGHT_PLATFORM_CENTER_OFFSET"}, {FIT_EXD_DESCRIPTORS_LEFT_POWER_PHASE_START_ANGLE, "LEFT_POWER_PHASE_START_ANGLE"},
+        {FIT_EXD_DESCRIPTORS_RIGHT_POWER_PHASE_START_ANGLE, "RIGHT_POWER_PHASE_START_ANGLE"}, {FIT_EXD_DESCRIPTORS_LEFT_POWER_PHASE_FINISH_ANGLE, "LEFT_POWER_PHASE_FINISH_ANGLE"},
+        {FIT_EXD_DESCRIPTORS_RIGHT_POWER_PHASE_FINISH_ANGLE, "RIGHT_POWER_PHASE_FINISH_ANGLE"}, {FIT_EXD_DESCRIPTORS_GEARS, "GEARS"},
+        {FIT_EXD_DESCRIPTORS_PACE, "PACE"}, {FIT_EXD_DESCRIPTORS_TRAINING_EFFECT, "TRAINING_EFFECT"},
+        {FIT_EXD_DESCRIPTORS_VERTICAL_OSCILLATION, "VERTICAL_OSCILLATION"}, {FIT_EXD_DESCRIPTORS_VERTICAL_RATIO, "VERTICAL_RATIO"},
+        {FIT_EXD_DESCRIPTORS_GROUND_CONTACT_TIME, "GROUND_CONTACT_TIME"}, {FIT_EXD_DESCRIPTORS_LEFT_GROUND_CONTACT_TIME_BALANCE, "LEFT_GROUND_CONTACT_TIME_BALANCE"},
+        {FIT_EXD_DESCRIPTORS_RIGHT_GROUND_CONTACT_TIME_BALANCE, "RIGHT_GROUND_CONTACT_TIME_BALANCE"}, {FIT_EXD_DESCRIPTORS_STRIDE_LENGTH, "STRIDE_LENGTH"},
+        {FIT_EXD_DESCRIPTORS_RUNNING_CADENCE, "RUNNING_CADENCE"}, {FIT_EXD_DESCRIPTORS_PERFORMANCE_CONDITION, "PERFORMANCE_CONDITION"},
+        {FIT_EXD_DESCRIPTORS_COURSE_TYPE, "COURSE_TYPE"}, {FIT_EXD_DESCRIPTORS_TIME_IN_POWER_ZONE, "TIME_IN_POWER_ZONE"},
+        {FIT_EXD_DESCRIPTORS_NAVIGATION_TURN, "NAVIGATION_TURN"}, {FIT_EXD_DESCRIPTORS_COURSE_LOCATION, "COURSE_LOCATION"},
+        {FIT_EXD_DESCRIPTORS_NAVIGATION_LOCATION, "NAVIGATION_LOCATION"}, {FIT_EXD_DESCRIPTORS_COMPASS, "COMPASS"},
+        {FIT_EXD_DESCRIPTORS_GEAR_COMBO, "GEAR_COMBO"}, {FIT_EXD_DESCRIPTORS_MUSCLE_OXYGEN, "MUSCLE_OXYGEN"},
+        {FIT_EXD_DESCRIPTORS_ICON, "ICON"}, {FIT_EXD_DESCRIPTORS_COMPASS_HEADING, "COMPASS_HEADING"},
+        {FIT_EXD_DESCRIPTORS_GPS_HEADING, "GPS_HEADING"}, {FIT_EXD_DESCRIPTORS_GPS_ELEVATION, "GPS_ELEVATION"},
+        {FIT_EXD_DESCRIPTORS_ANAEROBIC_TRAINING_EFFECT, "ANAEROBIC_TRAINING_EFFECT"}, {FIT_EXD_DESCRIPTORS_COURSE, "COURSE"},
+        {FIT_EXD_DESCRIPTORS_OFF_COURSE, "OFF_COURSE"}, {FIT_EXD_DESCRIPTORS_GLIDE_RATIO, "GLIDE_RATIO"},
+        {FIT_EXD_DESCRIPTORS_VERTICAL_DISTANCE, "VERTICAL_DISTANCE"}, {FIT_EXD_DESCRIPTORS_VMG, "VMG"},
+        {FIT_EXD_DESCRIPTORS_AMBIENT_PRESSURE, "AMBIENT_PRESSURE"}, {FIT_EXD_DESCRIPTORS_PRESSURE, "PRESSURE"},
+        {FIT_EXD_DESCRIPTORS_VAM, "VAM"}, {FIT_EXD_DESCRIPTORS_INVALID, "INVALID"},
+    };
+    static const FitEnumName auto_activity_detect_names[] = {
+        {FIT_AUTO_ACTIVITY_DETECT_NONE, "NONE"}, {FIT_AUTO_ACTIVITY_DETECT_RUNNING, "RUNNING"},
+        {FIT_AUTO_ACTIVITY_DETECT_CYCLING, "CYCLING"}, {FIT_AUTO_ACTIVITY_DETECT_SWIMMING, "SWIMMING"},
+        {FIT_AUTO_ACTIVITY_DETECT_WALKING, "WALKING"}, {FIT_AUTO_ACTIVITY_DETECT_ELLIPTICAL, "ELLIPTICAL"},
+        {FIT_AUTO_ACTIVITY_DETECT_SEDENTARY, "SEDENTARY"}, {FIT_AUTO_ACTIVITY_DETECT_INVALID, "INVALID"},
+    };
+    static const FitEnumName supported_exd_screen_layouts_names[] = {
+        {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_INVALID, "INVALID"}, {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_FULL_SCREEN, "FULL_SCREEN"},
+        {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_HALF_VERTICAL, "HALF_VERTICAL"}, {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_HALF_HORIZONTAL, "HALF_HORIZONTAL"},
+        {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_HALF_VERTICAL_RIGHT_SPLIT, "HALF_VERTICAL_RIGHT_SPLIT"}, {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_HALF_HORIZONTAL_BOTTOM_SPLIT, "HALF_HORIZONTAL_BOTTOM_SPLIT"},
+        {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_FULL_QUARTER_SPLIT, "FULL_QUARTER_SPLIT"}, {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_HALF_VERTICAL_LEFT_SPLIT, "HALF_VERTICAL_LEFT_SPLIT"},
+        {FIT_SUPPORTED_EXD_SCREEN_LAYOUTS_HALF_HORIZONTAL_TOP_SPLIT, "HALF_HORIZONTAL_TOP_SPLIT"},
+    };
+    static const FitEnumName fit_base_type_names[] = {
+        {FIT_FIT_BASE_TYPE_ENUM, "ENUM"}, {FIT_FIT_BASE_TYPE_SINT8, "SINT8"},
+        {FIT_FIT_BASE_TYPE_UINT8, "UINT8"}, {FIT_FIT_BASE_TYPE_STRING, "STRING"},
+        {FIT_FIT_BASE_TYPE_UINT8Z, "UINT8Z"}, {FIT_FIT_BASE_TYPE_BYTE, "BYTE"},
+        {FIT_FIT_BASE_TYPE_SINT16, "SINT16"}, {FIT_FIT_BASE_TYPE_UINT16, "UINT16"},
+        {FIT_FIT_BASE_TYPE_SINT32, "SINT32"}, {FIT_FIT_BASE_TYPE_UINT32, "UINT32"},
+        {FIT_FIT_BASE_TYPE_FLOAT32, "FLOAT32"}, {FIT_FIT_BASE_TYPE_FLOAT64, "FLOAT64"},
+        {FIT_FIT_BASE_TYPE_UINT16Z, "UINT16Z"}, {FIT_FIT_BASE_TYPE_UINT32Z, "UINT32Z"},
+        {FIT_FIT_BASE_TYPE_SINT64, "SINT64"}, {FIT_FIT_BASE_TYPE_UINT64, "UINT64"},
+        {FIT_FIT_BASE_TYPE_UINT64Z, "UINT64Z"}, {FIT_FIT_BASE_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName turn_type_names[] = {
+        {FIT_TURN_TYPE_ARRIVING_IDX, "ARRIVING_IDX"}, {FIT_TURN_TYPE_ARRIVING_LEFT_IDX, "ARRIVING_LEFT_IDX"},
+        {FIT_TURN_TYPE_ARRIVING_RIGHT_IDX, "ARRIVING_RIGHT_IDX"}, {FIT_TURN_TYPE_ARRIVING_VIA_IDX, "ARRIVING_VIA_IDX"},
+        {FIT_TURN_TYPE_ARRIVING_VIA_LEFT_IDX, "ARRIVING_VIA_LEFT_IDX"}, {FIT_TURN_TYPE_ARRIVING_VIA_RIGHT_IDX, "ARRIVING_VIA_RIGHT_IDX"},
+        {FIT_TURN_TYPE_BEAR_KEEP_LEFT_IDX, "BEAR_KEEP_LEFT_IDX"}, {FIT_TURN_TYPE_BEAR_KEEP_RIGHT_IDX, "BEAR_KEEP_RIGHT_IDX"},
+        {FIT_TURN_TYPE_CONTINUE_IDX, "CONTINUE_IDX"}, {FIT_TURN_TYPE_EXIT_LEFT_IDX, "EXIT_LEFT_IDX"},
+        {FIT_TURN_TYPE_EXIT_RIGHT_IDX, "EXIT_RIGHT_IDX"}, {FIT_TURN_TYPE_FERRY_IDX, "FERRY_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_45_IDX, "ROUNDABOUT_45_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_90_IDX, "ROUNDABOUT_90_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_135_IDX, "ROUNDABOUT_135_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_180_IDX, "ROUNDABOUT_180_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_225_IDX, "ROUNDABOUT_225_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_270_IDX, "ROUNDABOUT_270_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_315_IDX, "ROUNDABOUT_315_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_360_IDX, "ROUNDABOUT_360_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_NEG_45_IDX, "ROUNDABOUT_NEG_45_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_NEG_90_IDX, "ROUNDABOUT_NEG_90_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_NEG_135_IDX, "ROUNDABOUT_NEG_135_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_NEG_180_IDX, "ROUNDABOUT_NEG_180_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_NEG_225_IDX, "ROUNDABOUT_NEG_225_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_NEG_270_IDX, "ROUNDABOUT_NEG_270_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_NEG_315_IDX, "ROUNDABOUT_NEG_315_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_NEG_360_IDX, "ROUNDABOUT_NEG_360_IDX"},
+        {FIT_TURN_TYPE_ROUNDABOUT_GENERIC_IDX, "ROUNDABOUT_GENERIC_IDX"}, {FIT_TURN_TYPE_ROUNDABOUT_NEG_GENERIC_IDX, "ROUNDABOUT_NEG_GENERIC_IDX"},
+        {FIT_TURN_TYPE_SHARP_TURN_LEFT_IDX, "SHARP_TURN_LEFT_IDX"}, {FIT_TURN_TYPE_SHARP_TURN_RIGHT_IDX, "SHARP_TURN_RIGHT_IDX"},
+        {FIT_TURN_TYPE_TURN_LEFT_IDX, "TURN_LEFT_IDX"}, {FIT_TURN_TYPE_TURN_RIGHT_IDX, "TURN_RIGHT_IDX"},
+        {FIT_TURN_TYPE_UTURN_LEFT_IDX, "UTURN_LEFT_IDX"}, {FIT_TURN_TYPE_UTURN_RIGHT_IDX, "UTURN_RIGHT_IDX"},
+        {FIT_TURN_TYPE_ICON_INV_IDX, "ICON_INV_IDX"}, {FIT_TURN_TYPE_ICON_IDX_CNT, "ICON_IDX_CNT"},
+        {FIT_TURN_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName bike_light_beam_angle_mode_names[] = {
+        {FIT_BIKE_LIGHT_BEAM_ANGLE_MODE_MANUAL, "MANUAL"}, {FIT_BIKE_LIGHT_BEAM_ANGLE_MODE_AUTO, "AUTO"},
+        {FIT_BIKE_LIGHT_BEAM_ANGLE_MODE_INVALID, "INVALID"},
+    };
+    static const FitEnumName fit_base_unit_names[] = {
+        {FIT_FIT_BASE_UNIT_OTHER, "OTHER"}, {FIT_FIT_BASE_UNIT_KILOGRAM, "KILOGRAM"},
+        {FIT_FIT_BASE_UNIT_POUND, "POUND"}, {FIT_FIT_BASE_UNIT_INVALID, "INVALID"},
+    };
+    static const FitEnumName set_type_names[] = {
+        {FIT_SET_TYPE_REST, "REST"}, {FIT_SET_TYPE_ACTIVE, "ACTIVE"},
+        {FIT_SET_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName exercise_category_names[] = {
+        {FIT_EXERCISE_CATEGORY_BENCH_PRESS, "BENCH_PRESS"}, {FIT_EXERCISE_CATEGORY_CALF_RAISE, "CALF_RAISE"},
+        {FIT_EXERCISE_CATEGORY_CARDIO, "CARDIO"}, {FIT_EXERCISE_CATEGORY_CARRY, "CARRY"},
+        {FIT_EXERCISE_CATEGORY_CHOP, "CHOP"}, {FIT_EXERCISE_CATEGORY_CORE, "CORE"},
+        {FIT_EXERCISE_CATEGORY_CRUNCH, "CRUNCH"}, {FIT_EXERCISE_CATEGORY_CURL, "CURL"},
+        {FIT_EXERCISE_CATEGORY_DEADLIFT, "DEADLIFT"}, {FIT_EXERCISE_CATEGORY_FLYE, "FLYE"},
+        {FIT_EXERCISE_CATEGORY_HIP_RAISE, "HIP_RAISE"}, {FIT_EXERCISE_CATEGORY_HIP_STABILITY, "HIP_STABILITY"},
+        {FIT_EXERCISE_CATEGORY_HIP_SWING, "HIP_SWING"}, {FIT_EXERCISE_CATEGORY_HYPEREXTENSION, "HYPEREXTENSION"},
+        {FIT_EXERCISE_CATEGORY_LATERAL_RAISE, "LATERAL_RAISE"}, {FIT_EXERCISE_CATEGORY_LEG_CURL, "LEG_CURL"},
+        {FIT_EXERCISE_CATEGORY_LEG_RAISE, "LEG_RAISE"}, {FIT_EXERCISE_CATEGORY_LUNGE, "LUNGE"},
+        {FIT_EXERCISE_CATEGORY_OLYMPIC_LIFT, "OLYMPIC_LIFT"}, {FIT_EXERCISE_CATEGORY_PLANK, "PLANK"},
+        {FIT_EXERCISE_CATEGORY_PLYO, "PLYO"}, {FIT_EXERCISE_CATEGORY_PULL_UP, "PULL_UP"},
+        {FIT_EXERCISE_CATEGORY_PUSH_UP, "PUSH_UP"}, {FIT_EXERCISE_CATEGORY_ROW, "ROW"},
+        {FIT_EXERCISE_CATEGORY_SHOULDER_PRESS, "SHOULDER_PRESS"}, {FIT_EXERCISE_CATEGORY_SHOULDER_STABILITY, "SHOULDER_STABILITY"},
+        {FIT_EXERCISE_CATEGORY_SHRUG, "SHRUG"}, {FIT_EXERCISE_CATEGORY_SIT_UP, "SIT_UP"},
+        {FIT_EXERCISE_CATEGORY_SQUAT, "SQUAT"}, {FIT_EXERCISE_CATEGORY_TOTAL_BODY, "TOTAL_BODY"},
+        {FIT_EXERCISE_CATEGORY_TRICEPS_EXTENSION, "TRICEPS_EXTENSION"}, {FIT_EXERCISE_CATEGORY_WARM_UP, "WARM_UP"},
+        {FIT_EXERCISE_CATEGORY_RUN, "RUN"}, {FIT_EXERCISE_CATEGORY_UNKNOWN, "UNKNOWN"},
+        {FIT_EXERCISE_CATEGORY_INVALID, "INVALID"},
+    };
+    static const FitEnumName bench_press_exercise_name_names[] = {
+        {FIT_BENCH_PRESS_EXERCISE_NAME_ALTERNATING_DUMBBELL_CHEST_PRESS_ON_SWISS_BALL, "ALTERNATING_DUMBBELL_CHEST_PRESS_ON_SWISS_BALL"}, {FIT_BENCH_PRESS_EXERCISE_NAME_BARBELL_BENCH_PRESS, "BARBELL_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_BARBELL_BOARD_BENCH_PRESS, "BARBELL_BOARD_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_BARBELL_FLOOR_PRESS, "BARBELL_FLOOR_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_CLOSE_GRIP_BARBELL_BENCH_PRESS, "CLOSE_GRIP_BARBELL_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_DECLINE_DUMBBELL_BENCH_PRESS, "DECLINE_DUMBBELL_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_DUMBBELL_BENCH_PRESS, "DUMBBELL_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_DUMBBELL_FLOOR_PRESS, "DUMBBELL_FLOOR_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_INCLINE_BARBELL_BENCH_PRESS, "INCLINE_BARBELL_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_INCLINE_DUMBBELL_BENCH_PRESS, "INCLINE_DUMBBELL_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_INCLINE_SMITH_MACHINE_BENCH_PRESS, "INCLINE_SMITH_MACHINE_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_ISOMETRIC_BARBELL_BENCH_PRESS, "ISOMETRIC_BARBELL_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_KETTLEBELL_CHEST_PRESS, "KETTLEBELL_CHEST_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_NEUTRAL_GRIP_DUMBBELL_BENCH_PRESS, "NEUTRAL_GRIP_DUMBBELL_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_NEUTRAL_GRIP_DUMBBELL_INCLINE_BENCH_PRESS, "NEUTRAL_GRIP_DUMBBELL_INCLINE_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_ONE_ARM_FLOOR_PRESS, "ONE_ARM_FLOOR_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_WEIGHTED_ONE_ARM_FLOOR_PRESS, "WEIGHTED_ONE_ARM_FLOOR_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_PARTIAL_LOCKOUT, "PARTIAL_LOCKOUT"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_REVERSE_GRIP_BARBELL_BENCH_PRESS, "REVERSE_GRIP_BARBELL_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_REVERSE_GRIP_INCLINE_BENCH_PRESS, "REVERSE_GRIP_INCLINE_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_SINGLE_ARM_CABLE_CHEST_PRESS, "SINGLE_ARM_CABLE_CHEST_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_SINGLE_ARM_DUMBBELL_BENCH_PRESS, "SINGLE_ARM_DUMBBELL_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_SMITH_MACHINE_BENCH_PRESS, "SMITH_MACHINE_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_SWISS_BALL_DUMBBELL_CHEST_PRESS, "SWISS_BALL_DUMBBELL_CHEST_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_TRIPLE_STOP_BARBELL_BENCH_PRESS, "TRIPLE_STOP_BARBELL_BENCH_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_WIDE_GRIP_BARBELL_BENCH_PRESS, "WIDE_GRIP_BARBELL_BENCH_PRESS"},
+        {FIT_BENCH_PRESS_EXERCISE_NAME_ALTERNATING_DUMBBELL_CHEST_PRESS, "ALTERNATING_DUMBBELL_CHEST_PRESS"}, {FIT_BENCH_PRESS_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName calf_raise_exercise_name_names[] = {
+        {FIT_CALF_RAISE_EXERCISE_NAME_3_WAY_CALF_RAISE, "3_WAY_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_3_WAY_WEIGHTED_CALF_RAISE, "3_WAY_WEIGHTED_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_3_WAY_SINGLE_LEG_CALF_RAISE, "3_WAY_SINGLE_LEG_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_3_WAY_WEIGHTED_SINGLE_LEG_CALF_RAISE, "3_WAY_WEIGHTED_SINGLE_LEG_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_DONKEY_CALF_RAISE, "DONKEY_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_WEIGHTED_DONKEY_CALF_RAISE, "WEIGHTED_DONKEY_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_SEATED_CALF_RAISE, "SEATED_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_WEIGHTED_SEATED_CALF_RAISE, "WEIGHTED_SEATED_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_SEATED_DUMBBELL_TOE_RAISE, "SEATED_DUMBBELL_TOE_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_SINGLE_LEG_BENT_KNEE_CALF_RAISE, "SINGLE_LEG_BENT_KNEE_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_BENT_KNEE_CALF_RAISE, "WEIGHTED_SINGLE_LEG_BENT_KNEE_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_SINGLE_LEG_DECLINE_PUSH_UP, "SINGLE_LEG_DECLINE_PUSH_UP"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_SINGLE_LEG_DONKEY_CALF_RAISE, "SINGLE_LEG_DONKEY_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_DONKEY_CALF_RAISE, "WEIGHTED_SINGLE_LEG_DONKEY_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_SINGLE_LEG_HIP_RAISE_WITH_KNEE_HOLD, "SINGLE_LEG_HIP_RAISE_WITH_KNEE_HOLD"}, {FIT_CALF_RAISE_EXERCISE_NAME_SINGLE_LEG_STANDING_CALF_RAISE, "SINGLE_LEG_STANDING_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_SINGLE_LEG_STANDING_DUMBBELL_CALF_RAISE, "SINGLE_LEG_STANDING_DUMBBELL_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_STANDING_BARBELL_CALF_RAISE, "STANDING_BARBELL_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_STANDING_CALF_RAISE, "STANDING_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_WEIGHTED_STANDING_CALF_RAISE, "WEIGHTED_STANDING_CALF_RAISE"},
+        {FIT_CALF_RAISE_EXERCISE_NAME_STANDING_DUMBBELL_CALF_RAISE, "STANDING_DUMBBELL_CALF_RAISE"}, {FIT_CALF_RAISE_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName cardio_exercise_name_names[] = {
+        {FIT_CARDIO_EXERCISE_NAME_BOB_AND_WEAVE_CIRCLE, "BOB_AND_WEAVE_CIRCLE"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_BOB_AND_WEAVE_CIRCLE, "WEIGHTED_BOB_AND_WEAVE_CIRCLE"},
+        {FIT_CARDIO_EXERCISE_NAME_CARDIO_CORE_CRAWL, "CARDIO_CORE_CRAWL"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_CARDIO_CORE_CRAWL, "WEIGHTED_CARDIO_CORE_CRAWL"},
+        {FIT_CARDIO_EXERCISE_NAME_DOUBLE_UNDER, "DOUBLE_UNDER"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_DOUBLE_UNDER, "WEIGHTED_DOUBLE_UNDER"},
+        {FIT_CARDIO_EXERCISE_NAME_JUMP_ROPE, "JUMP_ROPE"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_JUMP_ROPE, "WEIGHTED_JUMP_ROPE"},
+        {FIT_CARDIO_EXERCISE_NAME_JUMP_ROPE_CROSSOVER, "JUMP_ROPE_CROSSOVER"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_JUMP_ROPE_CROSSOVER, "WEIGHTED_JUMP_ROPE_CROSSOVER"},
+        {FIT_CARDIO_EXERCISE_NAME_JUMP_ROPE_JOG, "JUMP_ROPE_JOG"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_JUMP_ROPE_JOG, "WEIGHTED_JUMP_ROPE_JOG"},
+        {FIT_CARDIO_EXERCISE_NAME_JUMPING_JACKS, "JUMPING_JACKS"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_JUMPING_JACKS, "WEIGHTED_JUMPING_JACKS"},
+        {FIT_CARDIO_EXERCISE_NAME_SKI_MOGULS, "SKI_MOGULS"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_SKI_MOGULS, "WEIGHTED_SKI_MOGULS"},
+        {FIT_CARDIO_EXERCISE_NAME_SPLIT_JACKS, "SPLIT_JACKS"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_SPLIT_JACKS, "WEIGHTED_SPLIT_JACKS"},
+        {FIT_CARDIO_EXERCISE_NAME_SQUAT_JACKS, "SQUAT_JACKS"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_SQUAT_JACKS, "WEIGHTED_SQUAT_JACKS"},
+        {FIT_CARDIO_EXERCISE_NAME_TRIPLE_UNDER, "TRIPLE_UNDER"}, {FIT_CARDIO_EXERCISE_NAME_WEIGHTED_TRIPLE_UNDER, "WEIGHTED_TRIPLE_UNDER"},
+        {FIT_CARDIO_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName carry_exercise_name_names[] = {
+        {FIT_CARRY_EXERCISE_NAME_BAR_HOLDS, "BAR_HOLDS"}, {FIT_CARRY_EXERCISE_NAME_FARMERS_WALK, "FARMERS_WALK"},
+        {FIT_CARRY_EXERCISE_NAME_FARMERS_WALK_ON_TOES, "FARMERS_WALK_ON_TOES"}, {FIT_CARRY_EXERCISE_NAME_HEX_DUMBBELL_HOLD, "HEX_DUMBBELL_HOLD"},
+        {FIT_CARRY_EXERCISE_NAME_OVERHEAD_CARRY, "OVERHEAD_CARRY"}, {FIT_CARRY_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName chop_exercise_name_names[] = {
+        {FIT_CHOP_EXERCISE_NAME_CABLE_PULL_THROUGH, "CABLE_PULL_THROUGH"}, {FIT_CHOP_EXERCISE_NAME_CABLE_ROTATIONAL_LIFT, "CABLE_ROTATIONAL_LIFT"},
+        {FIT_CHOP_EXERCISE_NAME_CABLE_WOODCHOP, "CABLE_WOODCHOP"}, {FIT_CHOP_EXERCISE_NAME_CROSS_CHOP_TO_KNEE, "CROSS_CHOP_TO_KNEE"},
+        {FIT_CHOP_EXERCISE_NAME_WEIGHTED_CROSS_CHOP_TO_KNEE, "WEIGHTED_CROSS_CHOP_TO_KNEE"}, {FIT_CHOP_EXERCISE_NAME_DUMBBELL_CHOP, "DUMBBELL_CHOP"},
+        {FIT_CHOP_EXERCISE_NAME_HALF_KNEELING_ROTATION, "HALF_KNEELING_ROTATION"}, {FIT_CHOP_EXERCISE_NAME_WEIGHTED_HALF_KNEELING_ROTATION, "WEIGHTED_HALF_KNEELING_ROTATION"},
+        {FIT_CHOP_EXERCISE_NAME_HALF_KNEELING_ROTATIONAL_CHOP, "HALF_KNEELING_ROTATIONAL_CHOP"}, {FIT_CHOP_EXERCISE_NAME_HALF_KNEELING_ROTATIONAL_REVERSE_CHOP, "HALF_KNEELING_ROTATIONAL_REVERSE_CHOP"},
+        {FIT_CHOP_EXERCISE_NAME_HALF_KNEELING_STABILITY_CHOP, "HALF_KNEELING_STABILITY_CHOP"}, {FIT_CHOP_EXERCISE_NAME_HALF_KNEELING_STABILITY_REVERSE_CHOP, "HALF_KNEELING_STABILITY_REVERSE_CHOP"},
+        {FIT_CHOP_EXERCISE_NAME_KNEELING_ROTATIONAL_CHOP, "KNEELING_ROTATIONAL_CHOP"}, {FIT_CHOP_EXERCISE_NAME_KNEELING_ROTATIONAL_REVERSE_CHOP, "KNEELING_ROTATIONAL_REVERSE_CHOP"},
+        {FIT_CHOP_EXERCISE_NAME_KNEELING_STABILITY_CHOP, "KNEELING_STABILITY_CHOP"}, {FIT_CHOP_EXERCISE_NAME_KNEELING_WOODCHOPPER, "KNEELING_WOODCHOPPER"},
+        {FIT_CHOP_EXERCISE_NAME_MEDICINE_BALL_WOOD_CHOPS, "MEDICINE_BALL_WOOD_CHOPS"}, {FIT_CHOP_EXERCISE_NAME_POWER_SQUAT_CHOPS, "POWER_SQUAT_CHOPS"},
+        {FIT_CHOP_EXERCISE_NAME_WEIGHTED_POWER_SQUAT_CHOPS, "WEIGHTED_POWER_SQUAT_CHOPS"}, {FIT_CHOP_EXERCISE_NAME_STANDING_ROTATIONAL_CHOP, "STANDING_ROTATIONAL_CHOP"},
+        {FIT_CHOP_EXERCISE_NAME_STANDING_SPLIT_ROTATIONAL_CHOP, "STANDING_SPLIT_ROTATIONAL_CHOP"}, {FIT_CHOP_EXERCISE_NAME_STANDING_SPLIT_ROTATIONAL_REVERSE_CHOP, "STANDING_SPLIT_ROTATIONAL_REVERSE_CHOP"},
+        {FIT_CHOP_EXERCISE_NAME_STANDING_STABILITY_REVERSE_CHOP, "STANDING_STABILITY_REVERSE_CHOP"}, {FIT_CHOP_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName core_exercise_name_names[] = {
+        {FIT_CORE_EXERCISE_NAME_ABS_JABS, "ABS_JABS"}, {FIT_CORE_EXERCISE_NAME_WEIGHTED_ABS_JABS, "WEIGHTED_ABS_JABS"},
+        {FIT_CORE_EXERCISE_NAME_ALTERNATING_PLATE_REACH, "ALTERNATING_PLATE_REACH"}, {FIT_CORE_EXERCISE_NAME_BARBELL_ROLLOUT, "BARBELL_ROLLOUT"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_BARBELL_ROLLOUT, "WEIGHTED_BARBELL_ROLLOUT"}, {FIT_CORE_EXERCISE_NAME_BODY_BAR_OBLIQUE_TWIST, "BODY_BAR_OBLIQUE_TWIST"},
+        {FIT_CORE_EXERCISE_NAME_CABLE_CORE_PRESS, "CABLE_CORE_PRESS"}, {FIT_CORE_EXERCISE_NAME_CABLE_SIDE_BEND, "CABLE_SIDE_BEND"},
+        {FIT_CORE_EXERCISE_NAME_SIDE_BEND, "SIDE_BEND"}, {FIT_CORE_EXERCISE_NAME_WEIGHTED_SIDE_BEND, "WEIGHTED_SIDE_BEND"},
+        {FIT_CORE_EXERCISE_NAME_CRESCENT_CIRCLE, "CRESCENT_CIRCLE"}, {FIT_CORE_EXERCISE_NAME_WEIGHTED_CRESCENT_CIRCLE, "WEIGHTED_CRESCENT_CIRCLE"},
+        {FIT_CORE_EXERCISE_NAME_CYCLING_RUSSIAN_TWIST, "CYCLING_RUSSIAN_TWIST"}, {FIT_CORE_EXERCISE_NAME_WEIGHTED_CYCLING_RUSSIAN_TWIST, "WEIGHTED_CYCLING_RUSSIAN_TWIST"},
+        {FIT_CORE_EXERCISE_NAME_ELEVATED_FEET_RUSSIAN_TWIST, "ELEVATED_FEET_RUSSIAN_TWIST"}, {FIT_CORE_EXERCISE_NAME_WEIGHTED_ELEVATED_FEET_RUSSIAN_TWIST, "WEIGHTED_ELEVATED_FEET_RUSSIAN_TWIST"},
+        {FIT_CORE_EXERCISE_NAME_HALF_TURKISH_GET_UP, "HALF_TURKISH_GET_UP"}, {FIT_CORE_EXERCISE_NAME_KETTLEBELL_WINDMILL, "KETTLEBELL_WINDMILL"},
+        {FIT_CORE_EXERCISE_NAME_KNEELING_AB_WHEEL, "KNEELING_AB_WHEEL"}, {FIT_CORE_EXERCISE_NAME_WEIGHTED_KNEELING_AB_WHEEL, "WEIGHTED_KNEELING_AB_WHEEL"},
+        {FIT_CORE_EXERCISE_NAME_MODIFIED_FRONT_LEVER, "MODIFIED_FRONT_LEVER"}, {FIT_CORE_EXERCISE_NAME_OPEN_KNEE_TUCKS, "OPEN_KNEE_TUCKS"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_OPEN_KNEE_TUCKS, "WEIGHTED_OPEN_KNEE_TUCKS"}, {FIT_CORE_EXERCISE_NAME_SIDE_ABS_LEG_LIFT, "SIDE_ABS_LEG_LIFT"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_SIDE_ABS_LEG_LIFT, "WEIGHTED_SIDE_ABS_LEG_LIFT"}, {FIT_CORE_EXERCISE_NAME_SWISS_BALL_JACKKNIFE, "SWISS_BALL_JACKKNIFE"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_SWISS_BALL_JACKKNIFE, "WEIGHTED_SWISS_BALL_JACKKNIFE"}, {FIT_CORE_EXERCISE_NAME_SWISS_BALL_PIKE, "SWISS_BALL_PIKE"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PIKE, "WEIGHTED_SWISS_BALL_PIKE"}, {FIT_CORE_EXERCISE_NAME_SWISS_BALL_ROLLOUT, "SWISS_BALL_ROLLOUT"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_SWISS_BALL_ROLLOUT, "WEIGHTED_SWISS_BALL_ROLLOUT"}, {FIT_CORE_EXERCISE_NAME_TRIANGLE_HIP_PRESS, "TRIANGLE_HIP_PRESS"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_TRIANGLE_HIP_PRESS, "WEIGHTED_TRIANGLE_HIP_PRESS"}, {FIT_CORE_EXERCISE_NAME_TRX_SUSPENDED_JACKKNIFE, "TRX_SUSPENDED_JACKKNIFE"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_TRX_SUSPENDED_JACKKNIFE, "WEIGHTED_TRX_SUSPENDED_JACKKNIFE"}, {FIT_CORE_EXERCISE_NAME_U_BOAT, "U_BOAT"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_U_BOAT, "WEIGHTED_U_BOAT"}, {FIT_CORE_EXERCISE_NAME_WINDMILL_SWITCHES, "WINDMILL_SWITCHES"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_WINDMILL_SWITCHES, "WEIGHTED_WINDMILL_SWITCHES"}, {FIT_CORE_EXERCISE_NAME_ALTERNATING_SLIDE_OUT, "ALTERNATING_SLIDE_OUT"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_ALTERNATING_SLIDE_OUT, "WEIGHTED_ALTERNATING_SLIDE_OUT"}, {FIT_CORE_EXERCISE_NAME_GHD_BACK_EXTENSIONS, "GHD_BACK_EXTENSIONS"},
+        {FIT_CORE_EXERCISE_NAME_WEIGHTED_GHD_BACK_EXTENSIONS, "WEIGHTED_GHD_BACK_EXTENSIONS"}, {FIT_CORE_EXERCISE_NAME_OVERHEAD_WALK, "OVERHEAD_WALK"},
+        {FIT_CORE_EXERCISE_NAME_INCHWORM, "INCHWORM"}, {FIT_CORE_EXERCISE_NAME_WEIGHTED_MODIFIED_FRONT_LEVER, "WEIGHTED_MODIFIED_FRONT_LEVER"},
+        {FIT_CORE_EXERCISE_NAME_RUSSIAN_TWIST, "RUSSIAN_TWIST"}, {FIT_CORE_EXERCISE_NAME_ABDOMINAL_LEG_ROTATIONS, "ABDOMINAL_LEG_ROTATIONS"},
+        {FIT_CORE_EXERCISE_NAME_ARM_AND_LEG_EXTENSION_ON_KNEES, "ARM_AND_LEG_EXTENSION_ON_KNEES"}, {FIT_CORE_EXERCISE_NAME_BICYCLE, "BICYCLE"},
+        {FIT_CORE_EXERCISE_NAME_BICEP_CURL_WITH_LEG_EXTENSION, "BICEP_CURL_WITH_LEG_EXTENSION"}, {FIT_CORE_EXERCISE_NAME_CAT_COW, "CAT_COW"},
+        {FIT_CORE_EXERCISE_NAME_CORKSCREW, "CORKSCREW"}, {FIT_CORE_EXERCISE_NAME_CRISS_CROSS, "CRISS_CROSS"},
+        {FIT_CORE_EXERCISE_NAME_CRISS_CROSS_WITH_BALL, "CRISS_CROSS_WITH_BALL"}, {FIT_CORE_EXERCISE_NAME_DOUBLE_LEG_STRETCH, "DOUBLE_LEG_STRETCH"},
+        {FIT_CORE_EXERCISE_NAME_KNEE_FOLDS, "KNEE_FOLDS"}, {FIT_CORE_EXERCISE_NAME_LOWER_LIFT, "LOWER_LIFT"},
+        {FIT_CORE_EXERCISE_NAME_NECK_PULL, "NECK_PULL"}, {FIT_CORE_EXERCISE_NAME_PELVIC_CLOCKS, "PELVIC_CLOCKS"},
+        {FIT_CORE_EXERCISE_NAME_ROLL_OVER, "ROLL_OVER"}, {FIT_CORE_EXERCISE_NAME_ROLL_UP, "ROLL_UP"},
+        {FIT_CORE_EXERCISE_NAME_ROLLING, "ROLLING"}, {FIT_CORE_EXERCISE_NAME_ROWING_1, "ROWING_1"},
+        {FIT_CORE_EXERCISE_NAME_ROWING_2, "ROWING_2"}, {FIT_CORE_EXERCISE_NAME_SCISSORS, "SCISSORS"},
+        {FIT_CORE_EXERCISE_NAME_SINGLE_LEG_CIRCLES, "SINGLE_LEG_CIRCLES"}, {FIT_CORE_EXERCISE_NAME_SINGLE_LEG_STRETCH, "SINGLE_LEG_STRETCH"},
+        {FIT_CORE_EXERCISE_NAME_SNAKE_TWIST_1_AND_2, "SNAKE_TWIST_1_AND_2"}, {FIT_CORE_EXERCISE_NAME_SWAN, "SWAN"},
+        {FIT_CORE_EXERCISE_NAME_SWIMMING, "SWIMMING"}, {FIT_CORE_EXERCISE_NAME_TEASER, "TEASER"},
+        {FIT_CORE_EXERCISE_NAME_THE_HUNDRED, "THE_HUNDRED"}, {FIT_CORE_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName crunch_exercise_name_names[] = {
+        {FIT_CRUNCH_EXERCISE_NAME_BICYCLE_CRUNCH, "BICYCLE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_CABLE_CRUNCH, "CABLE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_CIRCULAR_ARM_CRUNCH, "CIRCULAR_ARM_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_CROSSED_ARMS_CRUNCH, "CROSSED_ARMS_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_CROSSED_ARMS_CRUNCH, "WEIGHTED_CROSSED_ARMS_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_CROSS_LEG_REVERSE_CRUNCH, "CROSS_LEG_REVERSE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_CROSS_LEG_REVERSE_CRUNCH, "WEIGHTED_CROSS_LEG_REVERSE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_CRUNCH_CHOP, "CRUNCH_CHOP"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_CRUNCH_CHOP, "WEIGHTED_CRUNCH_CHOP"}, {FIT_CRUNCH_EXERCISE_NAME_DOUBLE_CRUNCH, "DOUBLE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_DOUBLE_CRUNCH, "WEIGHTED_DOUBLE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_ELBOW_TO_KNEE_CRUNCH, "ELBOW_TO_KNEE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_ELBOW_TO_KNEE_CRUNCH, "WEIGHTED_ELBOW_TO_KNEE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_FLUTTER_KICKS, "FLUTTER_KICKS"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_FLUTTER_KICKS, "WEIGHTED_FLUTTER_KICKS"}, {FIT_CRUNCH_EXERCISE_NAME_FOAM_ROLLER_REVERSE_CRUNCH_ON_BENCH, "FOAM_ROLLER_REVERSE_CRUNCH_ON_BENCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_FOAM_ROLLER_REVERSE_CRUNCH_ON_BENCH, "WEIGHTED_FOAM_ROLLER_REVERSE_CRUNCH_ON_BENCH"}, {FIT_CRUNCH_EXERCISE_NAME_FOAM_ROLLER_REVERSE_CRUNCH_WITH_DUMBBELL, "FOAM_ROLLER_REVERSE_CRUNCH_WITH_DUMBBELL"},
+        {FIT_CRUNCH_EXERCISE_NAME_FOAM_ROLLER_REVERSE_CRUNCH_WITH_MEDICINE_BALL, "FOAM_ROLLER_REVERSE_CRUNCH_WITH_MEDICINE_BALL"}, {FIT_CRUNCH_EXERCISE_NAME_FROG_PRESS, "FROG_PRESS"},
+        {FIT_CRUNCH_EXERCISE_NAME_HANGING_KNEE_RAISE_OBLIQUE_CRUNCH, "HANGING_KNEE_RAISE_OBLIQUE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_HANGING_KNEE_RAISE_OBLIQUE_CRUNCH, "WEIGHTED_HANGING_KNEE_RAISE_OBLIQUE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_HIP_CROSSOVER, "HIP_CROSSOVER"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_HIP_CROSSOVER, "WEIGHTED_HIP_CROSSOVER"},
+        {FIT_CRUNCH_EXERCISE_NAME_HOLLOW_ROCK, "HOLLOW_ROCK"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_HOLLOW_ROCK, "WEIGHTED_HOLLOW_ROCK"},
+        {FIT_CRUNCH_EXERCISE_NAME_INCLINE_REVERSE_CRUNCH, "INCLINE_REVERSE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_INCLINE_REVERSE_CRUNCH, "WEIGHTED_INCLINE_REVERSE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_KNEELING_CABLE_CRUNCH, "KNEELING_CABLE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_KNEELING_CROSS_CRUNCH, "KNEELING_CROSS_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_KNEELING_CROSS_CRUNCH, "WEIGHTED_KNEELING_CROSS_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_KNEELING_OBLIQUE_CABLE_CRUNCH, "KNEELING_OBLIQUE_CABLE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_KNEES_TO_ELBOW, "KNEES_TO_ELBOW"}, {FIT_CRUNCH_EXERCISE_NAME_LEG_EXTENSIONS, "LEG_EXTENSIONS"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_LEG_EXTENSIONS, "WEIGHTED_LEG_EXTENSIONS"}, {FIT_CRUNCH_EXERCISE_NAME_LEG_LEVERS, "LEG_LEVERS"},
+        {FIT_CRUNCH_EXERCISE_NAME_MCGILL_CURL_UP, "MCGILL_CURL_UP"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_MCGILL_CURL_UP, "WEIGHTED_MCGILL_CURL_UP"},
+        {FIT_CRUNCH_EXERCISE_NAME_MODIFIED_PILATES_ROLL_UP_WITH_BALL, "MODIFIED_PILATES_ROLL_UP_WITH_BALL"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_MODIFIED_PILATES_ROLL_UP_WITH_BALL, "WEIGHTED_MODIFIED_PILATES_ROLL_UP_WITH_BALL"},
+        {FIT_CRUNCH_EXERCISE_NAME_PILATES_CRUNCH, "PILATES_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_PILATES_CRUNCH, "WEIGHTED_PILATES_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_PILATES_ROLL_UP_WITH_BALL, "PILATES_ROLL_UP_WITH_BALL"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_PILATES_ROLL_UP_WITH_BALL, "WEIGHTED_PILATES_ROLL_UP_WITH_BALL"},
+        {FIT_CRUNCH_EXERCISE_NAME_RAISED_LEGS_CRUNCH, "RAISED_LEGS_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_RAISED_LEGS_CRUNCH, "WEIGHTED_RAISED_LEGS_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_REVERSE_CRUNCH, "REVERSE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_REVERSE_CRUNCH, "WEIGHTED_REVERSE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_REVERSE_CRUNCH_ON_A_BENCH, "REVERSE_CRUNCH_ON_A_BENCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_REVERSE_CRUNCH_ON_A_BENCH, "WEIGHTED_REVERSE_CRUNCH_ON_A_BENCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_REVERSE_CURL_AND_LIFT, "REVERSE_CURL_AND_LIFT"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_REVERSE_CURL_AND_LIFT, "WEIGHTED_REVERSE_CURL_AND_LIFT"},
+        {FIT_CRUNCH_EXERCISE_NAME_ROTATIONAL_LIFT, "ROTATIONAL_LIFT"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_ROTATIONAL_LIFT, "WEIGHTED_ROTATIONAL_LIFT"},
+        {FIT_CRUNCH_EXERCISE_NAME_SEATED_ALTERNATING_REVERSE_CRUNCH, "SEATED_ALTERNATING_REVERSE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SEATED_ALTERNATING_REVERSE_CRUNCH, "WEIGHTED_SEATED_ALTERNATING_REVERSE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_SEATED_LEG_U, "SEATED_LEG_U"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SEATED_LEG_U, "WEIGHTED_SEATED_LEG_U"},
+        {FIT_CRUNCH_EXERCISE_NAME_SIDE_TO_SIDE_CRUNCH_AND_WEAVE, "SIDE_TO_SIDE_CRUNCH_AND_WEAVE"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SIDE_TO_SIDE_CRUNCH_AND_WEAVE, "WEIGHTED_SIDE_TO_SIDE_CRUNCH_AND_WEAVE"},
+        {FIT_CRUNCH_EXERCISE_NAME_SINGLE_LEG_REVERSE_CRUNCH, "SINGLE_LEG_REVERSE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_REVERSE_CRUNCH, "WEIGHTED_SINGLE_LEG_REVERSE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_SKATER_CRUNCH_CROSS, "SKATER_CRUNCH_CROSS"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SKATER_CRUNCH_CROSS, "WEIGHTED_SKATER_CRUNCH_CROSS"},
+        {FIT_CRUNCH_EXERCISE_NAME_STANDING_CABLE_CRUNCH, "STANDING_CABLE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_STANDING_SIDE_CRUNCH, "STANDING_SIDE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_STEP_CLIMB, "STEP_CLIMB"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_STEP_CLIMB, "WEIGHTED_STEP_CLIMB"},
+        {FIT_CRUNCH_EXERCISE_NAME_SWISS_BALL_CRUNCH, "SWISS_BALL_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_SWISS_BALL_REVERSE_CRUNCH, "SWISS_BALL_REVERSE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SWISS_BALL_REVERSE_CRUNCH, "WEIGHTED_SWISS_BALL_REVERSE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_SWISS_BALL_RUSSIAN_TWIST, "SWISS_BALL_RUSSIAN_TWIST"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SWISS_BALL_RUSSIAN_TWIST, "WEIGHTED_SWISS_BALL_RUSSIAN_TWIST"}, {FIT_CRUNCH_EXERCISE_NAME_SWISS_BALL_SIDE_CRUNCH, "SWISS_BALL_SIDE_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SWISS_BALL_SIDE_CRUNCH, "WEIGHTED_SWISS_BALL_SIDE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_THORACIC_CRUNCHES_ON_FOAM_ROLLER, "THORACIC_CRUNCHES_ON_FOAM_ROLLER"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_THORACIC_CRUNCHES_ON_FOAM_ROLLER, "WEIGHTED_THORACIC_CRUNCHES_ON_FOAM_ROLLER"}, {FIT_CRUNCH_EXERCISE_NAME_TRICEPS_CRUNCH, "TRICEPS_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_BICYCLE_CRUNCH, "WEIGHTED_BICYCLE_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_CRUNCH, "WEIGHTED_CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_SWISS_BALL_CRUNCH, "WEIGHTED_SWISS_BALL_CRUNCH"}, {FIT_CRUNCH_EXERCISE_NAME_TOES_TO_BAR, "TOES_TO_BAR"},
+        {FIT_CRUNCH_EXERCISE_NAME_WEIGHTED_TOES_TO_BAR, "WEIGHTED_TOES_TO_BAR"}, {FIT_CRUNCH_EXERCISE_NAME_CRUNCH, "CRUNCH"},
+        {FIT_CRUNCH_EXERCISE_NAME_STRAIGHT_LEG_CRUNCH_WITH_BALL, "STRAIGHT_LEG_CRUNCH_WITH_BALL"}, {FIT_CRUNCH_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName curl_exercise_name_names[] = {
+        {FIT_CURL_EXERCISE_NAME_ALTERNATING_DUMBBELL_BICEPS_CURL, "ALTERNATING_DUMBBELL_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_ALTERNATING_DUMBBELL_BICEPS_CURL_ON_SWISS_BALL, "ALTERNATING_DUMBBELL_BICEPS_CURL_ON_SWISS_BALL"},
+        {FIT_CURL_EXERCISE_NAME_ALTERNATING_INCLINE_DUMBBELL_BICEPS_CURL, "ALTERNATING_INCLINE_DUMBBELL_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_BARBELL_BICEPS_CURL, "BARBELL_BICEPS_CURL"},
+        {FIT_CURL_EXERCISE_NAME_BARBELL_REVERSE_WRIST_CURL, "BARBELL_REVERSE_WRIST_CURL"}, {FIT_CURL_EXERCISE_NAME_BARBELL_WRIST_CURL, "BARBELL_WRIST_CURL"},
+        {FIT_CURL_EXERCISE_NAME_BEHIND_THE_BACK_BARBELL_REVERSE_WRIST_CURL, "BEHIND_THE_BACK_BARBELL_REVERSE_WRIST_CURL"}, {FIT_CURL_EXERCISE_NAME_BEHIND_THE_BACK_ONE_ARM_CABLE_CURL, "BEHIND_THE_BACK_ONE_ARM_CABLE_CURL"},
+        {FIT_CURL_EXERCISE_NAME_CABLE_BICEPS_CURL, "CABLE_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_CABLE_HAMMER_CURL, "CABLE_HAMMER_CURL"},
+        {FIT_CURL_EXERCISE_NAME_CHEATING_BARBELL_BICEPS_CURL, "CHEATING_BARBELL_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_CLOSE_GRIP_EZ_BAR_BICEPS_CURL, "CLOSE_GRIP_EZ_BAR_BICEPS_CURL"},
+        {FIT_CURL_EXERCISE_NAME_CROSS_BODY_DUMBBELL_HAMMER_CURL, "CROSS_BODY_DUMBBELL_HAMMER_CURL"}, {FIT_CURL_EXERCISE_NAME_DEAD_HANG_BICEPS_CURL, "DEAD_HANG_BICEPS_CURL"},
+        {FIT_CURL_EXERCISE_NAME_DECLINE_HAMMER_CURL, "DECLINE_HAMMER_CURL"}, {FIT_CURL_EXERCISE_NAME_DUMBBELL_BICEPS_CURL_WITH_STATIC_HOLD, "DUMBBELL_BICEPS_CURL_WITH_STATIC_HOLD"},
+        {FIT_CURL_EXERCISE_NAME_DUMBBELL_HAMMER_CURL, "DUMBBELL_HAMMER_CURL"}, {FIT_CURL_EXERCISE_NAME_DUMBBELL_REVERSE_WRIST_CURL, "DUMBBELL_REVERSE_WRIST_CURL"},
+        {FIT_CURL_EXERCISE_NAME_DUMBBELL_WRIST_CURL, "DUMBBELL_WRIST_CURL"}, {FIT_CURL_EXERCISE_NAME_EZ_BAR_PREACHER_CURL, "EZ_BAR_PREACHER_CURL"},
+        {FIT_CURL_EXERCISE_NAME_FORWARD_BEND_BICEPS_CURL, "FORWARD_BEND_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_HAMMER_CURL_TO_PRESS, "HAMMER_CURL_TO_PRESS"},
+        {FIT_CURL_EXERCISE_NAME_INCLINE_DUMBBELL_BICEPS_CURL, "INCLINE_DUMBBELL_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_INCLINE_OFFSET_THUMB_DUMBBELL_CURL, "INCLINE_OFFSET_THUMB_DUMBBELL_CURL"},
+        {FIT_CURL_EXERCISE_NAME_KETTLEBELL_BICEPS_CURL, "KETTLEBELL_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_LYING_CONCENTRATION_CABLE_CURL, "LYING_CONCENTRATION_CABLE_CURL"},
+        {FIT_CURL_EXERCISE_NAME_ONE_ARM_PREACHER_CURL, "ONE_ARM_PREACHER_CURL"}, {FIT_CURL_EXERCISE_NAME_PLATE_PINCH_CURL, "PLATE_PINCH_CURL"},
+        {FIT_CURL_EXERCISE_NAME_PREACHER_CURL_WITH_CABLE, "PREACHER_CURL_WITH_CABLE"}, {FIT_CURL_EXERCISE_NAME_REVERSE_EZ_BAR_CURL, "REVERSE_EZ_BAR_CURL"},
+        {FIT_CURL_EXERCISE_NAME_REVERSE_GRIP_WRIST_CURL, "REVERSE_GRIP_WRIST_CURL"}, {FIT_CURL_EXERCISE_NAME_REVERSE_GRIP_BARBELL_BICEPS_CURL, "REVERSE_GRIP_BARBELL_BICEPS_CURL"},
+        {FIT_CURL_EXERCISE_NAME_SEATED_ALTERNATING_DUMBBELL_BICEPS_CURL, "SEATED_ALTERNATING_DUMBBELL_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_SEATED_DUMBBELL_BICEPS_CURL, "SEATED_DUMBBELL_BICEPS_CURL"},
+        {FIT_CURL_EXERCISE_NAME_SEATED_REVERSE_DUMBBELL_CURL, "SEATED_REVERSE_DUMBBELL_CURL"}, {FIT_CURL_EXERCISE_NAME_SPLIT_STANCE_OFFSET_PINKY_DUMBBELL_CURL, "SPLIT_STANCE_OFFSET_PINKY_DUMBBELL_CURL"},
+        {FIT_CURL_EXERCISE_NAME_STANDING_ALTERNATING_DUMBBELL_CURLS, "STANDING_ALTERNATING_DUMBBELL_CURLS"}, {FIT_CURL_EXERCISE_NAME_STANDING_DUMBBELL_BICEPS_CURL, "STANDING_DUMBBELL_BICEPS_CURL"},
+        {FIT_CURL_EXERCISE_NAME_STANDING_EZ_BAR_BICEPS_CURL, "STANDING_EZ_BAR_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_STATIC_CURL, "STATIC_CURL"},
+        {FIT_CURL_EXERCISE_NAME_SWISS_BALL_DUMBBELL_OVERHEAD_TRICEPS_EXTENSION, "SWISS_BALL_DUMBBELL_OVERHEAD_TRICEPS_EXTENSION"}, {FIT_CURL_EXERCISE_NAME_SWISS_BALL_EZ_BAR_PREACHER_CURL, "SWISS_BALL_EZ_BAR_PREACHER_CURL"},
+        {FIT_CURL_EXERCISE_NAME_TWISTING_STANDING_DUMBBELL_BICEPS_CURL, "TWISTING_STANDING_DUMBBELL_BICEPS_CURL"}, {FIT_CURL_EXERCISE_NAME_WIDE_GRIP_EZ_BAR_BICEPS_CURL, "WIDE_GRIP_EZ_BAR_BICEPS_CURL"},
+        {FIT_CURL_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName deadlift_exercise_name_names[] = {
+        {FIT_DEADLIFT_EXERCISE_NAME_BARBELL_DEADLIFT, "BARBELL_DEADLIFT"}, {FIT_DEADLIFT_EXERCISE_NAME_BARBELL_STRAIGHT_LEG_DEADLIFT, "BARBELL_STRAIGHT_LEG_DEADLIFT"},
+        {FIT_DEADLIFT_EXERCISE_NAME_DUMBBELL_DEADLIFT, "DUMBBELL_DEADLIFT"}, {FIT_DEADLIFT_EXERCISE_NAME_DUMBBELL_SINGLE_LEG_DEADLIFT_TO_ROW, "DUMBBELL_SINGLE_LEG_DEADLIFT_TO_ROW"},
+        {FIT_DEADLIFT_EXERCISE_NAME_DUMBBELL_STRAIGHT_LEG_DEADLIFT, "DUMBBELL_STRAIGHT_LEG_DEADLIFT"}, {FIT_DEADLIFT_EXERCISE_NAME_KETTLEBELL_FLOOR_TO_SHELF, "KETTLEBELL_FLOOR_TO_SHELF"},
+        {FIT_DEADLIFT_EXERCISE_NAME_ONE_ARM_ONE_LEG_DEADLIFT, "ONE_ARM_ONE_LEG_DEADLIFT"}, {FIT_DEADLIFT_EXERCISE_NAME_RACK_PULL, "RACK_PULL"},
+        {FIT_DEADLIFT_EXERCISE_NAME_ROTATIONAL_DUMBBELL_STRAIGHT_LEG_DEADLIFT, "ROTATIONAL_DUMBBELL_STRAIGHT_LEG_DEADLIFT"}, {FIT_DEADLIFT_EXERCISE_NAME_SINGLE_ARM_DEADLIFT, "SINGLE_ARM_DEADLIFT"},
+        {FIT_DEADLIFT_EXERCISE_NAME_SINGLE_LEG_BARBELL_DEADLIFT, "SINGLE_LEG_BARBELL_DEADLIFT"}, {FIT_DEADLIFT_EXERCISE_NAME_SINGLE_LEG_BARBELL_STRAIGHT_LEG_DEADLIFT, "SINGLE_LEG_BARBELL_STRAIGHT_LEG_DEADLIFT"},
+        {FIT_DEADLIFT_EXERCISE_NAME_SINGLE_LEG_DEADLIFT_WITH_BARBELL, "SINGLE_LEG_DEADLIFT_WITH_BARBELL"}, {FIT_DEADLIFT_EXERCISE_NAME_SINGLE_LEG_RDL_CIRCUIT, "SINGLE_LEG_RDL_CIRCUIT"},
+        {FIT_DEADLIFT_EXERCISE_NAME_SINGLE_LEG_ROMANIAN_DEADLIFT_WITH_DUMBBELL, "SINGLE_LEG_ROMANIAN_DEADLIFT_WITH_DUMBBELL"}, {FIT_DEADLIFT_EXERCISE_NAME_SUMO_DEADLIFT, "SUMO_DEADLIFT"},
+        {FIT_DEADLIFT_EXERCISE_NAME_SUMO_DEADLIFT_HIGH_PULL, "SUMO_DEADLIFT_HIGH_PULL"}, {FIT_DEADLIFT_EXERCISE_NAME_TRAP_BAR_DEADLIFT, "TRAP_BAR_DEADLIFT"},
+        {FIT_DEADLIFT_EXERCISE_NAME_WIDE_GRIP_BARBELL_DEADLIFT, "WIDE_GRIP_BARBELL_DEADLIFT"}, {FIT_DEADLIFT_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName flye_exercise_name_names[] = {
+        {FIT_FLYE_EXERCISE_NAME_CABLE_CROSSOVER, "CABLE_CROSSOVER"}, {FIT_FLYE_EXERCISE_NAME_DECLINE_DUMBBELL_FLYE, "DECLINE_DUMBBELL_FLYE"},
+        {FIT_FLYE_EXERCISE_NAME_DUMBBELL_FLYE, "DUMBBELL_FLYE"}, {FIT_FLYE_EXERCISE_NAME_INCLINE_DUMBBELL_FLYE, "INCLINE_DUMBBELL_FLYE"},
+        {FIT_FLYE_EXERCISE_NAME_KETTLEBELL_FLYE, "KETTLEBELL_FLYE"}, {FIT_FLYE_EXERCISE_NAME_KNEELING_REAR_FLYE, "KNEELING_REAR_FLYE"},
+        {FIT_FLYE_EXERCISE_NAME_SINGLE_ARM_STANDING_CABLE_REVERSE_FLYE, "SINGLE_ARM_STANDING_CABLE_REVERSE_FLYE"}, {FIT_FLYE_EXERCISE_NAME_SWISS_BALL_DUMBBELL_FLYE, "SWISS_BALL_DUMBBELL_FLYE"},
+        {FIT_FLYE_EXERCISE_NAME_ARM_ROTATIONS, "ARM_ROTATIONS"}, {FIT_FLYE_EXERCISE_NAME_HUG_A_TREE, "HUG_A_TREE"},
+        {FIT_FLYE_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName hip_raise_exercise_name_names[] = {
+        {FIT_HIP_RAISE_EXERCISE_NAME_BARBELL_HIP_THRUST_ON_FLOOR, "BARBELL_HIP_THRUST_ON_FLOOR"}, {FIT_HIP_RAISE_EXERCISE_NAME_BARBELL_HIP_THRUST_WITH_BENCH, "BARBELL_HIP_THRUST_WITH_BENCH"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_BENT_KNEE_SWISS_BALL_REVERSE_HIP_RAISE, "BENT_KNEE_SWISS_BALL_REVERSE_HIP_RAISE"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_BENT_KNEE_SWISS_BALL_REVERSE_HIP_RAISE, "WEIGHTED_BENT_KNEE_SWISS_BALL_REVERSE_HIP_RAISE"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_BRIDGE_WITH_LEG_EXTENSION, "BRIDGE_WITH_LEG_EXTENSION"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_BRIDGE_WITH_LEG_EXTENSION, "WEIGHTED_BRIDGE_WITH_LEG_EXTENSION"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_CLAM_BRIDGE, "CLAM_BRIDGE"}, {FIT_HIP_RAISE_EXERCISE_NAME_FRONT_KICK_TABLETOP, "FRONT_KICK_TABLETOP"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_FRONT_KICK_TABLETOP, "WEIGHTED_FRONT_KICK_TABLETOP"}, {FIT_HIP_RAISE_EXERCISE_NAME_HIP_EXTENSION_AND_CROSS, "HIP_EXTENSION_AND_CROSS"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_HIP_EXTENSION_AND_CROSS, "WEIGHTED_HIP_EXTENSION_AND_CROSS"}, {FIT_HIP_RAISE_EXERCISE_NAME_HIP_RAISE, "HIP_RAISE"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_HIP_RAISE, "WEIGHTED_HIP_RAISE"}, {FIT_HIP_RAISE_EXERCISE_NAME_HIP_RAISE_WITH_FEET_ON_SWISS_BALL, "HIP_RAISE_WITH_FEET_ON_SWISS_BALL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_HIP_RAISE_WITH_FEET_ON_SWISS_BALL, "WEIGHTED_HIP_RAISE_WITH_FEET_ON_SWISS_BALL"}, {FIT_HIP_RAISE_EXERCISE_NAME_HIP_RAISE_WITH_HEAD_ON_BOSU_BALL, "HIP_RAISE_WITH_HEAD_ON_BOSU_BALL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_HIP_RAISE_WITH_HEAD_ON_BOSU_BALL, "WEIGHTED_HIP_RAISE_WITH_HEAD_ON_BOSU_BALL"}, {FIT_HIP_RAISE_EXERCISE_NAME_HIP_RAISE_WITH_HEAD_ON_SWISS_BALL, "HIP_RAISE_WITH_HEAD_ON_SWISS_BALL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_HIP_RAISE_WITH_HEAD_ON_SWISS_BALL, "WEIGHTED_HIP_RAISE_WITH_HEAD_ON_SWISS_BALL"}, {FIT_HIP_RAISE_EXERCISE_NAME_HIP_RAISE_WITH_KNEE_SQUEEZE, "HIP_RAISE_WITH_KNEE_SQUEEZE"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_HIP_RAISE_WITH_KNEE_SQUEEZE, "WEIGHTED_HIP_RAISE_WITH_KNEE_SQUEEZE"}, {FIT_HIP_RAISE_EXERCISE_NAME_INCLINE_REAR_LEG_EXTENSION, "INCLINE_REAR_LEG_EXTENSION"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_INCLINE_REAR_LEG_EXTENSION, "WEIGHTED_INCLINE_REAR_LEG_EXTENSION"}, {FIT_HIP_RAISE_EXERCISE_NAME_KETTLEBELL_SWING, "KETTLEBELL_SWING"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_MARCHING_HIP_RAISE, "MARCHING_HIP_RAISE"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_MARCHING_HIP_RAISE, "WEIGHTED_MARCHING_HIP_RAISE"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_MARCHING_HIP_RAISE_WITH_FEET_ON_A_SWISS_BALL, "MARCHING_HIP_RAISE_WITH_FEET_ON_A_SWISS_BALL"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_MARCHING_HIP_RAISE_WITH_FEET_ON_A_SWISS_BALL, "WEIGHTED_MARCHING_HIP_RAISE_WITH_FEET_ON_A_SWISS_BALL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_REVERSE_HIP_RAISE, "REVERSE_HIP_RAISE"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_REVERSE_HIP_RAISE, "WEIGHTED_REVERSE_HIP_RAISE"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_SINGLE_LEG_HIP_RAISE, "SINGLE_LEG_HIP_RAISE"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_HIP_RAISE, "WEIGHTED_SINGLE_LEG_HIP_RAISE"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BENCH, "SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BENCH"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BENCH, "WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BENCH"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BOSU_BALL, "SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BOSU_BALL"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BOSU_BALL, "WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_BOSU_BALL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_FOAM_ROLLER, "SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_FOAM_ROLLER"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_FOAM_ROLLER, "WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_FOAM_ROLLER"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_MEDICINE_BALL, "SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_MEDICINE_BALL"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_MEDICINE_BALL, "WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_FOOT_ON_MEDICINE_BALL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_SINGLE_LEG_HIP_RAISE_WITH_HEAD_ON_BOSU_BALL, "SINGLE_LEG_HIP_RAISE_WITH_HEAD_ON_BOSU_BALL"}, {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_HEAD_ON_BOSU_BALL, "WEIGHTED_SINGLE_LEG_HIP_RAISE_WITH_HEAD_ON_BOSU_BALL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_WEIGHTED_CLAM_BRIDGE, "WEIGHTED_CLAM_BRIDGE"}, {FIT_HIP_RAISE_EXERCISE_NAME_SINGLE_LEG_SWISS_BALL_HIP_RAISE_AND_LEG_CURL, "SINGLE_LEG_SWISS_BALL_HIP_RAISE_AND_LEG_CURL"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_CLAMS, "CLAMS"}, {FIT_HIP_RAISE_EXERCISE_NAME_INNER_THIGH_CIRCLES, "INNER_THIGH_CIRCLES"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_INNER_THIGH_SIDE_LIFT, "INNER_THIGH_SIDE_LIFT"}, {FIT_HIP_RAISE_EXERCISE_NAME_LEG_CIRCLES, "LEG_CIRCLES"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_LEG_LIFT, "LEG_LIFT"}, {FIT_HIP_RAISE_EXERCISE_NAME_LEG_LIFT_IN_EXTERNAL_ROTATION, "LEG_LIFT_IN_EXTERNAL_ROTATION"},
+        {FIT_HIP_RAISE_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName hip_stability_exercise_name_names[] = {
+        {FIT_HIP_STABILITY_EXERCISE_NAME_BAND_SIDE_LYING_LEG_RAISE, "BAND_SIDE_LYING_LEG_RAISE"}, {FIT_HIP_STABILITY_EXERCISE_NAME_DEAD_BUG, "DEAD_BUG"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_DEAD_BUG, "WEIGHTED_DEAD_BUG"}, {FIT_HIP_STABILITY_EXERCISE_NAME_EXTERNAL_HIP_RAISE, "EXTERNAL_HIP_RAISE"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_EXTERNAL_HIP_RAISE, "WEIGHTED_EXTERNAL_HIP_RAISE"}, {FIT_HIP_STABILITY_EXERCISE_NAME_FIRE_HYDRANT_KICKS, "FIRE_HYDRANT_KICKS"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_FIRE_HYDRANT_KICKS, "WEIGHTED_FIRE_HYDRANT_KICKS"}, {FIT_HIP_STABILITY_EXERCISE_NAME_HIP_CIRCLES, "HIP_CIRCLES"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_HIP_CIRCLES, "WEIGHTED_HIP_CIRCLES"}, {FIT_HIP_STABILITY_EXERCISE_NAME_INNER_THIGH_LIFT, "INNER_THIGH_LIFT"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_INNER_THIGH_LIFT, "WEIGHTED_INNER_THIGH_LIFT"}, {FIT_HIP_STABILITY_EXERCISE_NAME_LATERAL_WALKS_WITH_BAND_AT_ANKLES, "LATERAL_WALKS_WITH_BAND_AT_ANKLES"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_PRETZEL_SIDE_KICK, "PRETZEL_SIDE_KICK"}, {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_PRETZEL_SIDE_KICK, "WEIGHTED_PRETZEL_SIDE_KICK"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_PRONE_HIP_INTERNAL_ROTATION, "PRONE_HIP_INTERNAL_ROTATION"}, {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_PRONE_HIP_INTERNAL_ROTATION, "WEIGHTED_PRONE_HIP_INTERNAL_ROTATION"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_QUADRUPED, "QUADRUPED"}, {FIT_HIP_STABILITY_EXERCISE_NAME_QUADRUPED_HIP_EXTENSION, "QUADRUPED_HIP_EXTENSION"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_QUADRUPED_HIP_EXTENSION, "WEIGHTED_QUADRUPED_HIP_EXTENSION"}, {FIT_HIP_STABILITY_EXERCISE_NAME_QUADRUPED_WITH_LEG_LIFT, "QUADRUPED_WITH_LEG_LIFT"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_QUADRUPED_WITH_LEG_LIFT, "WEIGHTED_QUADRUPED_WITH_LEG_LIFT"}, {FIT_HIP_STABILITY_EXERCISE_NAME_SIDE_LYING_LEG_RAISE, "SIDE_LYING_LEG_RAISE"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_SIDE_LYING_LEG_RAISE, "WEIGHTED_SIDE_LYING_LEG_RAISE"}, {FIT_HIP_STABILITY_EXERCISE_NAME_SLIDING_HIP_ADDUCTION, "SLIDING_HIP_ADDUCTION"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_SLIDING_HIP_ADDUCTION, "WEIGHTED_SLIDING_HIP_ADDUCTION"}, {FIT_HIP_STABILITY_EXERCISE_NAME_STANDING_ADDUCTION, "STANDING_ADDUCTION"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_STANDING_ADDUCTION, "WEIGHTED_STANDING_ADDUCTION"}, {FIT_HIP_STABILITY_EXERCISE_NAME_STANDING_CABLE_HIP_ABDUCTION, "STANDING_CABLE_HIP_ABDUCTION"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_STANDING_HIP_ABDUCTION, "STANDING_HIP_ABDUCTION"}, {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_STANDING_HIP_ABDUCTION, "WEIGHTED_STANDING_HIP_ABDUCTION"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_STANDING_REAR_LEG_RAISE, "STANDING_REAR_LEG_RAISE"}, {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_STANDING_REAR_LEG_RAISE, "WEIGHTED_STANDING_REAR_LEG_RAISE"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_SUPINE_HIP_INTERNAL_ROTATION, "SUPINE_HIP_INTERNAL_ROTATION"}, {FIT_HIP_STABILITY_EXERCISE_NAME_WEIGHTED_SUPINE_HIP_INTERNAL_ROTATION, "WEIGHTED_SUPINE_HIP_INTERNAL_ROTATION"},
+        {FIT_HIP_STABILITY_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName hip_swing_exercise_name_names[] = {
+        {FIT_HIP_SWING_EXERCISE_NAME_SINGLE_ARM_KETTLEBELL_SWING, "SINGLE_ARM_KETTLEBELL_SWING"}, {FIT_HIP_SWING_EXERCISE_NAME_SINGLE_ARM_DUMBBELL_SWING, "SINGLE_ARM_DUMBBELL_SWING"},
+        {FIT_HIP_SWING_EXERCISE_NAME_STEP_OUT_SWING, "STEP_OUT_SWING"}, {FIT_HIP_SWING_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName hyperextension_exercise_name_names[] = {
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_BACK_EXTENSION_WITH_OPPOSITE_ARM_AND_LEG_REACH, "BACK_EXTENSION_WITH_OPPOSITE_ARM_AND_LEG_REACH"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_BACK_EXTENSION_WITH_OPPOSITE_ARM_AND_LEG_REACH, "WEIGHTED_BACK_EXTENSION_WITH_OPPOSITE_ARM_AND_LEG_REACH"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_BASE_ROTATIONS, "BASE_ROTATIONS"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_BASE_ROTATIONS, "WEIGHTED_BASE_ROTATIONS"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_BENT_KNEE_REVERSE_HYPEREXTENSION, "BENT_KNEE_REVERSE_HYPEREXTENSION"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_BENT_KNEE_REVERSE_HYPEREXTENSION, "WEIGHTED_BENT_KNEE_REVERSE_HYPEREXTENSION"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_HOLLOW_HOLD_AND_ROLL, "HOLLOW_HOLD_AND_ROLL"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_HOLLOW_HOLD_AND_ROLL, "WEIGHTED_HOLLOW_HOLD_AND_ROLL"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_KICKS, "KICKS"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_KICKS, "WEIGHTED_KICKS"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_KNEE_RAISES, "KNEE_RAISES"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_KNEE_RAISES, "WEIGHTED_KNEE_RAISES"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_KNEELING_SUPERMAN, "KNEELING_SUPERMAN"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_KNEELING_SUPERMAN, "WEIGHTED_KNEELING_SUPERMAN"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_LAT_PULL_DOWN_WITH_ROW, "LAT_PULL_DOWN_WITH_ROW"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_MEDICINE_BALL_DEADLIFT_TO_REACH, "MEDICINE_BALL_DEADLIFT_TO_REACH"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_ONE_ARM_ONE_LEG_ROW, "ONE_ARM_ONE_LEG_ROW"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_ONE_ARM_ROW_WITH_BAND, "ONE_ARM_ROW_WITH_BAND"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_OVERHEAD_LUNGE_WITH_MEDICINE_BALL, "OVERHEAD_LUNGE_WITH_MEDICINE_BALL"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_PLANK_KNEE_TUCKS, "PLANK_KNEE_TUCKS"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_PLANK_KNEE_TUCKS, "WEIGHTED_PLANK_KNEE_TUCKS"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SIDE_STEP, "SIDE_STEP"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_SIDE_STEP, "WEIGHTED_SIDE_STEP"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SINGLE_LEG_BACK_EXTENSION, "SINGLE_LEG_BACK_EXTENSION"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_BACK_EXTENSION, "WEIGHTED_SINGLE_LEG_BACK_EXTENSION"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SPINE_EXTENSION, "SPINE_EXTENSION"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_SPINE_EXTENSION, "WEIGHTED_SPINE_EXTENSION"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_STATIC_BACK_EXTENSION, "STATIC_BACK_EXTENSION"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_STATIC_BACK_EXTENSION, "WEIGHTED_STATIC_BACK_EXTENSION"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SUPERMAN_FROM_FLOOR, "SUPERMAN_FROM_FLOOR"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_SUPERMAN_FROM_FLOOR, "WEIGHTED_SUPERMAN_FROM_FLOOR"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SWISS_BALL_BACK_EXTENSION, "SWISS_BALL_BACK_EXTENSION"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_SWISS_BALL_BACK_EXTENSION, "WEIGHTED_SWISS_BALL_BACK_EXTENSION"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SWISS_BALL_HYPEREXTENSION, "SWISS_BALL_HYPEREXTENSION"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_SWISS_BALL_HYPEREXTENSION, "WEIGHTED_SWISS_BALL_HYPEREXTENSION"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SWISS_BALL_OPPOSITE_ARM_AND_LEG_LIFT, "SWISS_BALL_OPPOSITE_ARM_AND_LEG_LIFT"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_WEIGHTED_SWISS_BALL_OPPOSITE_ARM_AND_LEG_LIFT, "WEIGHTED_SWISS_BALL_OPPOSITE_ARM_AND_LEG_LIFT"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SUPERMAN_ON_SWISS_BALL, "SUPERMAN_ON_SWISS_BALL"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_COBRA, "COBRA"}, {FIT_HYPEREXTENSION_EXERCISE_NAME_SUPINE_FLOOR_BARRE, "SUPINE_FLOOR_BARRE"},
+        {FIT_HYPEREXTENSION_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName lateral_raise_exercise_name_names[] = {
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_45_DEGREE_CABLE_EXTERNAL_ROTATION, "45_DEGREE_CABLE_EXTERNAL_ROTATION"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_ALTERNATING_LATERAL_RAISE_WITH_STATIC_HOLD, "ALTERNATING_LATERAL_RAISE_WITH_STATIC_HOLD"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_BAR_MUSCLE_UP, "BAR_MUSCLE_UP"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_BENT_OVER_LATERAL_RAISE, "BENT_OVER_LATERAL_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_CABLE_DIAGONAL_RAISE, "CABLE_DIAGONAL_RAISE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_CABLE_FRONT_RAISE, "CABLE_FRONT_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_CALORIE_ROW, "CALORIE_ROW"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_COMBO_SHOULDER_RAISE, "COMBO_SHOULDER_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_DUMBBELL_DIAGONAL_RAISE, "DUMBBELL_DIAGONAL_RAISE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_DUMBBELL_V_RAISE, "DUMBBELL_V_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_FRONT_RAISE, "FRONT_RAISE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_LEANING_DUMBBELL_LATERAL_RAISE, "LEANING_DUMBBELL_LATERAL_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_LYING_DUMBBELL_RAISE, "LYING_DUMBBELL_RAISE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_MUSCLE_UP, "MUSCLE_UP"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_ONE_ARM_CABLE_LATERAL_RAISE, "ONE_ARM_CABLE_LATERAL_RAISE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_OVERHAND_GRIP_REAR_LATERAL_RAISE, "OVERHAND_GRIP_REAR_LATERAL_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_PLATE_RAISES, "PLATE_RAISES"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_RING_DIP, "RING_DIP"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_WEIGHTED_RING_DIP, "WEIGHTED_RING_DIP"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_RING_MUSCLE_UP, "RING_MUSCLE_UP"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_WEIGHTED_RING_MUSCLE_UP, "WEIGHTED_RING_MUSCLE_UP"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_ROPE_CLIMB, "ROPE_CLIMB"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_WEIGHTED_ROPE_CLIMB, "WEIGHTED_ROPE_CLIMB"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_SCAPTION, "SCAPTION"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_SEATED_LATERAL_RAISE, "SEATED_LATERAL_RAISE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_SEATED_REAR_LATERAL_RAISE, "SEATED_REAR_LATERAL_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_SIDE_LYING_LATERAL_RAISE, "SIDE_LYING_LATERAL_RAISE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_STANDING_LIFT, "STANDING_LIFT"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_SUSPENDED_ROW, "SUSPENDED_ROW"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_UNDERHAND_GRIP_REAR_LATERAL_RAISE, "UNDERHAND_GRIP_REAR_LATERAL_RAISE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_WALL_SLIDE, "WALL_SLIDE"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_WEIGHTED_WALL_SLIDE, "WEIGHTED_WALL_SLIDE"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_ARM_CIRCLES, "ARM_CIRCLES"}, {FIT_LATERAL_RAISE_EXERCISE_NAME_SHAVING_THE_HEAD, "SHAVING_THE_HEAD"},
+        {FIT_LATERAL_RAISE_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName leg_curl_exercise_name_names[] = {
+        {FIT_LEG_CURL_EXERCISE_NAME_LEG_CURL, "LEG_CURL"}, {FIT_LEG_CURL_EXERCISE_NAME_WEIGHTED_LEG_CURL, "WEIGHTED_LEG_CURL"},
+        {FIT_LEG_CURL_EXERCISE_NAME_GOOD_MORNING, "GOOD_MORNING"}, {FIT_LEG_CURL_EXERCISE_NAME_SEATED_BARBELL_GOOD_MORNING, "SEATED_BARBELL_GOOD_MORNING"},
+        {FIT_LEG_CURL_EXERCISE_NAME_SINGLE_LEG_BARBELL_GOOD_MORNING, "SINGLE_LEG_BARBELL_GOOD_MORNING"}, {FIT_LEG_CURL_EXERCISE_NAME_SINGLE_LEG_SLIDING_LEG_CURL, "SINGLE_LEG_SLIDING_LEG_CURL"},
+        {FIT_LEG_CURL_EXERCISE_NAME_SLIDING_LEG_CURL, "SLIDING_LEG_CURL"}, {FIT_LEG_CURL_EXERCISE_NAME_SPLIT_BARBELL_GOOD_MORNING, "SPLIT_BARBELL_GOOD_MORNING"},
+        {FIT_LEG_CURL_EXERCISE_NAME_SPLIT_STANCE_EXTENSION, "SPLIT_STANCE_EXTENSION"}, {FIT_LEG_CURL_EXERCISE_NAME_STAGGERED_STANCE_GOOD_MORNING, "STAGGERED_STANCE_GOOD_MORNING"},
+        {FIT_LEG_CURL_EXERCISE_NAME_SWISS_BALL_HIP_RAISE_AND_LEG_CURL, "SWISS_BALL_HIP_RAISE_AND_LEG_CURL"}, {FIT_LEG_CURL_EXERCISE_NAME_ZERCHER_GOOD_MORNING, "ZERCHER_GOOD_MORNING"},
+        {FIT_LEG_CURL_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName leg_raise_exercise_name_names[] = {
+        {FIT_LEG_RAISE_EXERCISE_NAME_HANGING_KNEE_RAISE, "HANGING_KNEE_RAISE"}, {FIT_LEG_RAISE_EXERCISE_NAME_HANGING_LEG_RAISE, "HANGING_LEG_RAISE"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_HANGING_LEG_RAISE, "WEIGHTED_HANGING_LEG_RAISE"}, {FIT_LEG_RAISE_EXERCISE_NAME_HANGING_SINGLE_LEG_RAISE, "HANGING_SINGLE_LEG_RAISE"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_HANGING_SINGLE_LEG_RAISE, "WEIGHTED_HANGING_SINGLE_LEG_RAISE"}, {FIT_LEG_RAISE_EXERCISE_NAME_KETTLEBELL_LEG_RAISES, "KETTLEBELL_LEG_RAISES"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_LEG_LOWERING_DRILL, "LEG_LOWERING_DRILL"}, {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_LEG_LOWERING_DRILL, "WEIGHTED_LEG_LOWERING_DRILL"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_LYING_STRAIGHT_LEG_RAISE, "LYING_STRAIGHT_LEG_RAISE"}, {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_LYING_STRAIGHT_LEG_RAISE, "WEIGHTED_LYING_STRAIGHT_LEG_RAISE"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_MEDICINE_BALL_LEG_DROPS, "MEDICINE_BALL_LEG_DROPS"}, {FIT_LEG_RAISE_EXERCISE_NAME_QUADRUPED_LEG_RAISE, "QUADRUPED_LEG_RAISE"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_QUADRUPED_LEG_RAISE, "WEIGHTED_QUADRUPED_LEG_RAISE"}, {FIT_LEG_RAISE_EXERCISE_NAME_REVERSE_LEG_RAISE, "REVERSE_LEG_RAISE"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_REVERSE_LEG_RAISE, "WEIGHTED_REVERSE_LEG_RAISE"}, {FIT_LEG_RAISE_EXERCISE_NAME_REVERSE_LEG_RAISE_ON_SWISS_BALL, "REVERSE_LEG_RAISE_ON_SWISS_BALL"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_REVERSE_LEG_RAISE_ON_SWISS_BALL, "WEIGHTED_REVERSE_LEG_RAISE_ON_SWISS_BALL"}, {FIT_LEG_RAISE_EXERCISE_NAME_SINGLE_LEG_LOWERING_DRILL, "SINGLE_LEG_LOWERING_DRILL"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_LOWERING_DRILL, "WEIGHTED_SINGLE_LEG_LOWERING_DRILL"}, {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_HANGING_KNEE_RAISE, "WEIGHTED_HANGING_KNEE_RAISE"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_LATERAL_STEPOVER, "LATERAL_STEPOVER"}, {FIT_LEG_RAISE_EXERCISE_NAME_WEIGHTED_LATERAL_STEPOVER, "WEIGHTED_LATERAL_STEPOVER"},
+        {FIT_LEG_RAISE_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName lunge_exercise_name_names[] = {
+        {FIT_LUNGE_EXERCISE_NAME_OVERHEAD_LUNGE, "OVERHEAD_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_LUNGE_MATRIX, "LUNGE_MATRIX"},
+        {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_LUNGE_MATRIX, "WEIGHTED_LUNGE_MATRIX"}, {FIT_LUNGE_EXERCISE_NAME_ALTERNATING_BARBELL_FORWARD_LUNGE, "ALTERNATING_BARBELL_FORWARD_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_ALTERNATING_DUMBBELL_LUNGE_WITH_REACH, "ALTERNATING_DUMBBELL_LUNGE_WITH_REACH"}, {FIT_LUNGE_EXERCISE_NAME_BACK_FOOT_ELEVATED_DUMBBELL_SPLIT_SQUAT, "BACK_FOOT_ELEVATED_DUMBBELL_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_BARBELL_BOX_LUNGE, "BARBELL_BOX_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_BARBELL_BULGARIAN_SPLIT_SQUAT, "BARBELL_BULGARIAN_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_BARBELL_CROSSOVER_LUNGE, "BARBELL_CROSSOVER_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_BARBELL_FRONT_SPLIT_SQUAT, "BARBELL_FRONT_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_BARBELL_LUNGE, "BARBELL_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_BARBELL_REVERSE_LUNGE, "BARBELL_REVERSE_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_BARBELL_SIDE_LUNGE, "BARBELL_SIDE_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_BARBELL_SPLIT_SQUAT, "BARBELL_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_CORE_CONTROL_REAR_LUNGE, "CORE_CONTROL_REAR_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_DIAGONAL_LUNGE, "DIAGONAL_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_DROP_LUNGE, "DROP_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_BOX_LUNGE, "DUMBBELL_BOX_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_BULGARIAN_SPLIT_SQUAT, "DUMBBELL_BULGARIAN_SPLIT_SQUAT"}, {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_CROSSOVER_LUNGE, "DUMBBELL_CROSSOVER_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_DIAGONAL_LUNGE, "DUMBBELL_DIAGONAL_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_LUNGE, "DUMBBELL_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_LUNGE_AND_ROTATION, "DUMBBELL_LUNGE_AND_ROTATION"}, {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_OVERHEAD_BULGARIAN_SPLIT_SQUAT, "DUMBBELL_OVERHEAD_BULGARIAN_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_REVERSE_LUNGE_TO_HIGH_KNEE_AND_PRESS, "DUMBBELL_REVERSE_LUNGE_TO_HIGH_KNEE_AND_PRESS"}, {FIT_LUNGE_EXERCISE_NAME_DUMBBELL_SIDE_LUNGE, "DUMBBELL_SIDE_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_ELEVATED_FRONT_FOOT_BARBELL_SPLIT_SQUAT, "ELEVATED_FRONT_FOOT_BARBELL_SPLIT_SQUAT"}, {FIT_LUNGE_EXERCISE_NAME_FRONT_FOOT_ELEVATED_DUMBBELL_SPLIT_SQUAT, "FRONT_FOOT_ELEVATED_DUMBBELL_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_GUNSLINGER_LUNGE, "GUNSLINGER_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_LAWNMOWER_LUNGE, "LAWNMOWER_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_LOW_LUNGE_WITH_ISOMETRIC_ADDUCTION, "LOW_LUNGE_WITH_ISOMETRIC_ADDUCTION"}, {FIT_LUNGE_EXERCISE_NAME_LOW_SIDE_TO_SIDE_LUNGE, "LOW_SIDE_TO_SIDE_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_LUNGE, "LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_LUNGE, "WEIGHTED_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_LUNGE_WITH_ARM_REACH, "LUNGE_WITH_ARM_REACH"}, {FIT_LUNGE_EXERCISE_NAME_LUNGE_WITH_DIAGONAL_REACH, "LUNGE_WITH_DIAGONAL_REACH"},
+        {FIT_LUNGE_EXERCISE_NAME_LUNGE_WITH_SIDE_BEND, "LUNGE_WITH_SIDE_BEND"}, {FIT_LUNGE_EXERCISE_NAME_OFFSET_DUMBBELL_LUNGE, "OFFSET_DUMBBELL_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_OFFSET_DUMBBELL_REVERSE_LUNGE, "OFFSET_DUMBBELL_REVERSE_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_OVERHEAD_BULGARIAN_SPLIT_SQUAT, "OVERHEAD_BULGARIAN_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_OVERHEAD_DUMBBELL_REVERSE_LUNGE, "OVERHEAD_DUMBBELL_REVERSE_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_OVERHEAD_DUMBBELL_SPLIT_SQUAT, "OVERHEAD_DUMBBELL_SPLIT_SQUAT"},
+        {FIT_LUNGE_EXERCISE_NAME_OVERHEAD_LUNGE_WITH_ROTATION, "OVERHEAD_LUNGE_WITH_ROTATION"}, {FIT_LUNGE_EXERCISE_NAME_REVERSE_BARBELL_BOX_LUNGE, "REVERSE_BARBELL_BOX_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_REVERSE_BOX_LUNGE, "REVERSE_BOX_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_REVERSE_DUMBBELL_BOX_LUNGE, "REVERSE_DUMBBELL_BOX_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_REVERSE_DUMBBELL_CROSSOVER_LUNGE, "REVERSE_DUMBBELL_CROSSOVER_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_REVERSE_DUMBBELL_DIAGONAL_LUNGE, "REVERSE_DUMBBELL_DIAGONAL_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_REVERSE_LUNGE_WITH_REACH_BACK, "REVERSE_LUNGE_WITH_REACH_BACK"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_REVERSE_LUNGE_WITH_REACH_BACK, "WEIGHTED_REVERSE_LUNGE_WITH_REACH_BACK"},
+        {FIT_LUNGE_EXERCISE_NAME_REVERSE_LUNGE_WITH_TWIST_AND_OVERHEAD_REACH, "REVERSE_LUNGE_WITH_TWIST_AND_OVERHEAD_REACH"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_REVERSE_LUNGE_WITH_TWIST_AND_OVERHEAD_REACH, "WEIGHTED_REVERSE_LUNGE_WITH_TWIST_AND_OVERHEAD_REACH"},
+        {FIT_LUNGE_EXERCISE_NAME_REVERSE_SLIDING_BOX_LUNGE, "REVERSE_SLIDING_BOX_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_REVERSE_SLIDING_BOX_LUNGE, "WEIGHTED_REVERSE_SLIDING_BOX_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_REVERSE_SLIDING_LUNGE, "REVERSE_SLIDING_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_REVERSE_SLIDING_LUNGE, "WEIGHTED_REVERSE_SLIDING_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_RUNNERS_LUNGE_TO_BALANCE, "RUNNERS_LUNGE_TO_BALANCE"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_RUNNERS_LUNGE_TO_BALANCE, "WEIGHTED_RUNNERS_LUNGE_TO_BALANCE"},
+        {FIT_LUNGE_EXERCISE_NAME_SHIFTING_SIDE_LUNGE, "SHIFTING_SIDE_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_SIDE_AND_CROSSOVER_LUNGE, "SIDE_AND_CROSSOVER_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_SIDE_AND_CROSSOVER_LUNGE, "WEIGHTED_SIDE_AND_CROSSOVER_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_SIDE_LUNGE, "SIDE_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_SIDE_LUNGE, "WEIGHTED_SIDE_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_SIDE_LUNGE_AND_PRESS, "SIDE_LUNGE_AND_PRESS"},
+        {FIT_LUNGE_EXERCISE_NAME_SIDE_LUNGE_JUMP_OFF, "SIDE_LUNGE_JUMP_OFF"}, {FIT_LUNGE_EXERCISE_NAME_SIDE_LUNGE_SWEEP, "SIDE_LUNGE_SWEEP"},
+        {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_SIDE_LUNGE_SWEEP, "WEIGHTED_SIDE_LUNGE_SWEEP"}, {FIT_LUNGE_EXERCISE_NAME_SIDE_LUNGE_TO_CROSSOVER_TAP, "SIDE_LUNGE_TO_CROSSOVER_TAP"},
+        {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_SIDE_LUNGE_TO_CROSSOVER_TAP, "WEIGHTED_SIDE_LUNGE_TO_CROSSOVER_TAP"}, {FIT_LUNGE_EXERCISE_NAME_SIDE_TO_SIDE_LUNGE_CHOPS, "SIDE_TO_SIDE_LUNGE_CHOPS"},
+        {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_SIDE_TO_SIDE_LUNGE_CHOPS, "WEIGHTED_SIDE_TO_SIDE_LUNGE_CHOPS"}, {FIT_LUNGE_EXERCISE_NAME_SIFF_JUMP_LUNGE, "SIFF_JUMP_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_SIFF_JUMP_LUNGE, "WEIGHTED_SIFF_JUMP_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_SINGLE_ARM_REVERSE_LUNGE_AND_PRESS, "SINGLE_ARM_REVERSE_LUNGE_AND_PRESS"},
+        {FIT_LUNGE_EXERCISE_NAME_SLIDING_LATERAL_LUNGE, "SLIDING_LATERAL_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_SLIDING_LATERAL_LUNGE, "WEIGHTED_SLIDING_LATERAL_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_WALKING_BARBELL_LUNGE, "WALKING_BARBELL_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_WALKING_DUMBBELL_LUNGE, "WALKING_DUMBBELL_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_WALKING_LUNGE, "WALKING_LUNGE"}, {FIT_LUNGE_EXERCISE_NAME_WEIGHTED_WALKING_LUNGE, "WEIGHTED_WALKING_LUNGE"},
+        {FIT_LUNGE_EXERCISE_NAME_WIDE_GRIP_OVERHEAD_BARBELL_SPLIT_SQUAT, "WIDE_GRIP_OVERHEAD_BARBELL_SPLIT_SQUAT"}, {FIT_LUNGE_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName olympic_lift_exercise_name_names[] = {
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_HANG_POWER_CLEAN, "BARBELL_HANG_POWER_CLEAN"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_HANG_SQUAT_CLEAN, "BARBELL_HANG_SQUAT_CLEAN"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_POWER_CLEAN, "BARBELL_POWER_CLEAN"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_POWER_SNATCH, "BARBELL_POWER_SNATCH"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_SQUAT_CLEAN, "BARBELL_SQUAT_CLEAN"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_CLEAN_AND_JERK, "CLEAN_AND_JERK"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_HANG_POWER_SNATCH, "BARBELL_HANG_POWER_SNATCH"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_HANG_PULL, "BARBELL_HANG_PULL"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_HIGH_PULL, "BARBELL_HIGH_PULL"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_SNATCH, "BARBELL_SNATCH"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_BARBELL_SPLIT_JERK, "BARBELL_SPLIT_JERK"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_CLEAN, "CLEAN"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_DUMBBELL_CLEAN, "DUMBBELL_CLEAN"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_DUMBBELL_HANG_PULL, "DUMBBELL_HANG_PULL"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_ONE_HAND_DUMBBELL_SPLIT_SNATCH, "ONE_HAND_DUMBBELL_SPLIT_SNATCH"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_PUSH_JERK, "PUSH_JERK"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_SINGLE_ARM_DUMBBELL_SNATCH, "SINGLE_ARM_DUMBBELL_SNATCH"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_SINGLE_ARM_HANG_SNATCH, "SINGLE_ARM_HANG_SNATCH"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_SINGLE_ARM_KETTLEBELL_SNATCH, "SINGLE_ARM_KETTLEBELL_SNATCH"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_SPLIT_JERK, "SPLIT_JERK"},
+        {FIT_OLYMPIC_LIFT_EXERCISE_NAME_SQUAT_CLEAN_AND_JERK, "SQUAT_CLEAN_AND_JERK"}, {FIT_OLYMPIC_LIFT_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName plank_exercise_name_names[] = {
+        {FIT_PLANK_EXERCISE_NAME_45_DEGREE_PLANK, "45_DEGREE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_45_DEGREE_PLANK, "WEIGHTED_45_DEGREE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_90_DEGREE_STATIC_HOLD, "90_DEGREE_STATIC_HOLD"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_90_DEGREE_STATIC_HOLD, "WEIGHTED_90_DEGREE_STATIC_HOLD"},
+        {FIT_PLANK_EXERCISE_NAME_BEAR_CRAWL, "BEAR_CRAWL"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_BEAR_CRAWL, "WEIGHTED_BEAR_CRAWL"},
+        {FIT_PLANK_EXERCISE_NAME_CROSS_BODY_MOUNTAIN_CLIMBER, "CROSS_BODY_MOUNTAIN_CLIMBER"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_CROSS_BODY_MOUNTAIN_CLIMBER, "WEIGHTED_CROSS_BODY_MOUNTAIN_CLIMBER"},
+        {FIT_PLANK_EXERCISE_NAME_ELBOW_PLANK_PIKE_JACKS, "ELBOW_PLANK_PIKE_JACKS"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_ELBOW_PLANK_PIKE_JACKS, "WEIGHTED_ELBOW_PLANK_PIKE_JACKS"},
+        {FIT_PLANK_EXERCISE_NAME_ELEVATED_FEET_PLANK, "ELEVATED_FEET_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_ELEVATED_FEET_PLANK, "WEIGHTED_ELEVATED_FEET_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_ELEVATOR_ABS, "ELEVATOR_ABS"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_ELEVATOR_ABS, "WEIGHTED_ELEVATOR_ABS"},
+        {FIT_PLANK_EXERCISE_NAME_EXTENDED_PLANK, "EXTENDED_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_EXTENDED_PLANK, "WEIGHTED_EXTENDED_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_FULL_PLANK_PASSE_TWIST, "FULL_PLANK_PASSE_TWIST"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_FULL_PLANK_PASSE_TWIST, "WEIGHTED_FULL_PLANK_PASSE_TWIST"},
+        {FIT_PLANK_EXERCISE_NAME_INCHING_ELBOW_PLANK, "INCHING_ELBOW_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_INCHING_ELBOW_PLANK, "WEIGHTED_INCHING_ELBOW_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_INCHWORM_TO_SIDE_PLANK, "INCHWORM_TO_SIDE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_INCHWORM_TO_SIDE_PLANK, "WEIGHTED_INCHWORM_TO_SIDE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_KNEELING_PLANK, "KNEELING_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_KNEELING_PLANK, "WEIGHTED_KNEELING_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_KNEELING_SIDE_PLANK_WITH_LEG_LIFT, "KNEELING_SIDE_PLANK_WITH_LEG_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_KNEELING_SIDE_PLANK_WITH_LEG_LIFT, "WEIGHTED_KNEELING_SIDE_PLANK_WITH_LEG_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_LATERAL_ROLL, "LATERAL_ROLL"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_LATERAL_ROLL, "WEIGHTED_LATERAL_ROLL"},
+        {FIT_PLANK_EXERCISE_NAME_LYING_REVERSE_PLANK, "LYING_REVERSE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_LYING_REVERSE_PLANK, "WEIGHTED_LYING_REVERSE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_MEDICINE_BALL_MOUNTAIN_CLIMBER, "MEDICINE_BALL_MOUNTAIN_CLIMBER"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_MEDICINE_BALL_MOUNTAIN_CLIMBER, "WEIGHTED_MEDICINE_BALL_MOUNTAIN_CLIMBER"},
+        {FIT_PLANK_EXERCISE_NAME_MODIFIED_MOUNTAIN_CLIMBER_AND_EXTENSION, "MODIFIED_MOUNTAIN_CLIMBER_AND_EXTENSION"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_MODIFIED_MOUNTAIN_CLIMBER_AND_EXTENSION, "WEIGHTED_MODIFIED_MOUNTAIN_CLIMBER_AND_EXTENSION"},
+        {FIT_PLANK_EXERCISE_NAME_MOUNTAIN_CLIMBER, "MOUNTAIN_CLIMBER"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_MOUNTAIN_CLIMBER, "WEIGHTED_MOUNTAIN_CLIMBER"},
+        {FIT_PLANK_EXERCISE_NAME_MOUNTAIN_CLIMBER_ON_SLIDING_DISCS, "MOUNTAIN_CLIMBER_ON_SLIDING_DISCS"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_MOUNTAIN_CLIMBER_ON_SLIDING_DISCS, "WEIGHTED_MOUNTAIN_CLIMBER_ON_SLIDING_DISCS"},
+        {FIT_PLANK_EXERCISE_NAME_MOUNTAIN_CLIMBER_WITH_FEET_ON_BOSU_BALL, "MOUNTAIN_CLIMBER_WITH_FEET_ON_BOSU_BALL"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_MOUNTAIN_CLIMBER_WITH_FEET_ON_BOSU_BALL, "WEIGHTED_MOUNTAIN_CLIMBER_WITH_FEET_ON_BOSU_BALL"},
+        {FIT_PLANK_EXERCISE_NAME_MOUNTAIN_CLIMBER_WITH_HANDS_ON_BENCH, "MOUNTAIN_CLIMBER_WITH_HANDS_ON_BENCH"}, {FIT_PLANK_EXERCISE_NAME_MOUNTAIN_CLIMBER_WITH_HANDS_ON_SWISS_BALL, "MOUNTAIN_CLIMBER_WITH_HANDS_ON_SWISS_BALL"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_MOUNTAIN_CLIMBER_WITH_HANDS_ON_SWISS_BALL, "WEIGHTED_MOUNTAIN_CLIMBER_WITH_HANDS_ON_SWISS_BALL"}, {FIT_PLANK_EXERCISE_NAME_PLANK, "PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_JACKS_WITH_FEET_ON_SLIDING_DISCS, "PLANK_JACKS_WITH_FEET_ON_SLIDING_DISCS"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_JACKS_WITH_FEET_ON_SLIDING_DISCS, "WEIGHTED_PLANK_JACKS_WITH_FEET_ON_SLIDING_DISCS"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_KNEE_TWIST, "PLANK_KNEE_TWIST"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_KNEE_TWIST, "WEIGHTED_PLANK_KNEE_TWIST"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_PIKE_JUMPS, "PLANK_PIKE_JUMPS"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_PIKE_JUMPS, "WEIGHTED_PLANK_PIKE_JUMPS"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_PIKES, "PLANK_PIKES"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_PIKES, "WEIGHTED_PLANK_PIKES"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_TO_STAND_UP, "PLANK_TO_STAND_UP"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_TO_STAND_UP, "WEIGHTED_PLANK_TO_STAND_UP"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_WITH_ARM_RAISE, "PLANK_WITH_ARM_RAISE"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_WITH_ARM_RAISE, "WEIGHTED_PLANK_WITH_ARM_RAISE"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_WITH_KNEE_TO_ELBOW, "PLANK_WITH_KNEE_TO_ELBOW"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_WITH_KNEE_TO_ELBOW, "WEIGHTED_PLANK_WITH_KNEE_TO_ELBOW"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_WITH_OBLIQUE_CRUNCH, "PLANK_WITH_OBLIQUE_CRUNCH"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK_WITH_OBLIQUE_CRUNCH, "WEIGHTED_PLANK_WITH_OBLIQUE_CRUNCH"},
+        {FIT_PLANK_EXERCISE_NAME_PLYOMETRIC_SIDE_PLANK, "PLYOMETRIC_SIDE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLYOMETRIC_SIDE_PLANK, "WEIGHTED_PLYOMETRIC_SIDE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_ROLLING_SIDE_PLANK, "ROLLING_SIDE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_ROLLING_SIDE_PLANK, "WEIGHTED_ROLLING_SIDE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_KICK_PLANK, "SIDE_KICK_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_KICK_PLANK, "WEIGHTED_SIDE_KICK_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK, "SIDE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK, "WEIGHTED_SIDE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_AND_ROW, "SIDE_PLANK_AND_ROW"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_AND_ROW, "WEIGHTED_SIDE_PLANK_AND_ROW"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_LIFT, "SIDE_PLANK_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_LIFT, "WEIGHTED_SIDE_PLANK_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_WITH_ELBOW_ON_BOSU_BALL, "SIDE_PLANK_WITH_ELBOW_ON_BOSU_BALL"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_WITH_ELBOW_ON_BOSU_BALL, "WEIGHTED_SIDE_PLANK_WITH_ELBOW_ON_BOSU_BALL"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_WITH_FEET_ON_BENCH, "SIDE_PLANK_WITH_FEET_ON_BENCH"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_WITH_FEET_ON_BENCH, "WEIGHTED_SIDE_PLANK_WITH_FEET_ON_BENCH"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_WITH_KNEE_CIRCLE, "SIDE_PLANK_WITH_KNEE_CIRCLE"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_WITH_KNEE_CIRCLE, "WEIGHTED_SIDE_PLANK_WITH_KNEE_CIRCLE"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_WITH_KNEE_TUCK, "SIDE_PLANK_WITH_KNEE_TUCK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_WITH_KNEE_TUCK, "WEIGHTED_SIDE_PLANK_WITH_KNEE_TUCK"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_WITH_LEG_LIFT, "SIDE_PLANK_WITH_LEG_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_WITH_LEG_LIFT, "WEIGHTED_SIDE_PLANK_WITH_LEG_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_WITH_REACH_UNDER, "SIDE_PLANK_WITH_REACH_UNDER"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SIDE_PLANK_WITH_REACH_UNDER, "WEIGHTED_SIDE_PLANK_WITH_REACH_UNDER"},
+        {FIT_PLANK_EXERCISE_NAME_SINGLE_LEG_ELEVATED_FEET_PLANK, "SINGLE_LEG_ELEVATED_FEET_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_ELEVATED_FEET_PLANK, "WEIGHTED_SINGLE_LEG_ELEVATED_FEET_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_SINGLE_LEG_FLEX_AND_EXTEND, "SINGLE_LEG_FLEX_AND_EXTEND"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_FLEX_AND_EXTEND, "WEIGHTED_SINGLE_LEG_FLEX_AND_EXTEND"},
+        {FIT_PLANK_EXERCISE_NAME_SINGLE_LEG_SIDE_PLANK, "SINGLE_LEG_SIDE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_SIDE_PLANK, "WEIGHTED_SINGLE_LEG_SIDE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_SPIDERMAN_PLANK, "SPIDERMAN_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SPIDERMAN_PLANK, "WEIGHTED_SPIDERMAN_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_STRAIGHT_ARM_PLANK, "STRAIGHT_ARM_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_STRAIGHT_ARM_PLANK, "WEIGHTED_STRAIGHT_ARM_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_STRAIGHT_ARM_PLANK_WITH_SHOULDER_TOUCH, "STRAIGHT_ARM_PLANK_WITH_SHOULDER_TOUCH"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_STRAIGHT_ARM_PLANK_WITH_SHOULDER_TOUCH, "WEIGHTED_STRAIGHT_ARM_PLANK_WITH_SHOULDER_TOUCH"},
+        {FIT_PLANK_EXERCISE_NAME_SWISS_BALL_PLANK, "SWISS_BALL_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PLANK, "WEIGHTED_SWISS_BALL_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_SWISS_BALL_PLANK_LEG_LIFT, "SWISS_BALL_PLANK_LEG_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PLANK_LEG_LIFT, "WEIGHTED_SWISS_BALL_PLANK_LEG_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_SWISS_BALL_PLANK_LEG_LIFT_AND_HOLD, "SWISS_BALL_PLANK_LEG_LIFT_AND_HOLD"}, {FIT_PLANK_EXERCISE_NAME_SWISS_BALL_PLANK_WITH_FEET_ON_BENCH, "SWISS_BALL_PLANK_WITH_FEET_ON_BENCH"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PLANK_WITH_FEET_ON_BENCH, "WEIGHTED_SWISS_BALL_PLANK_WITH_FEET_ON_BENCH"}, {FIT_PLANK_EXERCISE_NAME_SWISS_BALL_PRONE_JACKKNIFE, "SWISS_BALL_PRONE_JACKKNIFE"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PRONE_JACKKNIFE, "WEIGHTED_SWISS_BALL_PRONE_JACKKNIFE"}, {FIT_PLANK_EXERCISE_NAME_SWISS_BALL_SIDE_PLANK, "SWISS_BALL_SIDE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SWISS_BALL_SIDE_PLANK, "WEIGHTED_SWISS_BALL_SIDE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_THREE_WAY_PLANK, "THREE_WAY_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_THREE_WAY_PLANK, "WEIGHTED_THREE_WAY_PLANK"}, {FIT_PLANK_EXERCISE_NAME_TOWEL_PLANK_AND_KNEE_IN, "TOWEL_PLANK_AND_KNEE_IN"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_TOWEL_PLANK_AND_KNEE_IN, "WEIGHTED_TOWEL_PLANK_AND_KNEE_IN"}, {FIT_PLANK_EXERCISE_NAME_T_STABILIZATION, "T_STABILIZATION"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_T_STABILIZATION, "WEIGHTED_T_STABILIZATION"}, {FIT_PLANK_EXERCISE_NAME_TURKISH_GET_UP_TO_SIDE_PLANK, "TURKISH_GET_UP_TO_SIDE_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_TURKISH_GET_UP_TO_SIDE_PLANK, "WEIGHTED_TURKISH_GET_UP_TO_SIDE_PLANK"}, {FIT_PLANK_EXERCISE_NAME_TWO_POINT_PLANK, "TWO_POINT_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_TWO_POINT_PLANK, "WEIGHTED_TWO_POINT_PLANK"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_PLANK, "WEIGHTED_PLANK"},
+        {FIT_PLANK_EXERCISE_NAME_WIDE_STANCE_PLANK_WITH_DIAGONAL_ARM_LIFT, "WIDE_STANCE_PLANK_WITH_DIAGONAL_ARM_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_WIDE_STANCE_PLANK_WITH_DIAGONAL_ARM_LIFT, "WEIGHTED_WIDE_STANCE_PLANK_WITH_DIAGONAL_ARM_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_WIDE_STANCE_PLANK_WITH_DIAGONAL_LEG_LIFT, "WIDE_STANCE_PLANK_WITH_DIAGONAL_LEG_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_WIDE_STANCE_PLANK_WITH_DIAGONAL_LEG_LIFT, "WEIGHTED_WIDE_STANCE_PLANK_WITH_DIAGONAL_LEG_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_WIDE_STANCE_PLANK_WITH_LEG_LIFT, "WIDE_STANCE_PLANK_WITH_LEG_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_WIDE_STANCE_PLANK_WITH_LEG_LIFT, "WEIGHTED_WIDE_STANCE_PLANK_WITH_LEG_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_WIDE_STANCE_PLANK_WITH_OPPOSITE_ARM_AND_LEG_LIFT, "WIDE_STANCE_PLANK_WITH_OPPOSITE_ARM_AND_LEG_LIFT"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_MOUNTAIN_CLIMBER_WITH_HANDS_ON_BENCH, "WEIGHTED_MOUNTAIN_CLIMBER_WITH_HANDS_ON_BENCH"},
+        {FIT_PLANK_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PLANK_LEG_LIFT_AND_HOLD, "WEIGHTED_SWISS_BALL_PLANK_LEG_LIFT_AND_HOLD"}, {FIT_PLANK_EXERCISE_NAME_WEIGHTED_WIDE_STANCE_PLANK_WITH_OPPOSITE_ARM_AND_LEG_LIFT, "WEIGHTED_WIDE_STANCE_PLANK_WITH_OPPOSITE_ARM_AND_LEG_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_WITH_FEET_ON_SWISS_BALL, "PLANK_WITH_FEET_ON_SWISS_BALL"}, {FIT_PLANK_EXERCISE_NAME_SIDE_PLANK_TO_PLANK_WITH_REACH_UNDER, "SIDE_PLANK_TO_PLANK_WITH_REACH_UNDER"},
+        {FIT_PLANK_EXERCISE_NAME_BRIDGE_WITH_GLUTE_LOWER_LIFT, "BRIDGE_WITH_GLUTE_LOWER_LIFT"}, {FIT_PLANK_EXERCISE_NAME_BRIDGE_ONE_LEG_BRIDGE, "BRIDGE_ONE_LEG_BRIDGE"},
+        {FIT_PLANK_EXERCISE_NAME_PLANK_WITH_ARM_VARIATIONS, "PLANK_WITH_ARM_VARIATIONS"}, {FIT_PLANK_EXERCISE_NAME_PLANK_WITH_LEG_LIFT, "PLANK_WITH_LEG_LIFT"},
+        {FIT_PLANK_EXERCISE_NAME_REVERSE_PLANK_WITH_LEG_PULL, "REVERSE_PLANK_WITH_LEG_PULL"}, {FIT_PLANK_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName plyo_exercise_name_names[] = {
+        {FIT_PLYO_EXERCISE_NAME_ALTERNATING_JUMP_LUNGE, "ALTERNATING_JUMP_LUNGE"}, {FIT_PLYO_EXERCISE_NAME_WEIGHTED_ALTERNATING_JUMP_LUNGE, "WEIGHTED_ALTERNATING_JUMP_LUNGE"},
+        {FIT_PLYO_EXERCISE_NAME_BARBELL_JUMP_SQUAT, "BARBELL_JUMP_SQUAT"}, {FIT_PLYO_EXERCISE_NAME_BODY_WEIGHT_JUMP_SQUAT, "BODY_WEIGHT_JUMP_SQUAT"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_JUMP_SQUAT, "WEIGHTED_JUMP_SQUAT"}, {FIT_PLYO_EXERCISE_NAME_CROSS_KNEE_STRIKE, "CROSS_KNEE_STRIKE"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_CROSS_KNEE_STRIKE, "WEIGHTED_CROSS_KNEE_STRIKE"}, {FIT_PLYO_EXERCISE_NAME_DEPTH_JUMP, "DEPTH_JUMP"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_DEPTH_JUMP, "WEIGHTED_DEPTH_JUMP"}, {FIT_PLYO_EXERCISE_NAME_DUMBBELL_JUMP_SQUAT, "DUMBBELL_JUMP_SQUAT"},
+        {FIT_PLYO_EXERCISE_NAME_DUMBBELL_SPLIT_JUMP, "DUMBBELL_SPLIT_JUMP"}, {FIT_PLYO_EXERCISE_NAME_FRONT_KNEE_STRIKE, "FRONT_KNEE_STRIKE"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_FRONT_KNEE_STRIKE, "WEIGHTED_FRONT_KNEE_STRIKE"}, {FIT_PLYO_EXERCISE_NAME_HIGH_BOX_JUMP, "HIGH_BOX_JUMP"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_HIGH_BOX_JUMP, "WEIGHTED_HIGH_BOX_JUMP"}, {FIT_PLYO_EXERCISE_NAME_ISOMETRIC_EXPLOSIVE_BODY_WEIGHT_JUMP_SQUAT, "ISOMETRIC_EXPLOSIVE_BODY_WEIGHT_JUMP_SQUAT"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_ISOMETRIC_EXPLOSIVE_JUMP_SQUAT, "WEIGHTED_ISOMETRIC_EXPLOSIVE_JUMP_SQUAT"}, {FIT_PLYO_EXERCISE_NAME_LATERAL_LEAP_AND_HOP, "LATERAL_LEAP_AND_HOP"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_LATERAL_LEAP_AND_HOP, "WEIGHTED_LATERAL_LEAP_AND_HOP"}, {FIT_PLYO_EXERCISE_NAME_LATERAL_PLYO_SQUATS, "LATERAL_PLYO_SQUATS"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_LATERAL_PLYO_SQUATS, "WEIGHTED_LATERAL_PLYO_SQUATS"}, {FIT_PLYO_EXERCISE_NAME_LATERAL_SLIDE, "LATERAL_SLIDE"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_LATERAL_SLIDE, "WEIGHTED_LATERAL_SLIDE"}, {FIT_PLYO_EXERCISE_NAME_MEDICINE_BALL_OVERHEAD_THROWS, "MEDICINE_BALL_OVERHEAD_THROWS"},
+        {FIT_PLYO_EXERCISE_NAME_MEDICINE_BALL_SIDE_THROW, "MEDICINE_BALL_SIDE_THROW"}, {FIT_PLYO_EXERCISE_NAME_MEDICINE_BALL_SLAM, "MEDICINE_BALL_SLAM"},
+        {FIT_PLYO_EXERCISE_NAME_SIDE_TO_SIDE_MEDICINE_BALL_THROWS, "SIDE_TO_SIDE_MEDICINE_BALL_THROWS"}, {FIT_PLYO_EXERCISE_NAME_SIDE_TO_SIDE_SHUFFLE_JUMP, "SIDE_TO_SIDE_SHUFFLE_JUMP"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_SIDE_TO_SIDE_SHUFFLE_JUMP, "WEIGHTED_SIDE_TO_SIDE_SHUFFLE_JUMP"}, {FIT_PLYO_EXERCISE_NAME_SQUAT_JUMP_ONTO_BOX, "SQUAT_JUMP_ONTO_BOX"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_SQUAT_JUMP_ONTO_BOX, "WEIGHTED_SQUAT_JUMP_ONTO_BOX"}, {FIT_PLYO_EXERCISE_NAME_SQUAT_JUMPS_IN_AND_OUT, "SQUAT_JUMPS_IN_AND_OUT"},
+        {FIT_PLYO_EXERCISE_NAME_WEIGHTED_SQUAT_JUMPS_IN_AND_OUT, "WEIGHTED_SQUAT_JUMPS_IN_AND_OUT"}, {FIT_PLYO_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName pull_up_exercise_name_names[] = {
+        {FIT_PULL_UP_EXERCISE_NAME_BANDED_PULL_UPS, "BANDED_PULL_UPS"}, {FIT_PULL_UP_EXERCISE_NAME_30_DEGREE_LAT_PULLDOWN, "30_DEGREE_LAT_PULLDOWN"},
+        {FIT_PULL_UP_EXERCISE_NAME_BAND_ASSISTED_CHIN_UP, "BAND_ASSISTED_CHIN_UP"}, {FIT_PULL_UP_EXERCISE_NAME_CLOSE_GRIP_CHIN_UP, "CLOSE_GRIP_CHIN_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_CLOSE_GRIP_CHIN_UP, "WEIGHTED_CLOSE_GRIP_CHIN_UP"}, {FIT_PULL_UP_EXERCISE_NAME_CLOSE_GRIP_LAT_PULLDOWN, "CLOSE_GRIP_LAT_PULLDOWN"},
+        {FIT_PULL_UP_EXERCISE_NAME_CROSSOVER_CHIN_UP, "CROSSOVER_CHIN_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_CROSSOVER_CHIN_UP, "WEIGHTED_CROSSOVER_CHIN_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_EZ_BAR_PULLOVER, "EZ_BAR_PULLOVER"}, {FIT_PULL_UP_EXERCISE_NAME_HANGING_HURDLE, "HANGING_HURDLE"},
+        {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_HANGING_HURDLE, "WEIGHTED_HANGING_HURDLE"}, {FIT_PULL_UP_EXERCISE_NAME_KNEELING_LAT_PULLDOWN, "KNEELING_LAT_PULLDOWN"},
+        {FIT_PULL_UP_EXERCISE_NAME_KNEELING_UNDERHAND_GRIP_LAT_PULLDOWN, "KNEELING_UNDERHAND_GRIP_LAT_PULLDOWN"}, {FIT_PULL_UP_EXERCISE_NAME_LAT_PULLDOWN, "LAT_PULLDOWN"},
+        {FIT_PULL_UP_EXERCISE_NAME_MIXED_GRIP_CHIN_UP, "MIXED_GRIP_CHIN_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_MIXED_GRIP_CHIN_UP, "WEIGHTED_MIXED_GRIP_CHIN_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_MIXED_GRIP_PULL_UP, "MIXED_GRIP_PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_MIXED_GRIP_PULL_UP, "WEIGHTED_MIXED_GRIP_PULL_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_REVERSE_GRIP_PULLDOWN, "REVERSE_GRIP_PULLDOWN"}, {FIT_PULL_UP_EXERCISE_NAME_STANDING_CABLE_PULLOVER, "STANDING_CABLE_PULLOVER"},
+        {FIT_PULL_UP_EXERCISE_NAME_STRAIGHT_ARM_PULLDOWN, "STRAIGHT_ARM_PULLDOWN"}, {FIT_PULL_UP_EXERCISE_NAME_SWISS_BALL_EZ_BAR_PULLOVER, "SWISS_BALL_EZ_BAR_PULLOVER"},
+        {FIT_PULL_UP_EXERCISE_NAME_TOWEL_PULL_UP, "TOWEL_PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_TOWEL_PULL_UP, "WEIGHTED_TOWEL_PULL_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_PULL_UP, "WEIGHTED_PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WIDE_GRIP_LAT_PULLDOWN, "WIDE_GRIP_LAT_PULLDOWN"},
+        {FIT_PULL_UP_EXERCISE_NAME_WIDE_GRIP_PULL_UP, "WIDE_GRIP_PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_WIDE_GRIP_PULL_UP, "WEIGHTED_WIDE_GRIP_PULL_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_BURPEE_PULL_UP, "BURPEE_PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_BURPEE_PULL_UP, "WEIGHTED_BURPEE_PULL_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_JUMPING_PULL_UPS, "JUMPING_PULL_UPS"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_JUMPING_PULL_UPS, "WEIGHTED_JUMPING_PULL_UPS"},
+        {FIT_PULL_UP_EXERCISE_NAME_KIPPING_PULL_UP, "KIPPING_PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_KIPPING_PULL_UP, "WEIGHTED_KIPPING_PULL_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_L_PULL_UP, "L_PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_L_PULL_UP, "WEIGHTED_L_PULL_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_SUSPENDED_CHIN_UP, "SUSPENDED_CHIN_UP"}, {FIT_PULL_UP_EXERCISE_NAME_WEIGHTED_SUSPENDED_CHIN_UP, "WEIGHTED_SUSPENDED_CHIN_UP"},
+        {FIT_PULL_UP_EXERCISE_NAME_PULL_UP, "PULL_UP"}, {FIT_PULL_UP_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName push_up_exercise_name_names[] = {
+        {FIT_PUSH_UP_EXERCISE_NAME_CHEST_PRESS_WITH_BAND, "CHEST_PRESS_WITH_BAND"}, {FIT_PUSH_UP_EXERCISE_NAME_ALTERNATING_STAGGERED_PUSH_UP, "ALTERNATING_STAGGERED_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_ALTERNATING_STAGGERED_PUSH_UP, "WEIGHTED_ALTERNATING_STAGGERED_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_ALTERNATING_HANDS_MEDICINE_BALL_PUSH_UP, "ALTERNATING_HANDS_MEDICINE_BALL_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_ALTERNATING_HANDS_MEDICINE_BALL_PUSH_UP, "WEIGHTED_ALTERNATING_HANDS_MEDICINE_BALL_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_BOSU_BALL_PUSH_UP, "BOSU_BALL_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_BOSU_BALL_PUSH_UP, "WEIGHTED_BOSU_BALL_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_CLAPPING_PUSH_UP, "CLAPPING_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_CLAPPING_PUSH_UP, "WEIGHTED_CLAPPING_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_CLOSE_GRIP_MEDICINE_BALL_PUSH_UP, "CLOSE_GRIP_MEDICINE_BALL_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_CLOSE_GRIP_MEDICINE_BALL_PUSH_UP, "WEIGHTED_CLOSE_GRIP_MEDICINE_BALL_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_CLOSE_HANDS_PUSH_UP, "CLOSE_HANDS_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_CLOSE_HANDS_PUSH_UP, "WEIGHTED_CLOSE_HANDS_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_DECLINE_PUSH_UP, "DECLINE_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_DECLINE_PUSH_UP, "WEIGHTED_DECLINE_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_DIAMOND_PUSH_UP, "DIAMOND_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_DIAMOND_PUSH_UP, "WEIGHTED_DIAMOND_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_EXPLOSIVE_CROSSOVER_PUSH_UP, "EXPLOSIVE_CROSSOVER_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_EXPLOSIVE_CROSSOVER_PUSH_UP, "WEIGHTED_EXPLOSIVE_CROSSOVER_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_EXPLOSIVE_PUSH_UP, "EXPLOSIVE_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_EXPLOSIVE_PUSH_UP, "WEIGHTED_EXPLOSIVE_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_FEET_ELEVATED_SIDE_TO_SIDE_PUSH_UP, "FEET_ELEVATED_SIDE_TO_SIDE_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_FEET_ELEVATED_SIDE_TO_SIDE_PUSH_UP, "WEIGHTED_FEET_ELEVATED_SIDE_TO_SIDE_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_HAND_RELEASE_PUSH_UP, "HAND_RELEASE_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_HAND_RELEASE_PUSH_UP, "WEIGHTED_HAND_RELEASE_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_HANDSTAND_PUSH_UP, "HANDSTAND_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_HANDSTAND_PUSH_UP, "WEIGHTED_HANDSTAND_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_INCLINE_PUSH_UP, "INCLINE_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_INCLINE_PUSH_UP, "WEIGHTED_INCLINE_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_ISOMETRIC_EXPLOSIVE_PUSH_UP, "ISOMETRIC_EXPLOSIVE_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_ISOMETRIC_EXPLOSIVE_PUSH_UP, "WEIGHTED_ISOMETRIC_EXPLOSIVE_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_JUDO_PUSH_UP, "JUDO_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_JUDO_PUSH_UP, "WEIGHTED_JUDO_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_KNEELING_PUSH_UP, "KNEELING_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_KNEELING_PUSH_UP, "WEIGHTED_KNEELING_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_MEDICINE_BALL_CHEST_PASS, "MEDICINE_BALL_CHEST_PASS"},
+        {FIT_PUSH_UP_EXERCISE_NAME_MEDICINE_BALL_PUSH_UP, "MEDICINE_BALL_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_MEDICINE_BALL_PUSH_UP, "WEIGHTED_MEDICINE_BALL_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_ONE_ARM_PUSH_UP, "ONE_ARM_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_ONE_ARM_PUSH_UP, "WEIGHTED_ONE_ARM_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_PUSH_UP, "WEIGHTED_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_PUSH_UP_AND_ROW, "PUSH_UP_AND_ROW"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_PUSH_UP_AND_ROW, "WEIGHTED_PUSH_UP_AND_ROW"}, {FIT_PUSH_UP_EXERCISE_NAME_PUSH_UP_PLUS, "PUSH_UP_PLUS"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_PUSH_UP_PLUS, "WEIGHTED_PUSH_UP_PLUS"}, {FIT_PUSH_UP_EXERCISE_NAME_PUSH_UP_WITH_FEET_ON_SWISS_BALL, "PUSH_UP_WITH_FEET_ON_SWISS_BALL"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_PUSH_UP_WITH_FEET_ON_SWISS_BALL, "WEIGHTED_PUSH_UP_WITH_FEET_ON_SWISS_BALL"}, {FIT_PUSH_UP_EXERCISE_NAME_PUSH_UP_WITH_ONE_HAND_ON_MEDICINE_BALL, "PUSH_UP_WITH_ONE_HAND_ON_MEDICINE_BALL"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_PUSH_UP_WITH_ONE_HAND_ON_MEDICINE_BALL, "WEIGHTED_PUSH_UP_WITH_ONE_HAND_ON_MEDICINE_BALL"}, {FIT_PUSH_UP_EXERCISE_NAME_SHOULDER_PUSH_UP, "SHOULDER_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_SHOULDER_PUSH_UP, "WEIGHTED_SHOULDER_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_SINGLE_ARM_MEDICINE_BALL_PUSH_UP, "SINGLE_ARM_MEDICINE_BALL_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_SINGLE_ARM_MEDICINE_BALL_PUSH_UP, "WEIGHTED_SINGLE_ARM_MEDICINE_BALL_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_SPIDERMAN_PUSH_UP, "SPIDERMAN_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_SPIDERMAN_PUSH_UP, "WEIGHTED_SPIDERMAN_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_STACKED_FEET_PUSH_UP, "STACKED_FEET_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_STACKED_FEET_PUSH_UP, "WEIGHTED_STACKED_FEET_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_STAGGERED_HANDS_PUSH_UP, "STAGGERED_HANDS_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_STAGGERED_HANDS_PUSH_UP, "WEIGHTED_STAGGERED_HANDS_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_SUSPENDED_PUSH_UP, "SUSPENDED_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_SUSPENDED_PUSH_UP, "WEIGHTED_SUSPENDED_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_SWISS_BALL_PUSH_UP, "SWISS_BALL_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PUSH_UP, "WEIGHTED_SWISS_BALL_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_SWISS_BALL_PUSH_UP_PLUS, "SWISS_BALL_PUSH_UP_PLUS"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_SWISS_BALL_PUSH_UP_PLUS, "WEIGHTED_SWISS_BALL_PUSH_UP_PLUS"}, {FIT_PUSH_UP_EXERCISE_NAME_T_PUSH_UP, "T_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_T_PUSH_UP, "WEIGHTED_T_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_TRIPLE_STOP_PUSH_UP, "TRIPLE_STOP_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_TRIPLE_STOP_PUSH_UP, "WEIGHTED_TRIPLE_STOP_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_WIDE_HANDS_PUSH_UP, "WIDE_HANDS_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_WIDE_HANDS_PUSH_UP, "WEIGHTED_WIDE_HANDS_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_PARALLETTE_HANDSTAND_PUSH_UP, "PARALLETTE_HANDSTAND_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_PARALLETTE_HANDSTAND_PUSH_UP, "WEIGHTED_PARALLETTE_HANDSTAND_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_RING_HANDSTAND_PUSH_UP, "RING_HANDSTAND_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_RING_HANDSTAND_PUSH_UP, "WEIGHTED_RING_HANDSTAND_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_RING_PUSH_UP, "RING_PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_WEIGHTED_RING_PUSH_UP, "WEIGHTED_RING_PUSH_UP"}, {FIT_PUSH_UP_EXERCISE_NAME_PUSH_UP, "PUSH_UP"},
+        {FIT_PUSH_UP_EXERCISE_NAME_PILATES_PUSHUP, "PILATES_PUSHUP"}, {FIT_PUSH_UP_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName row_exercise_name_names[] = {
+        {FIT_ROW_EXERCISE_NAME_BARBELL_STRAIGHT_LEG_DEADLIFT_TO_ROW, "BARBELL_STRAIGHT_LEG_DEADLIFT_TO_ROW"}, {FIT_ROW_EXERCISE_NAME_CABLE_ROW_STANDING, "CABLE_ROW_STANDING"},
+        {FIT_ROW_EXERCISE_NAME_DUMBBELL_ROW, "DUMBBELL_ROW"}, {FIT_ROW_EXERCISE_NAME_ELEVATED_FEET_INVERTED_ROW, "ELEVATED_FEET_INVERTED_ROW"},
+        {FIT_ROW_EXERCISE_NAME_WEIGHTED_ELEVATED_FEET_INVERTED_ROW, "WEIGHTED_ELEVATED_FEET_INVERTED_ROW"}, {FIT_ROW_EXERCISE_NAME_FACE_PULL, "FACE_PULL"},
+        {FIT_ROW_EXERCISE_NAME_FACE_PULL_WITH_EXTERNAL_ROTATION, "FACE_PULL_WITH_EXTERNAL_ROTATION"}, {FIT_ROW_EXERCISE_NAME_INVERTED_ROW_WITH_FEET_ON_SWISS_BALL, "INVERTED_ROW_WITH_FEET_ON_SWISS_BALL"},
+        {FIT_ROW_EXERCISE_NAME_WEIGHTED_INVERTED_ROW_WITH_FEET_ON_SWISS_BALL, "WEIGHTED_INVERTED_ROW_WITH_FEET_ON_SWISS_BALL"}, {FIT_ROW_EXERCISE_NAME_KETTLEBELL_ROW, "KETTLEBELL_ROW"},
+        {FIT_ROW_EXERCISE_NAME_MODIFIED_INVERTED_ROW, "MODIFIED_INVERTED_ROW"}, {FIT_ROW_EXERCISE_NAME_WEIGHTED_MODIFIED_INVERTED_ROW, "WEIGHTED_MODIFIED_INVERTED_ROW"},
+        {FIT_ROW_EXERCISE_NAME_NEUTRAL_GRIP_ALTERNATING_DUMBBELL_ROW, "NEUTRAL_GRIP_ALTERNATING_DUMBBELL_ROW"}, {FIT_ROW_EXERCISE_NAME_ONE_ARM_BENT_OVER_ROW, "ONE_ARM_BENT_OVER_ROW"},
+        {FIT_ROW_EXERCISE_NAME_ONE_LEGGED_DUMBBELL_ROW, "ONE_LEGGED_DUMBBELL_ROW"}, {FIT_ROW_EXERCISE_NAME_RENEGADE_ROW, "RENEGADE_ROW"},
+        {FIT_ROW_EXERCISE_NAME_REVERSE_GRIP_BARBELL_ROW, "REVERSE_GRIP_BARBELL_ROW"}, {FIT_ROW_EXERCISE_NAME_ROPE_HANDLE_CABLE_ROW, "ROPE_HANDLE_CABLE_ROW"},
+        {FIT_ROW_EXERCISE_NAME_SEATED_CABLE_ROW, "SEATED_CABLE_ROW"}, {FIT_ROW_EXERCISE_NAME_SEATED_DUMBBELL_ROW, "SEATED_DUMBBELL_ROW"},
+        {FIT_ROW_EXERCISE_NAME_SINGLE_ARM_CABLE_ROW, "SINGLE_ARM_CABLE_ROW"}, {FIT_ROW_EXERCISE_NAME_SINGLE_ARM_CABLE_ROW_AND_ROTATION, "SINGLE_ARM_CABLE_ROW_AND_ROTATION"},
+        {FIT_ROW_EXERCISE_NAME_SINGLE_ARM_INVERTED_ROW, "SINGLE_ARM_INVERTED_ROW"}, {FIT_ROW_EXERCISE_NAME_WEIGHTED_SINGLE_ARM_INVERTED_ROW, "WEIGHTED_SINGLE_ARM_INVERTED_ROW"},
+        {FIT_ROW_EXERCISE_NAME_SINGLE_ARM_NEUTRAL_GRIP_DUMBBELL_ROW, "SINGLE_ARM_NEUTRAL_GRIP_DUMBBELL_ROW"}, {FIT_ROW_EXERCISE_NAME_SINGLE_ARM_NEUTRAL_GRIP_DUMBBELL_ROW_AND_ROTATION, "SINGLE_ARM_NEUTRAL_GRIP_DUMBBELL_ROW_AND_ROTATION"},
+        {FIT_ROW_EXERCISE_NAME_SUSPENDED_INVERTED_ROW, "SUSPENDED_INVERTED_ROW"}, {FIT_ROW_EXERCISE_NAME_WEIGHTED_SUSPENDED_INVERTED_ROW, "WEIGHTED_SUSPENDED_INVERTED_ROW"},
+        {FIT_ROW_EXERCISE_NAME_T_BAR_ROW, "T_BAR_ROW"}, {FIT_ROW_EXERCISE_NAME_TOWEL_GRIP_INVERTED_ROW, "TOWEL_GRIP_INVERTED_ROW"},
+        {FIT_ROW_EXERCISE_NAME_WEIGHTED_TOWEL_GRIP_INVERTED_ROW, "WEIGHTED_TOWEL_GRIP_INVERTED_ROW"}, {FIT_ROW_EXERCISE_NAME_UNDERHAND_GRIP_CABLE_ROW, "UNDERHAND_GRIP_CABLE_ROW"},
+        {FIT_ROW_EXERCISE_NAME_V_GRIP_CABLE_ROW, "V_GRIP_CABLE_ROW"}, {FIT_ROW_EXERCISE_NAME_WIDE_GRIP_SEATED_CABLE_ROW, "WIDE_GRIP_SEATED_CABLE_ROW"},
+        {FIT_ROW_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName shoulder_press_exercise_name_names[] = {
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_ALTERNATING_DUMBBELL_SHOULDER_PRESS, "ALTERNATING_DUMBBELL_SHOULDER_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_ARNOLD_PRESS, "ARNOLD_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_BARBELL_FRONT_SQUAT_TO_PUSH_PRESS, "BARBELL_FRONT_SQUAT_TO_PUSH_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_BARBELL_PUSH_PRESS, "BARBELL_PUSH_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_BARBELL_SHOULDER_PRESS, "BARBELL_SHOULDER_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_DEAD_CURL_PRESS, "DEAD_CURL_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_DUMBBELL_ALTERNATING_SHOULDER_PRESS_AND_TWIST, "DUMBBELL_ALTERNATING_SHOULDER_PRESS_AND_TWIST"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_DUMBBELL_HAMMER_CURL_TO_LUNGE_TO_PRESS, "DUMBBELL_HAMMER_CURL_TO_LUNGE_TO_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_DUMBBELL_PUSH_PRESS, "DUMBBELL_PUSH_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_FLOOR_INVERTED_SHOULDER_PRESS, "FLOOR_INVERTED_SHOULDER_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_WEIGHTED_FLOOR_INVERTED_SHOULDER_PRESS, "WEIGHTED_FLOOR_INVERTED_SHOULDER_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_INVERTED_SHOULDER_PRESS, "INVERTED_SHOULDER_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_WEIGHTED_INVERTED_SHOULDER_PRESS, "WEIGHTED_INVERTED_SHOULDER_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_ONE_ARM_PUSH_PRESS, "ONE_ARM_PUSH_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_OVERHEAD_BARBELL_PRESS, "OVERHEAD_BARBELL_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_OVERHEAD_DUMBBELL_PRESS, "OVERHEAD_DUMBBELL_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_SEATED_BARBELL_SHOULDER_PRESS, "SEATED_BARBELL_SHOULDER_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_SEATED_DUMBBELL_SHOULDER_PRESS, "SEATED_DUMBBELL_SHOULDER_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_SINGLE_ARM_DUMBBELL_SHOULDER_PRESS, "SINGLE_ARM_DUMBBELL_SHOULDER_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_SINGLE_ARM_STEP_UP_AND_PRESS, "SINGLE_ARM_STEP_UP_AND_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_SMITH_MACHINE_OVERHEAD_PRESS, "SMITH_MACHINE_OVERHEAD_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_SPLIT_STANCE_HAMMER_CURL_TO_PRESS, "SPLIT_STANCE_HAMMER_CURL_TO_PRESS"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_SWISS_BALL_DUMBBELL_SHOULDER_PRESS, "SWISS_BALL_DUMBBELL_SHOULDER_PRESS"}, {FIT_SHOULDER_PRESS_EXERCISE_NAME_WEIGHT_PLATE_FRONT_RAISE, "WEIGHT_PLATE_FRONT_RAISE"},
+        {FIT_SHOULDER_PRESS_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName shoulder_stability_exercise_name_names[] = {
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_90_DEGREE_CABLE_EXTERNAL_ROTATION, "90_DEGREE_CABLE_EXTERNAL_ROTATION"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_BAND_EXTERNAL_ROTATION, "BAND_EXTERNAL_ROTATION"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_BAND_INTERNAL_ROTATION, "BAND_INTERNAL_ROTATION"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_BENT_ARM_LATERAL_RAISE_AND_EXTERNAL_ROTATION, "BENT_ARM_LATERAL_RAISE_AND_EXTERNAL_ROTATION"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_CABLE_EXTERNAL_ROTATION, "CABLE_EXTERNAL_ROTATION"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_DUMBBELL_FACE_PULL_WITH_EXTERNAL_ROTATION, "DUMBBELL_FACE_PULL_WITH_EXTERNAL_ROTATION"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_FLOOR_I_RAISE, "FLOOR_I_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_FLOOR_I_RAISE, "WEIGHTED_FLOOR_I_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_FLOOR_T_RAISE, "FLOOR_T_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_FLOOR_T_RAISE, "WEIGHTED_FLOOR_T_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_FLOOR_Y_RAISE, "FLOOR_Y_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_FLOOR_Y_RAISE, "WEIGHTED_FLOOR_Y_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_INCLINE_I_RAISE, "INCLINE_I_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_INCLINE_I_RAISE, "WEIGHTED_INCLINE_I_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_INCLINE_L_RAISE, "INCLINE_L_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_INCLINE_L_RAISE, "WEIGHTED_INCLINE_L_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_INCLINE_T_RAISE, "INCLINE_T_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_INCLINE_T_RAISE, "WEIGHTED_INCLINE_T_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_INCLINE_W_RAISE, "INCLINE_W_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_INCLINE_W_RAISE, "WEIGHTED_INCLINE_W_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_INCLINE_Y_RAISE, "INCLINE_Y_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_INCLINE_Y_RAISE, "WEIGHTED_INCLINE_Y_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_LYING_EXTERNAL_ROTATION, "LYING_EXTERNAL_ROTATION"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_SEATED_DUMBBELL_EXTERNAL_ROTATION, "SEATED_DUMBBELL_EXTERNAL_ROTATION"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_STANDING_L_RAISE, "STANDING_L_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_SWISS_BALL_I_RAISE, "SWISS_BALL_I_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_SWISS_BALL_I_RAISE, "WEIGHTED_SWISS_BALL_I_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_SWISS_BALL_T_RAISE, "SWISS_BALL_T_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_SWISS_BALL_T_RAISE, "WEIGHTED_SWISS_BALL_T_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_SWISS_BALL_W_RAISE, "SWISS_BALL_W_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_SWISS_BALL_W_RAISE, "WEIGHTED_SWISS_BALL_W_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_SWISS_BALL_Y_RAISE, "SWISS_BALL_Y_RAISE"},
+        {FIT_SHOULDER_STABILITY_EXERCISE_NAME_WEIGHTED_SWISS_BALL_Y_RAISE, "WEIGHTED_SWISS_BALL_Y_RAISE"}, {FIT_SHOULDER_STABILITY_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName shrug_exercise_name_names[] = {
+        {FIT_SHRUG_EXERCISE_NAME_BARBELL_JUMP_SHRUG, "BARBELL_JUMP_SHRUG"}, {FIT_SHRUG_EXERCISE_NAME_BARBELL_SHRUG, "BARBELL_SHRUG"},
+        {FIT_SHRUG_EXERCISE_NAME_BARBELL_UPRIGHT_ROW, "BARBELL_UPRIGHT_ROW"}, {FIT_SHRUG_EXERCISE_NAME_BEHIND_THE_BACK_SMITH_MACHINE_SHRUG, "BEHIND_THE_BACK_SMITH_MACHINE_SHRUG"},
+        {FIT_SHRUG_EXERCISE_NAME_DUMBBELL_JUMP_SHRUG, "DUMBBELL_JUMP_SHRUG"}, {FIT_SHRUG_EXERCISE_NAME_DUMBBELL_SHRUG, "DUMBBELL_SHRUG"},
+        {FIT_SHRUG_EXERCISE_NAME_DUMBBELL_UPRIGHT_ROW, "DUMBBELL_UPRIGHT_ROW"}, {FIT_SHRUG_EXERCISE_NAME_INCLINE_DUMBBELL_SHRUG, "INCLINE_DUMBBELL_SHRUG"},
+        {FIT_SHRUG_EXERCISE_NAME_OVERHEAD_BARBELL_SHRUG, "OVERHEAD_BARBELL_SHRUG"}, {FIT_SHRUG_EXERCISE_NAME_OVERHEAD_DUMBBELL_SHRUG, "OVERHEAD_DUMBBELL_SHRUG"},
+        {FIT_SHRUG_EXERCISE_NAME_SCAPTION_AND_SHRUG, "SCAPTION_AND_SHRUG"}, {FIT_SHRUG_EXERCISE_NAME_SCAPULAR_RETRACTION, "SCAPULAR_RETRACTION"},
+        {FIT_SHRUG_EXERCISE_NAME_SERRATUS_CHAIR_SHRUG, "SERRATUS_CHAIR_SHRUG"}, {FIT_SHRUG_EXERCISE_NAME_WEIGHTED_SERRATUS_CHAIR_SHRUG, "WEIGHTED_SERRATUS_CHAIR_SHRUG"},
+        {FIT_SHRUG_EXERCISE_NAME_SERRATUS_SHRUG, "SERRATUS_SHRUG"}, {FIT_SHRUG_EXERCISE_NAME_WEIGHTED_SERRATUS_SHRUG, "WEIGHTED_SERRATUS_SHRUG"},
+        {FIT_SHRUG_EXERCISE_NAME_WIDE_GRIP_JUMP_SHRUG, "WIDE_GRIP_JUMP_SHRUG"}, {FIT_SHRUG_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName sit_up_exercise_name_names[] = {
+        {FIT_SIT_UP_EXERCISE_NAME_ALTERNATING_SIT_UP, "ALTERNATING_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_ALTERNATING_SIT_UP, "WEIGHTED_ALTERNATING_SIT_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_BENT_KNEE_V_UP, "BENT_KNEE_V_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_BENT_KNEE_V_UP, "WEIGHTED_BENT_KNEE_V_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_BUTTERFLY_SIT_UP, "BUTTERFLY_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_BUTTERFLY_SITUP, "WEIGHTED_BUTTERFLY_SITUP"},
+        {FIT_SIT_UP_EXERCISE_NAME_CROSS_PUNCH_ROLL_UP, "CROSS_PUNCH_ROLL_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_CROSS_PUNCH_ROLL_UP, "WEIGHTED_CROSS_PUNCH_ROLL_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_CROSSED_ARMS_SIT_UP, "CROSSED_ARMS_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_CROSSED_ARMS_SIT_UP, "WEIGHTED_CROSSED_ARMS_SIT_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_GET_UP_SIT_UP, "GET_UP_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_GET_UP_SIT_UP, "WEIGHTED_GET_UP_SIT_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_HOVERING_SIT_UP, "HOVERING_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_HOVERING_SIT_UP, "WEIGHTED_HOVERING_SIT_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_KETTLEBELL_SIT_UP, "KETTLEBELL_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_MEDICINE_BALL_ALTERNATING_V_UP, "MEDICINE_BALL_ALTERNATING_V_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_MEDICINE_BALL_SIT_UP, "MEDICINE_BALL_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_MEDICINE_BALL_V_UP, "MEDICINE_BALL_V_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_MODIFIED_SIT_UP, "MODIFIED_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_NEGATIVE_SIT_UP, "NEGATIVE_SIT_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_ONE_ARM_FULL_SIT_UP, "ONE_ARM_FULL_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_RECLINING_CIRCLE, "RECLINING_CIRCLE"},
+        {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_RECLINING_CIRCLE, "WEIGHTED_RECLINING_CIRCLE"}, {FIT_SIT_UP_EXERCISE_NAME_REVERSE_CURL_UP, "REVERSE_CURL_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_REVERSE_CURL_UP, "WEIGHTED_REVERSE_CURL_UP"}, {FIT_SIT_UP_EXERCISE_NAME_SINGLE_LEG_SWISS_BALL_JACKKNIFE, "SINGLE_LEG_SWISS_BALL_JACKKNIFE"},
+        {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_SWISS_BALL_JACKKNIFE, "WEIGHTED_SINGLE_LEG_SWISS_BALL_JACKKNIFE"}, {FIT_SIT_UP_EXERCISE_NAME_THE_TEASER, "THE_TEASER"},
+        {FIT_SIT_UP_EXERCISE_NAME_THE_TEASER_WEIGHTED, "THE_TEASER_WEIGHTED"}, {FIT_SIT_UP_EXERCISE_NAME_THREE_PART_ROLL_DOWN, "THREE_PART_ROLL_DOWN"},
+        {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_THREE_PART_ROLL_DOWN, "WEIGHTED_THREE_PART_ROLL_DOWN"}, {FIT_SIT_UP_EXERCISE_NAME_V_UP, "V_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_V_UP, "WEIGHTED_V_UP"}, {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_RUSSIAN_TWIST_ON_SWISS_BALL, "WEIGHTED_RUSSIAN_TWIST_ON_SWISS_BALL"},
+        {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_SIT_UP, "WEIGHTED_SIT_UP"}, {FIT_SIT_UP_EXERCISE_NAME_X_ABS, "X_ABS"},
+        {FIT_SIT_UP_EXERCISE_NAME_WEIGHTED_X_ABS, "WEIGHTED_X_ABS"}, {FIT_SIT_UP_EXERCISE_NAME_SIT_UP, "SIT_UP"},
+        {FIT_SIT_UP_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName squat_exercise_name_names[] = {
+        {FIT_SQUAT_EXERCISE_NAME_LEG_PRESS, "LEG_PRESS"}, {FIT_SQUAT_EXERCISE_NAME_BACK_SQUAT_WITH_BODY_BAR, "BACK_SQUAT_WITH_BODY_BAR"},
+        {FIT_SQUAT_EXERCISE_NAME_BACK_SQUATS, "BACK_SQUATS"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_BACK_SQUATS, "WEIGHTED_BACK_SQUATS"},
+        {FIT_SQUAT_EXERCISE_NAME_BALANCING_SQUAT, "BALANCING_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_BALANCING_SQUAT, "WEIGHTED_BALANCING_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_BARBELL_BACK_SQUAT, "BARBELL_BACK_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_BARBELL_BOX_SQUAT, "BARBELL_BOX_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_BARBELL_FRONT_SQUAT, "BARBELL_FRONT_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_BARBELL_HACK_SQUAT, "BARBELL_HACK_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_BARBELL_HANG_SQUAT_SNATCH, "BARBELL_HANG_SQUAT_SNATCH"}, {FIT_SQUAT_EXERCISE_NAME_BARBELL_LATERAL_STEP_UP, "BARBELL_LATERAL_STEP_UP"},
+        {FIT_SQUAT_EXERCISE_NAME_BARBELL_QUARTER_SQUAT, "BARBELL_QUARTER_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_BARBELL_SIFF_SQUAT, "BARBELL_SIFF_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_BARBELL_SQUAT_SNATCH, "BARBELL_SQUAT_SNATCH"}, {FIT_SQUAT_EXERCISE_NAME_BARBELL_SQUAT_WITH_HEELS_RAISED, "BARBELL_SQUAT_WITH_HEELS_RAISED"},
+        {FIT_SQUAT_EXERCISE_NAME_BARBELL_STEPOVER, "BARBELL_STEPOVER"}, {FIT_SQUAT_EXERCISE_NAME_BARBELL_STEP_UP, "BARBELL_STEP_UP"},
+        {FIT_SQUAT_EXERCISE_NAME_BENCH_SQUAT_WITH_ROTATIONAL_CHOP, "BENCH_SQUAT_WITH_ROTATIONAL_CHOP"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_BENCH_SQUAT_WITH_ROTATIONAL_CHOP, "WEIGHTED_BENCH_SQUAT_WITH_ROTATIONAL_CHOP"},
+        {FIT_SQUAT_EXERCISE_NAME_BODY_WEIGHT_WALL_SQUAT, "BODY_WEIGHT_WALL_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_WALL_SQUAT, "WEIGHTED_WALL_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_BOX_STEP_SQUAT, "BOX_STEP_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_BOX_STEP_SQUAT, "WEIGHTED_BOX_STEP_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_BRACED_SQUAT, "BRACED_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_CROSSED_ARM_BARBELL_FRONT_SQUAT, "CROSSED_ARM_BARBELL_FRONT_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_CROSSOVER_DUMBBELL_STEP_UP, "CROSSOVER_DUMBBELL_STEP_UP"}, {FIT_SQUAT_EXERCISE_NAME_DUMBBELL_FRONT_SQUAT, "DUMBBELL_FRONT_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_DUMBBELL_SPLIT_SQUAT, "DUMBBELL_SPLIT_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_DUMBBELL_SQUAT, "DUMBBELL_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_DUMBBELL_SQUAT_CLEAN, "DUMBBELL_SQUAT_CLEAN"}, {FIT_SQUAT_EXERCISE_NAME_DUMBBELL_STEPOVER, "DUMBBELL_STEPOVER"},
+        {FIT_SQUAT_EXERCISE_NAME_DUMBBELL_STEP_UP, "DUMBBELL_STEP_UP"}, {FIT_SQUAT_EXERCISE_NAME_ELEVATED_SINGLE_LEG_SQUAT, "ELEVATED_SINGLE_LEG_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_ELEVATED_SINGLE_LEG_SQUAT, "WEIGHTED_ELEVATED_SINGLE_LEG_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_FIGURE_FOUR_SQUATS, "FIGURE_FOUR_SQUATS"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_FIGURE_FOUR_SQUATS, "WEIGHTED_FIGURE_FOUR_SQUATS"}, {FIT_SQUAT_EXERCISE_NAME_GOBLET_SQUAT, "GOBLET_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_KETTLEBELL_SQUAT, "KETTLEBELL_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_KETTLEBELL_SWING_OVERHEAD, "KETTLEBELL_SWING_OVERHEAD"},
+        {FIT_SQUAT_EXERCISE_NAME_KETTLEBELL_SWING_WITH_FLIP_TO_SQUAT, "KETTLEBELL_SWING_WITH_FLIP_TO_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_LATERAL_DUMBBELL_STEP_UP, "LATERAL_DUMBBELL_STEP_UP"},
+        {FIT_SQUAT_EXERCISE_NAME_ONE_LEGGED_SQUAT, "ONE_LEGGED_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_OVERHEAD_DUMBBELL_SQUAT, "OVERHEAD_DUMBBELL_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_OVERHEAD_SQUAT, "OVERHEAD_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_PARTIAL_SINGLE_LEG_SQUAT, "PARTIAL_SINGLE_LEG_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_PARTIAL_SINGLE_LEG_SQUAT, "WEIGHTED_PARTIAL_SINGLE_LEG_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_PISTOL_SQUAT, "PISTOL_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_PISTOL_SQUAT, "WEIGHTED_PISTOL_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_PLIE_SLIDES, "PLIE_SLIDES"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_PLIE_SLIDES, "WEIGHTED_PLIE_SLIDES"}, {FIT_SQUAT_EXERCISE_NAME_PLIE_SQUAT, "PLIE_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_PLIE_SQUAT, "WEIGHTED_PLIE_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_PRISONER_SQUAT, "PRISONER_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_PRISONER_SQUAT, "WEIGHTED_PRISONER_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_SINGLE_LEG_BENCH_GET_UP, "SINGLE_LEG_BENCH_GET_UP"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_BENCH_GET_UP, "WEIGHTED_SINGLE_LEG_BENCH_GET_UP"}, {FIT_SQUAT_EXERCISE_NAME_SINGLE_LEG_BENCH_SQUAT, "SINGLE_LEG_BENCH_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_BENCH_SQUAT, "WEIGHTED_SINGLE_LEG_BENCH_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_SINGLE_LEG_SQUAT_ON_SWISS_BALL, "SINGLE_LEG_SQUAT_ON_SWISS_BALL"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_SQUAT_ON_SWISS_BALL, "WEIGHTED_SINGLE_LEG_SQUAT_ON_SWISS_BALL"}, {FIT_SQUAT_EXERCISE_NAME_SQUAT, "SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SQUAT, "WEIGHTED_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_SQUATS_WITH_BAND, "SQUATS_WITH_BAND"},
+        {FIT_SQUAT_EXERCISE_NAME_STAGGERED_SQUAT, "STAGGERED_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_STAGGERED_SQUAT, "WEIGHTED_STAGGERED_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_STEP_UP, "STEP_UP"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_STEP_UP, "WEIGHTED_STEP_UP"},
+        {FIT_SQUAT_EXERCISE_NAME_SUITCASE_SQUATS, "SUITCASE_SQUATS"}, {FIT_SQUAT_EXERCISE_NAME_SUMO_SQUAT, "SUMO_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_SUMO_SQUAT_SLIDE_IN, "SUMO_SQUAT_SLIDE_IN"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SUMO_SQUAT_SLIDE_IN, "WEIGHTED_SUMO_SQUAT_SLIDE_IN"},
+        {FIT_SQUAT_EXERCISE_NAME_SUMO_SQUAT_TO_HIGH_PULL, "SUMO_SQUAT_TO_HIGH_PULL"}, {FIT_SQUAT_EXERCISE_NAME_SUMO_SQUAT_TO_STAND, "SUMO_SQUAT_TO_STAND"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SUMO_SQUAT_TO_STAND, "WEIGHTED_SUMO_SQUAT_TO_STAND"}, {FIT_SQUAT_EXERCISE_NAME_SUMO_SQUAT_WITH_ROTATION, "SUMO_SQUAT_WITH_ROTATION"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SUMO_SQUAT_WITH_ROTATION, "WEIGHTED_SUMO_SQUAT_WITH_ROTATION"}, {FIT_SQUAT_EXERCISE_NAME_SWISS_BALL_BODY_WEIGHT_WALL_SQUAT, "SWISS_BALL_BODY_WEIGHT_WALL_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_SWISS_BALL_WALL_SQUAT, "WEIGHTED_SWISS_BALL_WALL_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_THRUSTERS, "THRUSTERS"},
+        {FIT_SQUAT_EXERCISE_NAME_UNEVEN_SQUAT, "UNEVEN_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_WEIGHTED_UNEVEN_SQUAT, "WEIGHTED_UNEVEN_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_WAIST_SLIMMING_SQUAT, "WAIST_SLIMMING_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_WALL_BALL, "WALL_BALL"},
+        {FIT_SQUAT_EXERCISE_NAME_WIDE_STANCE_BARBELL_SQUAT, "WIDE_STANCE_BARBELL_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_WIDE_STANCE_GOBLET_SQUAT, "WIDE_STANCE_GOBLET_SQUAT"},
+        {FIT_SQUAT_EXERCISE_NAME_ZERCHER_SQUAT, "ZERCHER_SQUAT"}, {FIT_SQUAT_EXERCISE_NAME_KBS_OVERHEAD, "KBS_OVERHEAD"},
+        {FIT_SQUAT_EXERCISE_NAME_SQUAT_AND_SIDE_KICK, "SQUAT_AND_SIDE_KICK"}, {FIT_SQUAT_EXERCISE_NAME_SQUAT_JUMPS_IN_N_OUT, "SQUAT_JUMPS_IN_N_OUT"},
+        {FIT_SQUAT_EXERCISE_NAME_PILATES_PLIE_SQUATS_PARALLEL_TURNED_OUT_FLAT_AND_HEELS, "PILATES_PLIE_SQUATS_PARALLEL_TURNED_OUT_FLAT_AND_HEELS"}, {FIT_SQUAT_EXERCISE_NAME_RELEVE_STRAIGHT_LEG_AND_KNEE_BENT_WITH_ONE_LEG_VARIATION, "RELEVE_STRAIGHT_LEG_AND_KNEE_BENT_WITH_ONE_LEG_VARIATION"},
+        {FIT_SQUAT_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName total_body_exercise_name_names[] = {
+        {FIT_TOTAL_BODY_EXERCISE_NAME_BURPEE, "BURPEE"}, {FIT_TOTAL_BODY_EXERCISE_NAME_WEIGHTED_BURPEE, "WEIGHTED_BURPEE"},
+        {FIT_TOTAL_BODY_EXERCISE_NAME_BURPEE_BOX_JUMP, "BURPEE_BOX_JUMP"}, {FIT_TOTAL_BODY_EXERCISE_NAME_WEIGHTED_BURPEE_BOX_JUMP, "WEIGHTED_BURPEE_BOX_JUMP"},
+        {FIT_TOTAL_BODY_EXERCISE_NAME_HIGH_PULL_BURPEE, "HIGH_PULL_BURPEE"}, {FIT_TOTAL_BODY_EXERCISE_NAME_MAN_MAKERS, "MAN_MAKERS"},
+        {FIT_TOTAL_BODY_EXERCISE_NAME_ONE_ARM_BURPEE, "ONE_ARM_BURPEE"}, {FIT_TOTAL_BODY_EXERCISE_NAME_SQUAT_THRUSTS, "SQUAT_THRUSTS"},
+        {FIT_TOTAL_BODY_EXERCISE_NAME_WEIGHTED_SQUAT_THRUSTS, "WEIGHTED_SQUAT_THRUSTS"}, {FIT_TOTAL_BODY_EXERCISE_NAME_SQUAT_PLANK_PUSH_UP, "SQUAT_PLANK_PUSH_UP"},
+        {FIT_TOTAL_BODY_EXERCISE_NAME_WEIGHTED_SQUAT_PLANK_PUSH_UP, "WEIGHTED_SQUAT_PLANK_PUSH_UP"}, {FIT_TOTAL_BODY_EXERCISE_NAME_STANDING_T_ROTATION_BALANCE, "STANDING_T_ROTATION_BALANCE"},
+        {FIT_TOTAL_BODY_EXERCISE_NAME_WEIGHTED_STANDING_T_ROTATION_BALANCE, "WEIGHTED_STANDING_T_ROTATION_BALANCE"}, {FIT_TOTAL_BODY_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName triceps_extension_exercise_name_names[] = {
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_BENCH_DIP, "BENCH_DIP"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_WEIGHTED_BENCH_DIP, "WEIGHTED_BENCH_DIP"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_BODY_WEIGHT_DIP, "BODY_WEIGHT_DIP"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_CABLE_KICKBACK, "CABLE_KICKBACK"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_CABLE_LYING_TRICEPS_EXTENSION, "CABLE_LYING_TRICEPS_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_CABLE_OVERHEAD_TRICEPS_EXTENSION, "CABLE_OVERHEAD_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_DUMBBELL_KICKBACK, "DUMBBELL_KICKBACK"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_DUMBBELL_LYING_TRICEPS_EXTENSION, "DUMBBELL_LYING_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_EZ_BAR_OVERHEAD_TRICEPS_EXTENSION, "EZ_BAR_OVERHEAD_TRICEPS_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_INCLINE_DIP, "INCLINE_DIP"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_WEIGHTED_INCLINE_DIP, "WEIGHTED_INCLINE_DIP"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_INCLINE_EZ_BAR_LYING_TRICEPS_EXTENSION, "INCLINE_EZ_BAR_LYING_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_LYING_DUMBBELL_PULLOVER_TO_EXTENSION, "LYING_DUMBBELL_PULLOVER_TO_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_LYING_EZ_BAR_TRICEPS_EXTENSION, "LYING_EZ_BAR_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_LYING_TRICEPS_EXTENSION_TO_CLOSE_GRIP_BENCH_PRESS, "LYING_TRICEPS_EXTENSION_TO_CLOSE_GRIP_BENCH_PRESS"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_OVERHEAD_DUMBBELL_TRICEPS_EXTENSION, "OVERHEAD_DUMBBELL_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_RECLINING_TRICEPS_PRESS, "RECLINING_TRICEPS_PRESS"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_REVERSE_GRIP_PRESSDOWN, "REVERSE_GRIP_PRESSDOWN"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_REVERSE_GRIP_TRICEPS_PRESSDOWN, "REVERSE_GRIP_TRICEPS_PRESSDOWN"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_ROPE_PRESSDOWN, "ROPE_PRESSDOWN"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SEATED_BARBELL_OVERHEAD_TRICEPS_EXTENSION, "SEATED_BARBELL_OVERHEAD_TRICEPS_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SEATED_DUMBBELL_OVERHEAD_TRICEPS_EXTENSION, "SEATED_DUMBBELL_OVERHEAD_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SEATED_EZ_BAR_OVERHEAD_TRICEPS_EXTENSION, "SEATED_EZ_BAR_OVERHEAD_TRICEPS_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SEATED_SINGLE_ARM_OVERHEAD_DUMBBELL_EXTENSION, "SEATED_SINGLE_ARM_OVERHEAD_DUMBBELL_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SINGLE_ARM_DUMBBELL_OVERHEAD_TRICEPS_EXTENSION, "SINGLE_ARM_DUMBBELL_OVERHEAD_TRICEPS_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SINGLE_DUMBBELL_SEATED_OVERHEAD_TRICEPS_EXTENSION, "SINGLE_DUMBBELL_SEATED_OVERHEAD_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SINGLE_LEG_BENCH_DIP_AND_KICK, "SINGLE_LEG_BENCH_DIP_AND_KICK"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_BENCH_DIP_AND_KICK, "WEIGHTED_SINGLE_LEG_BENCH_DIP_AND_KICK"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SINGLE_LEG_DIP, "SINGLE_LEG_DIP"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_WEIGHTED_SINGLE_LEG_DIP, "WEIGHTED_SINGLE_LEG_DIP"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_STATIC_LYING_TRICEPS_EXTENSION, "STATIC_LYING_TRICEPS_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SUSPENDED_DIP, "SUSPENDED_DIP"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_WEIGHTED_SUSPENDED_DIP, "WEIGHTED_SUSPENDED_DIP"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SWISS_BALL_DUMBBELL_LYING_TRICEPS_EXTENSION, "SWISS_BALL_DUMBBELL_LYING_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SWISS_BALL_EZ_BAR_LYING_TRICEPS_EXTENSION, "SWISS_BALL_EZ_BAR_LYING_TRICEPS_EXTENSION"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_SWISS_BALL_EZ_BAR_OVERHEAD_TRICEPS_EXTENSION, "SWISS_BALL_EZ_BAR_OVERHEAD_TRICEPS_EXTENSION"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_TABLETOP_DIP, "TABLETOP_DIP"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_WEIGHTED_TABLETOP_DIP, "WEIGHTED_TABLETOP_DIP"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_TRICEPS_EXTENSION_ON_FLOOR, "TRICEPS_EXTENSION_ON_FLOOR"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_TRICEPS_PRESSDOWN, "TRICEPS_PRESSDOWN"},
+        {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_WEIGHTED_DIP, "WEIGHTED_DIP"}, {FIT_TRICEPS_EXTENSION_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName warm_up_exercise_name_names[] = {
+        {FIT_WARM_UP_EXERCISE_NAME_QUADRUPED_ROCKING, "QUADRUPED_ROCKING"}, {FIT_WARM_UP_EXERCISE_NAME_NECK_TILTS, "NECK_TILTS"},
+        {FIT_WARM_UP_EXERCISE_NAME_ANKLE_CIRCLES, "ANKLE_CIRCLES"}, {FIT_WARM_UP_EXERCISE_NAME_ANKLE_DORSIFLEXION_WITH_BAND, "ANKLE_DORSIFLEXION_WITH_BAND"},
+        {FIT_WARM_UP_EXERCISE_NAME_ANKLE_INTERNAL_ROTATION, "ANKLE_INTERNAL_ROTATION"}, {FIT_WARM_UP_EXERCISE_NAME_ARM_CIRCLES, "ARM_CIRCLES"},
+        {FIT_WARM_UP_EXERCISE_NAME_BENT_OVER_REACH_TO_SKY, "BENT_OVER_REACH_TO_SKY"}, {FIT_WARM_UP_EXERCISE_NAME_CAT_CAMEL, "CAT_CAMEL"},
+        {FIT_WARM_UP_EXERCISE_NAME_ELBOW_TO_FOOT_LUNGE, "ELBOW_TO_FOOT_LUNGE"}, {FIT_WARM_UP_EXERCISE_NAME_FORWARD_AND_BACKWARD_LEG_SWINGS, "FORWARD_AND_BACKWARD_LEG_SWINGS"},
+        {FIT_WARM_UP_EXERCISE_NAME_GROINERS, "GROINERS"}, {FIT_WARM_UP_EXERCISE_NAME_INVERTED_HAMSTRING_STRETCH, "INVERTED_HAMSTRING_STRETCH"},
+        {FIT_WARM_UP_EXERCISE_NAME_LATERAL_DUCK_UNDER, "LATERAL_DUCK_UNDER"}, {FIT_WARM_UP_EXERCISE_NAME_NECK_ROTATIONS, "NECK_ROTATIONS"},
+        {FIT_WARM_UP_EXERCISE_NAME_OPPOSITE_ARM_AND_LEG_BALANCE, "OPPOSITE_ARM_AND_LEG_BALANCE"}, {FIT_WARM_UP_EXERCISE_NAME_REACH_ROLL_AND_LIFT, "REACH_ROLL_AND_LIFT"},
+        {FIT_WARM_UP_EXERCISE_NAME_SCORPION, "SCORPION"}, {FIT_WARM_UP_EXERCISE_NAME_SHOULDER_CIRCLES, "SHOULDER_CIRCLES"},
+        {FIT_WARM_UP_EXERCISE_NAME_SIDE_TO_SIDE_LEG_SWINGS, "SIDE_TO_SIDE_LEG_SWINGS"}, {FIT_WARM_UP_EXERCISE_NAME_SLEEPER_STRETCH, "SLEEPER_STRETCH"},
+        {FIT_WARM_UP_EXERCISE_NAME_SLIDE_OUT, "SLIDE_OUT"}, {FIT_WARM_UP_EXERCISE_NAME_SWISS_BALL_HIP_CROSSOVER, "SWISS_BALL_HIP_CROSSOVER"},
+        {FIT_WARM_UP_EXERCISE_NAME_SWISS_BALL_REACH_ROLL_AND_LIFT, "SWISS_BALL_REACH_ROLL_AND_LIFT"}, {FIT_WARM_UP_EXERCISE_NAME_SWISS_BALL_WINDSHIELD_WIPERS, "SWISS_BALL_WINDSHIELD_WIPERS"},
+        {FIT_WARM_UP_EXERCISE_NAME_THORACIC_ROTATION, "THORACIC_ROTATION"}, {FIT_WARM_UP_EXERCISE_NAME_WALKING_HIGH_KICKS, "WALKING_HIGH_KICKS"},
+        {FIT_WARM_UP_EXERCISE_NAME_WALKING_HIGH_KNEES, "WALKING_HIGH_KNEES"}, {FIT_WARM_UP_EXERCISE_NAME_WALKING_KNEE_HUGS, "WALKING_KNEE_HUGS"},
+        {FIT_WARM_UP_EXERCISE_NAME_WALKING_LEG_CRADLES, "WALKING_LEG_CRADLES"}, {FIT_WARM_UP_EXERCISE_NAME_WALKOUT, "WALKOUT"},
+        {FIT_WARM_UP_EXERCISE_NAME_WALKOUT_FROM_PUSH_UP_POSITION, "WALKOUT_FROM_PUSH_UP_POSITION"}, {FIT_WARM_UP_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName run_exercise_name_names[] = {
+        {FIT_RUN_EXERCISE_NAME_RUN, "RUN"}, {FIT_RUN_EXERCISE_NAME_WALK, "WALK"},
+        {FIT_RUN_EXERCISE_NAME_JOG, "JOG"}, {FIT_RUN_EXERCISE_NAME_SPRINT, "SPRINT"},
+        {FIT_RUN_EXERCISE_NAME_INVALID, "INVALID"},
+    };
+    static const FitEnumName water_type_names[] = {
+        {FIT_WATER_TYPE_FRESH, "FRESH"}, {FIT_WATER_TYPE_SALT, "SALT"},
+        {FIT_WATER_TYPE_EN13319, "EN13319"}, {FIT_WATER_TYPE_CUSTOM, "CUSTOM"},
+        {FIT_WATER_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName tissue_model_type_names[] = {
+        {FIT_TISSUE_MODEL_TYPE_ZHL_16C, "ZHL_16C"}, {FIT_TISSUE_MODEL_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName dive_gas_status_names[] = {
+        {FIT_DIVE_GAS_STATUS_DISABLED, "DISABLED"}, {FIT_DIVE_GAS_STATUS_ENABLED, "ENABLED"},
+        {FIT_DIVE_GAS_STATUS_BACKUP_ONLY, "BACKUP_ONLY"}, {FIT_DIVE_GAS_STATUS_INVALID, "INVALID"},
+    };
+    static const FitEnumName dive_alarm_type_names[] = {
+        {FIT_DIVE_ALARM_TYPE_DEPTH, "DEPTH"}, {FIT_DIVE_ALARM_TYPE_TIME, "TIME"},
+        {FIT_DIVE_ALARM_TYPE_INVALID, "INVALID"},
+    };
+    static const FitEnumName dive_backlight_mode_names[] = {
+        {FIT_DIVE_BACKLIGHT_MODE_AT_DEPTH, "AT_DEPTH"}, {FIT_DIVE_BACKLIGHT_MODE_ALWAYS_ON, "ALWAYS_ON"},
+        {FIT_DIVE_BACKLIGHT_MODE_INVALID, "INVALID"},
+    };
+    static const FitEnumName favero_product_names[] = {
+        {FIT_FAVERO_PRODUCT_ASSIOMA_UNO, "ASSIOMA_UNO"}, {FIT_FAVERO_PRODUCT_ASSIOMA_DUO, "ASSIOMA_DUO"},
+        {FIT_FAVERO_PRODUCT_INVALID, "INVALID"},
+    };
+    static const FitEnumName climb_pro_event_names[] = {
+        {FIT_CLIMB_PRO_EVENT_APPROACH, "APPROACH"}, {FIT_CLIMB_PRO_EVENT_START, "START"},
+        {FIT_CLIMB_PRO_EVENT_COMPLETE, "COMPLETE"}, {FIT_CLIMB_PRO_EVENT_INVALID, "INVALID"},
+    };
+    static const FitEnumName tap_sensitivity_names[] = {
+        {FIT_TAP_SENSITIVITY_HIGH, "HIGH"}, {FIT_TAP_SENSITIVITY_MEDIUM, "MEDIUM"},
+        {FIT_TAP_SENSITIVITY_LOW, "LOW"}, {FIT_TAP_SENSITIVITY_INVALID, "INVALID"},
+    };
+    static const FitEnumName radar_threat_level_type_names[] = {
+        {FIT_RADAR_THREAT_LEVEL_TYPE_THREAT_UNKNOWN, "THREAT_UNKNOWN"}, {FIT_RADAR_THREAT_LEVEL_TYPE_THREAT_NONE, "THREAT_NONE"},
+        {FIT_RADAR_THREAT_LEVEL_TYPE_THREAT_APPROACHING, "THREAT_APPROACHING"}, {FIT_RADAR_THREAT_LEVEL_TYPE_THREAT_APPROACHING_FAST, "THREAT_APPROACHING_FAST"},
+        {FIT_RADAR_THREAT_LEVEL_TYPE_INVALID, "INVALID"},
+    };
+
+    static const FitEnumTable tables[] = {
+        {nullptr, 0}, // Enum
+        {nullptr, 0}, // Sint8
+        {nullptr, 0}, // Uint8
+        {nullptr, 0}, // Sint16
+        {nullptr, 0}, // Uint16
+        {nullptr, 0}, // Sint32
+        {nullptr, 0}, // Uint32
+        {nullptr, 0}, // String
+        {nullptr, 0}, // Float32
+        {nullptr, 0}, // Float64
+        {nullptr, 0}, // Uint8z
+        {nullptr, 0}, // Uint16z
+        {nullptr, 0}, // Uint32z
+        {nullptr, 0}, // Byte
+        {nullptr, 0}, // Sint64
+        {nullptr, 0}, // Uint64
+        {nullptr, 0}, // Uint64z
+        {nullptr, 0}, // Bool
+        {file_names, 21}, // File
+        {mesg_num_names, 91}, // MesgNum
+        {checksum_names, 3}, // Checksum
+        {file_flags_names, 4}, // FileFlags
+        {mesg_count_names, 4}, // MesgCount
+        {nullptr, 0}, // DateTime
+        {nullptr, 0}, // LocalDateTime
+        {nullptr, 0}, // MessageIndex
+        {device_index_names, 2}, // DeviceIndex
+        {gender_names, 3}, // Gender
+        {language_names, 40}, // Language
+        {language_bits_0_names, 9}, // LanguageBits0
+        {language_bits_1_names, 9}, // LanguageBits1
+        {language_bits_2_names, 9}, // LanguageBits2
+        {language_bits_3_names, 9}, // LanguageBits3
+        {language_bits_4_names, 7}, // LanguageBits4
+        {time_zone_names, 107}, // TimeZone
+        {display_measure_names, 4}, // DisplayMeasure
+        {display_heart_names, 4}, // DisplayHeart
+        {display_power_names, 3}, // DisplayPower
+        {display_position_names, 43}, // DisplayPosition
+        {switch_names, 4}, // Switch
+        {sport_names, 52}, // Sport
+        {sport_bits_0_names, 9}, // SportBits0
+        {sport_bits_1_names, 9}, // SportBits1
+        {sport_bits_2_names, 9}, // SportBits2
+        {sport_bits_3_names, 9}, // SportBits3
+        {sport_bits_4_names, 9}, // SportBits4
+        {sport_bits_5_names, 9}, // SportBits5
+        {sport_bits_6_names, 2}, // SportBits6
+        {sub_sport_names, 62}, // SubSport
+        {sport_event_names, 10}, // SportEvent
+        {activity_names, 3}, // Activity
+        {intensity_names, 8}, // Intensity
+        {session_trigger_names, 5}, // SessionTrigger
+        {autolap_trigger_names, 8}, // AutolapTrigger
+        {lap_trigger_names, 10}, // LapTrigger
+        {time_mode_names, 7}, // TimeMode
+        {backlight_mode_names, 8}, // BacklightMode
+        {date_mode_names, 3}, // DateMode
+        {nullptr, 0}, // BacklightTimeout
+        {event_names, 38}, // Event
+        {event_type_names, 11}, // EventType
+        {timer_trigger_names, 4}, // TimerTrigger
+        {fitness_equipment_state_names, 5}, // FitnessEquipmentState
+        {tone_names, 5}, // Tone
+        {autoscroll_names, 5}, // Autoscroll
+        {activity_class_names, 4}, // ActivityClass
+        {hr_zone_calc_names, 4}, // HrZoneCalc
+        {pwr_zone_calc_names, 3}, // PwrZoneCalc
+        {wkt_step_duration_names, 32}, // WktStepDuration
+        {wkt_step_target_names, 15}, // WktStepTarget
+        {goal_names, 8}, // Goal
+        {goal_recurrence_names, 7}, // GoalRecurrence
+        {goal_source_names, 4}, // GoalSource
+        {schedule_names, 3}, // Schedule
+        {course_point_names, 27}, // CoursePoint
+        {manufacturer_names, 188}, // Manufacturer
+        {garmin_product_names, 322}, // GarminProduct
+        {antplus_device_type_names, 25}, // AntplusDeviceType
+        {ant_network_names, 5}, // AntNetwork
+        {workout_capabilities_names, 15}, // WorkoutCapabilities
+        {battery_status_names, 8}, // BatteryStatus
+        {hr_type_names, 3}, // HrType
+        {course_capabilities_names, 12}, // CourseCapabilities
+        {nullptr, 0}, // Weight
+        {nullptr, 0}, // WorkoutHr
+        {nullptr, 0}, // WorkoutPower
+        {bp_status_names, 6}, // BpStatus
+        {nullptr, 0}, // UserLocalId
+        {swim_stroke_names, 8}, // SwimStroke
+        {activity_type_names, 10}, // ActivityType
+        {activity_subtype_names, 21}, // ActivitySubtype
+        {activity_level_names, 4}, // ActivityLevel
+        {side_names, 3}, // Side
+        {nullptr, 0}, // LeftRightBalance
+        {nullptr, 0}, // LeftRightBalance100
+        {length_type_names, 3}, // LengthType
+        {day_of_week_names, 8}, // DayOfWeek
+        {connectivity_capabilities_names, 33}, // ConnectivityCapabilities
+        {weather_report_names, 4}, // WeatherReport
+        {weather_status_names, 22}, // WeatherStatus
+        {weather_severity_names, 6}, // WeatherSeverity
+        {weather_severe_type_names, 86}, // WeatherSevereType
+        {nullptr, 0}, // TimeIntoDay
+        {nullptr, 0}, // LocaltimeIntoDay
+        {stroke_type_names, 7}, // StrokeType
+        {body_location_names, 41}, // BodyLocation
+        {segment_lap_status_names, 3}, // SegmentLapStatus
+        {segment_leaderboard_type_names, 12}, // SegmentLeaderboardType
+        {segment_delete_status_names, 4}, // SegmentDeleteStatus
+        {segment_selection_type_names, 3}, // SegmentSelectionType
+        {source_type_names, 7}, // SourceType
+        {nullptr, 0}, // LocalDeviceType
+        {display_orientation_names, 6}, // DisplayOrientation
+        {workout_equipment_names, 7}, // WorkoutEquipment
+        {watchface_mode_names, 5}, // WatchfaceMode
+        {digital_watchface_layout_names, 4}, // DigitalWatchfaceLayout
+        {analog_watchface_layout_names, 4}, // AnalogWatchfaceLayout
+        {rider_position_type_names, 5}, // RiderPositionType
+        {power_phase_type_names, 5}, // PowerPhaseType
+        {camera_event_type_names, 14}, // CameraEventType
+        {sensor_type_names, 5}, // SensorType
+        {bike_light_network_config_type_names, 5}, // BikeLightNetworkConfigType
+        {comm_timeout_type_names, 5}, // CommTimeoutType
+        {camera_orientation_type_names, 5}, // CameraOrientationType
+        {attitude_stage_names, 5}, // AttitudeStage
+        {attitude_validity_names, 14}, // AttitudeValidity
+        {auto_sync_frequency_names, 6}, // AutoSyncFrequency
+        {exd_layout_names, 10}, // ExdLayout
+        {exd_display_type_names, 12}, // ExdDisplayType
+        {exd_data_units_names, 51}, // ExdDataUnits
+        {exd_qualifiers_names, 45}, // ExdQualifiers
+        {exd_descriptors_names, 98}, // ExdDescriptors
+        {auto_activity_detect_names, 8}, // AutoActivityDetect
+        {supported_exd_screen_layouts_names, 9}, // SupportedExdScreenLayouts
+        {fit_base_type_names, 18}, // FitBaseType
+        {turn_type_names, 39}, // TurnType
+        {bike_light_beam_angle_mode_names, 3}, // BikeLightBeamAngleMode
+        {fit_base_unit_names, 4}, // FitBaseUnit
+        {set_type_names, 3}, // SetType
+        {exercise_category_names, 35}, // ExerciseCategory
+        {bench_press_exercise_name_names, 28}, // BenchPressExerciseName
+        {calf_raise_exercise_name_names, 22}, // CalfRaiseExerciseName
+        {cardio_exercise_name_names, 23}, // CardioExerciseName
+        {carry_exercise_name_names, 6}, // CarryExerciseName
+        {chop_exercise_name_names, 24}, // ChopExerciseName
+        {core_exercise_name_names, 74}, // CoreExerciseName
+        {crunch_exercise_name_names, 86}, // CrunchExerciseName
+        {curl_exercise_name_names, 45}, // CurlExerciseName
+        {deadlift_exercise_name_names, 20}, // DeadliftExerciseName
+        {flye_exercise_name_names, 11}, // FlyeExerciseName
+        {hip_raise_exercise_name_names, 51}, // HipRaiseExerciseName
+        {hip_stability_exercise_name_names, 35}, // HipStabilityExerciseName
+        {hip_swing_exercise_name_names, 4}, // HipSwingExerciseName
+        {hyperextension_exercise_name_names, 41}, // HyperextensionExerciseName
+        {lateral_raise_exercise_name_names, 35}, // LateralRaiseExerciseName
+        {leg_curl_exercise_name_names, 13}, // LegCurlExerciseName
+        {leg_raise_exercise_name_names, 23}, // LegRaiseExerciseName
+        {lunge_exercise_name_names, 82}, // LungeExerciseName
+        {olympic_lift_exercise_name_names, 22}, // OlympicLiftExerciseName
+        {plank_exercise_name_names, 136}, // PlankExerciseName
+        {plyo_exercise_name_names, 34}, // PlyoExerciseName
+        {pull_up_exercise_name_names, 40}, // PullUpExerciseName
+        {push_up_exercise_name_names, 80}, // PushUpExerciseName
+        {row_exercise_name_names, 35}, // RowExerciseName
+        {shoulder_press_exercise_name_names, 25}, // ShoulderPressExerciseName
+        {shoulder_stability_exercise_name_names, 34}, // ShoulderStabilityExerciseName
+        {shrug_exercise_name_names, 18}, // ShrugExerciseName
+        {sit_up_exercise_name_names, 39}, // SitUpExerciseName
+        {squat_exercise_name_names, 93}, // SquatExerciseName
+        {total_body_exercise_name_names, 14}, // TotalBodyExerciseName
+        {triceps_extension_exercise_name_names, 42}, // TricepsExtensionExerciseName
+        {warm_up_exercise_name_names, 32}, // WarmUpExerciseName
+        {run_exercise_name_names, 5}, // RunExerciseName
+        {water_type_names, 5}, // WaterType
+        {tissue_model_type_names, 2}, // TissueModelType
+        {dive_gas_status_names, 4}, // DiveGasStatus
+        {dive_alarm_type_names, 3}, // DiveAlarmType
+        {dive_backlight_mode_names, 3}, // DiveBacklightMode
+        {favero_product_names, 3}, // FaveroProduct
+        {climb_pro_event_names, 4}, // ClimbProEvent
+        {tap_sensitivity_names, 4}, // TapSensitivity
+        {radar_threat_level_type_names, 5}, // RadarThreatLevelType
+        {nullptr, 0}, // Invalid
+    };
+    return tables[static_cast<int>(type)];
+}
+
+// Name of value in the table of type, nullptr if none
+inline const char* fit_enum_name(fit::Profile::Type type, FIT_UINT32 value)
+{
+    const FitEnumTable& table = fit_enum_table(type);
+    if (value < table.count && table.names[value].value == value) return table.names[value].name;
+
+    FIT_UINT16 lo = 0, hi = table.count;
+    while (lo < hi) {
+        FIT_UINT16 mid = (lo + hi) / 2;
+        if (table.names[mid].value < value) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < table.count && table.names[lo].value == value) ? table.names[lo].name : nullptr;
+}
+
+// Enumerated profile type of a mesg field, Profile::Type::Invalid if not enumerated
+inline fit::Profile::Type fit_enum_field_type(FIT_UINT16 mesg_num, FIT_UINT8 field_num)
+{
+    struct FitEnumField { FIT_UINT32 key; fit::Profile::Type type; }; // key: mesg_num << 8 | field_num
+    static const FitEnumField fields[] = {
+        {0x000000, fit::Profile::Type::File}, // file_id.type
+        {0x000001, fit::Profile::Type::Manufacturer}, // file_id.manufacturer
+        {0x000101, fit::Profile::Type::SportBits0}, // capabilities.sports
+        {0x000115, fit::Profile::Type::WorkoutCapabilities}, // capabilities.workouts_supported
+        {0x000117, fit::Profile::Type::ConnectivityCapabilities}, // capabilities.connectivity_supported
+        {0x000204, fit::Profile::Type::TimeMode}, // device_settings.time_mode
+        {0x00020c, fit::Profile::Type::BacklightMode}, // device_settings.backlight_mode
+        {0x00022f, fit::Profile::Type::DateMode}, // device_settings.date_mode
+        {0x000237, fit::Profile::Type::DisplayOrientation}, // device_settings.display_orientation
+        {0x000238, fit::Profile::Type::Side}, // device_settings.mounting_side
+        {0x000259, fit::Profile::Type::AutoSyncFrequency}, // device_settings.auto_sync_frequency
+        {0x00025a, fit::Profile::Type::AutoActivityDetect}, // device_settings.auto_activity_detect
+        {0x00025f, fit::Profile::Type::DisplayOrientation}, // device_settings.smart_notification_display_orientation
+        {0x000286, fit::Profile::Type::Switch}, // device_settings.tap_interface
+        {0x0002ae, fit::Profile::Type::TapSensitivity}, // device_settings.tap_sensitivity
+        {0x000301, fit::Profile::Type::Gender}, // user_profile.gender
+        {0x000305, fit::Profile::Type::Language}, // user_profile.language
+        {0x000306, fit::Profile::Type::DisplayMeasure}, // user_profile.elev_setting
+        {0x000307, fit::Profile::Type::DisplayMeasure}, // user_profile.weight_setting
+        {0x00030c, fit::Profile::Type::DisplayHeart}, // user_profile.hr_setting
+        {0x00030d, fit::Profile::Type::DisplayMeasure}, // user_profile.speed_setting
+        {0x00030e, fit::Profile::Type::DisplayMeasure}, // user_profile.dist_setting
+        {0x000310, fit::Profile::Type::DisplayPower}, // user_profile.power_setting
+        {0x000311, fit::Profile::Type::ActivityClass}, // user_profile.activity_class
+        {0x000312, fit::Profile::Type::DisplayPosition}, // user_profile.position_setting
+        {0x000315, fit::Profile::Type::DisplayMeasure}, // user_profile.temperature_setting
+        {0x00031e, fit::Profile::Type::DisplayMeasure}, // user_profile.height_setting
+        {0x00032f, fit::Profile::Type::DisplayMeasure}, // user_profile.depth_setting
+        {0x000601, fit::Profile::Type::Sport}, // bike_profile.sport
+        {0x000602, fit::Profile::Type::SubSport}, // bike_profile.sub_sport
+        {0x000705, fit::Profile::Type::HrZoneCalc}, // zones_target.hr_calc_type
+        {0x000707, fit::Profile::Type::PwrZoneCalc}, // zones_target.pwr_calc_type
+        {0x000c00, fit::Profile::Type::Sport}, // sport.sport
+        {0x000c01, fit::Profile::Type::SubSport}, // sport.sub_sport
+        {0x000f00, fit::Profile::Type::Sport}, // goal.sport
+        {0x000f01, fit::Profile::Type::SubSport}, // goal.sub_sport
+        {0x000f04, fit::Profile::Type::Goal}, // goal.type
+        {0x000f08, fit::Profile::Type::GoalRecurrence}, // goal.recurrence
+        {0x000f0b, fit::Profile::Type::GoalSource}, // goal.source
+        {0x001200, fit::Profile::Type::Event}, // session.event
+        {0x001201, fit::Profile::Type::EventType}, // session.event_type
+        {0x001205, fit::Profile::Type::Sport}, // session.sport
+        {0x001206, fit::Profile::Type::SubSport}, // session.sub_sport
+        {0x00121c, fit::Profile::Type::SessionTrigger}, // session.trigger
+        {0x00122b, fit::Profile::Type::SwimStroke}, // session.swim_stroke
+        {0x00122e, fit::Profile::Type::DisplayMeasure}, // session.pool_length_unit
+        {0x001300, fit::Profile::Type::Event}, // lap.event
+        {0x001301, fit::Profile::Type::EventType}, // lap.event_type
+        {0x001317, fit::Profile::Type::Intensity}, // lap.intensity
+        {0x001318, fit::Profile::Type::LapTrigger}, // lap.lap_trigger
+        {0x001319, fit::Profile::Type::Sport}, // lap.sport
+        {0x001326, fit::Profile::Type::SwimStroke}, // lap.swim_stroke
+        {0x001327, fit::Profile::Type::SubSport}, // lap.sub_sport
+        {0x00142a, fit::Profile::Type::ActivityType}, // record.activity_type
+        {0x001431, fit::Profile::Type::StrokeType}, // record.stroke_type
+        {0x00143e, fit::Profile::Type::DeviceIndex}, // record.device_index
+        {0x001500, fit::Profile::Type::Event}, // event.event
+        {0x001501, fit::Profile::Type::EventType}, // event.event_type
+        {0x00150d, fit::Profile::Type::DeviceIndex}, // event.device_index
+        {0x001515, fit::Profile::Type::RadarThreatLevelType}, // event.radar_threat_level_max
+        {0x001700, fit::Profile::Type::DeviceIndex}, // device_info.device_index
+        {0x001702, fit::Profile::Type::Manufacturer}, // device_info.manufacturer
+        {0x00170b, fit::Profile::Type::BatteryStatus}, // device_info.battery_status
+        {0x001712, fit::Profile::Type::BodyLocation}, // device_info.sensor_position
+        {0x001716, fit::Profile::Type::AntNetwork}, // device_info.ant_network
+        {0x001719, fit::Profile::Type::SourceType}, // device_info.source_type
+        {0x001a04, fit::Profile::Type::Sport}, // workout.sport
+        {0x001a05, fit::Profile::Type::WorkoutCapabilities}, // workout.capabilities
+        {0x001a0b, fit::Profile::Type::SubSport}, // workout.sub_sport
+        {0x001a0f, fit::Profile::Type::DisplayMeasure}, // workout.pool_length_unit
+        {0x001b01, fit::Profile::Type::WktStepDuration}, // workout_step.duration_type
+        {0x001b03, fit::Profile::Type::WktStepTarget}, // workout_step.target_type
+        {0x001b07, fit::Profile::Type::Intensity}, // workout_step.intensity
+        {0x001b09, fit::Profile::Type::WorkoutEquipment}, // workout_step.equipment
+        {0x001b0a, fit::Profile::Type::ExerciseCategory}, // workout_step.exercise_category
+        {0x001b0d, fit::Profile::Type::FitBaseUnit}, // workout_step.weight_display_unit
+        {0x001c00, fit::Profile::Type::Manufacturer}, // schedule.manufacturer
+        {0x001c05, fit::Profile::Type::Schedule}, // schedule.type
+        {0x001f04, fit::Profile::Type::Sport}, // course.sport
+        {0x001f06, fit::Profile::Type::CourseCapabilities}, // course.capabilities
+        {0x001f07, fit::Profile::Type::SubSport}, // course.sub_sport
+        {0x002005, fit::Profile::Type::CoursePoint}, // course_point.type
+        {0x002103, fit::Profile::Type::Sport}, // totals.sport
+        {0x002202, fit::Profile::Type::Activity}, // activity.type
+        {0x002203, fit::Profile::Type::Event}, // activity.event
+        {0x002204, fit::Profile::Type::EventType}, // activity.event_type
+        {0x002500, fit::Profile::Type::File}, // file_capabilities.type
+        {0x002501, fit::Profile::Type::FileFlags}, // file_capabilities.flags
+        {0x002600, fit::Profile::Type::File}, // mesg_capabilities.file
+        {0x002601, fit::Profile::Type::MesgNum}, // mesg_capabilities.mesg_num
+        {0x002602, fit::Profile::Type::MesgCount}, // mesg_capabilities.count_type
+        {0x002700, fit::Profile::Type::File}, // field_capabilities.file
+        {0x002701, fit::Profile::Type::MesgNum}, // field_capabilities.mesg_num
+        {0x003307, fit::Profile::Type::HrType}, // blood_pressure.heart_rate_type
+        {0x003308, fit::Profile::Type::BpStatus}, // blood_pressure.status
+        {0x003700, fit::Profile::Type::DeviceIndex}, // monitoring.device_index
+        {0x003705, fit::Profile::Type::ActivityType}, // monitoring.activity_type
+        {0x003706, fit::Profile::Type::ActivitySubtype}, // monitoring.activity_subtype
+        {0x003707, fit::Profile::Type::ActivityLevel}, // monitoring.activity_level
+        {0x004800, fit::Profile::Type::File}, // training_file.type
+        {0x004801, fit::Profile::Type::Manufacturer}, // training_file.manufacturer
+        {0x005204, fit::Profile::Type::DeviceIndex}, // ant_channel_id.device_index
+        {0x006500, fit::Profile::Type::Event}, // length.event
+        {0x006501, fit::Profile::Type::EventType}, // length.event_type
+        {0x006507, fit::Profile::Type::SwimStroke}, // length.swim_stroke
+        {0x00650c, fit::Profile::Type::LengthType}, // length.length_type
+        {0x006701, fit::Profile::Type::ActivityType}, // monitoring_info.activity_type
+        {0x006a00, fit::Profile::Type::Manufacturer}, // slave_device.manufacturer
+        {0x008000, fit::Profile::Type::WeatherReport}, // weather_conditions.weather_report
+        {0x008002, fit::Profile::Type::WeatherStatus}, // weather_conditions.condition
+        {0x00800c, fit::Profile::Type::DayOfWeek}, // weather_conditions.day_of_week
+        {0x008103, fit::Profile::Type::WeatherSeverity}, // weather_alert.severity
+        {0x008104, fit::Profile::Type::WeatherSevereType}, // weather_alert.type
+        {0x008e00, fit::Profile::Type::Event}, // segment_lap.event
+        {0x008e01, fit::Profile::Type::EventType}, // segment_lap.event_type
+        {0x008e17, fit::Profile::Type::Sport}, // segment_lap.sport
+        {0x008e20, fit::Profile::Type::SubSport}, // segment_lap.sub_sport
+        {0x008e3a, fit::Profile::Type::SportEvent}, // segment_lap.sport_event
+        {0x008e40, fit::Profile::Type::SegmentLapStatus}, // segment_lap.status
+        {0x008e53, fit::Profile::Type::Manufacturer}, // segment_lap.manufacturer
+        {0x009402, fit::Profile::Type::Sport}, // segment_id.sport
+        {0x009407, fit::Profile::Type::SegmentDeleteStatus}, // segment_id.delete_status
+        {0x009408, fit::Profile::Type::SegmentSelectionType}, // segment_id.selection_type
+        {0x009501, fit::Profile::Type::SegmentLeaderboardType}, // segment_leaderboard_entry.type
+        {0x009707, fit::Profile::Type::SegmentLeaderboardType}, // segment_file.leader_type
+        {0x009e00, fit::Profile::Type::Sport}, // workout_session.sport
+        {0x009e01, fit::Profile::Type::SubSport}, // workout_session.sub_sport
+        {0x009e05, fit::Profile::Type::DisplayMeasure}, // workout_session.pool_length_unit
+        {0x009f00, fit::Profile::Type::WatchfaceMode}, // watchface_settings.mode
+        {0x00a101, fit::Profile::Type::CameraEventType}, // camera_event.camera_event_type
+        {0x00a103, fit::Profile::Type::CameraOrientationType}, // camera_event.camera_orientation
+        {0x00a700, fit::Profile::Type::SensorType}, // three_d_sensor_calibration.sensor_type
+        {0x00b207, fit::Profile::Type::AttitudeStage}, // aviation_attitude.stage
+        {0x00b20a, fit::Profile::Type::AttitudeValidity}, // aviation_attitude.validity
+        {0x00bc00, fit::Profile::Type::Switch}, // ohr_settings.enabled
+        {0x00c802, fit::Profile::Type::ExdLayout}, // exd_screen_configuration.layout
+        {0x00c904, fit::Profile::Type::ExdDisplayType}, // exd_data_field_configuration.display_type
+        {0x00ca08, fit::Profile::Type::ExdDataUnits}, // exd_data_concept_configuration.data_units
+        {0x00ca09, fit::Profile::Type::ExdQualifiers}, // exd_data_concept_configuration.qualifier
+        {0x00ca0a, fit::Profile::Type::ExdDescriptors}, // exd_data_concept_configuration.descriptor
+        {0x00ce02, fit::Profile::Type::FitBaseType}, // field_description.fit_base_type_id
+        {0x00ce0d, fit::Profile::Type::FitBaseUnit}, // field_description.fit_base_unit_id
+        {0x00ce0e, fit::Profile::Type::MesgNum}, // field_description.native_mesg_num
+        {0x00cf02, fit::Profile::Type::Manufacturer}, // developer_data_id.manufacturer_id
+        {0x00d200, fit::Profile::Type::SensorType}, // one_d_sensor_calibration.sensor_type
+        {0x00e105, fit::Profile::Type::SetType}, // set.set_type
+        {0x00e107, fit::Profile::Type::ExerciseCategory}, // set.category
+        {0x00e109, fit::Profile::Type::FitBaseUnit}, // set.weight_display_unit
+        {0x010201, fit::Profile::Type::TissueModelType}, // dive_settings.model
+        {0x010204, fit::Profile::Type::WaterType}, // dive_settings.water_type
+        {0x01020e, fit::Profile::Type::DiveBacklightMode}, // dive_settings.backlight_mode
+        {0x010213, fit::Profile::Type::SourceType}, // dive_settings.heart_rate_source_type
+        {0x010302, fit::Profile::Type::DiveGasStatus}, // dive_gas.status
+        {0x010603, fit::Profile::Type::DiveAlarmType}, // dive_alarm.alarm_type
+        {0x010604, fit::Profile::Type::Tone}, // dive_alarm.sound
+        {0x010605, fit::Profile::Type::SubSport}, // dive_alarm.dive_types
+        {0x010800, fit::Profile::Type::ExerciseCategory}, // exercise_title.exercise_category
+        {0x010c00, fit::Profile::Type::MesgNum}, // dive_summary.reference_mesg
+        {0x013d02, fit::Profile::Type::ClimbProEvent}, // climb_pro.climb_pro_event
+    };
+    static const FIT_UINT16 count = sizeof(fields) / sizeof(fields[0]);
+
+    FIT_UINT32 key = static_cast<FIT_UINT32>(mesg_num) << 8 | field_num;
+    FIT_UINT16 lo = 0, hi = count;
+    while (lo < hi) {
+        FIT_UINT16 mid = (lo + hi) / 2;
+        if (fields[mid].key < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < count && fields[lo].key == key) ? fields[lo].type : fit::Profile::Type::Invalid;
+}
+
+#endif // defined(FITENUMS_H)
@@ -0,0 +1,499 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "fit_accelerometer_data_mesg.hpp"
+#include "fit_activity_mesg.hpp"
+#include "fit_crc.hpp"
+#include "fit_developer_data_id_mesg.hpp"
+#include "fit_developer_field.hpp"
+#include "fit_event_mesg.hpp"
+#include "fit_field_description_mesg.hpp"
+#include "fit_file_id_mesg.hpp"
+#include "fit_hrv_mesg.hpp"
+#include "fit_lap_mesg.hpp"
+#include "fit_mesg_definition.hpp"
+#include "fit_monitoring_mesg.hpp"
+#include "fit_record_mesg.hpp"
+#include "fit_session_mesg.hpp"
+
+#include "fitgen.h"
+
+// Deterministic synthetic FIT activities for benchmarks and scaling tests. Mesgs are
+// built with the SDK and serialized with Mesg/MesgDefinition::Write, but framed here
+// rather than by fit::Encode: compressed timestamp headers and big-endian definitions
+// need their own framing, and the file CRC is computed while streaming (fit::Encode
+// re-reads the whole file on Close).
+
+#define FITGEN_START_TIME 1000000000 // 2021-09-08T01:46:40Z
+#define FITGEN_ACCEL_SAMPLES 30 // Accelerometer samples per mesg
+#define FITGEN_HRV_BEATS 5 // R-R intervals per hrv mesg
+#define FITGEN_MAX_SAMPLE_HZ 1000
+#define FITGEN_MAX_DEV_FIELDS 64
+
+// Local mesg nums (one per mesg type, so definitions are written once). Compressed
+// timestamp headers only carry local nums 0-3: records use 0.
+enum LOCAL_MESG { LOCAL_RECORD, LOCAL_HRV, LOCAL_ACCEL, LOCAL_MONITORING, LOCAL_LAP, LOCAL_EVENT,
+                  LOCAL_FILE_ID, LOCAL_DEVELOPER, LOCAL_FIELD_DESC, LOCAL_SESSION, LOCAL_ACTIVITY };
+
+
+// splitmix64: std distributions are implementation defined, this is not
+class SplitMix64
+{
+public:
+
+    explicit SplitMix64(std::uint64_t seed) : state(seed) { }
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform integer in [lo, hi]
+    std::int64_t range(std::int64_t lo, std::int64_t hi) {
+        return lo + static_cast<std::int64_t>(next() % static_cast<std::uint64_t>(hi - lo + 1));
+    }
+
+    // Random walk step of value within [lo, hi]
+    std::int64_t walk(std::int64_t value, std::int64_t step, std::int64_t lo, std::int64_t hi) {
+        return std::min(std::max(value + range(-step, step), lo), hi);
+    }
+
+private:
+
+    std::uint64_t state;
+};
+
+
+// FIT CRC state after nbytes zero bytes from state (CRC::Get16 is linear over GF(2)
+// in the state): applies the 16x16 bit matrix of one zero byte, squared per bit of nbytes
+static FIT_UINT16 _crc_zeros(FIT_UINT16 state, std::uint64_t nbytes)
+{
+    FIT_UINT16 op[16], sq[16];
+    for (int b = 0; b < 16; ++b) op[b] = fit::CRC::Get16(static_cast<FIT_UINT16>(1 << b), 0);
+
+    auto apply = [](const FIT_UINT16* m, FIT_UINT16 s) {
+        FIT_UINT16 r = 0;
+        for (int b = 0; b < 16; ++b) if ((s >> b) & 1) r ^= m[b];
+        return r;
+    };
+
+    for (; nbytes > 0; nbytes >>= 1) {
+        if (nbytes & 1) state = apply(op, state);
+        for (int b = 0; b < 16; ++b) sq[b] = apply(op, op[b]);
+        std::copy(sq, sq + 16, op);
+    }
+    return state;
+}
+
+// Streams FIT records after a placeholder header. The data CRC starts from 0 and is
+// combined with the header's at finish(), so nothing is read back.
+class FitRecordWriter
+{
+public:
+
+    FitRecordWriter(std::ostream& fit_stream, bool big_endian)
+        : out(fit_stream), swap(fit::GetArch() != (big_endian ? FIT_ARCH_ENDIAN_BIG : FIT_ARCH_ENDIAN_LITTLE)),
+          arch(big_endian ? FIT_ARCH_ENDIAN_BIG : FIT_ARCH_ENDIAN_LITTLE), crc(0), data_size(0), defined{} {
+        char header[FIT_FILE_HDR_SIZE] = {};
+        out.write(header, FIT_FILE_HDR_SIZE);
+    }
+
+    // Writes mesg as local (and its definition if it changed), with a compressed
+    // timestamp header if timestamp >= 0 (the mesg then has no timestamp field)
+    void write(fit::Mesg& mesg, FIT_UINT8 local, std::int64_t timestamp = -1) {
+        mesg.SetLocalNum(local);
+        fit::MesgDefinition def(mesg);
+        if (!defined[local] || defs[local] != def) {
+            buffer.str("");
+            if (def.Write(buffer) == 0) throw std::runtime_error("ERROR writing FIT definition");
+            std::string bytes = buffer.str();
+            bytes[2] = static_cast<char>(arch);
+            if (swap) std::swap(bytes[3], bytes[4]);
+            _put(bytes);
+            defs[local] = def;
+            defined[local] = true;
+        }
+
+        buffer.str("");
+        if (mesg.Write(buffer, &defs[local]) == 0) throw std::runtime_error("ERROR writing FIT mesg");
+        std::string bytes = buffer.str();
+        if (timestamp >= 0) bytes[0] = static_cast<char>(FIT_HDR_TIME_REC_BIT | (local << FIT_HDR_TIME_TYPE_SHIFT)
+            | (timestamp & FIT_HDR_TIME_OFFSET_MASK));
+        if (swap) _swap_fields(bytes, defs[local]);
+        _put(bytes);
+    }
+
+    std::uint64_t size() const { return FIT_FILE_HDR_SIZE + data_size; }
+
+    // Appends the file CRC, patches the header; returns the file size
+    std::uint64_t finish() {
+        if (data_size > 0xFFFFFFFFULL) throw std::runtime_error("ERROR FIT data size exceeds 4GB");
+
+        FIT_FILE_HDR header;
+        header.header_size = FIT_FILE_HDR_SIZE;
+        header.protocol_version = FIT_PROTOCOL_VERSION;
+        header.profile_version = FIT_PROFILE_VERSION;
+        header.data_size = static_cast<FIT_UINT32>(data_size);
+        std::memcpy(&header.data_type, ".FIT", 4);
+        header.crc = fit::CRC::Calc16(&header, FIT_STRUCT_OFFSET(crc, FIT_FILE_HDR));
+
+        FIT_UINT16 file_crc = _crc_zeros(fit::CRC::Calc16(&header, FIT_FILE_HDR_SIZE), data_size) ^ crc;
+        out.put(static_cast<char>(file_crc & 0xFF));
+        out.put(static_cast<char>(file_crc >> 8));
+        out.seekp(0, std::ios::beg);
+        out.write(reinterpret_cast<const char*>(&header), FIT_FILE_HDR_SIZE);
+        out.seekp(0, std::ios::end);
+        if (!out) throw std::runtime_error("ERROR writing synthetic FIT file");
+        return size() + 2;
+    }
+
+private:
+
+    std::ostream& out;
+    bool swap; // Host and file byte order differ
+    FIT_UINT8 arch;
+    FIT_UINT16 crc;
+    std::uint64_t data_size;
+    fit::MesgDefinition defs[FIT_HDR_TYPE_MASK + 1];
+    bool defined[FIT_HDR_TYPE_MASK + 1];
+    std::ostringstream buffer;
+
+    void _put(const std::string& bytes) {
+        for (char c : bytes) crc = fit::CRC::Get16(crc, static_cast<FIT_UINT8>(c));
+        out.write(bytes.data(), bytes.size());
+        data_size += bytes.size();
+    }
+
+    // Reverses each field element (of its base type size) after the record header
+    static void _swap_fields(std::string& bytes, const fit::MesgDefinition& def) {
+        size_t offset = 1;
+        auto swap_field = [&](FIT_UINT8 type, FIT_UINT8 size) {
+            FIT_UINT8 esize = fit::baseTypeSizes[type & FIT_BASE_TYPE_NUM_MASK];
+            for (size_t k = 0; esize > 1 && k + esize <= size; k += esize)
+                std::reverse(bytes.begin() + offset + k, bytes.begin() + offset + k + esize);
+            offset += size;
+        };
+        for (const fit::FieldDefinition& fdef : def.GetFields()) swap_field(fdef.GetType(), fdef.GetSize());
+        for (const fit::DeveloperFieldDefinition& fdef : def.GetDevFields()) swap_field(fdef.GetType(), fdef.GetSize());
+    }
+};
+
+
+std::uint64_t write_synthetic_fit(const GenOptions& options, std::ostream& out)
+{
+    if (options.target_bytes <= 0 && options.duration_seconds <= 0)
+        throw std::runtime_error("ERROR synthetic FIT duration_seconds or target_bytes must be > 0");
+    if (options.target_bytes > FITGEN_MAX_BYTES)
+        throw std::runtime_error("ERROR synthetic FIT target_bytes exceeds " + std::to_string(FITGEN_MAX_BYTES));
+    if (options.sample_hz < 1 || options.sample_hz > FITGEN_MAX_SAMPLE_HZ)
+        throw std::runtime_error("ERROR synthetic FIT sample_hz must be in [1, " + std::to_string(FITGEN_MAX_SAMPLE_HZ) + "]");
+    if (options.dev_fields < 0 || options.dev_fields > FITGEN_MAX_DEV_FIELDS)
+        throw std::runtime_error("ERROR synthetic FIT dev_fields must be in [0, " + std::to_string(FITGEN_MAX_DEV_FIELDS) + "]");
+    if (options.laps && options.lap_seconds <= 0)
+        throw std::runtime_error("ERROR synthetic FIT lap_seconds must be > 0");
+    if (!(options.records || options.laps || options.hrv || options.accelerometer || options.monitoring))
+        throw std::runtime_error("ERROR synthetic FIT mesg mix is empty");
+
+    SplitMix64 rng(options.seed);
+    FitRecordWriter writer(out, options.big_endian);
+    const FIT_DATE_TIME tstart = FITGEN_START_TIME;
+
+    fit::FileIdMesg file_id;
+    file_id.SetType(FIT_FILE_ACTIVITY);
+    file_id.SetManufacturer(FIT_MANUFACTURER_DEVELOPMENT);
+    file_id.SetProduct(1);
+    file_id.SetSerialNumber(static_cast<FIT_UINT32Z>(rng.range(1, 0xFFFFFFFE)));
+    file_id.SetTimeCreated(tstart);
+    writer.write(file_id, LOCAL_FILE_ID);
+
+    // Developer fields: one developer, float32 fields synthetic_<k>
+    fit::DeveloperDataIdMesg developer;
+    std::vector<fit::FieldDescriptionMesg> descriptions;
+    if (options.dev_fields > 0) {
+        developer.SetDeveloperDataIndex(0);
+        for (FIT_UINT8 k = 0; k < 16; ++k) developer.SetApplicationId(k, static_cast<FIT_BYTE>(rng.range(0, 255)));
+        writer.write(developer, LOCAL_DEVELOPER);
+
+        for (int k = 0; k < options.dev_fields; ++k) {
+            fit::FieldDescriptionMesg description;
+            description.SetDeveloperDataIndex(0);
+            description.SetFieldDefinitionNumber(static_cast<FIT_UINT8>(k));
+            description.SetFitBaseTypeId(FIT_FIT_BASE_TYPE_FLOAT32);
+            description.SetFieldName(0, L"synthetic_" + std::to_wstring(k));
+            description.SetUnits(0, L"units");
+            writer.write(description, LOCAL_FIELD_DESC);
+            descriptions.push_back(description);
+        }
+    }
+
+    fit::EventMesg event;
+    event.SetTimestamp(tstart);
+    event.SetEvent(FIT_EVENT_TIMER);
+    event.SetEventType(FIT_EVENT_TYPE_START);
+    event.SetTimerTrigger(FIT_TIMER_TRIGGER_MANUAL);
+    writer.write(event, LOCAL_EVENT);
+
+    // Integer random walks (float conversion by one division, so platform independent)
+    std::int64_t heart_rate = 120, cadence = 85, power = 200, speed_mms = 8000, altitude_dm = 1000;
+    std::int64_t lat = 500000000, lon = -1000000000, distance_cm = 0, cycles = 0, work_j = 0;
+    std::vector<std::int64_t> dev_values(options.dev_fields, 0);
+    std::vector<std::int64_t> beats_ms;
+    std::int64_t beat_remainder_ms = 0, accel_sample = 0;
+
+    FIT_UINT16 nlaps = 0;
+    FIT_DATE_TIME lap_start = tstart;
+    std::int64_t lap_start_cm = 0, lap_hr_sum = 0, lap_hr_max = 0, hr_max = 0, hr_sum = 0;
+    auto write_lap = [&](FIT_DATE_TIME timestamp) {
+        fit::LapMesg lap;
+        lap.SetMessageIndex(nlaps++);
+        lap.SetTimestamp(timestamp);
+        lap.SetStartTime(lap_start);
+        lap.SetEvent(FIT_EVENT_LAP);
+        lap.SetEventType(FIT_EVENT_TYPE_STOP);
+        lap.SetSport(FIT_SPORT_CYCLING);
+        lap.SetTotalElapsedTime(static_cast<FIT_FLOAT32>(timestamp - lap_start));
+        lap.SetTotalTimerTime(static_cast<FIT_FLOAT32>(timestamp - lap_start));
+        lap.SetTotalDistance((distance_cm - lap_start_cm) / 100.0f);
+        lap.SetAvgHeartRate(static_cast<FIT_UINT8>(lap_hr_sum / std::max<std::int64_t>(timestamp - lap_start, 1)));
+        lap.SetMaxHeartRate(static_cast<FIT_UINT8>(lap_hr_max));
+        writer.write(lap, LOCAL_LAP);
+        lap_start = timestamp;
+        lap_start_cm = distance_cm;
+        lap_hr_sum = lap_hr_max = 0;
+    };
+
+    std::int64_t sec = 0;
+    for (; options.target_bytes > 0 ? writer.size() < static_cast<std::uint64_t>(options.target_bytes)
+                                    : sec < options.duration_seconds; ++sec) {
+        const FIT_DATE_TIME timestamp = static_cast<FIT_DATE_TIME>(tstart + sec);
+        heart_rate = rng.walk(heart_rate, 2, 90, 185);
+        cadence = rng.walk(cadence, 3, 60, 110);
+        power = rng.walk(power, 15, 100, 400);
+        speed_mms = rng.walk(speed_mms, 100, 4000, 14000);
+        altitude_dm = rng.walk(altitude_dm, 3, 0, 20000);
+        lat += rng.range(-200, 200);
+        lon += rng.range(-200, 200);
+        distance_cm += speed_mms / 10;
+        cycles += cadence;
+        work_j += power;
+        hr_sum += heart_rate; lap_hr_sum += heart_rate;
+        hr_max = std::max(hr_max, heart_rate); lap_hr_max = std::max(lap_hr_max, heart_rate);
+
+        if (options.records) {
+            fit::RecordMesg record;
+            bool compressed = options.compressed_timestamps && sec > 0;
+            if (!compressed) record.SetTimestamp(timestamp);
+            record.SetHeartRate(static_cast<FIT_UINT8>(heart_rate));
+            record.SetCadence(static_cast<FIT_UINT8>(cadence));
+            record.SetPower(static_cast<FIT_UINT16>(power));
+            record.SetSpeed(speed_mms / 1000.0f);
+            record.SetDistance(distance_cm / 100.0f);
+            record.SetAltitude(altitude_dm / 10.0f);
+            record.SetPositionLat(static_cast<FIT_SINT32>(lat));
+            record.SetPositionLong(static_cast<FIT_SINT32>(lon));
+            for (int k = 0; k < options.dev_fields; ++k) {
+                dev_values[k] = rng.walk(dev_values[k], 50, -100000, 100000);
+                fit::DeveloperField dev_field(descriptions[k], developer);
+                dev_field.SetFLOAT32Value(dev_values[k] / 1000.0f);
+                record.AddDeveloperField(dev_field);
+            }
+            writer.write(record, LOCAL_RECORD, compressed ? static_cast<std::int64_t>(timestamp) : -1);
+        }
+
+        // R-R intervals at the current heart rate, FITGEN_HRV_BEATS per mesg
+        if (options.hrv) {
+            for (beat_remainder_ms += 1000; beat_remainder_ms > 0; ) {
+                std::int64_t rr_ms = 60000 / heart_rate + rng.range(-15, 15);
+                beats_ms.push_back(rr_ms);
+                beat_remainder_ms -= rr_ms;
+            }
+            while (beats_ms.size() >= FITGEN_HRV_BEATS) {
+                fit::HrvMesg hrv;
+                for (FIT_UINT8 k = 0; k < FITGEN_HRV_BEATS; ++k) hrv.SetTime(k, beats_ms[k] / 1000.0f);
+                beats_ms.erase(beats_ms.begin(), beats_ms.begin() + FITGEN_HRV_BEATS);
+                writer.write(hrv, LOCAL_HRV);
+            }
+        }
+
+        // sample_hz samples in mesgs of FITGEN_ACCEL_SAMPLES (offsets from timestamp_ms)
+        if (options.accelerometer) {
+            for (int first = 0; first < options.sample_hz; first += FITGEN_ACCEL_SAMPLES) {
+                int nsamples = std::min(FITGEN_ACCEL_SAMPLES, options.sample_hz - first);
+                FIT_UINT16 timestamp_ms = static_cast<FIT_UINT16>(first * 1000 / options.sample_hz);
+                fit::AccelerometerDataMesg accel;
+                accel.SetTimestamp(timestamp);
+                accel.SetTimestampMs(timestamp_ms);
+                for (int j = 0; j < nsamples; ++j, ++accel_sample) {
+                    FIT_UINT8 idx = static_cast<FIT_UINT8>(j);
+                    accel.SetSampleTimeOffset(idx, static_cast<FIT_UINT16>((first + j) * 1000 / options.sample_hz - timestamp_ms));
+                    FIT_UINT16 counts[3];
+                    for (int axis = 0; axis < 3; ++axis) counts[axis] = static_cast<FIT_UINT16>(2048 + rng.range(-400, 400));
+                    accel.SetAccelX(idx, counts[0]);
+                    accel.SetAccelY(idx, counts[1]);
+                    accel.SetAccelZ(idx, counts[2]);
+                    accel.SetCalibratedAccelX(idx, (counts[0] - 2048) / 1024.0f);
+                    accel.SetCalibratedAccelY(idx, (counts[1] - 2048) / 1024.0f);
+                    accel.SetCalibratedAccelZ(idx, (counts[2] - 2048) / 1024.0f);
+                }
+                writer.write(accel, LOCAL_ACCEL);
+            }
+        }
+
+        if (options.monitoring && sec % 60 == 59) {
+            fit::MonitoringMesg monitoring;
+            monitoring.SetTimestamp(timestamp);
+            monitoring.SetActivityType(FIT_ACTIVITY_TYPE_CYCLING);
+            monitoring.SetCycles(cycles / 60.0f);
+            monitoring.SetDistance(distance_cm / 100.0f);
+            monitoring.SetCalories(static_cast<FIT_UINT16>(work_j / 4184));
+            monitoring.SetHeartRate(static_cast<FIT_UINT8>(heart_rate));
+            writer.write(monitoring, LOCAL_MONITORING);
+        }
+
+        if (options.laps && (sec + 1) % options.lap_seconds == 0) write_lap(timestamp + 1);
+    }
+
+    // Timer stop, last partial lap, session and activity summaries
+    const FIT_DATE_TIME tend = static_cast<FIT_DATE_TIME>(tstart + sec);
+    event.SetTimestamp(tend);
+    event.SetEventType(FIT_EVENT_TYPE_STOP_ALL);
+    writer.write(event, LOCAL_EVENT);
+
+    if (options.laps) {
+        if (lap_start < tend) write_lap(tend);
+
+        fit::SessionMesg session;
+        session.SetMessageIndex(0);
+        session.SetTimestamp(tend);
+        session.SetStartTime(tstart);
+        session.SetEvent(FIT_EVENT_SESSION);
+        session.SetEventType(FIT_EVENT_TYPE_STOP);
+        session.SetSport(FIT_SPORT_CYCLING);
+        session.SetTotalElapsedTime(static_cast<FIT_FLOAT32>(sec));
+        session.SetTotalTimerTime(static_cast<FIT_FLOAT32>(sec));
+        session.SetTotalDistance(distance_cm / 100.0f);
+        session.SetAvgHeartRate(static_cast<FIT_UINT8>(hr_sum / std::max<std::int64_t>(sec, 1)));
+        session.SetMaxHeartRate(static_cast<FIT_UINT8>(hr_max));
+        session.SetFirstLapIndex(0);
+        session.SetNumLaps(nlaps);
+        writer.write(session, LOCAL_SESSION);
+
+        fit::ActivityMesg activity;
+        activity.SetTimestamp(tend);
+        activity.SetTotalTimerTime(static_cast<FIT_FLOAT32>(sec));
+        activity.SetNumSessions(1);
+        activity.SetType(FIT_ACTIVITY_MANUAL);
+        activity.SetEvent(FIT_EVENT_ACTIVITY);
+        activity.SetEventType(FIT_EVENT_TYPE_STOP);
+        writer.write(activity, LOCAL_ACTIVITY);
+    }
+    return writer.finish();
+}
+
+
+#if !defined FITGEN_NO_MAIN
+// Byte count with an optional K/M/G suffix (powers of 1000)
+static std::int64_t _parse_bytes(const std::string& value)
+{
+    size_t pos = 0;
+    std::int64_t nbytes = std::stoll(value, &pos);
+    std::string suffix = value.substr(pos);
+    if (suffix == "K" || suffix == "k") return nbytes * 1000;
+    if (suffix == "M" || suffix == "m") return nbytes * 1000000;
+    if (suffix == "G" || suffix == "g") return nbytes * 1000000000;
+    if (!suffix.empty()) throw std::invalid_argument("byte count suffix");
+    return nbytes;
+}
+
+static bool _parse_mix(const std::string& value, GenOptions& options)
+{
+    options.records = options.laps = options.hrv = options.accelerometer = options.monitoring = false;
+    std::istringstream mix(value);
+    for (std::string mesg; std::getline(mix, mesg, ','); ) {
+        if (mesg == "record") options.records = true;
+        else if (mesg == "lap") options.laps = true;
+        else if (mesg == "hrv") options.hrv = true;
+        else if (mesg == "accelerometer") options.accelerometer = true;
+        else if (mesg == "monitoring") options.monitoring = true;
+        else return false;
+    }
+    return true;
+}
+
+static bool _parse_gen_options(int argc, char* argv[], GenOptions& options, std::int64_t& nfiles, std::string& out_name)
+{
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            if (option == "--compressed-timestamps") { options.compressed_timestamps = true; continue; }
+            if (option == "--big-endian") { options.big_endian = true; continue; }
+            if (i == argc - 1) {
+                if (option.compare(0, 2, "--") == 0) return false;
+                out_name = option;
+                return true;
+            }
+
+            std::string value = argv[++i];
+            if (option == "--seed") options.seed = std::stoull(value);
+            else if (option == "--duration") options.duration_seconds = std::stoll(value);
+            else if (option == "--target-bytes") options.target_bytes = _parse_bytes(value);
+            else if (option == "--sample-hz") options.sample_hz = std::stoi(value);
+            else if (option == "--lap-seconds") options.lap_seconds = std::stoll(value);
+            else if (option == "--dev-fields") options.dev_fields = std::stoi(value);
+            else if (option == "--mix") { if (!_parse_mix(value, options)) return false; }
+            else if (option == "--files") nfiles = std::stoll(value);
+            else return false;
+        }
+    }
+    catch (const std::exception&) { return false; }
+    return false;
+}
+
+int main(int argc, char* argv[])
+{
+    GenOptions options;
+    std::int64_t nfiles = 0;
+    std::string out_name;
+    if (!_parse_gen_options(argc, argv, options, nfiles, out_name) || nfiles < 0) {
+        std::cerr << "Usage: fitgen [--seed N] [--duration S | --target-bytes N[K|M|G]] [--sample-hz N]" << std::endl
+            << "              [--mix record,lap,hrv,accelerometer,monitoring] [--lap-seconds S] [--dev-fields N]" << std::endl
+            << "              [--compressed-timestamps] [--big-endian] [--files N] <fitfile|out_prefix>" << std::endl
+            << "  --files N writes <out_prefix>_000000.fit ... <out_prefix>_<N-1>.fit, seeding each with seed + file number" << std::endl;
+        return 1;
+    }
+
+    // One file, or nfiles numbered files with consecutive seeds
+    std::uint64_t total_bytes = 0;
+    const std::uint64_t seed = options.seed;
+    try {
+        for (std::int64_t i = 0; i < std::max<std::int64_t>(nfiles, 1); ++i) {
+            std::string fit_fname = out_name;
+            if (nfiles > 0) {
+                std::ostringstream fname;
+                fname << out_name << "_" << std::setw(6) << std::setfill('0') << i << ".fit";
+                fit_fname = fname.str();
+            }
+            std::ofstream fit_fhandle(fit_fname, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!fit_fhandle) throw std::runtime_error("ERROR opening " + fit_fname);
+
+            options.seed = seed + static_cast<std::uint64_t>(i);
+            total_bytes += write_synthetic_fit(options, fit_fhandle);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << std::max<std::int64_t>(nfiles, 1) << " FIT file(s), " << total_bytes << " bytes" << std::endl;
+    return 0;
+}
+#endif // !defined FITGEN_NO_MAIN
@@ -0,0 +1,40 @@
+#if !defined(FITGEN_H)
+#define FITGEN_H
+
+#include <cstdint>
+#include <iosfwd>
+
+#define FITGEN_SEED 1
+#define FITGEN_DURATION_SECONDS 3600 // 1Hz records (one hour)
+#define FITGEN_SAMPLE_HZ 25 // Accelerometer samples per second
+#define FITGEN_LAP_SECONDS 600
+#define FITGEN_MAX_BYTES 4000000000LL // FIT data size is a 32-bit header field
+
+
+// Synthetic FIT activity (see write_synthetic_fit). The mesg mix flags select the
+// mesgs written each second of the activity, after file_id and a timer start event.
+struct GenOptions
+{
+    std::uint64_t seed = FITGEN_SEED;
+    std::int64_t duration_seconds = FITGEN_DURATION_SECONDS;
+    std::int64_t target_bytes = 0; // If > 0, generate until the file reaches it (duration ignored)
+    int sample_hz = FITGEN_SAMPLE_HZ;
+    std::int64_t lap_seconds = FITGEN_LAP_SECONDS;
+
+    bool records = true;
+    bool laps = true; // Every lap_seconds, plus session/activity at the end
+    bool hrv = false; // R-R intervals, 5 beats per mesg
+    bool accelerometer = false; // sample_hz samples, 30 per mesg
+    bool monitoring = false; // One per minute
+
+    int dev_fields = 0; // float32 developer fields per record
+    bool compressed_timestamps = false; // Records after the first use compressed timestamp headers
+    bool big_endian = false; // Big-endian definitions and field values
+};
+
+// Writes a FIT activity to out (seekable: the header is patched last) and returns
+// its size. Output depends only on options: the same seed gives the same bytes on
+// any platform. Throws std::runtime_error on invalid options or a stream error.
+std::uint64_t write_synthetic_fit(const GenOptions& options, std::ostream& out);
+
+#endif // defined(FITGEN_H)
@@ -0,0 +1,273 @@
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <parquet/exception.h>
+
+#include "fitshm.h"
+
+
+// Slot data offset, after the ring header and slot header (64 byte aligned)
+static constexpr std::uint64_t _aligned(std::uint64_t nbytes) { return (nbytes + 63) & ~std::uint64_t(63); }
+static constexpr std::uint64_t RING_HEADER_BYTES = _aligned(sizeof(ShmRingHeader));
+static constexpr std::uint64_t SLOT_HEADER_BYTES = _aligned(sizeof(ShmSlotHeader));
+
+// Waits for ready(): spins SHM_SPIN_LIMIT yields, then polls every SHM_POLL_US up to
+// timeout_ms (-1: forever). Returns whether ready
+template <typename Ready>
+static bool _wait_for(Ready ready, int timeout_ms)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    for (int spins = 0; !ready(); ++spins) {
+        if (spins < SHM_SPIN_LIMIT) std::this_thread::yield();
+        else if (timeout_ms >= 0 && std::chrono::steady_clock::now() >= deadline) return false;
+        else std::this_thread::sleep_for(std::chrono::microseconds(SHM_POLL_US));
+    }
+    return true;
+}
+
+static std::string _errno_message(const std::string& what, const std::string& name)
+{
+    return "ERROR unable to " + what + " shared memory ring " + name + ": " + std::strerror(errno);
+}
+
+// Slot buffer of a batch read: returns the slot to the ring once the batch and
+// every array (slice of this buffer) read from it are gone
+class ShmSlotBuffer : public arrow::Buffer
+{
+public:
+
+    ShmSlotBuffer(const std::uint8_t* data, std::int64_t size, std::shared_ptr<ShmReleaseState> state,
+                  std::uint64_t seq) : arrow::Buffer(data, size), state(std::move(state)), seq(seq) {}
+
+    ~ShmSlotBuffer() override { state->release(seq); }
+
+private:
+
+    std::shared_ptr<ShmReleaseState> state;
+    std::uint64_t seq;
+};
+
+ShmMapping::~ShmMapping()
+{
+    if (addr != nullptr) ::munmap(addr, size);
+}
+
+std::uint8_t* ShmMapping::slot(std::uint64_t seq) const
+{
+    const ShmRingHeader* ring = header();
+    return static_cast<std::uint8_t*>(addr) + RING_HEADER_BYTES + (seq % ring->nslots) * ring->slot_bytes;
+}
+
+void ShmReleaseState::release(std::uint64_t seq)
+{
+    std::lock_guard<std::mutex> lock(release_mutex);
+    released.insert(seq);
+
+    std::uint64_t tail = mapping->header()->tail.load(std::memory_order_relaxed);
+    while (!released.empty() && *released.begin() == tail) {
+        released.erase(released.begin());
+        tail += 1;
+    }
+    mapping->header()->tail.store(tail, std::memory_order_release);
+}
+
+std::string shm_ring_name(const std::string& name)
+{
+    return (!name.empty() && name[0] == '/') ? name : "/" + name;
+}
+
+ShmRingWriter::ShmRingWriter(const std::string& name, std::uint32_t nslots, std::uint64_t slot_bytes) :
+    mapping(std::make_shared<ShmMapping>()), head(0), closed(false)
+{
+    if (nslots == 0 || slot_bytes <= SLOT_HEADER_BYTES)
+        throw std::runtime_error("ERROR invalid shared memory ring size: " + std::to_string(nslots)
+            + " slots of " + std::to_string(slot_bytes) + " bytes");
+    slot_bytes = _aligned(slot_bytes);
+
+    mapping->name = shm_ring_name(name);
+    ::shm_unlink(mapping->name.c_str());
+    int fd = ::shm_open(mapping->name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) throw std::runtime_error(_errno_message("create", mapping->name));
+
+    mapping->size = RING_HEADER_BYTES + nslots * slot_bytes;
+    if (::ftruncate(fd, mapping->size) != 0) {
+        std::string message = _errno_message("size", mapping->name);
+        ::close(fd);
+        ::shm_unlink(mapping->name.c_str());
+        throw std::runtime_error(message);
+    }
+    void* addr = ::mmap(nullptr, mapping->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        std::string message = _errno_message("map", mapping->name);
+        ::shm_unlink(mapping->name.c_str());
+        throw std::runtime_error(message);
+    }
+    mapping->addr = addr;
+
+    // Zero-filled by ftruncate: the counters start at 0, magic is set last (reader attach)
+    ShmRingHeader* ring = mapping->header();
+    ring->version = SHM_RING_VERSION;
+    ring->nslots = nslots;
+    ring->slot_bytes = slot_bytes;
+    std::atomic_thread_fence(std::memory_order_release);
+    ring->magic = SHM_RING_MAGIC;
+}
+
+ShmRingWriter::~ShmRingWriter()
+{
+    if (!closed) close();
+    ::shm_unlink(mapping->name.c_str());
+}
+
+void ShmRingWriter::publish(const arrow::RecordBatch& batch, int timeout_ms)
+{
+    if (closed) throw std::runtime_error("ERROR shared memory ring closed: " + mapping->name);
+    ShmRingHeader* ring = mapping->header();
+
+    // Batches whose body alone exceeds a slot are split without serializing them first
+    std::int64_t body_bytes = 0;
+    PARQUET_THROW_NOT_OK(arrow::ipc::GetRecordBatchSize(batch, &body_bytes));
+    bool fits = static_cast<std::uint64_t>(body_bytes) < ring->slot_bytes - SLOT_HEADER_BYTES;
+
+    if (fits) {
+        if (!_wait_for([&] { return head - ring->tail.load(std::memory_order_acquire) < ring->nslots; }, timeout_ms))
+            throw std::runtime_error("ERROR timed out waiting for the reader of shared memory ring " + mapping->name);
+        fits = _write_slot(batch, mapping->slot(head));
+    }
+    if (fits) {
+        head += 1;
+        ring->head.store(head, std::memory_order_release);
+    }
+    else if (batch.num_rows() > 1) {
+        std::int64_t half = batch.num_rows() / 2;
+        publish(*batch.Slice(0, half), timeout_ms);
+        publish(*batch.Slice(half), timeout_ms);
+    }
+    else throw std::runtime_error("ERROR record batch row larger than a slot of shared memory ring "
+        + mapping->name + " (" + std::to_string(ring->slot_bytes) + " bytes)");
+}
+
+bool ShmRingWriter::_write_slot(const arrow::RecordBatch& batch, std::uint8_t* slot)
+{
+    // Serialized in place: the slot holds a complete IPC stream (schema, batch, end of stream)
+    std::uint64_t capacity = mapping->header()->slot_bytes - SLOT_HEADER_BYTES;
+    auto data = std::make_shared<arrow::MutableBuffer>(slot + SLOT_HEADER_BYTES, capacity);
+    arrow::io::FixedSizeBufferWriter sink(data);
+
+    auto writer = arrow::ipc::MakeStreamWriter(&sink, batch.schema());
+    if (!writer.ok()) throw std::runtime_error("ERROR " + writer.status().ToString());
+    if (!(*writer)->WriteRecordBatch(batch).ok() || !(*writer)->Close().ok()) return false;
+
+    auto nbytes = sink.Tell();
+    if (!nbytes.ok()) return false;
+    reinterpret_cast<ShmSlotHeader*>(slot)->nbytes = *nbytes;
+    return true;
+}
+
+bool ShmRingWriter::close(int drain_ms)
+{
+    ShmRingHeader* ring = mapping->header();
+    if (!closed) {
+        closed = true;
+        ring->closed.store(1, std::memory_order_release);
+    }
+    return _wait_for([&] { return ring->tail.load(std::memory_order_acquire) == head; }, drain_ms);
+}
+
+ShmRingReader::ShmRingReader(const std::string& name, int timeout_ms) :
+    state(std::make_shared<ShmReleaseState>()), next(0), timeout_ms(timeout_ms)
+{
+    std::shared_ptr<ShmMapping> mapping = std::make_shared<ShmMapping>();
+    mapping->name = shm_ring_name(name);
+
+    // The writer may not have created (or sized) the ring yet
+    std::string error;
+    auto attach = [&] {
+        int fd = ::shm_open(mapping->name.c_str(), O_RDWR, 0600);
+        if (fd < 0) {
+            if (errno != ENOENT) error = _errno_message("open", mapping->name);
+            return !error.empty();
+        }
+        struct stat fstatus;
+        if (::fstat(fd, &fstatus) != 0 || static_cast<std::uint64_t>(fstatus.st_size) < RING_HEADER_BYTES) {
+            ::close(fd);
+            return false;
+        }
+        void* addr = ::mmap(nullptr, fstatus.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            error = _errno_message("map", mapping->name);
+            return true;
+        }
+        if (static_cast<ShmRingHeader*>(addr)->magic != SHM_RING_MAGIC) {
+            ::munmap(addr, fstatus.st_size);
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        mapping->addr = addr;
+        mapping->size = fstatus.st_size;
+        return true;
+    };
+    if (!_wait_for(attach, timeout_ms))
+        throw std::runtime_error("ERROR timed out waiting for shared memory ring " + mapping->name);
+    if (!error.empty()) throw std::runtime_error(error);
+
+    ShmRingHeader* ring = mapping->header();
+    if (ring->version != SHM_RING_VERSION || mapping->size < RING_HEADER_BYTES + ring->nslots * ring->slot_bytes)
+        throw std::runtime_error("ERROR incompatible shared memory ring " + mapping->name);
+    state->mapping = mapping;
+
+    // Schema of the first batch's stream (an empty schema if the writer closed without batches)
+    if (!_wait_for([&] { return ring->head.load(std::memory_order_acquire) > 0 || ring->closed.load(std::memory_order_acquire); }, timeout_ms))
+        throw std::runtime_error("ERROR timed out waiting for a batch of shared memory ring " + mapping->name);
+    if (ring->head.load(std::memory_order_acquire) == 0) rschema = arrow::schema({});
+    else {
+        std::uint8_t* slot = mapping->slot(0);
+        auto data = std::make_shared<arrow::Buffer>(slot + SLOT_HEADER_BYTES, reinterpret_cast<ShmSlotHeader*>(slot)->nbytes);
+        auto stream = arrow::ipc::RecordBatchStreamReader::Open(std::make_shared<arrow::io::BufferReader>(data));
+        if (!stream.ok()) throw std::runtime_error("ERROR " + stream.status().ToString());
+        rschema = (*stream)->schema();
+    }
+}
+
+std::shared_ptr<arrow::Schema> ShmRingReader::schema() const
+{
+    return rschema;
+}
+
+arrow::Status ShmRingReader::ReadNext(std::shared_ptr<arrow::RecordBatch>* batch)
+{
+    *batch = nullptr;
+    ShmRingHeader* ring = state->mapping->header();
+
+    // closed is read before head: once closed, head holds the last batch published
+    bool ended = false;
+    auto ready = [&] {
+        bool closed = ring->closed.load(std::memory_order_acquire);
+        if (ring->head.load(std::memory_order_acquire) > next) return true;
+        return ended = closed;
+    };
+    if (!_wait_for(ready, timeout_ms))
+        return arrow::Status::IOError("timed out waiting for a batch of shared memory ring ", state->mapping->name);
+    if (ended) return arrow::Status::OK();
+
+    // The slot buffer leases the slot (ShmSlotBuffer), the batch's arrays slice it
+    std::uint8_t* slot = state->mapping->slot(next);
+    auto data = std::make_shared<ShmSlotBuffer>(slot + SLOT_HEADER_BYTES,
+        reinterpret_cast<ShmSlotHeader*>(slot)->nbytes, state, next);
+    next += 1;
+
+    ARROW_ASSIGN_OR_RAISE(auto stream, arrow::ipc::RecordBatchStreamReader::Open(
+        std::make_shared<arrow::io::BufferReader>(data)));
+    return stream->ReadNext(batch);
+}
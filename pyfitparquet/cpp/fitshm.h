@@ -0,0 +1,128 @@
+#if !defined(FITSHM_H)
+#define FITSHM_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <arrow/api.h>
+
+#define SHM_RING_MAGIC 0x474e495254494623ULL // "#FITRING"
+#define SHM_RING_VERSION 1
+#define SHM_RING_SLOTS 8 // Default slots of a ring (batches in flight)
+#define SHM_SLOT_BYTES 16777216 // Default slot size: largest serialized batch (16MB)
+#define SHM_SPIN_LIMIT 256 // Yields before a waiting side starts sleeping
+#define SHM_POLL_US 50 // Sleep between polls of a waiting side
+#define SHM_DRAIN_MS 30000 // Writer close: wait this long for the reader to release all batches
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared-memory ring needs lock-free 64-bit atomics");
+
+
+// Ring header at the start of the shared memory object, followed by nslots slots of
+// slot_bytes. Counters are shared by the two processes (lock-free atomics, mapped).
+struct ShmRingHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t nslots;
+    std::uint64_t slot_bytes;
+    alignas(64) std::atomic<std::uint64_t> head; // Batches published (writer owned)
+    alignas(64) std::atomic<std::uint64_t> tail; // Batches released (reader owned)
+    alignas(64) std::atomic<std::uint32_t> closed; // Writer done: no batch after head
+};
+
+// Slot: serialized size, then (64 byte aligned) one Arrow IPC stream of the batch
+struct ShmSlotHeader
+{
+    alignas(64) std::uint64_t nbytes;
+};
+
+// Mapping of a ring's shared memory object (unmapped once writer/reader and batches are gone)
+struct ShmMapping
+{
+    std::string name;
+    void* addr = nullptr;
+    size_t size = 0;
+
+    ~ShmMapping();
+    ShmRingHeader* header() const { return static_cast<ShmRingHeader*>(addr); }
+    std::uint8_t* slot(std::uint64_t seq) const;
+};
+
+// Released slots of a ring past its tail (reader side), shared with the slot buffers of
+// the batches read: the tail advances over consecutive released slots
+struct ShmReleaseState
+{
+    std::shared_ptr<ShmMapping> mapping;
+    std::mutex release_mutex;
+    std::set<std::uint64_t> released;
+
+    void release(std::uint64_t seq);
+};
+
+// Hands off record batches to one reader process on the same host through a POSIX
+// shared memory ring (shm_open name, e.g. "/fitring"), as Arrow IPC streams written
+// in place. Single producer, single consumer: publish() waits while all slots hold
+// batches the reader has not released (backpressure on the producer).
+class ShmRingWriter
+{
+public:
+
+    // Creates the ring (a ring left under name by a writer that did not close is replaced)
+    ShmRingWriter(const std::string& name, std::uint32_t nslots = SHM_RING_SLOTS,
+                  std::uint64_t slot_bytes = SHM_SLOT_BYTES);
+
+    // Closes (see close()) and removes the name; a reader still attached reads on
+    ~ShmRingWriter();
+
+    // Publishes batch, sliced in halves as needed to fit a slot. Waits up to timeout_ms
+    // (-1: forever) for a free slot, throws std::runtime_error on timeout
+    void publish(const arrow::RecordBatch& batch, int timeout_ms = -1);
+
+    // Marks the ring closed (the reader ends after the last batch), then waits up to
+    // drain_ms for the reader to release every batch. Returns false if it did not
+    bool close(int drain_ms = SHM_DRAIN_MS);
+
+    std::uint64_t published() const { return head; }
+
+private:
+
+    std::shared_ptr<ShmMapping> mapping;
+    std::uint64_t head;
+    bool closed;
+
+    bool _write_slot(const arrow::RecordBatch& batch, std::uint8_t* slot);
+};
+
+// Reads the batches of a ShmRingWriter, in order and zero-copy: their buffers point
+// into the ring. A slot is reused once every batch and array read from it is gone,
+// so batches may be held (and released out of order) as long as the ring has slots.
+class ShmRingReader : public arrow::RecordBatchReader
+{
+public:
+
+    // Attaches to the ring name, waiting up to timeout_ms (-1: forever) for it to exist and
+    // for its first batch (whose schema is the reader's). timeout_ms also bounds each wait
+    // for a batch. Throws std::runtime_error on error or timeout
+    explicit ShmRingReader(const std::string& name, int timeout_ms = -1);
+
+    std::shared_ptr<arrow::Schema> schema() const override;
+
+    // Next batch; nullptr once the writer closed and every batch was read. Waits up to
+    // timeout_ms for a batch (arrow::Status::IOError on timeout)
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override;
+
+private:
+
+    std::shared_ptr<ShmReleaseState> state;
+    std::shared_ptr<arrow::Schema> rschema;
+    std::uint64_t next;
+    int timeout_ms;
+};
+
+// Normalized shm_open name of a ring ("fitring": "/fitring")
+std::string shm_ring_name(const std::string& name);
+
+#endif // defined(FITSHM_H)
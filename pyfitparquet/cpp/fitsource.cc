@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <arrow/buffer_builder.h>
+#include <arrow/io/api.h>
+#include <arrow/util/compression.h>
+#include <arrow/util/config.h>
+#include <parquet/exception.h>
+
+#include "boost/filesystem.hpp"
+#include "fitsource.h"
+
+#define XXH_INLINE_ALL
+#include <arrow/vendored/xxhash.h>
+
+#define ZIP_EOCD_SIGNATURE 0x06054b50
+#define ZIP_EOCD_SIZE 22
+#define ZIP_EOCD_MAX_COMMENT 65535
+#define ZIP64_LOCATOR_SIGNATURE 0x07064b50
+#define ZIP64_LOCATOR_SIZE 20
+#define ZIP64_EOCD_SIGNATURE 0x06064b50
+#define ZIP64_EOCD_SIZE 56
+#define ZIP_CENTRAL_SIGNATURE 0x02014b50
+#define ZIP_CENTRAL_SIZE 46
+#define ZIP_LOCAL_SIGNATURE 0x04034b50
+#define ZIP_LOCAL_SIZE 30
+#define ZIP64_EXTRA_ID 0x0001
+#define ZIP_FLAG_ENCRYPTED 0x0001
+#define ZIP_METHOD_STORED 0
+#define ZIP_METHOD_DEFLATED 8
+
+
+// Little-endian zip fields
+static std::uint16_t _le16(const std::uint8_t* p) { return p[0] | (p[1] << 8); }
+static std::uint32_t _le32(const std::uint8_t* p) { return _le16(p) | (static_cast<std::uint32_t>(_le16(p + 2)) << 16); }
+static std::uint64_t _le64(const std::uint8_t* p) { return _le32(p) | (static_cast<std::uint64_t>(_le32(p + 4)) << 32); }
+
+static std::shared_ptr<arrow::Buffer> _read_at(arrow::io::RandomAccessFile& file, std::int64_t offset,
+                                               std::int64_t nbytes, const std::string& zip_fname)
+{
+    std::shared_ptr<arrow::Buffer> buffer;
+    PARQUET_ASSIGN_OR_THROW(buffer, file.ReadAt(offset, nbytes));
+    if (buffer->size() != nbytes) throw std::runtime_error("ERROR truncated zip archive: " + zip_fname);
+    return buffer;
+}
+
+static std::shared_ptr<arrow::io::RandomAccessFile> _open_file(const std::string& fname, const std::string& what)
+{
+    auto result = arrow::io::ReadableFile::Open(fname);
+    if (!result.ok()) throw std::runtime_error("ERROR opening " + what + ": " + fname);
+    return *result;
+}
+
+std::string compression_extension(const std::string& fname)
+{
+    std::string ext = boost::filesystem::path(fname).extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+    return (ext == ".gz" || ext == ".zst") ? ext : std::string();
+}
+
+std::string fit_stem(const std::string& fname)
+{
+    boost::filesystem::path pfname(fname);
+    if (!compression_extension(fname).empty()) pfname = pfname.stem();
+    std::string ext = pfname.extension().string();
+    return (ext == ".fit" || ext == ".FIT") ? pfname.stem().string() : std::string();
+}
+
+std::vector<std::pair<ZipMember, std::string>> list_zip_fit_members(const std::string& zip_fname)
+{
+    std::vector<std::pair<ZipMember, std::string>> members;
+    std::unordered_map<std::string, std::string> outputs; // Output path => member name
+    for (const ZipMember& member : list_zip_members(zip_fname)) {
+        std::string stem = fit_stem(member.name);
+        if (stem.empty()) continue;
+
+        boost::filesystem::path poutput;
+        for (const boost::filesystem::path& part : boost::filesystem::path(member.name).parent_path().relative_path())
+            if (part != "." && part != "..") poutput /= part;
+        poutput /= stem;
+
+        auto inserted = outputs.insert({poutput.generic_string(), member.name});
+        if (!inserted.second) throw std::runtime_error("ERROR zip members " + inserted.first->second + 
+            " and " + member.name + " convert to the same output " + poutput.generic_string() + ": " + zip_fname);
+        members.push_back({member, poutput.string()});
+    }
+    return members;
+}
+
+std::uint64_t content_hash(const std::string& fname)
+{
+    std::shared_ptr<arrow::io::RandomAccessFile> file = _open_file(fname, "file");
+    std::unique_ptr<XXH3_state_t, XXH_errorcode (*)(XXH3_state_t*)> state(XXH3_createState(), XXH3_freeState);
+    XXH3_64bits_reset(state.get());
+
+    std::shared_ptr<arrow::Buffer> buffer;
+    do {
+        PARQUET_ASSIGN_OR_THROW(buffer, file->Read(SOURCE_READ_BYTES));
+        XXH3_64bits_update(state.get(), buffer->data(), buffer->size());
+    } while (buffer->size() == SOURCE_READ_BYTES);
+    return XXH3_64bits_digest(state.get());
+}
+
+std::vector<ZipMember> list_zip_members(const std::string& zip_fname)
+{
+    std::shared_ptr<arrow::io::RandomAccessFile> zip = _open_file(zip_fname, "zip archive");
+    std::int64_t zsize;
+    PARQUET_ASSIGN_OR_THROW(zsize, zip->GetSize());
+
+    // End of central directory record: last signature within the maximum comment length
+    std::int64_t tail_offset = std::max<std::int64_t>(zsize - ZIP_EOCD_SIZE - ZIP_EOCD_MAX_COMMENT, 0);
+    std::shared_ptr<arrow::Buffer> tail = _read_at(*zip, tail_offset, zsize - tail_offset, zip_fname);
+    std::int64_t eocd = tail->size() - ZIP_EOCD_SIZE;
+    while (eocd >= 0 && _le32(tail->data() + eocd) != ZIP_EOCD_SIGNATURE) --eocd;
+    if (eocd < 0) throw std::runtime_error("ERROR not a zip archive: " + zip_fname);
+
+    const std::uint8_t* record = tail->data() + eocd;
+    std::uint64_t nentries = _le16(record + 10);
+    std::uint64_t cd_size = _le32(record + 12);
+    std::uint64_t cd_offset = _le32(record + 16);
+
+    // Zip64: counts and offsets saturated here are in the zip64 record, found by its locator
+    if (tail_offset + eocd >= ZIP64_LOCATOR_SIZE) {
+        std::shared_ptr<arrow::Buffer> locator = _read_at(*zip, tail_offset + eocd - ZIP64_LOCATOR_SIZE,
+                                                          ZIP64_LOCATOR_SIZE, zip_fname);
+        if (_le32(locator->data()) == ZIP64_LOCATOR_SIGNATURE) {
+            std::shared_ptr<arrow::Buffer> record64 = _read_at(*zip, _le64(locator->data() + 8), ZIP64_EOCD_SIZE, zip_fname);
+            if (_le32(record64->data()) != ZIP64_EOCD_SIGNATURE)
+                throw std::runtime_error("ERROR corrupt zip64 archive: " + zip_fname);
+            nentries = _le64(record64->data() + 32);
+            cd_size = _le64(record64->data() + 40);
+            cd_offset = _le64(record64->data() + 48);
+        }
+    }
+    if (cd_offset + cd_size > static_cast<std::uint64_t>(zsize))
+        throw std::runtime_error("ERROR corrupt zip archive: " + zip_fname);
+
+    std::shared_ptr<arrow::Buffer> cdir = _read_at(*zip, cd_offset, cd_size, zip_fname);
+    std::vector<ZipMember> members;
+    std::int64_t pos = 0;
+    for (std::uint64_t i = 0; i < nentries; ++i) {
+        const std::uint8_t* entry = cdir->data() + pos;
+        if (pos + ZIP_CENTRAL_SIZE > cdir->size() || _le32(entry) != ZIP_CENTRAL_SIGNATURE)
+            throw std::runtime_error("ERROR corrupt zip central directory: " + zip_fname);
+        std::uint16_t name_len = _le16(entry + 28), extra_len = _le16(entry + 30), comment_len = _le16(entry + 32);
+        if (pos + ZIP_CENTRAL_SIZE + name_len + extra_len + comment_len > cdir->size())
+            throw std::runtime_error("ERROR corrupt zip central directory: " + zip_fname);
+
+        ZipMember member;
+        member.name.assign(reinterpret_cast<const char*>(entry + ZIP_CENTRAL_SIZE), name_len);
+        member.method = _le16(entry + 10);
+        member.compressed_size = _le32(entry + 20);
+        member.size = _le32(entry + 24);
+        member.header_offset = _le32(entry + 42);
+        if (_le16(entry + 8) & ZIP_FLAG_ENCRYPTED) member.method = 0xFFFF; // Unsupported, see FitSource::load
+
+        // Zip64 extra field: 8-byte values, in this order, of the fields saturated above
+        const std::uint8_t* extra = entry + ZIP_CENTRAL_SIZE + name_len;
+        for (std::uint16_t e = 0; e + 4 <= extra_len; e += 4 + _le16(extra + e + 2)) {
+            if (_le16(extra + e) != ZIP64_EXTRA_ID) continue;
+            const std::uint8_t* value = extra + e + 4;
+            const std::uint8_t* value_end = value + _le16(extra + e + 2);
+            if (member.size == 0xFFFFFFFF && value + 8 <= value_end) { member.size = _le64(value); value += 8; }
+            if (member.compressed_size == 0xFFFFFFFF && value + 8 <= value_end) { member.compressed_size = _le64(value); value += 8; }
+            if (member.header_offset == 0xFFFFFFFF && value + 8 <= value_end) member.header_offset = _le64(value);
+        }
+
+        if (member.name.empty() || member.name.back() != '/') members.push_back(member);
+        pos += ZIP_CENTRAL_SIZE + name_len + extra_len + comment_len;
+    }
+    return members;
+}
+
+// Reads a (decompressing) stream to its end, size_hint: expected size if known
+static std::shared_ptr<arrow::Buffer> _read_stream(arrow::io::InputStream& stream, std::int64_t size_hint)
+{
+    arrow::BufferBuilder builder;
+    PARQUET_THROW_NOT_OK(builder.Reserve(std::max<std::int64_t>(size_hint, SOURCE_READ_BYTES)));
+    while (true) {
+        if (builder.capacity() - builder.length() < SOURCE_READ_BYTES)
+            PARQUET_THROW_NOT_OK(builder.Reserve(std::max<std::int64_t>(builder.length(), SOURCE_READ_BYTES)));
+        std::int64_t nread;
+        PARQUET_ASSIGN_OR_THROW(nread, stream.Read(SOURCE_READ_BYTES, builder.mutable_data() + builder.length()));
+        if (nread == 0) break;
+        builder.UnsafeAdvance(nread);
+    }
+    std::shared_ptr<arrow::Buffer> buffer;
+    PARQUET_THROW_NOT_OK(builder.Finish(&buffer));
+    return buffer;
+}
+
+// Wraps stream in a decompressing stream of codec (kept alive in codecs)
+static std::shared_ptr<arrow::io::InputStream> _decompress(const std::shared_ptr<arrow::io::InputStream>& stream,
+    std::unique_ptr<arrow::util::Codec> codec, std::vector<std::unique_ptr<arrow::util::Codec>>& codecs)
+{
+    codecs.push_back(std::move(codec));
+    std::shared_ptr<arrow::io::InputStream> decompressed;
+    PARQUET_ASSIGN_OR_THROW(decompressed, arrow::io::CompressedInputStream::Make(codecs.back().get(), stream));
+    return decompressed;
+}
+
+static std::unique_ptr<arrow::util::Codec> _extension_codec(const std::string& ext)
+{
+    std::unique_ptr<arrow::util::Codec> codec;
+    PARQUET_ASSIGN_OR_THROW(codec, arrow::util::Codec::Create(
+        (ext == ".gz") ? arrow::Compression::GZIP : arrow::Compression::ZSTD));
+    return codec;
+}
+
+
+// Read-only, seekable std::streambuf over a buffer (not copied)
+class BufferStreambuf : public std::streambuf
+{
+public:
+
+    BufferStreambuf(const std::uint8_t* data, std::int64_t size) {
+        char* begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) return pos_type(off_type(-1));
+        char* base = (dir == std::ios_base::beg) ? eback() : (dir == std::ios_base::cur) ? gptr() : egptr();
+        if (off < eback() - base || off > egptr() - base) return pos_type(off_type(-1));
+        setg(eback(), base + off, egptr());
+        return pos_type(gptr() - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+// std::istream over a shared buffer
+class BufferStream : public std::istream
+{
+public:
+
+    explicit BufferStream(const std::shared_ptr<arrow::Buffer>& buffer) :
+        std::istream(nullptr), data(buffer), sbuf(buffer->data(), buffer->size()) { rdbuf(&sbuf); }
+
+private:
+
+    std::shared_ptr<arrow::Buffer> data;
+    BufferStreambuf sbuf;
+};
+
+
+FitSource::FitSource(const std::string& fit_fname) :
+    sname(fit_fname), fname(fit_fname), in_zip(false), ssize(0) { }
+
+FitSource::FitSource(const std::string& zip_fname, const ZipMember& zip_member) :
+    sname(zip_fname + "/" + zip_member.name), fname(zip_fname), member(zip_member), in_zip(true), ssize(0) { }
+
+void FitSource::load()
+{
+    std::string ext = compression_extension(in_zip ? member.name : fname);
+    std::vector<std::unique_ptr<arrow::util::Codec>> codecs;
+    std::shared_ptr<arrow::io::InputStream> stream;
+
+    if (!in_zip) {
+        if (ext.empty()) {
+            // Plain file: read in place
+            std::ifstream fit_fhandle(fname, std::ios::in | std::ios::binary);
+            if (!fit_fhandle.is_open()) throw std::runtime_error("ERROR opening FIT file: " + fname);
+            ssize = boost::filesystem::file_size(fname);
+            return;
+        }
+        stream = _open_file(fname, "FIT file");
+    }
+    else {
+        // Member data follows its local header (whose name/extra lengths may differ from the central one)
+        std::shared_ptr<arrow::io::RandomAccessFile> zip = _open_file(fname, "zip archive");
+        std::shared_ptr<arrow::Buffer> local = _read_at(*zip, member.header_offset, ZIP_LOCAL_SIZE, fname);
+        if (_le32(local->data()) != ZIP_LOCAL_SIGNATURE) throw std::runtime_error("ERROR corrupt zip member: " + sname);
+        std::int64_t data_offset = member.header_offset + ZIP_LOCAL_SIZE + _le16(local->data() + 26) + _le16(local->data() + 28);
+        PARQUET_ASSIGN_OR_THROW(stream, arrow::io::RandomAccessFile::GetStream(zip, data_offset, member.compressed_size));
+
+        if (member.method == ZIP_METHOD_DEFLATED) {
+            #if ARROW_VERSION_MAJOR >= ZIP_DEFLATE_ARROW_VERSION
+            arrow::util::GZipCodecOptions options;
+            options.gzip_format = arrow::util::GZipFormat::DEFLATE;
+            std::unique_ptr<arrow::util::Codec> codec;
+            PARQUET_ASSIGN_OR_THROW(codec, arrow::util::Codec::Create(arrow::Compression::GZIP, options));
+            stream = _decompress(stream, std::move(codec), codecs);
+            #else
+            throw std::runtime_error("ERROR deflated zip members need Arrow >= 12: " + sname);
+            #endif
+        }
+        else if (member.method != ZIP_METHOD_STORED)
+            throw std::runtime_error("ERROR unsupported zip member compression/encryption: " + sname);
+    }
+
+    if (!ext.empty()) stream = _decompress(stream, _extension_codec(ext), codecs);
+    data = _read_stream(*stream, (in_zip && ext.empty()) ? member.size : 0);
+    ssize = data->size();
+}
+
+std::unique_ptr<std::istream> FitSource::open() const
+{
+    if (data != nullptr) return std::unique_ptr<std::istream>(new BufferStream(data));
+
+    std::unique_ptr<std::ifstream> fit_fhandle(new std::ifstream(fname, std::ios::in | std::ios::binary));
+    if (!fit_fhandle->is_open()) throw std::runtime_error("ERROR opening FIT file: " + fname);
+    return fit_fhandle;
+}
+
+std::string FitSource::filename() const
+{
+    return boost::filesystem::path(in_zip ? member.name : fname).filename().string();
+}
+
+std::string FitSource::uri() const
+{
+    std::string canonical = boost::filesystem::canonical(fname).string();
+    return in_zip ? canonical + "/" + member.name : canonical;
+}
@@ -0,0 +1,82 @@
+#if !defined(FITSOURCE_H)
+#define FITSOURCE_H
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <arrow/buffer.h>
+
+#define ZIP_DEFLATE_ARROW_VERSION 12 // First Arrow decompressing raw deflate (GZipCodecOptions)
+#define SOURCE_READ_BYTES 1048576 // Decompression read size
+
+
+// Zip archive member, from its central directory entry
+struct ZipMember
+{
+    std::string name;
+    std::uint16_t method = 0; // 0: stored, 8: deflated
+    std::int64_t compressed_size = 0;
+    std::int64_t size = 0;
+    std::int64_t header_offset = 0; // Local file header
+};
+
+// Members of a zip archive (zip64 included), in central directory order, directories
+// skipped. Throws std::runtime_error if the archive has no readable central directory.
+std::vector<ZipMember> list_zip_members(const std::string& zip_fname);
+
+// A FIT input: a plain file, a gzip (.gz) or zstd (.zst) compressed file, or a member
+// (plain or compressed) of a zip archive. Compressed input is streamed through the
+// Arrow codecs into memory on load(), never to disk: FIT decoding needs to seek
+// (integrity check, row estimate, parallel chunks), which a compressed stream can't.
+class FitSource
+{
+public:
+
+    explicit FitSource(const std::string& fit_fname);
+    FitSource(const std::string& zip_fname, const ZipMember& member);
+
+    // Opens (plain file) or decompresses the source, throws std::runtime_error on error
+    void load();
+
+    // A new stream at the start of the loaded source (one per decoding thread)
+    std::unique_ptr<std::istream> open() const;
+
+    // As given (zip: <archive>/<member>), base name, and canonical uri
+    const std::string& name() const { return sname; }
+    std::string filename() const;
+    std::string uri() const;
+
+    // FIT bytes (decompressed) of the loaded source
+    std::int64_t size() const { return ssize; }
+
+private:
+
+    std::string sname;
+    std::string fname; // Plain or compressed file, or zip archive
+    ZipMember member;
+    bool in_zip;
+
+    std::shared_ptr<arrow::Buffer> data; // Decompressed (null: plain file read in place)
+    std::int64_t ssize;
+};
+
+// Compressed FIT/TCX file extension (.gz, .zst), else empty
+std::string compression_extension(const std::string& fname);
+
+// Stem of a FIT file or zip member name, compressed or not (FIT/14305.fit.gz: 14305), 
+// empty if not a FIT name
+std::string fit_stem(const std::string& fname);
+
+// FIT members of a zip archive, each with its output path relative to the output directory
+// (without extension): the member's directories ("." and ".." dropped) and its fit_stem. 
+// Throws std::runtime_error, before anything converts, if two members share an output path.
+std::vector<std::pair<ZipMember, std::string>> list_zip_fit_members(const std::string& zip_fname);
+
+// XXH3 (64-bit) of a file's bytes as stored (not decompressed), for incremental conversion
+// manifests. Throws std::runtime_error if the file can't be read
+std::uint64_t content_hash(const std::string& fname);
+
+#endif // defined(FITSOURCE_H)
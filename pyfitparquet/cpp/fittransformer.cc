@@ -1,55 +1,209 @@
 #include <math.h> 
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstring>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <unordered_set>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <arrow/api.h>
 #include <arrow/io/api.h>
+#include <arrow/ipc/api.h>
+#include <parquet/arrow/reader.h>
 #include <parquet/arrow/writer.h>
+#include <parquet/bloom_filter.h>
+#include <parquet/file_reader.h>
+#include <parquet/page_index.h>
+#include <arrow/util/byte_size.h>
+#include <arrow/util/config.h>
 
 #include "fit_unicode.hpp"
 #include "fit_mesg_broadcaster.hpp"
+#include "fit_profile.hpp"
 
 #include "fittransformer.h"
+#include "fitenums.h"
 #include "config.h"
 
 #if defined PYBIND11_PRINT_PYSTDOUT
 #include <pybind11/pybind11.h>
 #endif 
 
+#if ARROW_VERSION_MAJOR >= BLOOM_FILTER_ARROW_VERSION
+#include <parquet/bloom_filter_reader.h>
+#endif
+
+// High-rate sensor channels: (column, FIT field, unit factor) per mesg 
+// type. When several fields map to one column, the first present wins.
+struct SensorChannel { const char* column; const char* field; FIT_FLOAT64 factor; };
+static const std::unordered_map<FIT_UINT16, std::vector<SensorChannel>> SENSOR_CHANNELS = {
+    {FIT_MESG_NUM_ACCELEROMETER_DATA, {
+        {"accel_x", "calibrated_accel_x", 1.0}, {"accel_x", "compressed_calibrated_accel_x", 0.001},
+        {"accel_y", "calibrated_accel_y", 1.0}, {"accel_y", "compressed_calibrated_accel_y", 0.001},
+        {"accel_z", "calibrated_accel_z", 1.0}, {"accel_z", "compressed_calibrated_accel_z", 0.001}}},
+    {FIT_MESG_NUM_GYROSCOPE_DATA, {
+        {"gyro_x", "calibrated_gyro_x", 1.0}, {"gyro_y", "calibrated_gyro_y", 1.0},
+        {"gyro_z", "calibrated_gyro_z", 1.0}}},
+    {FIT_MESG_NUM_MAGNETOMETER_DATA, {
+        {"mag_x", "calibrated_mag_x", 1.0}, {"mag_y", "calibrated_mag_y", 1.0},
+        {"mag_z", "calibrated_mag_z", 1.0}}},
+    {FIT_MESG_NUM_BAROMETER_DATA, {{"baro_pres", "baro_pres", 1.0}}},
+    {FIT_MESG_NUM_HRV, {{"rr_interval", "time", 1.0}}}
+};
+
+// Applies FIT scale/offset (value = raw / scale - offset) to a whole sample array.
+// Branch-free so the compiler vectorizes it; invalid (NaN) samples propagate.
+static void _apply_scale_offset(FIT_FLOAT64* vals, size_t n, FIT_FLOAT64 scale,
+                                FIT_FLOAT64 offset, FIT_FLOAT64 factor) 
+{
+    for (size_t k = 0; k < n; ++k) vals[k] = (vals[k] / scale - offset) * factor;
+}
+
 
 FitTransformer::FitTransformer() : 
     time_created(FIT_DATE_TIME_INVALID), manufacturer_index(FIT_MANUFACTURER_INVALID),
     product_index(FIT_UINT16_INVALID), colkeys{"source_filetype", "source_filename", 
     "source_file_uri", "manufacturer_index", "manufacturer_name", "product_index", 
     "product_name", "timestamp", "mesg_index", "mesg_name", "field_index", "field_name", 
-    "field_type", "value_string", "value_integer", "value_float", "units"} { }
+    "field_type", "value_string", "value_integer", "value_float", "value_enum_name", "units"},
+    expand_sensor_arrays(false), last_timestamp(FIT_DATE_TIME_INVALID), 
+    hrv_anchor(FIT_DATE_TIME_INVALID), hrv_clock(0), hrcolkeys{"timestamp",
+    "mesg_name", "accel_x", "accel_y", "accel_z", "gyro_x", "gyro_y", "gyro_z", "mag_x", "mag_y",
+    "mag_z", "baro_pres", "rr_interval"}, timestamp_unit(arrow::TimeUnit::SECOND), timestamp_scale(1),
+    epoch_seconds(0),
+    row_group_bytes(ROW_GROUP_BYTES), last_mesg_num(FIT_MESG_NUM_INVALID), mark_row_groups(false),
+    staged_rows(0), ipc_output(false), ipc_compression(arrow::Compression::UNCOMPRESSED), collect_stats(false), expand_left(STAGE_OTHER), pool_allocations(0), pool_bytes(0) { }
 
 int FitTransformer::fit_to_parquet(const char fit_fname[], const char parquet_fname[]) 
 {
-    int status = 1;
+    std::string error;
+    int status = fit_to_parquet(fit_fname, parquet_fname, error);
 
-    try {
-        // Open FIT file
-        std::fstream fit_fhandle;
-        fit_fhandle.open(fit_fname, std::ios::in | std::ios::binary);
-        if (!fit_fhandle.is_open()) throw std::runtime_error(
-            std::string("ERROR opening FIT file: ") + fit_fname);
-
-        // Validate FIT file
-        fit::Decode fit_decoder;
-        if (!fit_decoder.CheckIntegrity(fit_fhandle)) throw std::runtime_error(
-            std::string("FIT file integrity FAILURE: ") + fit_fname);
-        
-        // Record FIT filename/uri
-        boost::filesystem::path pfit(fit_fname);
-        source_filename = pfit.filename().string();
-        source_file_uri = boost::filesystem::canonical(pfit).string();
+    #if defined PYBIND11_PRINT_PYSTDOUT
+    if (status != 0) pybind11::print(error);
+    #else
+    if (status != 0) std::cerr << error << std::endl;
+    #endif 
+    return status;
+}
 
-        // Finish process initialization
-        fit::MesgBroadcaster msg_broadcaster;
-        msg_broadcaster.AddListener((fit::MesgListener &)*this);
-        _init_from_config(colflags, excludeflags, builders);
+int FitTransformer::fit_to_parquet(const char fit_fname[], const char parquet_fname[], std::string& error) 
+{
+    int status = 1;
 
+    try {
         // Execute FIT-to-parquet serialization 
-        fit_decoder.Read(fit_fhandle, msg_broadcaster);
+        FitSource source(fit_fname);
+        _decode_fit(source, parquet_fname);
         _write_parquet(parquet_fname);
+        if (expand_sensor_arrays) _write_highrate_parquet(parquet_fname);
+        status = 0;
+    }
+    catch (const std::exception& e) { error = e.what(); }
+
+    _reset_state();
+    return status;
+}
+
+int FitTransformer::zip_to_parquet(const char zip_fname[], const char parquet_dir[]) 
+{
+    int status = 1;
+
+    try {
+        std::vector<FitSource> sources;
+        std::vector<std::string> parquet_fnames;
+        for (const auto& member : list_zip_fit_members(zip_fname)) {
+            boost::filesystem::path pparquet = boost::filesystem::path(parquet_dir) / (member.second + output_extension());
+            boost::filesystem::create_directories(pparquet.parent_path());
+            sources.emplace_back(zip_fname, member.first);
+            parquet_fnames.push_back(pparquet.string());
+        }
+        boost::filesystem::create_directories(parquet_dir);
+
+        int nthreads = CONFIG.exists("zip_threads") ? std::stoi(CONFIG["zip_threads"]) : 0;
+        std::vector<bool> converted = convert_sources(sources, parquet_fnames, nthreads);
+        status = (std::count(converted.begin(), converted.end(), false) > 0) ? 1 : 0;
+    }
+    #if defined PYBIND11_PRINT_PYSTDOUT
+    catch (const std::exception& e) { pybind11::gil_scoped_acquire gil; pybind11::print(e.what()); }
+    #else
+    catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+    #endif 
+
+    _reset_state();
+    return status;
+}
+
+std::vector<bool> FitTransformer::convert_sources(const std::vector<FitSource>& sources, 
+                                                  const std::vector<std::string>& parquet_fnames, int nthreads)
+{
+    if (nthreads <= 0) nthreads = std::max<int>(std::thread::hardware_concurrency(), 1);
+    nthreads = std::min<int>(nthreads, sources.size());
+
+    // Threads take the next source in order (sources decode unchunked: the source
+    // is the parallel unit). CONFIG is only read meanwhile.
+    std::vector<char> converted(sources.size(), 0); // (not vector<bool>: set concurrently)
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nthreads; ++t) {
+        threads.emplace_back([&]() {
+            FitTransformer worker;
+            for (size_t i = next++; i < sources.size(); i = next++) {
+                FitSource source = sources[i]; // Loaded (decompressed) for this conversion only
+                const char* parquet_fname = parquet_fnames[i].c_str();
+                try {
+                    worker._decode_fit(source, parquet_fname, false);
+                    worker._write_parquet(parquet_fname);
+                    if (worker.expand_sensor_arrays) worker._write_highrate_parquet(parquet_fname);
+                    converted[i] = 1;
+                }
+                catch (const std::exception& e) {
+                    std::string msg = source.name() + ": " + e.what();
+                    #if defined PYBIND11_PRINT_PYSTDOUT // (called with the GIL released)
+                    pybind11::gil_scoped_acquire gil;
+                    pybind11::print(msg);
+                    #else
+                    std::cerr << msg << std::endl;
+                    #endif
+                }
+                worker._reset_state();
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    return std::vector<bool>(converted.begin(), converted.end());
+}
+
+int FitTransformer::fit_append_parquet(const char fit_fname[], const char parquet_dir[]) 
+{
+    int status = 1;
+
+    try {
+        _append_fit(fit_fname, parquet_dir);
+        status = 0;
+    }
+    #if defined PYBIND11_PRINT_PYSTDOUT
+    catch (const std::exception& e) { pybind11::print(e.what()); }
+    #else
+    catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+    #endif 
+
+    _reset_state();
+    return status;
+}
+
+int FitTransformer::fit_follow(const char fit_fname[], const char out_prefix[], const FollowOptions& options) 
+{
+    int status = 1;
+
+    try {
+        _follow_fit(fit_fname, out_prefix, options);
         status = 0;
     }
     #if defined PYBIND11_PRINT_PYSTDOUT
@@ -62,39 +216,135 @@ int FitTransformer::fit_to_parquet(const char fit_fname[], const char parquet_fn
     return status;
 }
 
+std::shared_ptr<arrow::Table> FitTransformer::fit_to_table(const char fit_fname[]) 
+{
+    std::shared_ptr<arrow::Table> atable_ptr;
+
+    try {
+        FitSource source(fit_fname);
+        _decode_fit(source);
+        row_groups.push_back(_finish_table());
+        PARQUET_ASSIGN_OR_THROW(atable_ptr, arrow::ConcatenateTables(row_groups));
+    }
+    catch (...) { _reset_state(); throw; }
+
+    _reset_state();
+    return atable_ptr;
+}
+
+std::shared_ptr<arrow::RecordBatchReader> FitTransformer::fit_to_reader(const char fit_fname[], 
+                                                                       std::int64_t batch_rows) 
+{
+    return std::make_shared<FitBatchReader>(fit_fname, batch_rows);
+}
+
+int FitTransformer::fit_to_shm(const char fit_fname[], ShmRingWriter& ring, std::int64_t batch_rows)
+{
+    int status = 1;
+
+    try {
+        std::shared_ptr<arrow::RecordBatchReader> reader = fit_to_reader(fit_fname, batch_rows);
+        std::shared_ptr<arrow::RecordBatch> batch;
+        while (true) {
+            PARQUET_THROW_NOT_OK(reader->ReadNext(&batch));
+            if (batch == nullptr) break;
+            ring.publish(*batch);
+        }
+        status = 0;
+    }
+    #if defined PYBIND11_PRINT_PYSTDOUT
+    catch (const std::exception& e) { pybind11::gil_scoped_acquire gil; pybind11::print(e.what()); }
+    #else
+    catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+    #endif 
+
+    return status;
+}
+
+FitBatchReader::FitBatchReader(const char fit_fname[], std::int64_t batch_rows) : 
+    batch_rows(std::max<std::int64_t>(batch_rows, 1)), started(false), finished(false)
+{
+    FitSource source(fit_fname);
+    transformer._open_fit(fit_fhandle, fit_decoder, source);
+    rschema = transformer._get_schema();
+}
+
+arrow::Status FitBatchReader::ReadNext(std::shared_ptr<arrow::RecordBatch>* batch)
+{
+    try {
+        while (batches.empty() && !finished) {
+            finished = started ? fit_decoder.ResumeRead() : fit_decoder.Read(*fit_fhandle, *this);
+            started = true;
+
+            // Staged rows, plus row groups closed on the way (e.g. chained file_id)
+            if (transformer.staged_rows > 0) transformer.row_groups.push_back(transformer._finish_table());
+            for (const std::shared_ptr<arrow::Table>& table : transformer.row_groups) {
+                arrow::TableBatchReader table_reader(*table);
+                std::shared_ptr<arrow::RecordBatch> tbatch;
+                while (true) {
+                    PARQUET_THROW_NOT_OK(table_reader.ReadNext(&tbatch));
+                    if (tbatch == nullptr) break;
+                    if (tbatch->num_rows() > 0) batches.push_back(tbatch);
+                }
+            }
+            transformer.row_groups.clear();
+
+            // Main table only: high-rate samples are not kept
+            for (auto bpair : transformer.hrbuilders) bpair.second->Reset();
+        }
+    }
+    catch (const std::exception& e) {
+        ARROW_UNUSED(Close());
+        return arrow::Status::IOError(e.what());
+    }
+
+    if (batches.empty()) {
+        *batch = nullptr;
+        return Close();
+    }
+    *batch = batches.front();
+    batches.pop_front();
+    return arrow::Status::OK();
+}
+
+arrow::Status FitBatchReader::Close()
+{
+    fit_fhandle.reset();
+    finished = true;
+    batches.clear();
+    transformer._reset_state();
+    return arrow::Status::OK();
+}
+
+void FitBatchReader::OnMesg(fit::Mesg& mesg)
+{
+    transformer.OnMesg(mesg);
+    if (transformer.staged_rows >= batch_rows) fit_decoder.Pause();
+}
+
 void FitTransformer::reset_from_config() {
     CONFIG.reset();
-    colflags.clear(); excludeflags.clear(); builders.clear();
+    colflags.clear(); excludeflags.clear(); builders.clear(); hrbuilders.clear();
     _init_from_config(colflags, excludeflags, builders);
 }
 
 void FitTransformer::OnMesg(fit::Mesg& mesg)
 {
+    StageScope stringify(stage_clock, STAGE_STRINGIFY);
+    stats.mesgs += 1;
+    if (stage_clock.is_enabled()) stats.mesg_counts[mesg.GetNum()] += 1;
+
     switch (mesg.GetNum()) {
         case FIT_MESG_NUM_INVALID:  
             break; // Drops messages of type name: unknown
 
         case FIT_MESG_NUM_FILE_ID:
         {
-            // Downcast from non-virtual base
-            fit::FileIdMesg& fit_mesg = static_cast<fit::FileIdMesg&>(mesg);
-            if (fit_mesg.IsTimeCreatedValid() == FIT_TRUE)
-                time_created = fit_mesg.GetTimeCreated();
+            // File-constant columns hold one value per row group (chained FIT files)
+            if (staged_rows > 0) _emit_row_group(_finish_table());
 
-            if (fit_mesg.IsManufacturerValid() == FIT_TRUE) {
-                manufacturer_index = fit_mesg.GetManufacturer();
-                manufacturer_name = CONFIG.manufacturer_name(manufacturer_index);
-            }
-            if (fit_mesg.IsFaveroProductValid() == FIT_TRUE) {
-                product_index = fit_mesg.GetFaveroProduct();
-                product_name = CONFIG.favero_product_name(product_index);
-            }
-            else if (fit_mesg.IsGarminProductValid() == FIT_TRUE) {
-                product_index = fit_mesg.GetGarminProduct();
-                product_name = CONFIG.garmin_product_name(product_index);
-            }
-            else if (fit_mesg.IsProductValid() == FIT_TRUE) 
-                product_index = fit_mesg.GetProduct();
+            // Downcast from non-virtual base
+            _set_file_id(static_cast<fit::FileIdMesg&>(mesg));
         } // Fall thru to default
 
         default:
@@ -102,25 +352,43 @@ void FitTransformer::OnMesg(fit::Mesg& mesg)
             if (product_index != FIT_UINT16_INVALID &&
                 manufacturer_index != FIT_MANUFACTURER_INVALID)
             {
+                // Sensor arrays go to the high-rate table, one row per sample
+                if (expand_sensor_arrays && _expand_sensor_mesg(mesg)) break;
+                _check_row_group(mesg.GetNum());
+
                 FIT_DATE_TIME timestamp_a = time_created;
+                std::int64_t subsecond_a = 0;
+                bool has_tstamp = false;
                 int nfields = 0;
 
                 // Generate field rows
                 for (int i = 0; i < mesg.GetNumFields(); ++i) {
                     fit::Field* field = mesg.GetFieldByIndex(i);
-                    bool is_tstamp = (field->GetName() == "timestamp");
+                    std::string fname = field->GetName();
+                    fit::Profile::Type etype = colflags["value_enum_name"] ? 
+                        fit_enum_field_type(mesg.GetNum(), field->GetNum()) : fit::Profile::Type::Invalid;
+                    bool is_tstamp = (fname == "timestamp");
+                    bool is_tstamp_ms = (fname == "timestamp_ms");
+                    bool is_tstamp_frac = (fname == "fractional_timestamp");
                     for (FIT_UINT8 j = 0; j < field->GetNumValues(); ++j) {
                         std::string sval = fit::Unicode::Copy_UTF8ToStd(
                         fit::Unicode::Encode_BaseToUTF8(field->GetSTRINGValue(j)));
                         if (excludeflags["exclude_empty_values"] && sval.length() == 0) continue;
                         else if (is_tstamp) {
-                            timestamp_a = field->GetUINT32Value(j);
+                            timestamp_a = last_timestamp = field->GetUINT32Value(j);
+                            has_tstamp = true;
                             if (excludeflags["exclude_timestamp_values"])
                                 continue;
                         }
+                        else if ((is_tstamp_ms || is_tstamp_frac) && field->IsValueValid(j)) {
+                            // Sub-second component, merged into this mesg's timestamp
+                            subsecond_a = is_tstamp_ms ? field->GetUINT16Value(j) * timestamp_scale / 1000 :
+                                std::llround(field->GetFLOAT64Value(j) * timestamp_scale);
+                        }
 
+                        StageScope append(stage_clock, STAGE_APPEND);
                         _append_mesg_fields(mesg);                            
-                        _append_field_fields(*field, sval, j);
+                        _append_field_fields(*field, sval, j, etype);
                         nfields += 1;
                     }
                 }
@@ -132,70 +400,862 @@ void FitTransformer::OnMesg(fit::Mesg& mesg)
                         fit::Unicode::Encode_BaseToUTF8(dev_field.GetSTRINGValue(j)));
                         if (excludeflags["exclude_empty_values"] && sval.length() == 0) continue;
 
-                        _append_mesg_fields(mesg);
-                        _append_field_fields(dev_field, sval, j);
-                        nfields += 1;
-                    }
-                }
+                        StageScope append(stage_clock, STAGE_APPEND);
+                        _append_mesg_fields(mesg);
+                        _append_field_fields(dev_field, sval, j, fit::Profile::Type::Invalid);
+                        nfields += 1;
+                    }
+                }
+
+                if (colflags["timestamp"]) {
+                    // Finalize timestamp on mesg block of rows
+                    StageScope append(stage_clock, STAGE_APPEND);
+                    if (timestamp_a == FIT_DATE_TIME_INVALID)
+                        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::TimestampBuilder>(
+                        builders["timestamp"])->AppendNulls(nfields));
+                    else PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::TimestampBuilder>(
+                        builders["timestamp"])->AppendValues(std::vector<std::int64_t>(nfields, 
+                        _to_timestamp(timestamp_a, timestamp_scale) + (has_tstamp ? subsecond_a : 0))));
+                }
+            }
+            else {
+                stats.dropped_mesgs += 1;
+                #if defined PYBIND11_PRINT_PYSTDOUT // (FitBatchReader consumers may not hold the GIL)
+                pybind11::gil_scoped_acquire gil;
+                pybind11::print("  Manufacturer/Product invalid, dropping:", mesg.GetName());
+                #else
+                std::cerr << "  Manufacturer/Product invalid, dropping: " << mesg.GetName() << std::endl;
+                #endif
+            }
+        }
+    }
+}
+
+void FitTransformer::_set_file_id(const fit::FileIdMesg& fit_mesg)
+{
+    if (fit_mesg.IsTimeCreatedValid() == FIT_TRUE)
+        time_created = fit_mesg.GetTimeCreated();
+
+    if (fit_mesg.IsManufacturerValid() == FIT_TRUE) {
+        manufacturer_index = fit_mesg.GetManufacturer();
+        manufacturer_name = CONFIG.manufacturer_name(manufacturer_index);
+    }
+    if (fit_mesg.IsFaveroProductValid() == FIT_TRUE) {
+        product_index = fit_mesg.GetFaveroProduct();
+        product_name = CONFIG.favero_product_name(product_index);
+    }
+    else if (fit_mesg.IsGarminProductValid() == FIT_TRUE) {
+        product_index = fit_mesg.GetGarminProduct();
+        product_name = CONFIG.garmin_product_name(product_index);
+    }
+    else if (fit_mesg.IsProductValid() == FIT_TRUE) 
+        product_index = fit_mesg.GetProduct();
+}
+
+// Opens (decompressing if compressed) and validates a FIT source, then initializes the transformer for it
+void FitTransformer::_open_fit(std::unique_ptr<std::istream>& fit_fhandle, fit::Decode& fit_decoder, FitSource& source) 
+{
+    _start_stats();
+
+    // Open FIT file
+    stage_clock.enter(STAGE_OPEN);
+    source.load();
+    fit_fhandle = source.open();
+
+    // Validate FIT file
+    stage_clock.enter(STAGE_INTEGRITY);
+    if (!fit_decoder.CheckIntegrity(*fit_fhandle)) throw std::runtime_error(
+        "FIT file integrity FAILURE: " + source.name());
+    stage_clock.enter(STAGE_OTHER);
+    
+    // Record FIT filename/uri
+    source_filename = source.filename();
+    source_file_uri = source.uri();
+    stats.fit_bytes = source.size();
+
+    _init_from_config(colflags, excludeflags, builders);
+    if (stage_clock.is_enabled()) fit_decoder.SetExpansionListener(this);
+}
+
+void FitTransformer::_decode_fit(FitSource& source, const char parquet_fname[], bool chunked) 
+{
+    std::unique_ptr<std::istream> fit_fhandle;
+    fit::Decode fit_decoder;
+    _open_fit(fit_fhandle, fit_decoder, source);
+
+    fit::MesgBroadcaster msg_broadcaster;
+    msg_broadcaster.AddListener((fit::MesgListener &)*this);
+
+    // Pre-size builders from a skip-scan estimate
+    stage_clock.enter(STAGE_OPEN);
+    _estimate_rows(*fit_fhandle);
+    stage_clock.enter(STAGE_OTHER);
+    _reserve_builders();
+
+    // Row groups closed while decoding go to the background writer
+    bool pipeline = CONFIG.exists("pipeline_writer") && CONFIG["pipeline_writer"] == "true";
+    if (parquet_fname != nullptr && pipeline && cluster_keys.empty() && !ipc_output) _start_writer(parquet_fname);
+
+    // Decode into column builders, in parallel chunks if large enough
+    if (!chunked || !_decode_chunks(*fit_fhandle, source)) {
+        StageScope decode(stage_clock, STAGE_DECODE);
+        fit_decoder.Read(*fit_fhandle, msg_broadcaster);
+    }
+}
+
+// Decodes the complete records past the checkpoint (none: file start) in parquet_dir. 
+// Only the first FIT file of a chained file is followed. The checkpoint is replaced 
+// after the part files are written, so an interrupted append is simply redone.
+void FitTransformer::_append_fit(const char fit_fname[], const char parquet_dir[])
+{
+    _start_stats();
+    stage_clock.enter(STAGE_OPEN);
+    std::ifstream fit_fhandle(fit_fname, std::ios::in | std::ios::binary);
+    if (!fit_fhandle.is_open()) throw std::runtime_error(
+        std::string("ERROR opening FIT file: ") + fit_fname);
+    stage_clock.enter(STAGE_OTHER);
+
+    boost::filesystem::path pfit(fit_fname);
+    source_filename = pfit.filename().string();
+    source_file_uri = boost::filesystem::canonical(pfit).string();
+    _init_from_config(colflags, excludeflags, builders);
+
+    // Restore decoder and file_id state
+    boost::filesystem::path pckpt = boost::filesystem::path(parquet_dir) / 
+        (pfit.stem().string() + CHECKPOINT_EXTENSION);
+    fit::Decode fit_decoder;
+    if (stage_clock.is_enabled()) fit_decoder.SetExpansionListener(this);
+    fit::Decode::Checkpoint checkpoint = fit_decoder.GetCheckpoint();
+    if (boost::filesystem::exists(pckpt)) {
+        std::ifstream ckpt_fhandle(pckpt.string(), std::ios::in | std::ios::binary);
+        std::string blob((std::istreambuf_iterator<char>(ckpt_fhandle)), std::istreambuf_iterator<char>());
+        checkpoint = fit_decoder.DeserializeCheckpoint(_load_checkpoint(blob));
+    }
+
+    // Up to the last complete record written so far
+    stage_clock.enter(STAGE_OPEN);
+    fit_fhandle.seekg(0, fit_fhandle.end);
+    FIT_UINT32 fsize = fit_fhandle.tellg();
+    FIT_UINT32 records_end = fit_decoder.FindRecordsEnd(fit_fhandle, checkpoint, fsize);
+    stage_clock.enter(STAGE_OTHER);
+    if (checkpoint.byteOffset != 0 && records_end <= checkpoint.byteOffset) return;
+    stats.fit_bytes = records_end - checkpoint.byteOffset;
+    {
+        StageScope decode(stage_clock, STAGE_DECODE);
+        fit_decoder.Read(fit_fhandle, *this, checkpoint, records_end);
+    }
+
+    // Part files named by start offset: re-running an append overwrites its own part
+    if (staged_rows > 0 || !row_groups.empty()) {
+        char offset[16];
+        std::snprintf(offset, sizeof(offset), "%010u", checkpoint.byteOffset);
+        boost::filesystem::path ppart = boost::filesystem::path(parquet_dir) / 
+            (pfit.stem().string() + "_" + offset + output_extension());
+        _write_parquet(ppart.string().c_str());
+        if (expand_sensor_arrays) _write_highrate_parquet(ppart.string().c_str());
+    }
+
+    // Atomic replace: a reader never sees a partial checkpoint
+    boost::filesystem::path ptmp = pckpt.string() + ".tmp";
+    {
+        std::ofstream ckpt_fhandle(ptmp.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+        std::string blob = _save_checkpoint(fit_decoder.GetCheckpoint());
+        if (!ckpt_fhandle.write(blob.data(), blob.size())) throw std::runtime_error(
+            std::string("ERROR writing checkpoint: ") + ptmp.string());
+    }
+    boost::filesystem::rename(ptmp, pckpt);
+}
+
+// Checkpoint file: transformer file_id state, then the FIT decoder checkpoint
+static const std::string CHECKPOINT_MAGIC = "FITPQCK2";
+
+static void _put_uint(std::string& blob, std::uint32_t value, int nbytes) 
+{
+    for (int i = 0; i < nbytes; ++i) blob.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+static std::uint32_t _get_uint(const std::string& blob, size_t& offset, int nbytes) 
+{
+    if (offset + nbytes > blob.size()) throw std::runtime_error("ERROR truncated checkpoint");
+    std::uint32_t value = 0;
+    for (int i = 0; i < nbytes; ++i) value |= static_cast<std::uint32_t>(static_cast<FIT_UINT8>(blob[offset++])) << (8 * i);
+    return value;
+}
+
+static std::string _get_string(const std::string& blob, size_t& offset) 
+{
+    std::uint32_t length = _get_uint(blob, offset, 4);
+    if (offset + length > blob.size()) throw std::runtime_error("ERROR truncated checkpoint");
+    offset += length;
+    return blob.substr(offset - length, length);
+}
+
+std::string FitTransformer::_save_checkpoint(const fit::Decode::Checkpoint& checkpoint)
+{
+    std::string blob = CHECKPOINT_MAGIC;
+    _put_uint(blob, time_created, 4);
+    _put_uint(blob, manufacturer_index, 2);
+    _put_uint(blob, product_index, 2);
+    _put_uint(blob, last_timestamp, 4);
+    _put_uint(blob, hrv_anchor, 4);
+    _put_uint(blob, static_cast<std::uint64_t>(hrv_clock) & 0xFFFFFFFF, 4);
+    _put_uint(blob, static_cast<std::uint64_t>(hrv_clock) >> 32, 4);
+    for (const std::string* name : {&manufacturer_name, &product_name}) {
+        _put_uint(blob, name->length(), 4);
+        blob += *name;
+    }
+    return blob + fit::Decode::SerializeCheckpoint(checkpoint);
+}
+
+// Restores file_id state, returns the FIT decoder checkpoint blob
+std::string FitTransformer::_load_checkpoint(const std::string& blob)
+{
+    if (blob.compare(0, CHECKPOINT_MAGIC.length(), CHECKPOINT_MAGIC) != 0) 
+        throw std::runtime_error("ERROR not a pyfitparquet checkpoint");
+
+    size_t offset = CHECKPOINT_MAGIC.length();
+    time_created = _get_uint(blob, offset, 4);
+    manufacturer_index = _get_uint(blob, offset, 2);
+    product_index = _get_uint(blob, offset, 2);
+    last_timestamp = _get_uint(blob, offset, 4);
+    hrv_anchor = _get_uint(blob, offset, 4);
+    std::uint64_t hrv_low = _get_uint(blob, offset, 4);
+    hrv_clock = static_cast<std::int64_t>(hrv_low | (static_cast<std::uint64_t>(_get_uint(blob, offset, 4)) << 32));
+    manufacturer_name = _get_string(blob, offset);
+    product_name = _get_string(blob, offset);
+    return blob.substr(offset);
+}
+
+// Set by SIGINT/SIGTERM: tail mode flushes and returns
+static volatile std::sig_atomic_t follow_interrupted = 0;
+static void _on_follow_signal(int) { follow_interrupted = 1; }
+
+// Tail mode input descriptor and signal handlers, released on any exit
+struct FollowSource
+{
+    int fd;
+    void (*prev_sigint)(int);
+    void (*prev_sigterm)(int);
+
+    explicit FollowSource(int source_fd) : fd(source_fd) {
+        follow_interrupted = 0;
+        prev_sigint = std::signal(SIGINT, _on_follow_signal);
+        prev_sigterm = std::signal(SIGTERM, _on_follow_signal);
+    }
+    ~FollowSource() {
+        if (fd != STDIN_FILENO) ::close(fd);
+        std::signal(SIGINT, prev_sigint);
+        std::signal(SIGTERM, prev_sigterm);
+    }
+};
+
+// Feeds bytes as they arrive to an IncompleteStream decoder (resumed per read) and flushes 
+// staged rows every flush_ms / flush_rows. Only the first FIT file of a chained stream is 
+// decoded. With an unset header data size (still recording) records run to the end of 
+// stream, and its last 2 bytes (the file CRC) are held back.
+void FitTransformer::_follow_fit(const char fit_fname[], const char out_prefix[], const FollowOptions& options)
+{
+    _start_stats();
+    bool from_stdin = (std::string(fit_fname) == "-");
+    int fd = from_stdin ? STDIN_FILENO : ::open(fit_fname, O_RDONLY);
+    if (fd < 0) throw std::runtime_error(std::string("ERROR opening FIT file: ") + fit_fname);
+    FollowSource source(fd);
+
+    // Regular files are re-read at EOF, pipes/FIFOs end when the writer closes
+    struct stat fstatus;
+    if (::fstat(fd, &fstatus) != 0) throw std::runtime_error(std::string("ERROR reading FIT file: ") + fit_fname);
+    bool regular = S_ISREG(fstatus.st_mode);
+
+    boost::filesystem::path pfit(from_stdin ? "stdin" : fit_fname);
+    source_filename = pfit.filename().string();
+    source_file_uri = from_stdin ? "-" : boost::filesystem::canonical(pfit).string();
+    _init_from_config(colflags, excludeflags, builders);
+
+    fit::Decode fit_decoder;
+    fit_decoder.IncompleteStream();
+    if (stage_clock.is_enabled()) fit_decoder.SetExpansionListener(this);
+    std::stringstream fed(std::ios::in | std::ios::out | std::ios::binary);
+    std::string received;  // Bytes not yet fed (the header until complete)
+    std::int64_t nfed = 0, fit_bytes = -1;
+    bool started = false, closed = false;
+    int nbatch = 0;
+
+    std::vector<char> block(65536);
+    auto last_flush = std::chrono::steady_clock::now();
+    auto last_data = last_flush;
+    while (!follow_interrupted) {
+        // Wait for bytes at most until the flush deadline
+        std::int64_t since_flush = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - last_flush).count();
+        int timeout_ms = static_cast<int>(std::max<std::int64_t>(options.flush_ms - since_flush, 0));
+        ssize_t nread = 0;
+        if (regular) {
+            nread = ::read(fd, block.data(), block.size());
+            if (nread == 0) std::this_thread::sleep_for(std::chrono::milliseconds(std::min(timeout_ms, FOLLOW_POLL_MS)));
+        }
+        else {
+            struct pollfd pfd = {fd, POLLIN, 0};
+            int ready = ::poll(&pfd, 1, timeout_ms);
+            if (ready > 0) {
+                nread = ::read(fd, block.data(), block.size());
+                closed = (nread == 0);
+            }
+            else if (ready < 0 && errno != EINTR) throw std::runtime_error(std::string("ERROR polling FIT file: ") + fit_fname);
+        }
+        if (nread < 0 && errno != EINTR) throw std::runtime_error(std::string("ERROR reading FIT file: ") + fit_fname);
+
+        auto now = std::chrono::steady_clock::now();
+        if (nread > 0) {
+            received.append(block.data(), nread);
+            last_data = now;
+        }
+
+        // Header: records end at its data size, else at the end of stream
+        if (!started && received.size() >= FIT_HEADER_SIZE_NO_CRC) {
+            const FIT_UINT8* fhdr = reinterpret_cast<const FIT_UINT8*>(received.data());
+            FIT_UINT32 data_size = fhdr[4] | (fhdr[5] << 8) | (fhdr[6] << 16) | (static_cast<FIT_UINT32>(fhdr[7]) << 24);
+            if (data_size == 0) fit_decoder.setInvalidDataSize(FIT_TRUE);
+            else fit_bytes = fhdr[0] + static_cast<std::int64_t>(data_size) + 2;
+        }
+
+        // Decode what has arrived (the decoder keeps partial records)
+        std::int64_t nfeed = (fit_bytes < 0) ? received.size() - std::min<size_t>(received.size(), 2) :
+            std::min<std::int64_t>(received.size(), fit_bytes - nfed);
+        if (nfeed > 0 && received.size() >= FIT_HEADER_SIZE_NO_CRC) {
+            fed.str(received.substr(0, nfeed));
+            fed.clear();
+            {
+                StageScope decode(stage_clock, STAGE_DECODE);
+                if (!started) fit_decoder.Read(fed, *this);
+                else fit_decoder.Resume();
+            }
+            started = true;
+            received.erase(0, nfeed);
+            nfed += nfeed;
+            stats.fit_bytes = nfed;
+        }
+
+        bool done = closed || (fit_bytes >= 0 && nfed >= fit_bytes) || (regular && 
+            std::chrono::duration_cast<std::chrono::seconds>(now - last_data).count() >= options.idle_seconds);
+        since_flush = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_flush).count();
+        if (done || since_flush >= options.flush_ms || staged_rows >= options.flush_rows) {
+            std::string batch_fname = _flush_batch(out_prefix, nbatch, options.arrow_ipc);
+            if (!batch_fname.empty()) {
+                nbatch += 1;
+                #if !defined PYBIND11_PRINT_PYSTDOUT
+                std::cout << "Flushed " << batch_fname << std::endl;
+                #endif
+            }
+            last_flush = now;
+        }
+        if (done) return;
+    }
+    _flush_batch(out_prefix, nbatch, options.arrow_ipc);
+}
+
+// Writes staged rows (and high-rate rows) as batch files <out_prefix>_<nbatch>, returning the 
+// first file name ("" if nothing staged). Written under a '.' prefix, then renamed: readers
+// (and Arrow datasets, which skip '.' files) never see a partial batch.
+std::string FitTransformer::_flush_batch(const std::string& out_prefix, int nbatch, bool arrow_ipc)
+{
+    if (staged_rows > 0) row_groups.push_back(_finish_table());
+    std::shared_ptr<arrow::Table> hrtable = expand_sensor_arrays ? _finish_highrate_table() : nullptr;
+    if (row_groups.empty() && hrtable == nullptr) return "";
+
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), "_%06d", nbatch);
+    boost::filesystem::path pout(out_prefix + suffix + (arrow_ipc ? ".arrow" : ".parquet"));
+    std::string stem = pout.stem().string(), ext = pout.extension().string();
+
+    std::vector<std::pair<std::vector<std::shared_ptr<arrow::Table>>, std::string>> outputs;
+    if (!row_groups.empty()) outputs.push_back({row_groups, stem});
+    if (hrtable != nullptr) outputs.push_back({{hrtable}, stem + "_highrate"});
+    for (auto& output : outputs) {
+        boost::filesystem::path ptmp = pout.parent_path() / ("." + output.second + ext);
+        if (arrow_ipc) _write_ipc(output.first, ptmp.string());
+        else _write_table(output.first, ptmp.string());
+
+        // Bloom sidecar (older Arrow) is renamed with its file
+        for (std::string sidecar : {"", "_bloom"}) {
+            boost::filesystem::path psrc = pout.parent_path() / ("." + output.second + sidecar + ext);
+            if (boost::filesystem::exists(psrc)) 
+                boost::filesystem::rename(psrc, pout.parent_path() / (output.second + sidecar + ext));
+        }
+    }
+    row_groups.clear();
+    return (pout.parent_path() / (outputs.front().second + ext)).string();
+}
+
+struct FileIdScan : public fit::MesgListener
+{
+    fit::Decode& decoder;
+    std::vector<std::pair<FIT_UINT32, fit::FileIdMesg>> file_ids;
+
+    explicit FileIdScan(fit::Decode& scan_decoder) : decoder(scan_decoder) { }
+    void OnMesg(fit::Mesg& mesg) override {
+        if (mesg.GetNum() == FIT_MESG_NUM_FILE_ID) 
+            file_ids.push_back({decoder.GetByteOffset(), fit::FileIdMesg(mesg)});
+    }
+};
+
+// Splits the records at pre-scanned checkpoints: chunk 0 is decoded here, the 
+// others by worker transformers (seeded with the file_id) on their own threads.
+// Row groups come out as a sequential decode's would. Returns false (nothing decoded) when 
+// the file is too small, chained, or needs state the checkpoints don't carry.
+bool FitTransformer::_decode_chunks(std::istream& fit_fhandle, const FitSource& source)
+{
+    int nthreads = CONFIG.exists("decode_threads") ? std::stoi(CONFIG["decode_threads"]) : 1;
+    if (nthreads <= 0) nthreads = std::max<int>(std::thread::hardware_concurrency(), 1);
+    std::int64_t chunk_bytes = CONFIG.exists("decode_chunk_bytes") ? 
+        std::stoll(CONFIG["decode_chunk_bytes"]) : DECODE_CHUNK_BYTES;
+
+    // High-rate rows carry timestamps across mesgs
+    if (nthreads < 2 || expand_sensor_arrays) return false;
+
+    fit_fhandle.clear();
+    fit_fhandle.seekg(0, fit_fhandle.end);
+    std::int64_t fsize = fit_fhandle.tellg();
+    if (fsize < 2 * chunk_bytes) return false;
+
+    // Record boundaries about fsize/nthreads apart
+    fit::Decode scan_decoder;
+    FileIdScan file_id_scan(scan_decoder);
+    std::vector<fit::Decode::Checkpoint> checkpoints;
+    try { checkpoints = scan_decoder.Scan(fit_fhandle, std::max(chunk_bytes, fsize / nthreads), &file_id_scan); }
+    catch (const fit::RuntimeException&) { fit_fhandle.clear(); return false; } // Sequential decode reports it
+    fit_fhandle.clear();
+
+    size_t nchunks = checkpoints.size() - 1;
+    if (nchunks < 2 || checkpoints.back().byteOffset + 2 != fsize) return false;
+    if (file_id_scan.file_ids.size() != 1 || file_id_scan.file_ids[0].first >= checkpoints[1].byteOffset) return false;
+
+    // Workers set up here, on the calling thread (CONFIG is read-only while converting:
+    // only the daemon re-parses it, under its reload lock)
+    std::vector<std::unique_ptr<FitTransformer>> workers;
+    for (size_t k = 1; k < nchunks; ++k) {
+        workers.emplace_back(new FitTransformer());
+        FitTransformer& worker = *workers.back();
+        worker._init_from_config(worker.colflags, worker.excludeflags, worker.builders);
+        worker.source_filename = source_filename;
+        worker.source_file_uri = source_file_uri;
+        worker._set_file_id(file_id_scan.file_ids[0].second);
+        worker.mark_row_groups = true;
+        worker.stage_clock.reset(stage_clock.is_enabled());
+
+        double fraction = static_cast<double>(checkpoints[k + 1].byteOffset - checkpoints[k].byteOffset) / fsize;
+        worker.stats.estimated_rows = stats.estimated_rows * fraction;
+        worker.stats.estimated_string_bytes = stats.estimated_string_bytes * fraction;
+        for (auto npair : estimated_nbytes) worker.estimated_nbytes[npair.first] = npair.second * fraction;
+        worker._reserve_builders();
+    }
+
+    std::vector<std::exception_ptr> errors(nchunks);
+    std::vector<std::thread> threads;
+    for (size_t k = 1; k < nchunks; ++k) {
+        threads.emplace_back([&, k]() {
+            try {
+                std::unique_ptr<std::istream> chunk_fhandle = source.open();
+                fit::Decode chunk_decoder;
+                FitTransformer& worker = *workers[k - 1];
+                if (worker.stage_clock.is_enabled()) chunk_decoder.SetExpansionListener(&worker);
+                worker.stage_clock.enter(STAGE_DECODE);
+                chunk_decoder.Read(*chunk_fhandle, worker, checkpoints[k], checkpoints[k + 1].byteOffset);
+                worker.stage_clock.enter(STAGE_OTHER);
+                worker.row_groups.push_back(worker._finish_table());
+            }
+            catch (...) { errors[k] = std::current_exception(); }
+        });
+    }
+
+    try {
+        fit::Decode chunk_decoder;
+        if (stage_clock.is_enabled()) chunk_decoder.SetExpansionListener(this);
+        StageScope decode(stage_clock, STAGE_DECODE);
+        chunk_decoder.Read(fit_fhandle, *this, checkpoints[0], checkpoints[1].byteOffset);
+    }
+    catch (...) { errors[0] = std::current_exception(); }
+    for (std::thread& thread : threads) thread.join();
+    for (const std::exception_ptr& error : errors) if (error != nullptr) std::rethrow_exception(error);
+
+    // Row groups cut in chunk order as a sequential decode cuts them (see _check_row_group):
+    // rows of a group straddling chunks are staged back into the builders, the others
+    // are slices of the worker's table. The last chunk's remaining rows stay staged.
+    for (const std::unique_ptr<FitTransformer>& worker : workers) {
+        stats.rows += worker->stats.rows;
+        stats.string_bytes += worker->stats.string_bytes;
+        worker->_collect_stats();
+        stats.add_collected(worker->stats);
+
+        const std::shared_ptr<arrow::Table>& table = worker->row_groups.front();
+        std::int64_t group_start = 0, group_start_nbytes = 0;
+        for (const RowGroupMark& mark : worker->row_group_marks) {
+            bool mesg_boundary = (mark.mesg_num != last_mesg_num);
+            last_mesg_num = mark.mesg_num;
+
+            std::int64_t nbytes = _builders_byte_size() + mark.nbytes - group_start_nbytes;
+            if (nbytes >= 2 * row_group_bytes || (mesg_boundary && nbytes >= row_group_bytes)) {
+                if (staged_rows == 0) _emit_row_group(table->Slice(group_start, mark.rows - group_start));
+                else {
+                    _stage_rows(table, group_start, mark.rows - group_start);
+                    _emit_row_group(_finish_table());
+                    _reserve_builders();
+                }
+                group_start = mark.rows;
+                group_start_nbytes = mark.nbytes;
+            }
+        }
+        _stage_rows(table, group_start, table->num_rows() - group_start);
+    }
+    return true;
+}
+
+// Fields a decoded value of pfield expands into (one value each): its components, or
+// those of its largest subfield, and the components of these in turn (see Decode::ExpandComponents)
+static void _expanded_fields(FIT_UINT16 mesg_num, const fit::Profile::FIELD& pfield,
+                             std::vector<const fit::Profile::FIELD*>& expanded, int depth = 0)
+{
+    const fit::Profile::FIELD_COMPONENT* components = pfield.components;
+    FIT_UINT16 ncomponents = pfield.numComponents;
+    for (FIT_UINT16 s = 0; s < pfield.numSubFields; ++s) {
+        if (pfield.subFields[s].numComponents > ncomponents) {
+            components = pfield.subFields[s].components;
+            ncomponents = pfield.subFields[s].numComponents;
+        }
+    }
+
+    for (FIT_UINT16 c = 0; c < ncomponents; ++c) {
+        const fit::Profile::FIELD* target = fit::Profile::GetField(mesg_num, components[c].num);
+        if (target == nullptr) continue;
+        expanded.push_back(target);
+        if (depth < 2 && target != &pfield) _expanded_fields(mesg_num, *target, expanded, depth + 1);
+    }
+}
+
+// Skip-scans record headers and definitions (data records are skipped, not decoded)
+// to estimate main table rows (one per field value, component expansions included) 
+// and string column bytes
+void FitTransformer::_estimate_rows(std::istream& fit_fhandle)
+{
+    // Per local mesg type: rows and string bytes per column, per data record
+    struct LocalEstimate { std::int64_t rows; std::unordered_map<std::string, std::int64_t> nbytes; };
+    std::vector<LocalEstimate> locals(FIT_MAX_LOCAL_MESGS, LocalEstimate{0, {}});
+    estimated_nbytes.clear();
+
+    FIT_UINT8 fhdr[FIT_FILE_HDR_SIZE];
+    fit_fhandle.clear();
+    std::streamoff file_start = 0;
+
+    // Chained FIT files: header, records and CRC of each file follow the previous file's
+    while (true) {
+        fit_fhandle.seekg(file_start, fit_fhandle.beg);
+        if (!fit_fhandle.read(reinterpret_cast<char*>(fhdr), 12)) break;
+        if (file_start > 0 && std::memcmp(fhdr + 8, ".FIT", 4) != 0) break;
+        FIT_UINT32 data_size = fhdr[4] | (fhdr[5] << 8) | (fhdr[6] << 16) | (static_cast<FIT_UINT32>(fhdr[7]) << 24);
+        fit_fhandle.seekg(file_start + fhdr[0], fit_fhandle.beg);
+
+        std::istream::pos_type data_end = fit_fhandle.tellg() + static_cast<std::streamoff>(data_size);
+        while (fit_fhandle && fit_fhandle.tellg() < data_end) {
+            int rhdr = fit_fhandle.get();
+            if (rhdr == EOF) break;
+
+            FIT_UINT8 local = (rhdr & FIT_HDR_TIME_REC_BIT) ? 
+                (rhdr & FIT_HDR_TIME_TYPE_MASK) >> FIT_HDR_TIME_TYPE_SHIFT : rhdr & FIT_HDR_TYPE_MASK;
+
+            // Data record: accumulate its local type estimate, skip the payload
+            if ((rhdr & FIT_HDR_TIME_REC_BIT) || !(rhdr & FIT_HDR_TYPE_DEF_BIT)) {
+                LocalEstimate& lest = locals[local];
+                stats.estimated_rows += lest.rows;
+                for (auto npair : lest.nbytes) estimated_nbytes[npair.first] += npair.second;
+                fit_fhandle.seekg(lest.nbytes["record"], fit_fhandle.cur);
+                continue;
+            }
+
+            // Definition record: reserved, architecture, global mesg num, field defs
+            FIT_UINT8 dhdr[5];
+            if (!fit_fhandle.read(reinterpret_cast<char*>(dhdr), 5)) break;
+            FIT_UINT16 mesg_num = (dhdr[1] == FIT_ARCH_ENDIAN_BIG) ? (dhdr[2] << 8) | dhdr[3] : dhdr[2] | (dhdr[3] << 8);
+            const fit::Profile::MESG* pmesg = fit::Profile::GetMesg(mesg_num);
+            std::int64_t mesg_name_len = (pmesg == nullptr) ? 7 : pmesg->name.length();
+
+            LocalEstimate lest{0, {}};
+            FIT_UINT8 ndefs[2] = {dhdr[4], 0};
+            for (int dev = 0; dev < 2; ++dev) {
+                for (FIT_UINT8 i = 0; i < ndefs[dev]; ++i) {
+                    FIT_UINT8 fdef[FIT_FIELD_DEF_SIZE];
+                    if (!fit_fhandle.read(reinterpret_cast<char*>(fdef), FIT_FIELD_DEF_SIZE)) break;
+                    lest.nbytes["record"] += fdef[1];
+
+                    // Dev fields: one value of unknown name/units
+                    std::int64_t nvalues = 1, vbytes = ESTIMATED_VALUE_CHARS;
+                    std::int64_t name_len = ESTIMATED_VALUE_CHARS, units_len = 0;
+                    if (dev == 0) {
+                        FIT_UINT8 btype = fdef[2] & FIT_BASE_TYPE_NUM_MASK;
+                        FIT_UINT8 bsize = (btype < FIT_BASE_TYPES) ? fit::baseTypeSizes[btype] : 1;
+                        if (btype == (FIT_BASE_TYPE_STRING & FIT_BASE_TYPE_NUM_MASK)) vbytes = fdef[1];
+                        else { nvalues = std::max(fdef[1] / bsize, 1); vbytes = nvalues * ESTIMATED_VALUE_CHARS; }
+
+                        const fit::Profile::FIELD* pfield = fit::Profile::GetField(mesg_num, fdef[0]);
+                        name_len = (pfield == nullptr) ? 7 : pfield->name.length();
+                        units_len = (pfield == nullptr) ? 0 : pfield->units.length();
+                        if (fit_enum_field_type(mesg_num, fdef[0]) != fit::Profile::Type::Invalid)
+                            lest.nbytes["value_enum_name"] += nvalues * ESTIMATED_VALUE_CHARS;
+
+                        // Component expansion (e.g. speed => enhanced_speed) adds undefined values
+                        std::vector<const fit::Profile::FIELD*> expanded;
+                        if (pfield != nullptr) _expanded_fields(mesg_num, *pfield, expanded);
+                        for (const fit::Profile::FIELD* efield : expanded) {
+                            lest.rows += 1;
+                            lest.nbytes["mesg_name"] += mesg_name_len;
+                            lest.nbytes["field_name"] += efield->name.length();
+                            lest.nbytes["field_type"] += ESTIMATED_VALUE_CHARS;
+                            lest.nbytes["value_string"] += ESTIMATED_VALUE_CHARS;
+                            lest.nbytes["units"] += efield->units.length();
+                        }
+                    }
+
+                    lest.rows += nvalues;
+                    lest.nbytes["mesg_name"] += nvalues * mesg_name_len;
+                    lest.nbytes["field_name"] += nvalues * name_len;
+                    lest.nbytes["field_type"] += nvalues * ESTIMATED_VALUE_CHARS;
+                    lest.nbytes["value_string"] += vbytes;
+                    lest.nbytes["units"] += nvalues * units_len;
+                }
+                if (dev == 0 && (rhdr & FIT_HDR_DEV_FIELD_BIT)) ndefs[1] = fit_fhandle.get();
+            }
+            locals[local] = lest;
+        }
+        file_start = static_cast<std::streamoff>(data_end) + 2;
+        locals.assign(FIT_MAX_LOCAL_MESGS, LocalEstimate{0, {}});
+    }
+    fit_fhandle.clear();
+    estimated_nbytes.erase("record");
+
+    for (auto npair : estimated_nbytes) 
+        if (colflags[npair.first]) stats.estimated_string_bytes += npair.second;
+}
+
+// Reserves builder capacity for the estimated rows not yet staged, 
+// at most one row group (by byte budget) at a time
+void FitTransformer::_reserve_builders()
+{
+    std::int64_t nrows = stats.estimated_rows - stats.rows;
+    if (nrows <= 0) return;
+
+    std::int64_t nbytes = stats.estimated_string_bytes;
+    for (auto bpair : builders) 
+        if (bpair.second->type()->id() != arrow::Type::STRING) 
+            nbytes += stats.estimated_rows * arrow::bit_width(bpair.second->type()->id()) / 8;
+    nrows = std::min(nrows, std::max<std::int64_t>(row_group_bytes * stats.estimated_rows / std::max<std::int64_t>(nbytes, 1), 1));
+
+    for (auto bpair : builders) {
+        PARQUET_THROW_NOT_OK(bpair.second->Reserve(nrows));
+        auto npair = estimated_nbytes.find(bpair.first);
+        if (npair != estimated_nbytes.end() && bpair.second->type()->id() == arrow::Type::STRING)
+            PARQUET_THROW_NOT_OK(static_cast<arrow::StringBuilder&>(*bpair.second).ReserveData(std::min<std::int64_t>(
+                npair->second * nrows / stats.estimated_rows, std::numeric_limits<std::int32_t>::max() / 2)));
+    }
+}
+
+// Resets stats for a new file; stage clocks run if collect_stats (read from CONFIG, which
+// is read-only while converting and re-parsed only under the daemon's reload lock)
+void FitTransformer::_start_stats()
+{
+    stats = TransformStats();
+    stage_clock.reset(collect_stats || (CONFIG.exists("collect_stats") && CONFIG["collect_stats"] == "true"));
+    writer_clock.reset(stage_clock.is_enabled());
+
+    #if ARROW_VERSION_MAJOR >= POOL_STATS_ARROW_VERSION
+    pool_allocations = arrow::default_memory_pool()->num_allocations();
+    pool_bytes = arrow::default_memory_pool()->total_bytes_allocated();
+    #endif
+}
+
+// Folds stage clocks (after the writer thread joined) and pool counters into stats
+void FitTransformer::_collect_stats()
+{
+    if (!stage_clock.is_enabled()) return;
+
+    // Writer thread time outside encode/write is idle (waiting on the queue)
+    stage_clock.enter(STAGE_OTHER);
+    for (int k = 0; k < NUM_STAGES; ++k) stats.stage_seconds[k] += stage_clock.get_seconds(static_cast<STAGE>(k)) + 
+        ((k == STAGE_OTHER) ? 0.0 : writer_clock.get_seconds(static_cast<STAGE>(k)));
+
+    // Process-wide pool: includes worker and writer threads
+    #if ARROW_VERSION_MAJOR >= POOL_STATS_ARROW_VERSION
+    stats.allocations = arrow::default_memory_pool()->num_allocations() - pool_allocations;
+    stats.allocated_bytes = arrow::default_memory_pool()->total_bytes_allocated() - pool_bytes;
+    #endif
+    stats.collected = true;
+    stage_clock.reset(false);
+    writer_clock.reset(false);
+}
+
+void FitTransformer::OnExpansion(FIT_BOOL begin)
+{
+    if (begin) expand_left = stage_clock.enter(STAGE_EXPAND);
+    else stage_clock.enter(expand_left);
+}
+
+const char* TransformStats::stage_name(int stage)
+{
+    static const char* names[NUM_STAGES] = {"other", "open", "integrity", "decode", "expand",
+        "stringify", "append", "finish", "encode", "write"};
+    return names[stage];
+}
+
+std::map<std::string, std::int64_t> TransformStats::mesg_name_counts() const
+{
+    std::map<std::string, std::int64_t> name_counts;
+    for (auto cpair : mesg_counts) {
+        const fit::Profile::MESG* pmesg = fit::Profile::GetMesg(cpair.first);
+        name_counts[(pmesg == nullptr) ? "unknown" : pmesg->name] += cpair.second;
+    }
+    return name_counts;
+}
+
+void TransformStats::add_collected(const TransformStats& other)
+{
+    mesgs += other.mesgs;
+    dropped_mesgs += other.dropped_mesgs;
+    for (auto cpair : other.mesg_counts) mesg_counts[cpair.first] += cpair.second;
+    for (int k = 0; k < NUM_STAGES; ++k) stage_seconds[k] += other.stage_seconds[k];
+}
+
+std::string TransformStats::to_json() const
+{
+    std::ostringstream json;
+    json << "{\n  \"fit_bytes\": " << fit_bytes << ",\n  \"mesgs\": " << mesgs 
+        << ",\n  \"dropped_mesgs\": " << dropped_mesgs << ",\n  \"rows\": " << rows 
+        << ",\n  \"string_bytes\": " << string_bytes << ",\n  \"estimated_rows\": " << estimated_rows 
+        << ",\n  \"estimated_string_bytes\": " << estimated_string_bytes 
+        << ",\n  \"collected\": " << (collected ? "true" : "false");
+    if (collected) {
+        json << ",\n  \"allocations\": " << allocations << ",\n  \"allocated_bytes\": " << allocated_bytes
+            << ",\n  \"stage_seconds\": {";
+        for (int k = 0; k < NUM_STAGES; ++k)
+            json << (k ? ", " : "") << "\"" << stage_name(k) << "\": " << stage_seconds[k];
+
+        // Mesg names are FIT profile identifiers (no escaping needed)
+        json << "},\n  \"mesg_counts\": {";
+        bool first = true;
+        for (auto cpair : mesg_name_counts()) {
+            json << (first ? "" : ", ") << "\"" << cpair.first << "\": " << cpair.second;
+            first = false;
+        }
+        json << "}";
+    }
+    json << "\n}";
+    return json.str();
+}
+
+bool FitTransformer::_expand_sensor_mesg(fit::Mesg& mesg)
+{
+    auto chans = SENSOR_CHANNELS.find(mesg.GetNum());
+    if (chans == SENSOR_CHANNELS.end()) return false;
+
+    // Gather channel sample arrays
+    size_t nsamples = 0;
+    std::unordered_map<std::string, std::vector<FIT_FLOAT64>> samples;
+    for (const SensorChannel& chan : chans->second) {
+        const fit::Field* field = mesg.GetField(chan.field);
+        if (samples.count(chan.column) || field == nullptr || field->GetNumValues() == 0) continue;
+
+        std::vector<FIT_FLOAT64>& vals = samples[chan.column];
+        vals.resize(field->GetNumValues());
+        for (FIT_UINT8 j = 0; j < field->GetNumValues(); ++j) vals[j] = field->GetRawValue(j);
+        _apply_scale_offset(vals.data(), vals.size(), field->GetScale(), field->GetOffset(), chan.factor);
+        nsamples = std::max(nsamples, vals.size());
+    }
+
+    // No calibrated data (e.g. raw counts only), emit as regular rows
+    if (nsamples == 0) return false;
+    StageScope append(stage_clock, STAGE_APPEND);
+
+    // Per-sample timestamps (at least millisecond resolution)
+    std::int64_t hr_scale = _highrate_timestamp_scale();
+    std::vector<std::int64_t> tstamps(nsamples, 0);
+    std::vector<uint8_t> tvalid(nsamples, 0);
+
+    if (mesg.GetNum() == FIT_MESG_NUM_HRV) {
+        // HRV has no timestamp: beats are placed at cumulative RR intervals on a beat 
+        // clock carried across HRV mesgs, synced forward by each newer timestamped mesg
+        if (last_timestamp != FIT_DATE_TIME_INVALID) {
+            if (last_timestamp != hrv_anchor) {
+                hrv_anchor = last_timestamp;
+                hrv_clock = std::max(hrv_clock, _to_timestamp(last_timestamp, hr_scale));
+            }
+            const std::vector<FIT_FLOAT64>& rr = samples["rr_interval"];
+            for (size_t k = 0; k < nsamples; ++k) {
+                if (std::isnan(rr[k])) continue;
+                hrv_clock += std::llround(rr[k] * hr_scale);
+                tstamps[k] = hrv_clock; tvalid[k] = 1;
+            }
+        }
+    }
+    else {
+        const fit::Field* tfield = mesg.GetField("timestamp");
+        if (tfield != nullptr && tfield->IsValueValid()) {
+            last_timestamp = tfield->GetUINT32Value();
+            std::int64_t tbase = _to_timestamp(last_timestamp, hr_scale);
+
+            const fit::Field* msfield = mesg.GetField("timestamp_ms");
+            if (msfield != nullptr && msfield->IsValueValid()) tbase += msfield->GetUINT16Value() * hr_scale / 1000;
 
-                if (colflags["timestamp"]) {
-                    // Finalize timestamp on mesg block of rows
-                    if (timestamp_a == FIT_DATE_TIME_INVALID)
-                        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::TimestampBuilder>(
-                        builders["timestamp"])->AppendNulls(nfields));
-                    else if (CONFIG["epoch_format"] == "UNIX")
-                        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::TimestampBuilder>(
-                        builders["timestamp"])->AppendValues(std::vector<std::int64_t>(
-                        nfields, static_cast<std::int64_t>(timestamp_a) + 631065600)));
-                    else PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::TimestampBuilder>(
-                        builders["timestamp"])->AppendValues(std::vector<std::int64_t>(
-                        nfields, static_cast<std::int64_t>(timestamp_a))));
-                }
+            const fit::Field* offfield = mesg.GetField("sample_time_offset");
+            FIT_UINT8 noffsets = (offfield == nullptr) ? 0 : offfield->GetNumValues();
+            for (size_t k = 0; k < nsamples; ++k) {
+                tstamps[k] = tbase;
+                if (k < noffsets && offfield->IsValueValid(k)) tstamps[k] += offfield->GetUINT16Value(k) * hr_scale / 1000;
+                tvalid[k] = 1;
             }
-            #if defined PYBIND11_PRINT_PYSTDOUT
-            else pybind11::print("  Manufacturer/Product invalid, dropping:", mesg.GetName());
-            #else
-            else std::cerr << "  Manufacturer/Product invalid, dropping: " << mesg.GetName() << std::endl;
-            #endif 
         }
     }
-}
 
-void FitTransformer::_append_mesg_fields(fit::Mesg& mesg) 
-{
-    if (colflags["source_filetype"])
-        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
-            builders["source_filetype"])->Append(std::string("FIT")));
+    PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::TimestampBuilder>(
+        hrbuilders["timestamp"])->AppendValues(tstamps.data(), nsamples, tvalid.data()));
 
-    if (colflags["source_filename"])
-        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
-            builders["source_filename"])->Append(source_filename));
+    std::string mesg_name = mesg.GetName();
+    std::shared_ptr<arrow::StringBuilder> mesg_builder = 
+        std::dynamic_pointer_cast<arrow::StringBuilder>(hrbuilders["mesg_name"]);
+    for (size_t k = 0; k < nsamples; ++k) PARQUET_THROW_NOT_OK(mesg_builder->Append(mesg_name));
 
-    if (colflags["source_file_uri"])
-        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
-            builders["source_file_uri"])->Append(source_file_uri));
+    // Channel columns, null where absent or invalid
+    std::vector<uint8_t> valid(nsamples);
+    for (int i = 2; i < hrcolkeys.size(); ++i) {
+        std::shared_ptr<arrow::DoubleBuilder> chan_builder = 
+            std::dynamic_pointer_cast<arrow::DoubleBuilder>(hrbuilders[hrcolkeys[i]]);
 
-    if (colflags["manufacturer_index"])
-        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::Int32Builder>(
-            builders["manufacturer_index"])->Append(manufacturer_index));
+        auto sit = samples.find(hrcolkeys[i]);
+        if (sit == samples.end()) {
+            PARQUET_THROW_NOT_OK(chan_builder->AppendNulls(nsamples));
+            continue;
+        }
 
-    if (colflags["manufacturer_name"])
-        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
-            builders["manufacturer_name"])->Append(manufacturer_name)); 
-    
-    if (colflags["product_index"])
-        PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::Int32Builder>(
-            builders["product_index"])->Append(product_index));
-    
-    if (colflags["product_name"]) {
-        if (product_name.length() == 0)
-            PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
-                builders["product_name"])->AppendNull());
-        else 
-            PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
-                builders["product_name"])->Append(product_name));
+        std::vector<FIT_FLOAT64>& vals = sit->second;
+        vals.resize(nsamples, std::nan(""));
+        for (size_t k = 0; k < nsamples; ++k) valid[k] = !std::isnan(vals[k]);
+        PARQUET_THROW_NOT_OK(chan_builder->AppendValues(vals.data(), nsamples, valid.data()));
     }
 
+    return true;
+}
+
+// FIT date_time (whole seconds) => ticks of scale/sec since configured epoch
+std::int64_t FitTransformer::_to_timestamp(FIT_DATE_TIME fit_datetime, std::int64_t scale)
+{
+    return (static_cast<std::int64_t>(fit_datetime) + epoch_seconds) * scale;
+}
+
+// High-rate samples are never coarser than milliseconds
+std::int64_t FitTransformer::_highrate_timestamp_scale() {
+    return std::max<std::int64_t>(timestamp_scale, 1000);
+}
+
+void FitTransformer::_append_mesg_fields(fit::Mesg& mesg) 
+{
+    // File-constant columns are only counted (see _get_file_constant)
+    staged_rows += 1;
+
     if (colflags["mesg_index"])
         PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::Int32Builder>(
             builders["mesg_index"])->Append(mesg.GetNum()));
@@ -205,7 +1265,8 @@ void FitTransformer::_append_mesg_fields(fit::Mesg& mesg)
             builders["mesg_name"])->Append(mesg.GetName()));
 }
 
-void FitTransformer::_append_field_fields(const fit::FieldBase& field, const std::string &sval, FIT_UINT8 j)
+void FitTransformer::_append_field_fields(const fit::FieldBase& field, const std::string &sval, FIT_UINT8 j,
+                                         fit::Profile::Type etype)
 {
     if (colflags["field_index"]) {
         FIT_UINT16 field_index = field.GetNum();
@@ -287,6 +1348,17 @@ void FitTransformer::_append_field_fields(const fit::FieldBase& field, const std
             PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
                 builders["value_string"])->Append(sval));
     }
+
+    // Name of an enumerated value (fitenums.h), null for other fields and unknown values
+    if (colflags["value_enum_name"]) {
+        const char* ename = (etype == fit::Profile::Type::Invalid || ftype != FIELD_TYPE::INT_VALUE || 
+            !field.IsValueValid(j)) ? nullptr : fit_enum_name(etype, static_cast<FIT_UINT32>(ival));
+        if (ename == nullptr)
+            PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
+                builders["value_enum_name"])->AppendNull());
+        else PARQUET_THROW_NOT_OK(std::dynamic_pointer_cast<arrow::StringBuilder>(
+            builders["value_enum_name"])->Append(ename, std::strlen(ename)));
+    }
 }
 
 std::tuple<FIELD_TYPE, FIT_SINT64, FIT_FLOAT64> FitTransformer::_get_field_type(
@@ -351,7 +1423,7 @@ std::shared_ptr<arrow::Schema> FitTransformer::_get_schema()
     if (CONFIG["manufacturer_name"] == "true") fldvec.push_back(arrow::field("manufacturer_name", arrow::utf8(), false));
     if (CONFIG["product_index"] == "true") fldvec.push_back(arrow::field("product_index", arrow::int32(), false));
     if (CONFIG["product_name"] == "true") fldvec.push_back(arrow::field("product_name", arrow::utf8(), true));
-    if (CONFIG["timestamp"] == "true") fldvec.push_back(arrow::field("timestamp", arrow::timestamp(arrow::TimeUnit::SECOND), true));
+    if (CONFIG["timestamp"] == "true") fldvec.push_back(arrow::field("timestamp", arrow::timestamp(timestamp_unit), true));
     if (CONFIG["mesg_index"] == "true") fldvec.push_back(arrow::field("mesg_index", arrow::int32(), false)); 
     if (CONFIG["mesg_name"] == "true") fldvec.push_back(arrow::field("mesg_name", arrow::utf8(), false)); 
     if (CONFIG["field_index"] == "true") fldvec.push_back(arrow::field("field_index", arrow::int32(), true));
@@ -360,12 +1432,24 @@ std::shared_ptr<arrow::Schema> FitTransformer::_get_schema()
     if (CONFIG["value_string"] == "true") fldvec.push_back(arrow::field("value_string", arrow::utf8(), false));
     if (CONFIG["value_integer"] == "true") fldvec.push_back(arrow::field("value_integer", arrow::int64(), true));
     if (CONFIG["value_float"] == "true") fldvec.push_back(arrow::field("value_float", arrow::float64(), true));
+    if (CONFIG.exists("value_enum_name") && CONFIG["value_enum_name"] == "true") 
+        fldvec.push_back(arrow::field("value_enum_name", arrow::utf8(), true));
     if (CONFIG["units"] == "true") fldvec.push_back(arrow::field("units", arrow::utf8(), true));
     std::shared_ptr<arrow::Schema> p_schema;
     p_schema = arrow::schema(fldvec);
     return p_schema;
 }
 
+std::shared_ptr<arrow::Schema> FitTransformer::_get_highrate_schema() 
+{
+    std::vector<std::shared_ptr<arrow::Field>> fldvec;
+    arrow::TimeUnit::type hr_unit = (_highrate_timestamp_scale() == 1000) ? arrow::TimeUnit::MILLI : arrow::TimeUnit::MICRO;
+    fldvec.push_back(arrow::field("timestamp", arrow::timestamp(hr_unit), true));
+    fldvec.push_back(arrow::field("mesg_name", arrow::utf8(), false));
+    for (int i = 2; i < hrcolkeys.size(); ++i) fldvec.push_back(arrow::field(hrcolkeys[i], arrow::float64(), true));
+    return arrow::schema(fldvec);
+}
+
 void FitTransformer::_init_from_config(std::unordered_map<std::string, bool> &cflags,
                                       std::unordered_map<std::string, bool> &exflags,
                                       std::unordered_map<std::string, pBuilder> &cbuilders) 
@@ -375,18 +1459,46 @@ void FitTransformer::_init_from_config(std::unordered_map<std::string, bool> &cf
     exflags.insert({"exclude_timestamp_values", CONFIG["exclude_timestamp_values"] == "true"});
 
     // Set column flags
-    for (int i = 0; i < colkeys.size(); ++i) cflags.insert({colkeys[i], CONFIG[colkeys[i]] == "true"});
-
-    // Create column ArrayBuilders
-    if (cflags["source_filetype"]) cbuilders.insert({"source_filetype", pBuilder(new arrow::StringBuilder())});
-    if (cflags["source_filename"]) cbuilders.insert({"source_filename", pBuilder(new arrow::StringBuilder())});
-    if (cflags["source_file_uri"]) cbuilders.insert({"source_file_uri", pBuilder(new arrow::StringBuilder())});
-    if (cflags["manufacturer_index"]) cbuilders.insert({"manufacturer_index", pBuilder(new arrow::Int32Builder())});
-    if (cflags["manufacturer_name"]) cbuilders.insert({"manufacturer_name", pBuilder(new arrow::StringBuilder())});
-    if (cflags["product_index"]) cbuilders.insert({"product_index", pBuilder(new arrow::Int32Builder())});
-    if (cflags["product_name"]) cbuilders.insert({"product_name", pBuilder(new arrow::StringBuilder())});
+    for (int i = 0; i < colkeys.size(); ++i) 
+        cflags.insert({colkeys[i], CONFIG.exists(colkeys[i]) && CONFIG[colkeys[i]] == "true"});
+
+    // FIT epoch (1989-12-31) => configured epoch
+    epoch_seconds = (CONFIG["epoch_format"] == "UNIX") ? 631065600 : 0;
+
+    // Row group byte budget (optional config param)
+    row_group_bytes = CONFIG.exists("row_group_bytes") ? std::stoll(CONFIG["row_group_bytes"]) : ROW_GROUP_BYTES;
+
+    // Clustered row order (optional config params), as: cluster_key_1, cluster_key_2, ...
+    cluster_keys.clear();
+    if (CONFIG.exists("cluster_rows") && CONFIG["cluster_rows"] == "true") {
+        for (int k = 1; CONFIG.exists("cluster_key_" + std::to_string(k)); ++k) {
+            auto cflag = cflags.find(CONFIG["cluster_key_" + std::to_string(k)]);
+            if (cflag != cflags.end() && cflag->second) cluster_keys.push_back(cflag->first);
+        }
+    }
+
+    // Bloom filtered (string) columns (optional config params), as: bloom_filter_<column>
+    bloom_columns.clear();
+    for (int i = 0; i < colkeys.size(); ++i) {
+        std::string bloom_k = "bloom_filter_" + colkeys[i];
+        if (cflags[colkeys[i]] && CONFIG.exists(bloom_k) && CONFIG[bloom_k] == "true") 
+            bloom_columns.push_back(colkeys[i]);
+    }
+
+    // Output format and Arrow IPC codec (optional config params, default Parquet/uncompressed)
+    ipc_output = CONFIG.exists("output_format") && CONFIG["output_format"] == "arrow";
+    ipc_compression = parse_ipc_compression(CONFIG.exists("ipc_compression") ? 
+        CONFIG["ipc_compression"] : "uncompressed");
+
+    // Timestamp resolution (optional config param, defaults to seconds)
+    std::string tunit = CONFIG.exists("timestamp_unit") ? CONFIG["timestamp_unit"] : "s";
+    if (tunit == "us") { timestamp_unit = arrow::TimeUnit::MICRO; timestamp_scale = 1000000; }
+    else if (tunit == "ms") { timestamp_unit = arrow::TimeUnit::MILLI; timestamp_scale = 1000; }
+    else { timestamp_unit = arrow::TimeUnit::SECOND; timestamp_scale = 1; }
+
+    // Create column ArrayBuilders (file-constant columns need none)
     if (cflags["timestamp"]) cbuilders.insert({"timestamp", pBuilder(new arrow::TimestampBuilder(
-        arrow::timestamp(arrow::TimeUnit::SECOND), arrow::default_memory_pool()))});
+        arrow::timestamp(timestamp_unit), arrow::default_memory_pool()))});
     if (cflags["mesg_index"]) cbuilders.insert({"mesg_index", pBuilder(new arrow::Int32Builder())});
     if (cflags["mesg_name"]) cbuilders.insert({"mesg_name", pBuilder(new arrow::StringBuilder())});
     if (cflags["field_index"]) cbuilders.insert({"field_index", pBuilder(new arrow::Int32Builder())});
@@ -395,53 +1507,735 @@ void FitTransformer::_init_from_config(std::unordered_map<std::string, bool> &cf
     if (cflags["value_string"]) cbuilders.insert({"value_string", pBuilder(new arrow::StringBuilder())});
     if (cflags["value_integer"]) cbuilders.insert({"value_integer", pBuilder(new arrow::Int64Builder())});
     if (cflags["value_float"]) cbuilders.insert({"value_float", pBuilder(new arrow::DoubleBuilder())});
+    if (cflags["value_enum_name"]) cbuilders.insert({"value_enum_name", pBuilder(new arrow::StringBuilder())});
     if (cflags["units"]) cbuilders.insert({"units", pBuilder(new arrow::StringBuilder())});
+
+    // High-rate sensor table (optional config param)
+    expand_sensor_arrays = CONFIG.exists("expand_sensor_arrays") && CONFIG["expand_sensor_arrays"] == "true";
+    if (expand_sensor_arrays) {
+        hrbuilders.insert({"timestamp", pBuilder(new arrow::TimestampBuilder(
+            _get_highrate_schema()->GetFieldByName("timestamp")->type(), arrow::default_memory_pool()))});
+        hrbuilders.insert({"mesg_name", pBuilder(new arrow::StringBuilder())});
+        for (int i = 2; i < hrcolkeys.size(); ++i) hrbuilders.insert({hrcolkeys[i], pBuilder(new arrow::DoubleBuilder())});
+    }
 }
 
-void FitTransformer::_write_parquet(const char parquet_fname[]) 
+// Closes staged rows into a row group once they reach the byte budget, 
+// preferably where the mesg type changes (so per row group mesg_name/
+// timestamp statistics stay selective), unconditionally at twice budget
+void FitTransformer::_check_row_group(FIT_UINT16 mesg_num) 
+{
+    if (mark_row_groups) {
+        row_group_marks.push_back({mesg_num, staged_rows, _builders_byte_size()});
+        return;
+    }
+
+    bool mesg_boundary = (mesg_num != last_mesg_num);
+    last_mesg_num = mesg_num;
+
+    std::int64_t nbytes = _builders_byte_size();
+    if (nbytes >= 2 * row_group_bytes || (mesg_boundary && nbytes >= row_group_bytes)) {
+        _emit_row_group(_finish_table());
+        _reserve_builders();
+    }
+}
+
+// Uncompressed bytes currently staged in column builders, plus the file-constant columns 
+// as _finish_table materializes them for the staged rows (validity bitmaps ignored)
+std::int64_t FitTransformer::_builders_byte_size() 
+{
+    std::int64_t nbytes = 0;
+    for (auto bpair : builders) {
+        const arrow::ArrayBuilder& builder = *bpair.second;
+        if (builder.type()->id() == arrow::Type::STRING) 
+            nbytes += static_cast<const arrow::StringBuilder&>(builder).value_data_length() + 
+                builder.length() * sizeof(std::int32_t);
+        else nbytes += builder.length() * arrow::bit_width(builder.type()->id()) / 8;
+    }
+
+    std::int64_t constant_row_bytes = 0;
+    if (colflags["source_filetype"]) constant_row_bytes += 3 + sizeof(std::int32_t);
+    if (colflags["source_filename"]) constant_row_bytes += source_filename.length() + sizeof(std::int32_t);
+    if (colflags["source_file_uri"]) constant_row_bytes += source_file_uri.length() + sizeof(std::int32_t);
+    if (colflags["manufacturer_index"]) constant_row_bytes += sizeof(std::int32_t);
+    if (colflags["manufacturer_name"]) constant_row_bytes += manufacturer_name.length() + sizeof(std::int32_t);
+    if (colflags["product_index"]) constant_row_bytes += sizeof(std::int32_t);
+    if (colflags["product_name"]) constant_row_bytes += product_name.length() + sizeof(std::int32_t);
+    return nbytes + staged_rows * constant_row_bytes;
+}
+
+// Value of a column constant over the whole FIT file (nullptr if not file-constant)
+std::shared_ptr<arrow::Scalar> FitTransformer::_get_file_constant(const std::string& cname) 
+{
+    if (cname == "source_filetype") return arrow::MakeScalar(std::string("FIT"));
+    else if (cname == "source_filename") return arrow::MakeScalar(source_filename);
+    else if (cname == "source_file_uri") return arrow::MakeScalar(source_file_uri);
+    else if (cname == "manufacturer_index") return arrow::MakeScalar(static_cast<std::int32_t>(manufacturer_index));
+    else if (cname == "manufacturer_name") return arrow::MakeScalar(manufacturer_name);
+    else if (cname == "product_index") return arrow::MakeScalar(static_cast<std::int32_t>(product_index));
+    else if (cname == "product_name") return (product_name.length() == 0) ? 
+        arrow::MakeNullScalar(arrow::utf8()) : arrow::MakeScalar(product_name);
+    return nullptr;
+}
+
+std::shared_ptr<arrow::Table> FitTransformer::_finish_table() 
 {
-    // Finish builders into arrays
+    StageScope finish(stage_clock, STAGE_FINISH);
+
+    // Finish builders into arrays, file-constant columns 
+    // materialize from their single value per row group
     std::vector<std::shared_ptr<arrow::Array>> tcolumns;
     for (int i = 0; i < colkeys.size(); ++i) {
         if (colflags[colkeys[i]]) {
             std::shared_ptr<arrow::Array> carray;
-            PARQUET_THROW_NOT_OK(builders[colkeys[i]]->Finish(&carray));
+            std::shared_ptr<arrow::Scalar> constant = _get_file_constant(colkeys[i]);
+            if (constant == nullptr && builders[colkeys[i]]->type()->id() == arrow::Type::STRING)
+                stats.string_bytes += static_cast<arrow::StringBuilder&>(*builders[colkeys[i]]).value_data_length();
+            if (constant == nullptr) PARQUET_THROW_NOT_OK(builders[colkeys[i]]->Finish(&carray));
+            else { PARQUET_ASSIGN_OR_THROW(carray, arrow::MakeArrayFromScalar(*constant, staged_rows)); }
             tcolumns.push_back(carray);
         }
     }
+    stats.rows += staged_rows;
+    staged_rows = 0;
     
-    // Make table from arrays, then write table to parquet outfile
-    std::shared_ptr<::arrow::io::FileOutputStream> parquet_fhandle;
-    std::shared_ptr<arrow::Table> atable_ptr = arrow::Table::Make(_get_schema(), tcolumns);
-    PARQUET_ASSIGN_OR_THROW(parquet_fhandle, ::arrow::io::FileOutputStream::Open(parquet_fname));
-    PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(*atable_ptr, arrow::default_memory_pool(), 
-                                                    parquet_fhandle, ROW_GROUP_SIZE));
+    // Make table from arrays
+    return arrow::Table::Make(_get_schema(), tcolumns);
+}
+
+// Stages nrows rows of a chunk worker's finished table (one chunk per column) back into
+// the column builders. The worker counted them already: removed here, _finish_table recounts.
+void FitTransformer::_stage_rows(const std::shared_ptr<arrow::Table>& table, std::int64_t offset, std::int64_t nrows)
+{
+    if (nrows == 0) return;
+    for (int i = 0; i < colkeys.size(); ++i) {
+        if (!colflags[colkeys[i]] || _get_file_constant(colkeys[i]) != nullptr) continue;
+        arrow::ArrayBuilder& builder = *builders[colkeys[i]];
+        bool is_string = (builder.type()->id() == arrow::Type::STRING);
+        std::int64_t nbytes = is_string ? static_cast<arrow::StringBuilder&>(builder).value_data_length() : 0;
+
+        arrow::ArraySpan span(*table->GetColumnByName(colkeys[i])->chunk(0)->data());
+        PARQUET_THROW_NOT_OK(builder.AppendArraySlice(span, offset, nrows));
+        if (is_string) stats.string_bytes -= static_cast<arrow::StringBuilder&>(builder).value_data_length() - nbytes;
+    }
+    staged_rows += nrows;
+    stats.rows -= nrows;
+}
+
+// Closed row group => background writer if running, else staged for _write_parquet
+void FitTransformer::_emit_row_group(const std::shared_ptr<arrow::Table>& table) 
+{
+    StageScope wait(stage_clock, STAGE_OTHER); // (Queue backpressure)
+    if (wthread.joinable()) wqueue->push(table);
+    else row_groups.push_back(table);
+}
+
+void FitTransformer::_start_writer(const char parquet_fname[]) 
+{
+    // Opened here, before the writer thread starts: _get_writer_properties reads CONFIG
+    std::shared_ptr<arrow::Schema> schema = _get_schema();
+    writer_clock.reset(stage_clock.is_enabled());
+    pwriter = _open_writer(schema, parquet_fname, cluster_keys, writer_clock);
+    wfname = parquet_fname;
+
+    std::int64_t depth = CONFIG.exists("writer_queue_depth") ? std::stoll(CONFIG["writer_queue_depth"]) : 2;
+    wqueue.reset(new SpscQueue<std::shared_ptr<arrow::Table>>(std::max<std::int64_t>(depth, 1)));
+    writer_abort = false;
+    writer_error = nullptr;
+    wthread = std::thread(&FitTransformer::_run_writer, this);
+}
+
+// Writer thread: encodes/compresses/writes queued row groups until a nullptr 
+// arrives. After an error or abort it keeps draining so push() never blocks.
+void FitTransformer::_run_writer() 
+{
+    bool written = false;
+    std::shared_ptr<arrow::Table> empty;
+    std::vector<std::shared_ptr<arrow::Table>> sidecar_rows; // (Filters only: row groups aren't kept)
+    for (std::shared_ptr<arrow::Table> table = wqueue->pop(); table != nullptr; table = wqueue->pop()) {
+        if (writer_abort || writer_error != nullptr) continue;
+        if (table->num_rows() == 0) { empty = table; continue; }
+
+        try {
+            StageScope encode(writer_clock, STAGE_ENCODE);
+            PARQUET_THROW_NOT_OK(pwriter->WriteTable(*table, table->num_rows())); 
+            #if ARROW_VERSION_MAJOR < BLOOM_FILTER_ARROW_VERSION
+            if (!bloom_columns.empty()) sidecar_rows.push_back(_bloom_sidecar_rows(*table, sidecar_rows.size()));
+            #endif
+            written = true;
+        }
+        catch (...) { writer_error = std::current_exception(); }
+    }
+    if (writer_abort || writer_error != nullptr) return;
+
+    try {
+        StageScope encode(writer_clock, STAGE_ENCODE);
+        if (!written && empty != nullptr) {
+            PARQUET_THROW_NOT_OK(pwriter->WriteTable(*empty, 1));
+            #if ARROW_VERSION_MAJOR < BLOOM_FILTER_ARROW_VERSION
+            if (!bloom_columns.empty()) sidecar_rows.push_back(_bloom_sidecar_rows(*empty, 0));
+            #endif
+        }
+        PARQUET_THROW_NOT_OK(pwriter->Close());
+        if (!bloom_columns.empty() && !sidecar_rows.empty()) _write_bloom_sidecar(sidecar_rows, wfname);
+    }
+    catch (...) { writer_error = std::current_exception(); }
+}
+
+// Joins the writer thread (if running). On abort the partial file is removed,
+// otherwise a writer thread error is rethrown here.
+void FitTransformer::_stop_writer(bool abort) 
+{
+    if (!wthread.joinable()) return;
+    writer_abort = abort;
+    wqueue->push(nullptr);
+    wthread.join();
+    pwriter.reset();
+    wqueue.reset();
+
+    boost::system::error_code ec;
+    if (abort || writer_error != nullptr) {
+        boost::filesystem::path pbloom(wfname);
+        pbloom = pbloom.parent_path() / (pbloom.stem().string() + "_bloom" + pbloom.extension().string());
+        boost::filesystem::remove(wfname, ec);
+        boost::filesystem::remove(pbloom, ec);
+    }
+    if (!abort && writer_error != nullptr) {
+        std::exception_ptr error = writer_error;
+        writer_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void FitTransformer::_write_parquet(const char parquet_fname[]) 
+{
+    // Pipelined: only the last row group is left to write
+    if (wthread.joinable()) {
+        wqueue->push(_finish_table());
+        _stop_writer(false);
+        return;
+    }
+
+    row_groups.push_back(_finish_table());
+
+    // Clustered: whole table sorted by cluster keys, then re-cut by byte budget
+    if (!cluster_keys.empty()) {
+        std::shared_ptr<arrow::Table> atable_ptr;
+        PARQUET_ASSIGN_OR_THROW(atable_ptr, arrow::ConcatenateTables(row_groups));
+        row_groups = _slice_row_groups(cluster_table(atable_ptr, cluster_keys));
+    }
+    if (ipc_output) _write_ipc(row_groups, parquet_fname);
+    else _write_table(row_groups, parquet_fname, cluster_keys);
+}
+
+void FitTransformer::_write_highrate_parquet(const char parquet_fname[]) 
+{
+    std::shared_ptr<arrow::Table> atable_ptr = _finish_highrate_table();
+    if (atable_ptr == nullptr) return;
+
+    // Written beside the main table as: <parquet_stem>_highrate.parquet
+    boost::filesystem::path phr(parquet_fname);
+    phr = phr.parent_path() / (phr.stem().string() + "_highrate" + phr.extension().string());
+    if (ipc_output) _write_ipc(_slice_row_groups(atable_ptr), phr.string());
+    else _write_table(_slice_row_groups(atable_ptr), phr.string());
+}
+
+// Finishes high-rate builders into a table (nullptr if no samples staged)
+std::shared_ptr<arrow::Table> FitTransformer::_finish_highrate_table() 
+{
+    if (hrbuilders["timestamp"]->length() == 0) return nullptr;
+    StageScope finish(stage_clock, STAGE_FINISH);
+
+    std::vector<std::shared_ptr<arrow::Array>> tcolumns;
+    for (int i = 0; i < hrcolkeys.size(); ++i) {
+        std::shared_ptr<arrow::Array> carray;
+        PARQUET_THROW_NOT_OK(hrbuilders[hrcolkeys[i]]->Finish(&carray));
+        tcolumns.push_back(carray);
+    }
+    return arrow::Table::Make(_get_highrate_schema(), tcolumns);
+}
+
+// Slices a finished table into row groups of about row_group_bytes each
+std::vector<std::shared_ptr<arrow::Table>> FitTransformer::_slice_row_groups(
+    const std::shared_ptr<arrow::Table>& table) 
+{
+    std::int64_t nrows = table->num_rows();
+    std::int64_t nbytes = std::max<std::int64_t>(arrow::util::TotalBufferSize(*table), 1);
+    std::int64_t group_rows = std::max<std::int64_t>(nrows * row_group_bytes / nbytes, 1);
+
+    std::vector<std::shared_ptr<arrow::Table>> tables;
+    for (std::int64_t offset = 0; offset < nrows; offset += group_rows)
+        tables.push_back(table->Slice(offset, group_rows));
+    if (tables.empty()) tables.push_back(table);
+    return tables;
+}
+
+// Output file stream, timing its writes as STAGE_WRITE while collecting stats
+class TimedOutputStream : public arrow::io::OutputStream
+{
+public:
+
+    TimedOutputStream(const std::shared_ptr<arrow::io::OutputStream>& sink, StageClock& clock) :
+        sink(sink), clock(clock) { }
+
+    arrow::Status Write(const void* data, std::int64_t nbytes) override {
+        StageScope write(clock, STAGE_WRITE);
+        return sink->Write(data, nbytes);
+    }
+    arrow::Status Write(const std::shared_ptr<arrow::Buffer>& data) override {
+        StageScope write(clock, STAGE_WRITE);
+        return sink->Write(data);
+    }
+    arrow::Status Flush() override { StageScope write(clock, STAGE_WRITE); return sink->Flush(); }
+    arrow::Status Close() override { StageScope write(clock, STAGE_WRITE); return sink->Close(); }
+    arrow::Result<std::int64_t> Tell() const override { return sink->Tell(); }
+    bool closed() const override { return sink->closed(); }
+
+private:
+
+    std::shared_ptr<arrow::io::OutputStream> sink;
+    StageClock& clock;
+};
+
+static std::shared_ptr<arrow::io::OutputStream> _open_output(const std::string& fname, StageClock& clock)
+{
+    std::shared_ptr<arrow::io::FileOutputStream> fhandle;
+    PARQUET_ASSIGN_OR_THROW(fhandle, arrow::io::FileOutputStream::Open(fname));
+    if (!clock.is_enabled()) return fhandle;
+    return std::make_shared<TimedOutputStream>(fhandle, clock);
+}
+
+std::unique_ptr<parquet::arrow::FileWriter> FitTransformer::_open_writer(
+    const std::shared_ptr<arrow::Schema>& schema, const std::string& parquet_fname, 
+    const std::vector<std::string>& sort_keys, StageClock& clock) 
+{
+    std::shared_ptr<arrow::io::OutputStream> parquet_fhandle = _open_output(parquet_fname, clock);
+
+    std::unique_ptr<parquet::arrow::FileWriter> parquet_writer;
+    PARQUET_ASSIGN_OR_THROW(parquet_writer, parquet::arrow::FileWriter::Open(*schema, 
+        arrow::default_memory_pool(), parquet_fhandle, _get_writer_properties(schema, sort_keys)));
+    return parquet_writer;
+}
+
+// Writes each table as (exactly) one row group
+void FitTransformer::_write_table(const std::vector<std::shared_ptr<arrow::Table>>& tables, 
+                                  const std::string& parquet_fname, 
+                                  const std::vector<std::string>& sort_keys) 
+{
+    StageScope encode(stage_clock, STAGE_ENCODE);
+    std::unique_ptr<parquet::arrow::FileWriter> parquet_writer = 
+        _open_writer(tables.front()->schema(), parquet_fname, sort_keys, stage_clock);
+
+    std::vector<std::shared_ptr<arrow::Table>> sidecar_rows;
+    for (const std::shared_ptr<arrow::Table>& table : tables) {
+        if (table->num_rows() == 0 && tables.size() > 1) continue;
+        PARQUET_THROW_NOT_OK(parquet_writer->WriteTable(*table, std::max<std::int64_t>(table->num_rows(), 1)));
+        #if ARROW_VERSION_MAJOR < BLOOM_FILTER_ARROW_VERSION
+        if (!bloom_columns.empty()) sidecar_rows.push_back(_bloom_sidecar_rows(*table, sidecar_rows.size()));
+        #endif
+    }
+    PARQUET_THROW_NOT_OK(parquet_writer->Close());
+    if (!bloom_columns.empty() && !sidecar_rows.empty()) _write_bloom_sidecar(sidecar_rows, parquet_fname);
+}
+
+// Writes tables as record batches (one per row group) of one Arrow IPC file (Feather V2), 
+// buffers compressed by ipc_compression. Uncompressed files memory-map without copying.
+void FitTransformer::_write_ipc(const std::vector<std::shared_ptr<arrow::Table>>& tables, 
+                                const std::string& ipc_fname) 
+{
+    StageScope encode(stage_clock, STAGE_ENCODE);
+    std::shared_ptr<arrow::io::OutputStream> ipc_fhandle = _open_output(ipc_fname, stage_clock);
+
+    arrow::ipc::IpcWriteOptions options = arrow::ipc::IpcWriteOptions::Defaults();
+    if (ipc_compression != arrow::Compression::UNCOMPRESSED) {
+        PARQUET_ASSIGN_OR_THROW(options.codec, arrow::util::Codec::Create(ipc_compression));
+    }
+    std::shared_ptr<arrow::ipc::RecordBatchWriter> ipc_writer;
+    PARQUET_ASSIGN_OR_THROW(ipc_writer, arrow::ipc::MakeFileWriter(ipc_fhandle, tables.front()->schema(), options));
+    for (const std::shared_ptr<arrow::Table>& table : tables)
+        PARQUET_THROW_NOT_OK(ipc_writer->WriteTable(*table));
+    PARQUET_THROW_NOT_OK(ipc_writer->Close());
+    PARQUET_THROW_NOT_OK(ipc_fhandle->Close());
+}
+
+// Linked Arrow can't write bloom filters into the parquet file: written beside it as 
+// <parquet_stem>_bloom.parquet, one row per (row_group, column) holding the serialized
+// split-block filter (readable with parquet::BlockSplitBloomFilter::Deserialize)
+static const std::shared_ptr<arrow::Schema> BLOOM_SIDECAR_SCHEMA = arrow::schema({
+    arrow::field("row_group", arrow::int32(), false), arrow::field("column", arrow::utf8(), false),
+    arrow::field("bloom_filter", arrow::binary(), false)});
+
+// Sidecar rows for the bloom columns of table, written as row group rgroup
+std::shared_ptr<arrow::Table> FitTransformer::_bloom_sidecar_rows(const arrow::Table& table, int rgroup) 
+{
+    arrow::Int32Builder rgroup_builder;
+    arrow::StringBuilder column_builder;
+    arrow::BinaryBuilder bloom_builder;
+
+    for (const std::string& cname : bloom_columns) {
+        std::shared_ptr<arrow::ChunkedArray> column = table.GetColumnByName(cname);
+        if (column == nullptr || column->type()->id() != arrow::Type::STRING) continue;
+
+        // Sized for the distinct values actually present
+        std::unordered_set<std::string_view> distinct;
+        for (const std::shared_ptr<arrow::Array>& chunk : column->chunks()) {
+            const arrow::StringArray& values = static_cast<const arrow::StringArray&>(*chunk);
+            for (std::int64_t k = 0; k < values.length(); ++k) 
+                if (!values.IsNull(k)) distinct.insert(values.GetView(k));
+        }
+        parquet::BlockSplitBloomFilter bloom;
+        bloom.Init(parquet::BlockSplitBloomFilter::OptimalNumOfBytes(
+            std::max<std::uint64_t>(distinct.size(), 1), BLOOM_FILTER_FPP));
+        for (std::string_view value : distinct) {
+            parquet::ByteArray bvalue(value);
+            bloom.InsertHash(bloom.Hash(&bvalue));
+        }
+
+        std::shared_ptr<arrow::io::BufferOutputStream> bloom_sink;
+        std::shared_ptr<arrow::Buffer> bloom_buffer;
+        PARQUET_ASSIGN_OR_THROW(bloom_sink, arrow::io::BufferOutputStream::Create());
+        bloom.WriteTo(bloom_sink.get());
+        PARQUET_ASSIGN_OR_THROW(bloom_buffer, bloom_sink->Finish());
+
+        PARQUET_THROW_NOT_OK(rgroup_builder.Append(rgroup));
+        PARQUET_THROW_NOT_OK(column_builder.Append(cname));
+        PARQUET_THROW_NOT_OK(bloom_builder.Append(bloom_buffer->data(), bloom_buffer->size()));
+    }
+
+    std::vector<std::shared_ptr<arrow::Array>> tcolumns(3);
+    PARQUET_THROW_NOT_OK(rgroup_builder.Finish(&tcolumns[0]));
+    PARQUET_THROW_NOT_OK(column_builder.Finish(&tcolumns[1]));
+    PARQUET_THROW_NOT_OK(bloom_builder.Finish(&tcolumns[2]));
+    return arrow::Table::Make(BLOOM_SIDECAR_SCHEMA, tcolumns);
+}
+
+void FitTransformer::_write_bloom_sidecar(const std::vector<std::shared_ptr<arrow::Table>>& sidecar_rows, 
+                                          const std::string& parquet_fname) 
+{
+    std::shared_ptr<arrow::Table> bloom_table;
+    if (sidecar_rows.empty()) {
+        PARQUET_ASSIGN_OR_THROW(bloom_table, arrow::Table::MakeEmpty(BLOOM_SIDECAR_SCHEMA));
+    }
+    else {
+        PARQUET_ASSIGN_OR_THROW(bloom_table, arrow::ConcatenateTables(sidecar_rows));
+    }
+
+    boost::filesystem::path pbloom(parquet_fname);
+    pbloom = pbloom.parent_path() / (pbloom.stem().string() + "_bloom" + pbloom.extension().string());
+
+    std::shared_ptr<::arrow::io::FileOutputStream> bloom_fhandle;
+    PARQUET_ASSIGN_OR_THROW(bloom_fhandle, ::arrow::io::FileOutputStream::Open(pbloom.string()));
+    PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(*bloom_table, arrow::default_memory_pool(), 
+        bloom_fhandle, std::max<std::int64_t>(bloom_table->num_rows(), 1)));
+}
+
+std::shared_ptr<parquet::WriterProperties> FitTransformer::_get_writer_properties(
+    const std::shared_ptr<arrow::Schema>& schema, const std::vector<std::string>& sort_keys) 
+{
+    parquet::WriterProperties::Builder props;
+
+    // Row groups are closed by byte budget (see _check_row_group), never by row count
+    props.max_row_group_length(std::numeric_limits<std::int64_t>::max());
+
+    // Codec and level (level is codec-specific, see Arrow's util/compression.h)
+    if (CONFIG.exists("compression")) props.compression(parse_compression(CONFIG["compression"]));
+    if (CONFIG.exists("compression_level") && CONFIG["compression_level"] != "default") 
+        props.compression_level(std::stoi(CONFIG["compression_level"]));
+
+    // Page layout and statistics
+    if (CONFIG.exists("data_page_size")) props.data_pagesize(std::stoll(CONFIG["data_page_size"]));
+    if (CONFIG.exists("data_page_version")) props.data_page_version(CONFIG["data_page_version"] == "v2" ? 
+        parquet::ParquetDataPageVersion::V2 : parquet::ParquetDataPageVersion::V1);
+    if (CONFIG.exists("write_statistics") && CONFIG["write_statistics"] != "true") props.disable_statistics();
+    if (CONFIG.exists("write_page_index")) {
+        if (CONFIG["write_page_index"] == "true") props.enable_write_page_index();
+        else props.disable_write_page_index();
+    }
+
+    // Per-column dictionary/encoding, as: dictionary_<column>, encoding_<column>
+    for (const std::string& cname : schema->field_names()) {
+        std::string dict_k = "dictionary_" + cname, enc_k = "encoding_" + cname;
+        bool has_encoding = CONFIG.exists(enc_k) || cname == "timestamp";
+
+        // Timestamps are near-monotonic: delta encoding keeps the column tiny
+        if (has_encoding) props.encoding(cname, parse_encoding(
+            CONFIG.exists(enc_k) ? CONFIG[enc_k] : "DELTA_BINARY_PACKED"));
+
+        // Explicit encodings only apply to non-dictionary columns
+        if (CONFIG.exists(dict_k) ? CONFIG[dict_k] != "true" : has_encoding) props.disable_dictionary(cname);
+        else props.enable_dictionary(cname);
+
+        #if ARROW_VERSION_MAJOR >= BLOOM_FILTER_ARROW_VERSION
+        if (std::find(bloom_columns.begin(), bloom_columns.end(), cname) != bloom_columns.end()) {
+            parquet::BloomFilterOptions bloom_options;
+            bloom_options.fpp = BLOOM_FILTER_FPP;
+            bloom_options.ndv = BLOOM_FILTER_NDV; // Default (max_row_group_length) hits the 128MB cap
+            props.enable_bloom_filter(cname, bloom_options);
+        }
+        #endif
+    }
+
+    // Clustered columns, recorded in the footer as row group sorting_columns
+    std::vector<parquet::SortingColumn> sorting;
+    for (const std::string& key : sort_keys) {
+        int cindex = schema->GetFieldIndex(key);
+        if (cindex >= 0) sorting.push_back({cindex, false, true});
+    }
+    if (!sorting.empty()) props.set_sorting_columns(sorting);
+
+    return props.build();
+}
+
+// Per-row ascending ranks of a cluster key column, nulls first
+static std::vector<std::int64_t> _key_ranks(const arrow::Array& column)
+{
+    std::int64_t nrows = column.length();
+    std::vector<std::int64_t> ranks(nrows, std::numeric_limits<std::int64_t>::min());
+
+    switch (column.type_id()) {
+    case arrow::Type::STRING:
+    {
+        // Rank by position among the (few) distinct values
+        const arrow::StringArray& scolumn = static_cast<const arrow::StringArray&>(column);
+        std::map<std::string, std::int64_t, std::less<>> distinct;
+        for (std::int64_t i = 0; i < nrows; ++i) 
+            if (scolumn.IsValid(i) && distinct.find(scolumn.GetView(i)) == distinct.end()) 
+                distinct.emplace(std::string(scolumn.GetView(i)), 0);
+
+        std::int64_t rank = 0;
+        for (auto& dpair : distinct) dpair.second = rank++;
+        for (std::int64_t i = 0; i < nrows; ++i) 
+            if (scolumn.IsValid(i)) ranks[i] = distinct.find(scolumn.GetView(i))->second;
+        break;
+    }
+    case arrow::Type::INT32:
+    {
+        const std::int32_t* vals = column.data()->GetValues<std::int32_t>(1);
+        for (std::int64_t i = 0; i < nrows; ++i) if (column.IsValid(i)) ranks[i] = vals[i];
+        break;
+    }
+    case arrow::Type::INT64:
+    case arrow::Type::TIMESTAMP:
+    {
+        const std::int64_t* vals = column.data()->GetValues<std::int64_t>(1);
+        for (std::int64_t i = 0; i < nrows; ++i) if (column.IsValid(i)) ranks[i] = vals[i];
+        break;
+    }
+    case arrow::Type::DOUBLE:
+    {
+        // Order-preserving map of IEEE-754 bits onto signed integers
+        const double* vals = column.data()->GetValues<double>(1);
+        for (std::int64_t i = 0; i < nrows; ++i) {
+            if (!column.IsValid(i)) continue;
+            std::int64_t bits; std::memcpy(&bits, &vals[i], sizeof(bits));
+            ranks[i] = (bits < 0) ? (bits ^ std::numeric_limits<std::int64_t>::max()) : bits;
+        }
+        break;
+    }
+    default:
+        throw std::runtime_error(std::string("ERROR unsupported cluster key type: ") + column.type()->ToString());
+    }
+    return ranks;
+}
+
+// Stable sort of table rows by keys (columns missing from table are ignored)
+std::shared_ptr<arrow::Table> cluster_table(const std::shared_ptr<arrow::Table>& table, 
+                                            const std::vector<std::string>& keys) 
+{
+    std::shared_ptr<arrow::Table> ctable;
+    PARQUET_ASSIGN_OR_THROW(ctable, table->CombineChunks());
+    std::int64_t nrows = ctable->num_rows();
+    if (nrows < 2) return ctable;
+
+    std::vector<std::vector<std::int64_t>> ranks;
+    for (const std::string& key : keys) {
+        std::shared_ptr<arrow::ChunkedArray> column = ctable->GetColumnByName(key);
+        if (column != nullptr) ranks.push_back(_key_ranks(*column->chunk(0)));
+    }
+    if (ranks.empty()) return ctable;
+
+    std::vector<std::int64_t> order(nrows);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&ranks](std::int64_t a, std::int64_t b) {
+        for (const std::vector<std::int64_t>& rank : ranks) 
+            if (rank[a] != rank[b]) return rank[a] < rank[b];
+        return false;
+    });
+
+    // Gather columns in sorted order, copying runs of consecutive rows at once
+    std::vector<std::shared_ptr<arrow::Array>> tcolumns;
+    for (const std::shared_ptr<arrow::ChunkedArray>& column : ctable->columns()) {
+        std::unique_ptr<arrow::ArrayBuilder> builder;
+        PARQUET_ASSIGN_OR_THROW(builder, arrow::MakeBuilder(column->type()));
+        PARQUET_THROW_NOT_OK(builder->Reserve(nrows));
+
+        arrow::ArraySpan span(*column->chunk(0)->data());
+        for (std::int64_t i = 0, j; i < nrows; i = j) {
+            for (j = i + 1; j < nrows && order[j] == order[j - 1] + 1; ++j);
+            PARQUET_THROW_NOT_OK(builder->AppendArraySlice(span, order[i], j - i));
+        }
+
+        std::shared_ptr<arrow::Array> carray;
+        PARQUET_THROW_NOT_OK(builder->Finish(&carray));
+        tcolumns.push_back(carray);
+    }
+    return arrow::Table::Make(ctable->schema(), tcolumns);
+}
+
+// Bloom filters of column cindex per row group (nullptr: none): written in the file,
+// or with older Arrow read from the <parquet_stem>_bloom.parquet sidecar (see _write_bloom_sidecar)
+static std::vector<std::unique_ptr<parquet::BloomFilter>> _read_bloom_filters(
+    parquet::ParquetFileReader& reader, const std::string& parquet_fname, int cindex)
+{
+    std::vector<std::unique_ptr<parquet::BloomFilter>> blooms(reader.metadata()->num_row_groups());
+    #if ARROW_VERSION_MAJOR >= BLOOM_FILTER_ARROW_VERSION
+    for (size_t i = 0; i < blooms.size(); ++i) {
+        std::shared_ptr<parquet::RowGroupBloomFilterReader> rg_bloom = reader.GetBloomFilterReader().RowGroup(i);
+        if (rg_bloom != nullptr) blooms[i] = rg_bloom->GetColumnBloomFilter(cindex);
+    }
+    #else
+    boost::filesystem::path pbloom(parquet_fname);
+    pbloom = pbloom.parent_path() / (pbloom.stem().string() + "_bloom" + pbloom.extension().string());
+    if (!boost::filesystem::exists(pbloom)) return blooms;
+
+    std::shared_ptr<arrow::io::ReadableFile> infile;
+    PARQUET_ASSIGN_OR_THROW(infile, arrow::io::ReadableFile::Open(pbloom.string()));
+    std::unique_ptr<parquet::arrow::FileReader> bloom_reader;
+    PARQUET_ASSIGN_OR_THROW(bloom_reader, parquet::arrow::OpenFile(infile, arrow::default_memory_pool()));
+    std::shared_ptr<arrow::Table> table;
+    PARQUET_ASSIGN_OR_THROW(table, bloom_reader->ReadTable());
+    PARQUET_ASSIGN_OR_THROW(table, table->CombineChunks());
+    if (table->num_rows() == 0) return blooms;
+
+    const std::string& column = reader.metadata()->schema()->Column(cindex)->name();
+    const arrow::Int32Array& rgroups = static_cast<const arrow::Int32Array&>(*table->column(0)->chunk(0));
+    const arrow::StringArray& columns = static_cast<const arrow::StringArray&>(*table->column(1)->chunk(0));
+    const arrow::BinaryArray& filters = static_cast<const arrow::BinaryArray&>(*table->column(2)->chunk(0));
+    for (std::int64_t k = 0; k < table->num_rows(); ++k) {
+        if (columns.GetView(k) != column || rgroups.Value(k) < 0 || rgroups.Value(k) >= blooms.size()) continue;
+        arrow::io::BufferReader filter_stream(std::make_shared<arrow::Buffer>(filters.GetView(k)));
+        blooms[rgroups.Value(k)].reset(new parquet::BlockSplitBloomFilter(
+            parquet::BlockSplitBloomFilter::Deserialize(parquet::default_reader_properties(), &filter_stream)));
+    }
+    #endif
+    return blooms;
+}
+
+// Pages of column a reader must read to find rows equal to value, using the page 
+// index (per page min/max) and bloom filters (per row group), over all row groups.
+// Integer and timestamp columns take value as raw integer (ticks since epoch).
+std::pair<int, int> scan_pages(const std::string& parquet_fname, const std::string& column, 
+                               const std::string& value) 
+{
+    std::unique_ptr<parquet::ParquetFileReader> reader = parquet::ParquetFileReader::OpenFile(parquet_fname);
+    std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
+    int cindex = metadata->schema()->ColumnIndex(column);
+    if (cindex < 0) throw std::runtime_error("ERROR unknown parquet column: " + column);
+
+    parquet::Type::type ptype = metadata->schema()->Column(cindex)->physical_type();
+    bool is_bytes = (ptype == parquet::Type::BYTE_ARRAY);
+    parquet::ByteArray bvalue(static_cast<std::uint32_t>(value.size()), 
+        reinterpret_cast<const std::uint8_t*>(value.data()));
+    std::int64_t ivalue = is_bytes ? 0 : std::stoll(value);
+
+    int pages_read = 0, pages_total = 0;
+    std::vector<std::unique_ptr<parquet::BloomFilter>> blooms = _read_bloom_filters(*reader, parquet_fname, cindex);
+    std::shared_ptr<parquet::PageIndexReader> pindex_reader = reader->GetPageIndexReader();
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+        std::shared_ptr<parquet::RowGroupPageIndexReader> rg_pindex = 
+            (pindex_reader == nullptr) ? nullptr : pindex_reader->RowGroup(i);
+        std::shared_ptr<parquet::ColumnIndex> col_index = 
+            (rg_pindex == nullptr) ? nullptr : rg_pindex->GetColumnIndex(cindex);
+        if (col_index == nullptr) throw std::runtime_error("ERROR no page index: " + parquet_fname);
+
+        const std::vector<bool>& null_pages = col_index->null_pages();
+        pages_total += null_pages.size();
+
+        // Bloom filter rules out the whole column chunk
+        const std::unique_ptr<parquet::BloomFilter>& bloom = blooms[i];
+        if (bloom != nullptr && !bloom->FindHash(is_bytes ? bloom->Hash(&bvalue) : (ptype == parquet::Type::INT32) ? 
+            bloom->Hash(static_cast<std::int32_t>(ivalue)) : bloom->Hash(ivalue))) continue;
+
+        // Page min/max (PLAIN encoded) rule out single pages
+        for (size_t p = 0; p < null_pages.size(); ++p) {
+            if (null_pages[p]) continue;
+            const std::string& emin = col_index->encoded_min_values()[p];
+            const std::string& emax = col_index->encoded_max_values()[p];
+            if (is_bytes) pages_read += (emin <= value && value <= emax);
+            else {
+                std::int64_t vmin = 0, vmax = 0;
+                if (emin.size() == sizeof(std::int32_t)) {
+                    std::int32_t vmin32, vmax32;
+                    std::memcpy(&vmin32, emin.data(), sizeof(vmin32)); std::memcpy(&vmax32, emax.data(), sizeof(vmax32));
+                    vmin = vmin32; vmax = vmax32;
+                }
+                else { std::memcpy(&vmin, emin.data(), sizeof(vmin)); std::memcpy(&vmax, emax.data(), sizeof(vmax)); }
+                pages_read += (vmin <= ivalue && ivalue <= vmax);
+            }
+        }
+    }
+    return std::make_pair(pages_read, pages_total);
+}
+
+parquet::Compression::type parse_compression(const std::string& codec) 
+{
+    if (codec == "none" || codec == "uncompressed") return parquet::Compression::UNCOMPRESSED;
+    else if (codec == "snappy") return parquet::Compression::SNAPPY;
+    else if (codec == "gzip") return parquet::Compression::GZIP;
+    else if (codec == "brotli") return parquet::Compression::BROTLI;
+    else if (codec == "zstd") return parquet::Compression::ZSTD;
+    else if (codec == "lz4") return parquet::Compression::LZ4;
+    throw std::runtime_error(std::string("ERROR unknown parquet compression: ") + codec);
+}
+
+arrow::Compression::type parse_ipc_compression(const std::string& codec) 
+{
+    if (codec == "uncompressed") return arrow::Compression::UNCOMPRESSED;
+    else if (codec == "lz4") return arrow::Compression::LZ4_FRAME;
+    else if (codec == "zstd") return arrow::Compression::ZSTD;
+    throw std::runtime_error(std::string("ERROR unknown arrow ipc compression: ") + codec);
+}
+
+std::string output_extension() 
+{
+    return (CONFIG.exists("output_format") && CONFIG["output_format"] == "arrow") ? ".arrow" : ".parquet";
+}
+
+std::unique_ptr<ShmRingWriter> make_shm_ring(const std::string& name)
+{
+    std::uint32_t nslots = CONFIG.exists("shm_slots") ? std::stoul(CONFIG["shm_slots"]) : SHM_RING_SLOTS;
+    std::uint64_t slot_bytes = CONFIG.exists("shm_slot_bytes") ? std::stoull(CONFIG["shm_slot_bytes"]) : SHM_SLOT_BYTES;
+    return std::unique_ptr<ShmRingWriter>(new ShmRingWriter(name, nslots, slot_bytes));
+}
+
+parquet::Encoding::type parse_encoding(const std::string& encoding) 
+{
+    if (encoding == "PLAIN") return parquet::Encoding::PLAIN;
+    else if (encoding == "DELTA_BINARY_PACKED") return parquet::Encoding::DELTA_BINARY_PACKED;
+    else if (encoding == "DELTA_LENGTH_BYTE_ARRAY") return parquet::Encoding::DELTA_LENGTH_BYTE_ARRAY;
+    else if (encoding == "DELTA_BYTE_ARRAY") return parquet::Encoding::DELTA_BYTE_ARRAY;
+    else if (encoding == "BYTE_STREAM_SPLIT") return parquet::Encoding::BYTE_STREAM_SPLIT;
+    throw std::runtime_error(std::string("ERROR unknown parquet encoding: ") + encoding);
 }
 
 // Note: does NOT re-parse config file
 void FitTransformer::_reset_state() {
+    _stop_writer(true);
+    _collect_stats();
     time_created = FIT_DATE_TIME_INVALID;
     manufacturer_index = FIT_MANUFACTURER_INVALID;
     product_index = FIT_UINT16_INVALID;
+    last_timestamp = FIT_DATE_TIME_INVALID;
+    hrv_anchor = FIT_DATE_TIME_INVALID;
+    hrv_clock = 0;
+    last_mesg_num = FIT_MESG_NUM_INVALID;
+    staged_rows = 0;
     source_filename.clear();
     source_file_uri.clear();
     manufacturer_name.clear();
     product_name.clear();
 
     for (auto bpair : builders) bpair.second->Reset();
-}
-
-int main(int argc, char* argv[])
-{
-   int retstatus = 1;
-   if (argc == 3) {
-        FitTransformer transformer;
-        auto tstart = std::chrono::system_clock::now();
-        retstatus = transformer.fit_to_parquet(argv[1], argv[2]);
-        std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now()-tstart;
-        if (retstatus == 0) std::cout << "Data transformation completed in " 
-            << elapsed_seconds.count() << "sec" << std::endl;
-   }
-   else std::cerr << "Usage: fitparquet <fitfile> <parquetfile>" << std::endl;
-   return retstatus;
+    for (auto bpair : hrbuilders) bpair.second->Reset();
+    row_groups.clear();
 }
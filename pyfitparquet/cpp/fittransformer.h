@@ -3,31 +3,153 @@
 
 #include "fit.hpp"
 #include "fit_mesg_listener.hpp"
+#include "fit_file_id_mesg.hpp"
+#include "fit_decode.hpp"
 
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <thread>
 #include <arrow/api.h>
-#define ROW_GROUP_SIZE 20000
+#include <parquet/arrow/writer.h>
+#include <parquet/properties.h>
+#include "fitshm.h"
+#include "fitsource.h"
+#include "spscqueue.h"
+#include "stageclock.h"
+
+#define ROW_GROUP_BYTES 134217728 // Default uncompressed row group budget (128MB)
+#define BLOOM_FILTER_FPP 0.05 // Bloom filter false positive probability
+#define BLOOM_FILTER_NDV 4096 // Bloom filter sizing, distinct values per row group (name columns)
+#define BLOOM_FILTER_ARROW_VERSION 22 // First Arrow writing bloom filters natively
+#define ESTIMATED_VALUE_CHARS 6 // Builder pre-sizing: assumed chars per numeric value string
+#define DECODE_CHUNK_BYTES 4194304 // Default minimum FIT bytes per parallel decode chunk
+#define CHECKPOINT_EXTENSION ".fitckpt" // Incremental decode state, beside the part files
+#define FOLLOW_FLUSH_MS 1000 // Tail mode: flush staged rows at least every second,
+#define FOLLOW_FLUSH_ROWS 100000 // or as soon as this many rows are staged
+#define FOLLOW_IDLE_SECONDS 30 // Tail mode: stop following a regular file idle this long
+#define FOLLOW_POLL_MS 100 // Tail mode: regular file re-read interval at end of file
+#define READER_BATCH_ROWS 65536 // Default rows per record batch of fit_to_reader()
+#define POOL_STATS_ARROW_VERSION 13 // First Arrow counting memory pool allocations
 
 typedef std::shared_ptr<arrow::ArrayBuilder> pBuilder;
 enum FIELD_TYPE { INT_VALUE, FLOAT_VALUE, STRING_VALUE };
 
-class FitTransformer : public fit::MesgListener
+// Per-file transform statistics (main table), reset on each FIT file
+struct TransformStats 
+{
+    std::int64_t rows = 0;
+    std::int64_t string_bytes = 0;
+
+    // Skip-scan estimates used to pre-size builders
+    std::int64_t estimated_rows = 0;
+    std::int64_t estimated_string_bytes = 0;
+
+    // FIT bytes decoded, mesgs received and mesgs dropped (Manufacturer/Product invalid)
+    std::int64_t fit_bytes = 0;
+    std::int64_t mesgs = 0;
+    std::int64_t dropped_mesgs = 0;
+
+    // Collected only when enabled (collect_stats config, set_collect_stats()):
+    // mesgs per global mesg num, Arrow memory pool allocations and bytes, and
+    // exclusive seconds per STAGE, summed over threads (parallel decode, writer)
+    bool collected = false;
+    std::map<FIT_UINT16, std::int64_t> mesg_counts;
+    std::int64_t allocations = 0;
+    std::int64_t allocated_bytes = 0;
+    double stage_seconds[NUM_STAGES] = {};
+
+    // Name of a STAGE, as used in to_json()
+    static const char* stage_name(int stage);
+
+    // mesg_counts by mesg name (unknown mesg nums summed as "unknown")
+    std::map<std::string, std::int64_t> mesg_name_counts() const;
+
+    // Adds stage seconds, counters and mesg counts (not rows/estimates) of other
+    void add_collected(const TransformStats& other);
+
+    std::string to_json() const;
+};
+
+// Tail (--follow) mode latency budget and batch file format
+struct FollowOptions
+{
+    std::int64_t flush_ms = FOLLOW_FLUSH_MS;
+    std::int64_t flush_rows = FOLLOW_FLUSH_ROWS;
+    std::int64_t idle_seconds = FOLLOW_IDLE_SECONDS;
+    bool arrow_ipc = false; // Arrow IPC files (.arrow) instead of Parquet
+};
+
+class FitTransformer : public fit::MesgListener, public fit::ExpansionListener
 {
 public:
 
     FitTransformer();
 
-    // The public FIT => Parquet function (resets transformer on completion)
+    // The public FIT => Parquet function (resets transformer on completion). With 
+    // output_format: arrow (config), writes an Arrow IPC file instead
     int fit_to_parquet(const char fit_fname[], const char parquet_fname[]);
 
+    // As fit_to_parquet, but an error is returned in error instead of printed
+    int fit_to_parquet(const char fit_fname[], const char parquet_fname[], std::string& error);
+
+    // Zip archive => one Parquet file per FIT member (.fit, .fit.gz, .fit.zst), written as 
+    // <parquet_dir>/<member dirs>/<member stem><output_extension()>. Members are decompressed in memory
+    // and converted zip_threads (config) at a time, each thread by a transformer of its own. Returns 0 
+    // if all FIT members converted, 1 (none converted) if two share an output (resets transformer on completion)
+    int zip_to_parquet(const char zip_fname[], const char parquet_dir[]);
+
+    // Converts sources[i] => parquet_fnames[i] on up to nthreads threads (0: one per core), 
+    // each with a transformer of its own, decoding sources unchunked. Returns whether each 
+    // source converted (errors are printed)
+    static std::vector<bool> convert_sources(const std::vector<FitSource>& sources, 
+                                             const std::vector<std::string>& parquet_fnames, int nthreads);
+
+    // Incremental FIT => Parquet for a growing FIT file: decodes the records added since
+    // the checkpoint in parquet_dir into a new part file <fit_stem>_<byte offset>.parquet,
+    // then advances the checkpoint (resets transformer on completion)
+    int fit_append_parquet(const char fit_fname[], const char parquet_dir[]);
+
+    // Tails a growing FIT file, a FIFO or stdin ("-") until the FIT file completes, the
+    // stream closes or the file idles. Rows are flushed within the options' latency budget
+    // to new batch files <out_prefix>_<n>.parquet (resets transformer on completion)
+    int fit_follow(const char fit_fname[], const char out_prefix[], 
+                   const FollowOptions& options = FollowOptions());
+
+    // FIT => arrow::Table (main table only, resets transformer on completion, throws on error)
+    std::shared_ptr<arrow::Table> fit_to_table(const char fit_fname[]);
+
+    // FIT => lazy record batches of about batch_rows rows (main table only, see FitBatchReader),
+    // decoded by a transformer of the reader's own (throws on open/integrity error)
+    std::shared_ptr<arrow::RecordBatchReader> fit_to_reader(const char fit_fname[], 
+                                                            std::int64_t batch_rows = READER_BATCH_ROWS);
+
+    // FIT => record batches of about batch_rows rows (main table only) published to ring, for
+    // a reader process to map without copying (see ShmRingWriter). Returns 0 on success
+    int fit_to_shm(const char fit_fname[], ShmRingWriter& ring, std::int64_t batch_rows = READER_BATCH_ROWS);
+
     // Re-parse configuration file
     void reset_from_config();
 
+    // Statistics of the last transformed file
+    const TransformStats& get_stats() const { return stats; }
+
+    // Collects per-stage statistics even if the collect_stats config is false
+    void set_collect_stats(bool enable) { collect_stats = enable; }
+
     // MesgListener callback override,
     // meant for fit::MesgBroadcasters only
     void OnMesg(fit::Mesg& mesg) override;
 
+    // ExpansionListener callback override (set on decoders while collecting stats)
+    void OnExpansion(FIT_BOOL begin) override;
+
 private:
 
+    friend class FitBatchReader;
+    friend class FitBench;
+
     // Source file name/uri (type is always: FIT)
     std::string source_filename;
     std::string source_file_uri;
@@ -45,8 +167,66 @@ private:
     std::unordered_map<std::string, bool> excludeflags;
     std::unordered_map<std::string, pBuilder> builders;
 
+    // High-rate sensor table config/staging objects (one row per array sample)
+    bool expand_sensor_arrays;
+    FIT_DATE_TIME last_timestamp;
+    FIT_DATE_TIME hrv_anchor; // last_timestamp the HRV beat clock last synced to
+    std::int64_t hrv_clock; // Time of the last HRV beat (high-rate timestamp units)
+    std::vector<std::string> hrcolkeys;
+    std::unordered_map<std::string, pBuilder> hrbuilders;
+
+    // Timestamp column resolution (timestamp_unit: s, ms or us)
+    arrow::TimeUnit::type timestamp_unit;
+    std::int64_t timestamp_scale;
+    std::int64_t epoch_seconds;
+
+    // Closed row groups (main table), sized by uncompressed byte budget
+    std::int64_t row_group_bytes;
+    FIT_UINT16 last_mesg_num;
+    std::vector<std::shared_ptr<arrow::Table>> row_groups;
+
+    // Chunk workers (see _decode_chunks) leave row groups to the caller: each
+    // _check_row_group marks its mesg, and the rows and bytes staged before it
+    struct RowGroupMark { FIT_UINT16 mesg_num; std::int64_t rows; std::int64_t nbytes; };
+    bool mark_row_groups;
+    std::vector<RowGroupMark> row_group_marks;
+
+    // Rows staged since the last row group (file-constant columns have no builders)
+    std::int64_t staged_rows;
+
+    // Columns the written table is sorted by (empty == arrival order)
+    std::vector<std::string> cluster_keys;
+
+    // Columns written with bloom filters
+    std::vector<std::string> bloom_columns;
+
+    // Output files as Arrow IPC (output_format: arrow) instead of Parquet, and their codec
+    bool ipc_output;
+    arrow::Compression::type ipc_compression;
+
+    // Background row group writer (see pipeline_writer config)
+    std::unique_ptr<SpscQueue<std::shared_ptr<arrow::Table>>> wqueue;
+    std::unique_ptr<parquet::arrow::FileWriter> pwriter;
+    std::thread wthread;
+    std::string wfname;
+    std::atomic<bool> writer_abort;
+    std::exception_ptr writer_error;
+
+    // Statistics, estimated string bytes per column (see _estimate_rows)
+    TransformStats stats;
+    std::unordered_map<std::string, std::int64_t> estimated_nbytes;
+
+    // Stage timers (decoding thread, background writer) and Arrow pool counters at file start
+    bool collect_stats;
+    StageClock stage_clock;
+    StageClock writer_clock;
+    STAGE expand_left;
+    std::int64_t pool_allocations;
+    std::int64_t pool_bytes;
+
     // Generates schema based on parquet_config.yml
     std::shared_ptr<arrow::Schema> _get_schema();
+    std::shared_ptr<arrow::Schema> _get_highrate_schema();
 
     // Internally used helper fncs
     void _init_from_config(std::unordered_map<std::string, bool> &cflags,
@@ -56,9 +236,96 @@ private:
     std::tuple<FIELD_TYPE, FIT_SINT64, FIT_FLOAT64> _get_field_type(
         const fit::FieldBase& field, const std::string &sval, FIT_UINT8 j);
     void _append_mesg_fields(fit::Mesg& mesg);
-    void _append_field_fields(const fit::FieldBase& field, const std::string &sval, FIT_UINT8 j);
+    void _append_field_fields(const fit::FieldBase& field, const std::string &sval, FIT_UINT8 j,
+                              fit::Profile::Type etype);
+    void _set_file_id(const fit::FileIdMesg& fit_mesg);
+    void _open_fit(std::unique_ptr<std::istream>& fit_fhandle, fit::Decode& fit_decoder, FitSource& source);
+    void _decode_fit(FitSource& source, const char parquet_fname[] = nullptr, bool chunked = true);
+    bool _decode_chunks(std::istream& fit_fhandle, const FitSource& source);
+    void _append_fit(const char fit_fname[], const char parquet_dir[]);
+    std::string _save_checkpoint(const fit::Decode::Checkpoint& checkpoint);
+    std::string _load_checkpoint(const std::string& blob);
+    void _follow_fit(const char fit_fname[], const char out_prefix[], const FollowOptions& options);
+    std::string _flush_batch(const std::string& out_prefix, int nbatch, bool arrow_ipc);
+    bool _expand_sensor_mesg(fit::Mesg& mesg);
+    std::int64_t _to_timestamp(FIT_DATE_TIME fit_datetime, std::int64_t scale);
+    std::int64_t _highrate_timestamp_scale();
+    void _estimate_rows(std::istream& fit_fhandle);
+    void _reserve_builders();
+    void _start_stats();
+    void _collect_stats();
+    void _check_row_group(FIT_UINT16 mesg_num);
+    std::int64_t _builders_byte_size();
+    std::shared_ptr<arrow::Scalar> _get_file_constant(const std::string& cname);
+    std::shared_ptr<arrow::Table> _finish_table();
+    void _stage_rows(const std::shared_ptr<arrow::Table>& table, std::int64_t offset, std::int64_t nrows);
+    std::shared_ptr<parquet::WriterProperties> _get_writer_properties(
+        const std::shared_ptr<arrow::Schema>& schema, const std::vector<std::string>& sort_keys);
+    void _emit_row_group(const std::shared_ptr<arrow::Table>& table);
+    void _start_writer(const char parquet_fname[]);
+    void _run_writer();
+    void _stop_writer(bool abort);
     void _write_parquet(const char parquet_fname[]);
+    void _write_highrate_parquet(const char parquet_fname[]);
+    std::shared_ptr<arrow::Table> _finish_highrate_table();
+    std::vector<std::shared_ptr<arrow::Table>> _slice_row_groups(const std::shared_ptr<arrow::Table>& table);
+    std::unique_ptr<parquet::arrow::FileWriter> _open_writer(const std::shared_ptr<arrow::Schema>& schema, 
+        const std::string& parquet_fname, const std::vector<std::string>& sort_keys, StageClock& clock);
+    void _write_table(const std::vector<std::shared_ptr<arrow::Table>>& tables, 
+                      const std::string& parquet_fname, 
+                      const std::vector<std::string>& sort_keys = std::vector<std::string>());
+    void _write_ipc(const std::vector<std::shared_ptr<arrow::Table>>& tables, const std::string& ipc_fname);
+    std::shared_ptr<arrow::Table> _bloom_sidecar_rows(const arrow::Table& table, int rgroup);
+    void _write_bloom_sidecar(const std::vector<std::shared_ptr<arrow::Table>>& sidecar_rows, 
+                              const std::string& parquet_fname);
     void _reset_state();
 };
 
+// Lazy FIT => arrow::RecordBatch reader (main table). Each ReadNext() resumes the decoder
+// only until another batch_rows rows are staged (paused from OnMesg), so a consumer that 
+// stops early never decodes, or holds, the rest of the file.
+class FitBatchReader : public arrow::RecordBatchReader, public fit::MesgListener
+{
+public:
+
+    FitBatchReader(const char fit_fname[], std::int64_t batch_rows);
+
+    std::shared_ptr<arrow::Schema> schema() const override { return rschema; }
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override;
+    arrow::Status Close() override;
+
+    // Forwards to the transformer, pausing the decoder once a batch is staged
+    void OnMesg(fit::Mesg& mesg) override;
+
+private:
+
+    FitTransformer transformer;
+    std::unique_ptr<std::istream> fit_fhandle;
+    fit::Decode fit_decoder;
+    std::shared_ptr<arrow::Schema> rschema;
+    std::int64_t batch_rows;
+    bool started;
+    bool finished;
+    std::deque<std::shared_ptr<arrow::RecordBatch>> batches;
+};
+
+// Config value => parquet enum parsers (throw std::runtime_error if unknown)
+parquet::Compression::type parse_compression(const std::string& codec);
+parquet::Encoding::type parse_encoding(const std::string& encoding);
+arrow::Compression::type parse_ipc_compression(const std::string& codec);
+
+// Output file extension by output_format config: ".arrow" (Arrow IPC) or ".parquet"
+std::string output_extension();
+
+// Shared-memory ring name sized by the shm_slots and shm_slot_bytes config (throws on error)
+std::unique_ptr<ShmRingWriter> make_shm_ring(const std::string& name);
+
+// Stable sort of table rows by the given key columns (see cluster_rows config)
+std::shared_ptr<arrow::Table> cluster_table(const std::shared_ptr<arrow::Table>& table, 
+                                            const std::vector<std::string>& keys);
+
+// (pages to read, pages total) for a column == value lookup via page index/bloom filters
+std::pair<int, int> scan_pages(const std::string& parquet_fname, const std::string& column, 
+                               const std::string& value);
+
 #endif // defined(FITTRANSFORMER_H)
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <parquet/exception.h>
+
+#include "fittransformer.h"
+#include "fitdaemon.h"
+#include "fitbatch.h"
+#include "fitshm.h"
+
+
+// Tail mode: --follow <fitfile|fifo|-> <out_prefix> [--flush-ms N] [--flush-rows N] ...
+static bool _parse_follow_options(int argc, char* argv[], FollowOptions& options)
+{
+    try {
+        for (int i = 4; i < argc; i += 2) {
+            std::string option = argv[i], value = (i + 1 < argc) ? argv[i + 1] : "";
+            if (option == "--flush-ms") options.flush_ms = std::stoll(value);
+            else if (option == "--flush-rows") options.flush_rows = std::stoll(value);
+            else if (option == "--idle-seconds") options.idle_seconds = std::stoll(value);
+            else if (option == "--format" && (value == "parquet" || value == "arrow")) 
+                options.arrow_ipc = (value == "arrow");
+            else return false;
+        }
+    }
+    catch (const std::exception&) { return false; }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+   int retstatus = 1;
+   FollowOptions options;
+   if (argc >= 4 && std::string(argv[1]) == "--follow" && _parse_follow_options(argc, argv, options)) {
+        FitTransformer transformer;
+        retstatus = transformer.fit_follow(argv[2], argv[3], options);
+   }
+   else if (argc == 4 && std::string(argv[1]) == "--stats") {
+        FitTransformer transformer;
+        transformer.set_collect_stats(true);
+        retstatus = transformer.fit_to_parquet(argv[2], argv[3]);
+        if (retstatus == 0) std::cout << transformer.get_stats().to_json() << std::endl;
+   }
+   else if (argc == 4 && std::string(argv[1]) == "--zip") {
+        FitTransformer transformer;
+        retstatus = transformer.zip_to_parquet(argv[2], argv[3]);
+   }
+   else if ((argc == 3 || (argc == 5 && std::string(argv[3]) == "--threads")) && std::string(argv[1]) == "--serve") {
+        FitDaemon daemon(argv[2], (argc == 5) ? std::atoi(argv[4]) : 0);
+        retstatus = daemon.serve();
+   }
+   else if ((argc == 4 || (argc == 6 && std::string(argv[4]) == "--shard")) && std::string(argv[1]) == "--batch") {
+        ShardSpec shard;
+        if (argc == 4 || parse_shard(argv[5], shard)) retstatus = batch_to_parquet(argv[2], argv[3], shard);
+        else std::cerr << "ERROR invalid shard (expected <index>/<count>, 0 <= index < count): " << argv[5] << std::endl;
+   }
+   else if (argc >= 4 && std::string(argv[1]) == "--shm") {
+        try {
+            std::unique_ptr<ShmRingWriter> ring = make_shm_ring(argv[2]);
+            FitTransformer transformer;
+            retstatus = 0;
+            for (int i = 3; i < argc; ++i) {
+                if (transformer.fit_to_shm(argv[i], *ring) != 0) retstatus = 1;
+            }
+            if (!ring->close()) {
+                std::cerr << "ERROR reader did not release all batches of shared memory ring " << argv[2] << std::endl;
+                retstatus = 1;
+            }
+        }
+        catch (const std::exception& e) { std::cerr << e.what() << std::endl; retstatus = 1; }
+   }
+   else if (argc == 3 && std::string(argv[1]) == "--shm-read") {
+        try {
+            ShmRingReader reader(argv[2]);
+            std::shared_ptr<arrow::RecordBatch> batch;
+            std::int64_t nbatches = 0, nrows = 0;
+            while (true) {
+                PARQUET_THROW_NOT_OK(reader.ReadNext(&batch));
+                if (batch == nullptr) break;
+                nbatches += 1;
+                nrows += batch->num_rows();
+            }
+            std::cout << "Read " << nbatches << " batches, " << nrows << " rows" << std::endl;
+            retstatus = 0;
+        }
+        catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+   }
+   else if (argc == 3 && std::string(argv[1]) == "--merge-manifests") {
+        retstatus = merge_manifests(argv[2]);
+   }
+   else if (argc == 3) {
+        FitTransformer transformer;
+        auto tstart = std::chrono::system_clock::now();
+        retstatus = transformer.fit_to_parquet(argv[1], argv[2]);
+        std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now()-tstart;
+        if (retstatus == 0) std::cout << "Data transformation completed in " 
+            << elapsed_seconds.count() << "sec" << std::endl;
+   }
+   else std::cerr << "Usage: fitparquet [--stats] <fitfile[.gz|.zst]> <parquetfile>" << std::endl
+        << "       fitparquet --zip <zipfile> <parquet_dir>" << std::endl
+        << "       fitparquet --batch <data_dir> <parquet_dir> [--shard <index>/<count>]" << std::endl
+        << "       fitparquet --merge-manifests <parquet_dir>" << std::endl
+        << "       fitparquet --serve <socket> [--threads N]" << std::endl
+        << "       fitparquet --shm <ring_name> <fitfile> [<fitfile> ...]" << std::endl
+        << "       fitparquet --shm-read <ring_name>" << std::endl
+        << "       fitparquet --follow <fitfile|fifo|-> <out_prefix> [--flush-ms N] [--flush-rows N]"
+        << " [--idle-seconds N] [--format parquet|arrow]" << std::endl;
+   return retstatus;
+}
@@ -1,10 +1,87 @@
 #include "fittransformer.h"
+#include "config.h"
+#include <arrow/c/bridge.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 
+// Lazy FIT record batches (or the batches of a shared-memory ring), exported over the Arrow C stream interface through the
+// PyCapsule protocol (__arrow_c_stream__): pyarrow.RecordBatchReader.from_stream,
+// duckdb and polars consume it directly. The stream can be consumed once.
+struct FitBatchStream
+{
+    std::shared_ptr<arrow::RecordBatchReader> reader;
+};
+
+static void _release_stream_capsule(PyObject* capsule)
+{
+    auto stream = static_cast<ArrowArrayStream*>(PyCapsule_GetPointer(capsule, "arrow_array_stream"));
+    if (stream->release != nullptr) stream->release(stream);
+    delete stream;
+}
+
+static pybind11::object _export_stream(FitBatchStream& fstream, pybind11::object requested_schema)
+{
+    if (fstream.reader == nullptr) throw std::runtime_error("ERROR FIT batch stream already consumed");
+
+    ArrowArrayStream* stream = new ArrowArrayStream();
+    arrow::Status status = arrow::ExportRecordBatchReader(fstream.reader, stream);
+    fstream.reader.reset();
+    if (!status.ok()) {
+        delete stream;
+        throw std::runtime_error(status.ToString());
+    }
+    return pybind11::reinterpret_steal<pybind11::object>(
+        PyCapsule_New(stream, "arrow_array_stream", _release_stream_capsule));
+}
+
 PYBIND11_MODULE(fittransformer_so, m) {
+    pybind11::class_<TransformStats>(m, "TransformStats")
+        .def_readonly("rows", &TransformStats::rows)
+        .def_readonly("string_bytes", &TransformStats::string_bytes)
+        .def_readonly("estimated_rows", &TransformStats::estimated_rows)
+        .def_readonly("estimated_string_bytes", &TransformStats::estimated_string_bytes)
+        .def_readonly("fit_bytes", &TransformStats::fit_bytes)
+        .def_readonly("mesgs", &TransformStats::mesgs)
+        .def_readonly("dropped_mesgs", &TransformStats::dropped_mesgs)
+        .def_readonly("collected", &TransformStats::collected)
+        .def_readonly("allocations", &TransformStats::allocations)
+        .def_readonly("allocated_bytes", &TransformStats::allocated_bytes)
+        .def_property_readonly("mesg_counts", &TransformStats::mesg_name_counts)
+        .def_property_readonly("stage_seconds", [](const TransformStats& stats) {
+            pybind11::dict seconds;
+            for (int k = 0; k < NUM_STAGES; ++k) seconds[TransformStats::stage_name(k)] = stats.stage_seconds[k];
+            return seconds; })
+        .def("to_json", &TransformStats::to_json);
+
+    pybind11::class_<FitBatchStream>(m, "FitBatchStream")
+        .def("__arrow_c_stream__", &_export_stream, pybind11::arg("requested_schema") = pybind11::none());
+
+    pybind11::class_<ShmRingWriter>(m, "ShmRingWriter")
+        .def(pybind11::init(&make_shm_ring), pybind11::arg("name"))
+        .def("close", &ShmRingWriter::close, pybind11::arg("drain_ms") = SHM_DRAIN_MS,
+            pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("published", &ShmRingWriter::published);
+
     pybind11::class_<FitTransformer>(m, "FitTransformer")
         .def(pybind11::init<>())
-        .def("fit_to_parquet", &FitTransformer::fit_to_parquet)
+        .def("fit_to_parquet", static_cast<int (FitTransformer::*)(const char[], const char[])>(&FitTransformer::fit_to_parquet))
+        .def("fit_append_parquet", &FitTransformer::fit_append_parquet)
+        .def("zip_to_parquet", &FitTransformer::zip_to_parquet, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("get_stats", &FitTransformer::get_stats)
+        .def("set_collect_stats", &FitTransformer::set_collect_stats)
+        .def("fit_to_stream", [](FitTransformer& transformer, const char* fit_fname, std::int64_t batch_rows) {
+            return FitBatchStream{transformer.fit_to_reader(fit_fname, batch_rows)}; },
+            pybind11::arg("fit_fname"), pybind11::arg("batch_rows") = READER_BATCH_ROWS)
+        .def("fit_to_shm", &FitTransformer::fit_to_shm, pybind11::arg("fit_fname"), pybind11::arg("ring"),
+            pybind11::arg("batch_rows") = READER_BATCH_ROWS, pybind11::call_guard<pybind11::gil_scoped_release>())
         .def("reset_from_config", &FitTransformer::reset_from_config);
+
+    m.def("scan_pages", &scan_pages);
+    m.def("content_hash", &content_hash, pybind11::call_guard<pybind11::gil_scoped_release>());
+    m.def("config_hash", []() { return CONFIG.hash(); });
+    m.def("output_extension", &output_extension);
+    m.def("shm_ring_stream", [](const std::string& name, int timeout_ms) {
+            return FitBatchStream{std::make_shared<ShmRingReader>(name, timeout_ms)}; },
+        pybind11::arg("name"), pybind11::arg("timeout_ms") = -1, pybind11::call_guard<pybind11::gil_scoped_release>());
 }
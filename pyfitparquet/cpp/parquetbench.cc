@@ -0,0 +1,339 @@
+#include <chrono>
+#include <iomanip>
+#include <arrow/io/api.h>
+#include <arrow/ipc/api.h>
+#include <arrow/util/byte_size.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/statistics.h>
+
+#include "fittransformer.h"
+#include "config.h"
+
+// Parquet writer settings benchmark: decodes a FIT corpus once into Arrow tables,
+// then reports output size and encode time (encode, compress and write to memory)
+// for each codec/encoding setting. Row group budget is taken from parquet_config.yml.
+// A second pass compares FIT arrival order with clustered order (see cluster_rows):
+// output size, and time/row groups read for a field_name == QUERY_FIELD_NAME query.
+// A third compares time to first table (open a file, read it whole into an Arrow 
+// table) of Parquet against Arrow IPC output (see output_format), page cache warm.
+
+#define QUERY_FIELD_NAME "heart_rate"
+#define QUERY_ROW_GROUP_BYTES 1048576 // Small row groups so pruning shows on small corpora
+
+struct BenchSetting
+{
+    std::string name;
+    std::shared_ptr<parquet::WriterProperties> props;
+};
+
+static std::vector<BenchSetting> _get_settings()
+{
+    std::vector<std::pair<std::string, std::string>> codecs = {{"none", "default"},
+        {"snappy", "default"}, {"lz4", "default"}, {"gzip", "default"}, {"zstd", "1"}, {"zstd", "9"}};
+
+    std::vector<BenchSetting> settings;
+    for (auto codec : codecs) {
+        for (bool tuned : {false, true}) {
+            parquet::WriterProperties::Builder props;
+            props.compression(parse_compression(codec.first));
+            if (codec.second != "default") props.compression_level(std::stoi(codec.second));
+
+            // Tuned: delta integers/timestamps, byte-split floats
+            if (tuned) {
+                for (const char* cname : {"timestamp", "mesg_index", "field_index"})
+                    props.disable_dictionary(cname)->encoding(cname, parquet::Encoding::DELTA_BINARY_PACKED);
+                props.disable_dictionary("value_float")->encoding("value_float", parquet::Encoding::BYTE_STREAM_SPLIT);
+            }
+
+            std::string level = (codec.second == "default") ? "" : "(" + codec.second + ")";
+            settings.push_back({codec.first + level + (tuned ? "+tuned" : "+dict"), props.build()});
+        }
+    }
+    return settings;
+}
+
+// Writes table to an in-memory parquet file
+static std::shared_ptr<arrow::Buffer> _write_buffer(const arrow::Table& table, std::int64_t row_group_size,
+                                                    const std::shared_ptr<parquet::WriterProperties>& props)
+{
+    std::shared_ptr<arrow::io::BufferOutputStream> sink;
+    PARQUET_ASSIGN_OR_THROW(sink, arrow::io::BufferOutputStream::Create());
+    PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(table, arrow::default_memory_pool(),
+        sink, row_group_size, props));
+    std::shared_ptr<arrow::Buffer> buffer;
+    PARQUET_ASSIGN_OR_THROW(buffer, sink->Finish());
+    return buffer;
+}
+
+// Counts field_name == fname rows (reading field_name, value_float), skipping
+// row groups whose field_name statistics exclude fname. Returns row groups read.
+static int _query_field_name(const std::shared_ptr<arrow::Buffer>& buffer, const std::string& fname,
+                             std::int64_t& nmatches)
+{
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    PARQUET_ASSIGN_OR_THROW(reader, parquet::arrow::OpenFile(
+        std::make_shared<arrow::io::BufferReader>(buffer), arrow::default_memory_pool()));
+
+    std::shared_ptr<parquet::FileMetaData> metadata = reader->parquet_reader()->metadata();
+    int fcol = metadata->schema()->ColumnIndex("field_name");
+    int vcol = metadata->schema()->ColumnIndex("value_float");
+
+    int groups_read = 0;
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+        std::shared_ptr<parquet::Statistics> stats = metadata->RowGroup(i)->ColumnChunk(fcol)->statistics();
+        if (stats != nullptr && stats->HasMinMax() && 
+            (fname < stats->EncodeMin() || fname > stats->EncodeMax())) continue;
+
+        std::shared_ptr<arrow::Table> rgtable;
+        PARQUET_ASSIGN_OR_THROW(rgtable, reader->ReadRowGroup(i, {fcol, vcol}));
+        for (const std::shared_ptr<arrow::Array>& chunk : rgtable->column(0)->chunks()) {
+            const arrow::StringArray& fnames = static_cast<const arrow::StringArray&>(*chunk);
+            for (std::int64_t k = 0; k < fnames.length(); ++k) nmatches += (fnames.GetView(k) == fname);
+        }
+        groups_read += 1;
+    }
+    return groups_read;
+}
+
+static void _bench_clustering(const std::vector<std::shared_ptr<arrow::Table>>& tables,
+                              std::int64_t arrow_bytes, std::int64_t nrows)
+{
+    std::vector<std::string> keys = {"mesg_name", "field_name", "timestamp"};
+    std::int64_t row_group_size = std::max<std::int64_t>(nrows * QUERY_ROW_GROUP_BYTES / arrow_bytes, 1);
+
+    std::cout << std::endl << "Clustering (snappy+tuned, " << QUERY_ROW_GROUP_BYTES << " byte row groups, query "
+        << "field_name == " << QUERY_FIELD_NAME << ")" << std::endl << std::endl;
+    std::cout << std::left << std::setw(20) << "order" << std::right << std::setw(12) << "size_MB"
+        << std::setw(12) << "cluster_ms" << std::setw(12) << "query_ms" << std::setw(14) << "groups_read"
+        << std::setw(12) << "matches" << std::endl;
+
+    for (bool clustered : {false, true}) {
+        parquet::WriterProperties::Builder props;
+        props.compression(parquet::Compression::SNAPPY);
+        props.disable_dictionary("timestamp")->encoding("timestamp", parquet::Encoding::DELTA_BINARY_PACKED);
+        props.disable_dictionary("value_float")->encoding("value_float", parquet::Encoding::BYTE_STREAM_SPLIT);
+
+        // Order and write each table, recording sort keys as sorting_columns
+        double cluster_seconds = 0.0;
+        std::int64_t out_bytes = 0;
+        int groups_total = 0;
+        std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+        for (const std::shared_ptr<arrow::Table>& table : tables) {
+            std::shared_ptr<arrow::Table> otable = table;
+            if (clustered) {
+                auto tstart = std::chrono::steady_clock::now();
+                otable = cluster_table(table, keys);
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - tstart;
+                cluster_seconds += elapsed.count();
+
+                std::vector<parquet::SortingColumn> sorting;
+                for (const std::string& key : keys)
+                    if (otable->schema()->GetFieldIndex(key) >= 0) 
+                        sorting.push_back({otable->schema()->GetFieldIndex(key), false, true});
+                props.set_sorting_columns(sorting);
+            }
+            buffers.push_back(_write_buffer(*otable, row_group_size, props.build()));
+            out_bytes += buffers.back()->size();
+            groups_total += parquet::ReadMetaData(std::make_shared<arrow::io::BufferReader>(buffers.back()))->num_row_groups();
+        }
+
+        // Query, best of 3 runs
+        int groups_read = 0;
+        std::int64_t nmatches = 0;
+        double best_seconds = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            groups_read = 0; nmatches = 0;
+            auto tstart = std::chrono::steady_clock::now();
+            for (const std::shared_ptr<arrow::Buffer>& buffer : buffers)
+                groups_read += _query_field_name(buffer, QUERY_FIELD_NAME, nmatches);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - tstart;
+            if (run == 0 || elapsed.count() < best_seconds) best_seconds = elapsed.count();
+        }
+
+        std::cout << std::left << std::setw(20) << (clustered ? "clustered" : "arrival") << std::right 
+            << std::fixed << std::setprecision(3) << std::setw(12) << out_bytes / 1e6
+            << std::setprecision(1) << std::setw(12) << cluster_seconds * 1e3 
+            << std::setw(12) << best_seconds * 1e3 << std::setw(14) 
+            << (std::to_string(groups_read) + "/" + std::to_string(groups_total)) 
+            << std::setw(12) << nmatches << std::endl;
+    }
+}
+
+// Writes table to an Arrow IPC file, record batches of batch_rows rows
+static void _write_ipc_file(const arrow::Table& table, std::int64_t batch_rows, 
+                            arrow::Compression::type codec, const std::string& ipc_fname)
+{
+    arrow::ipc::IpcWriteOptions options = arrow::ipc::IpcWriteOptions::Defaults();
+    if (codec != arrow::Compression::UNCOMPRESSED) {
+        PARQUET_ASSIGN_OR_THROW(options.codec, arrow::util::Codec::Create(codec));
+    }
+    std::shared_ptr<arrow::io::FileOutputStream> sink;
+    PARQUET_ASSIGN_OR_THROW(sink, arrow::io::FileOutputStream::Open(ipc_fname));
+    std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+    PARQUET_ASSIGN_OR_THROW(writer, arrow::ipc::MakeFileWriter(sink, table.schema(), options));
+    PARQUET_THROW_NOT_OK(writer->WriteTable(table, batch_rows));
+    PARQUET_THROW_NOT_OK(writer->Close());
+    PARQUET_THROW_NOT_OK(sink->Close());
+}
+
+// Opens fname and reads it whole into a table: Parquet decoded, Arrow IPC memory-mapped
+static std::shared_ptr<arrow::Table> _read_first_table(const std::string& fname, bool ipc)
+{
+    std::shared_ptr<arrow::Table> table;
+    if (ipc) {
+        std::shared_ptr<arrow::io::MemoryMappedFile> mapped;
+        PARQUET_ASSIGN_OR_THROW(mapped, arrow::io::MemoryMappedFile::Open(fname, arrow::io::FileMode::READ));
+        std::shared_ptr<arrow::ipc::RecordBatchFileReader> reader;
+        PARQUET_ASSIGN_OR_THROW(reader, arrow::ipc::RecordBatchFileReader::Open(mapped));
+        std::vector<std::shared_ptr<arrow::RecordBatch>> batches(reader->num_record_batches());
+        for (int i = 0; i < reader->num_record_batches(); ++i) {
+            PARQUET_ASSIGN_OR_THROW(batches[i], reader->ReadRecordBatch(i));
+        }
+        PARQUET_ASSIGN_OR_THROW(table, arrow::Table::FromRecordBatches(reader->schema(), batches));
+    }
+    else {
+        std::shared_ptr<arrow::io::ReadableFile> infile;
+        PARQUET_ASSIGN_OR_THROW(infile, arrow::io::ReadableFile::Open(fname));
+        std::unique_ptr<parquet::arrow::FileReader> reader;
+        PARQUET_ASSIGN_OR_THROW(reader, parquet::arrow::OpenFile(infile, arrow::default_memory_pool()));
+        PARQUET_ASSIGN_OR_THROW(table, reader->ReadTable());
+    }
+    return table;
+}
+
+static void _bench_first_table(const std::vector<std::shared_ptr<arrow::Table>>& tables, 
+                               std::int64_t row_group_size)
+{
+    std::cout << std::endl << "Time to first table (files in " << temp_directory_path().string() 
+        << ", best of 3)" << std::endl << std::endl;
+    std::cout << std::left << std::setw(20) << "format" << std::right << std::setw(12) << "size_MB"
+        << std::setw(12) << "read_ms" << std::setw(14) << "first_ms" << std::endl;
+
+    parquet::WriterProperties::Builder props;
+    props.compression(parquet::Compression::SNAPPY);
+    props.disable_dictionary("timestamp")->encoding("timestamp", parquet::Encoding::DELTA_BINARY_PACKED);
+    props.disable_dictionary("value_float")->encoding("value_float", parquet::Encoding::BYTE_STREAM_SPLIT);
+    std::vector<std::pair<std::string, arrow::Compression::type>> formats = {{"parquet(snappy)", 
+        arrow::Compression::SNAPPY}, {"arrow", arrow::Compression::UNCOMPRESSED}, 
+        {"arrow(lz4)", arrow::Compression::LZ4_FRAME}, {"arrow(zstd)", arrow::Compression::ZSTD}};
+
+    for (const auto& format : formats) {
+        bool ipc = (format.first != "parquet(snappy)");
+        path pdir = temp_directory_path() / unique_path("parquetbench-%%%%%%%%");
+        create_directories(pdir);
+
+        std::vector<std::string> fnames;
+        std::int64_t out_bytes = 0;
+        for (size_t t = 0; t < tables.size(); ++t) {
+            fnames.push_back((pdir / ("table_" + std::to_string(t) + (ipc ? ".arrow" : ".parquet"))).string());
+            if (ipc) _write_ipc_file(*tables[t], row_group_size, format.second, fnames.back());
+            else {
+                std::shared_ptr<arrow::io::FileOutputStream> sink;
+                PARQUET_ASSIGN_OR_THROW(sink, arrow::io::FileOutputStream::Open(fnames.back()));
+                PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(*tables[t], arrow::default_memory_pool(), 
+                    sink, row_group_size, props.build()));
+                PARQUET_THROW_NOT_OK(sink->Close());
+            }
+            out_bytes += file_size(fnames.back());
+        }
+
+        // All files (read_ms), and the first file alone (first_ms: one activity)
+        double best_seconds = 0.0, best_first = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            auto tstart = std::chrono::steady_clock::now();
+            _read_first_table(fnames.front(), ipc);
+            std::chrono::duration<double> first = std::chrono::steady_clock::now() - tstart;
+            for (size_t t = 1; t < fnames.size(); ++t) _read_first_table(fnames[t], ipc);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - tstart;
+            if (run == 0 || elapsed.count() < best_seconds) best_seconds = elapsed.count();
+            if (run == 0 || first.count() < best_first) best_first = first.count();
+        }
+        remove_all(pdir);
+
+        std::cout << std::left << std::setw(20) << format.first << std::right << std::fixed 
+            << std::setprecision(3) << std::setw(12) << out_bytes / 1e6 << std::setw(12) << best_seconds * 1e3 
+            << std::setw(14) << best_first * 1e3 << std::endl;
+    }
+}
+
+static std::vector<std::string> _find_fit_files(int argc, char* argv[])
+{
+    std::vector<std::string> fit_files;
+    for (int i = 1; i < argc; ++i) {
+        path parg(argv[i]);
+        if (is_directory(parg)) {
+            for (const directory_entry& e : directory_iterator(parg)) {
+                std::string ext = e.path().extension().string();
+                if (ext == ".fit" || ext == ".FIT") fit_files.push_back(e.path().string());
+            }
+        }
+        else fit_files.push_back(parg.string());
+    }
+    std::sort(fit_files.begin(), fit_files.end());
+    return fit_files;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: parquetbench <fitfile|fitdir> [<fitfile|fitdir> ...]" << std::endl;
+        return 1;
+    }
+
+    // Decode corpus once
+    FitTransformer transformer;
+    std::int64_t arrow_bytes = 0, nrows = 0;
+    std::vector<std::shared_ptr<arrow::Table>> tables;
+    for (const std::string& fit_fname : _find_fit_files(argc, argv)) {
+        try { tables.push_back(transformer.fit_to_table(fit_fname.c_str())); }
+        catch (const std::exception& e) { std::cerr << e.what() << std::endl; continue; }
+        arrow_bytes += arrow::util::TotalBufferSize(*tables.back());
+        nrows += tables.back()->num_rows();
+    }
+
+    if (tables.empty()) {
+        std::cerr << "ERROR no decodable FIT files found" << std::endl;
+        return 1;
+    }
+
+    // Row groups of about row_group_bytes (uncompressed)
+    std::int64_t row_group_bytes = CONFIG.exists("row_group_bytes") ?
+        std::stoll(CONFIG["row_group_bytes"]) : ROW_GROUP_BYTES;
+    std::int64_t row_group_size = std::max<std::int64_t>(nrows * row_group_bytes / arrow_bytes, 1);
+    std::cout << "Corpus: " << tables.size() << " files, " << nrows << " rows, "
+        << arrow_bytes / 1e6 << " MB in Arrow memory" << std::endl << std::endl;
+    std::cout << std::left << std::setw(20) << "setting" << std::right << std::setw(12) << "size_MB"
+        << std::setw(10) << "ratio" << std::setw(12) << "encode_ms" << std::setw(12) << "MB/s" << std::endl;
+
+    // Encode each table per setting, best of 3 runs
+    for (const BenchSetting& setting : _get_settings()) {
+        std::int64_t out_bytes = 0;
+        double best_seconds = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            out_bytes = 0;
+            auto tstart = std::chrono::steady_clock::now();
+            for (const std::shared_ptr<arrow::Table>& table : tables) {
+                std::shared_ptr<arrow::io::BufferOutputStream> sink;
+                PARQUET_ASSIGN_OR_THROW(sink, arrow::io::BufferOutputStream::Create());
+                PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(*table, arrow::default_memory_pool(),
+                    sink, row_group_size, setting.props));
+                std::int64_t position;
+                PARQUET_ASSIGN_OR_THROW(position, sink->Tell());
+                out_bytes += position;
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - tstart;
+            if (run == 0 || elapsed.count() < best_seconds) best_seconds = elapsed.count();
+        }
+
+        std::cout << std::left << std::setw(20) << setting.name << std::right << std::fixed
+            << std::setprecision(3) << std::setw(12) << out_bytes / 1e6
+            << std::setw(10) << static_cast<double>(arrow_bytes) / out_bytes
+            << std::setprecision(1) << std::setw(12) << best_seconds * 1e3
+            << std::setw(12) << arrow_bytes / 1e6 / best_seconds << std::endl;
+    }
+
+    _bench_clustering(tables, arrow_bytes, nrows);
+    _bench_first_table(tables, row_group_size);
+    return 0;
+}
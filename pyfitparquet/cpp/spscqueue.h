@@ -0,0 +1,52 @@
+#if !defined(SPSCQUEUE_H)
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define SPSC_SPIN_LIMIT 64 // Yields before a waiting side starts sleeping
+
+
+// Bounded single-producer/single-consumer lock-free ring. push() waits while
+// the ring is full (backpressure on the producer), pop() waits while empty.
+template <typename T>
+class SpscQueue
+{
+public:
+
+    explicit SpscQueue(size_t capacity) : slots(capacity + 1), head(0), tail(0) { }
+
+    void push(T item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t next = (t + 1) % slots.size();
+        for (int spins = 0; next == head.load(std::memory_order_acquire); ++spins) _wait(spins);
+
+        slots[t] = std::move(item);
+        tail.store(next, std::memory_order_release);
+    }
+
+    T pop() {
+        size_t h = head.load(std::memory_order_relaxed);
+        for (int spins = 0; h == tail.load(std::memory_order_acquire); ++spins) _wait(spins);
+
+        T item = std::move(slots[h]);
+        head.store((h + 1) % slots.size(), std::memory_order_release);
+        return item;
+    }
+
+private:
+
+    std::vector<T> slots;
+    alignas(64) std::atomic<size_t> head; // Next slot to pop (consumer owned)
+    alignas(64) std::atomic<size_t> tail; // Next slot to push (producer owned)
+
+    // Spin briefly, then sleep: either side may wait a whole decode/encode phase
+    static void _wait(int spins) {
+        if (spins < SPSC_SPIN_LIMIT) std::this_thread::yield();
+        else std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+};
+
+#endif // defined(SPSCQUEUE_H)
@@ -0,0 +1,66 @@
+#if !defined(STAGECLOCK_H)
+#define STAGECLOCK_H
+
+#include <chrono>
+
+// Transform stages timed by a StageClock (see TransformStats)
+enum STAGE { STAGE_OTHER, STAGE_OPEN, STAGE_INTEGRITY, STAGE_DECODE, STAGE_EXPAND, STAGE_STRINGIFY,
+             STAGE_APPEND, STAGE_FINISH, STAGE_ENCODE, STAGE_WRITE, NUM_STAGES };
+
+
+// Exclusive wall time per stage of one thread: each enter() charges the time since
+// the last one to the stage being left, so nested stages are not counted twice.
+// Disabled (the default), enter() reads no clock.
+class StageClock
+{
+public:
+
+    StageClock() { reset(false); }
+
+    void reset(bool enable) {
+        enabled = enable;
+        current = STAGE_OTHER;
+        last = std::chrono::steady_clock::now();
+        for (int s = 0; s < NUM_STAGES; ++s) seconds[s] = 0.0;
+    }
+
+    bool is_enabled() const { return enabled; }
+
+    // Switches to stage, returns the stage left
+    STAGE enter(STAGE stage) {
+        if (!enabled) return stage;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        seconds[current] += std::chrono::duration<double>(now - last).count();
+        last = now;
+
+        STAGE left = current;
+        current = stage;
+        return left;
+    }
+
+    // Seconds charged to stage so far (the current stage up to the last enter())
+    double get_seconds(STAGE stage) const { return seconds[stage]; }
+
+private:
+
+    bool enabled;
+    STAGE current;
+    std::chrono::steady_clock::time_point last;
+    double seconds[NUM_STAGES];
+};
+
+// Times a scope as stage, then returns to the enclosing stage
+class StageScope
+{
+public:
+
+    StageScope(StageClock& stage_clock, STAGE stage) : clock(stage_clock), left(stage_clock.enter(stage)) { }
+    ~StageScope() { clock.enter(left); }
+
+private:
+
+    StageClock& clock;
+    STAGE left;
+};
+
+#endif // defined(STAGECLOCK_H)
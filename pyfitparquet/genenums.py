@@ -0,0 +1,153 @@
+import re, argparse
+from collections import OrderedDict
+
+# FIT base type invalid values (fit.hpp)
+BASE_INVALIDS = {
+    'FIT_ENUM': 0xFF, 'FIT_UINT8': 0xFF, 'FIT_UINT16': 0xFFFF, 'FIT_UINT32': 0xFFFFFFFF,
+    'FIT_UINT8Z': 0x00, 'FIT_UINT16Z': 0x0000, 'FIT_UINT32Z': 0x00000000,
+}
+
+# Profile types whose #defines are limits, offsets or masks of a value, not enumerants
+NOT_ENUMERATED = {
+    'DATE_TIME', 'LOCAL_DATE_TIME', 'MESSAGE_INDEX', 'BACKLIGHT_TIMEOUT', 'WEIGHT', 'WORKOUT_HR',
+    'WORKOUT_POWER', 'USER_LOCAL_ID', 'LEFT_RIGHT_BALANCE', 'LEFT_RIGHT_BALANCE_100',
+}
+
+class GenEnums:
+#{
+    def __init__(self):
+        self.profile_types = None
+        self.enums = None
+        self.fields = None
+
+    def __repr__(self):
+        outstr = f'Enums:\n'
+        for k in self.enums: outstr += f'  {k} : {len(self.enums[k][1])} names\n'
+
+        outstr += f'\nEnum Fields:\n'
+        for k in self.fields: outstr += f'  {k} : {self.fields[k]}\n'
+        return outstr
+
+    def parse_profile(self, hpp_fname, cpp_fname):
+        with open(hpp_fname) as f_handle: hpp = f_handle.read()
+        with open(cpp_fname) as f_handle: cpp = f_handle.read()
+
+        # fit::Profile::Type enumerators, in declaration order
+        body = re.search(r'enum class Type\s*\{([^}]*)\}', hpp).group(1)
+        self.profile_types = [t.strip() for t in body.split(',') if t.strip()]
+
+        # typedef FIT_<BASE> FIT_<NAME>; followed by its #define FIT_<NAME>_<VAL> ((FIT_<NAME>)n)
+        self.enums = OrderedDict()
+        for base, name in re.findall(r'^typedef (FIT_\w+) FIT_(\w+);', hpp, re.M):
+            if base not in BASE_INVALIDS or name in NOT_ENUMERATED: continue
+            defines = re.findall(rf'^#define FIT_{name}_(\w+)\s+\(\(FIT_{name}\)(\w+)\)', hpp, re.M)
+            if not defines: continue
+
+            # Keep the first name of a value (aliases follow it), as Config's maps did
+            names = OrderedDict()
+            for val, num in defines: names.setdefault(int(num, 0), val)
+            names.setdefault(BASE_INVALIDS[base], 'INVALID')
+            self.enums[self.camel_case(name)] = (name, sorted(names.items()))
+
+        # Fields with an enumerated profile type, keyed by (mesg num, field num)
+        field_types = {}
+        fieldsets = re.findall(r'static const Profile::FIELD (\w+)\[\] =\s*\{(.*?)\n\};', cpp, re.S)
+        for fieldset, body in fieldsets:
+            field_types[fieldset] = re.findall(
+                r'^\{[^"]*"(\w+)",.*, (\d+), \d+, \w+, Profile::Type::(\w+) \},', body, re.M)
+
+        mesg_nums = {int(num, 0): name for name, num in re.findall(
+            r'^#define FIT_MESG_NUM_(\w+)\s+\(\(FIT_MESG_NUM\)(\w+)\)', hpp, re.M)}
+        self.fields = OrderedDict()
+        for fieldset, mesg_name, mesg_num in re.findall(
+            r'^\s*\{ (\w+), "(\w+)", FIT_MESG_NUM_(\w+), \d+ \},', cpp, re.M):
+            num = next(k for k, v in mesg_nums.items() if v == mesg_num)
+            for field_name, field_num, ptype in field_types.get(fieldset, []):
+                if ptype in self.enums:
+                    self.fields[(num, int(field_num))] = (mesg_name, field_name, ptype)
+        self.fields = OrderedDict(sorted(self.fields.items()))
+
+    def camel_case(self, name):
+        ptype = ''.join(part.capitalize() for part in name.split('_'))
+        assert ptype in self.profile_types, f"No fit::Profile::Type for FIT_{name}: '{ptype}'"
+        return ptype
+
+    def create_header(self):
+        print('// Generated by genenums.py from fit_profile.hpp/.cpp, do not edit')
+        print('#if !defined(FITENUMS_H)')
+        print('#define FITENUMS_H')
+        print('')
+        print('#include "fit_profile.hpp"')
+        print('')
+        print('// Name of an enumerated value: the #define suffix of fit_profile.hpp (FIT_SPORT_RUNNING')
+        print('// is "RUNNING"). Per type, names are sorted by value, indexed directly when dense.')
+        print('struct FitEnumName { FIT_UINT32 value; const char* name; };')
+        print('struct FitEnumTable { const FitEnumName* names; FIT_UINT16 count; };')
+        print('')
+        print('// Table of a profile type (count 0 if the type is not enumerated)')
+        print('inline const FitEnumTable& fit_enum_table(fit::Profile::Type type)')
+        print('{')
+        for ptype, (name, names) in self.enums.items():
+            print(f'    static const FitEnumName {name.lower()}_names[] = {{')
+            for i in range(0, len(names), 2):
+                entries = [f'{{FIT_{name}_{val}, "{val}"}}' for _, val in names[i:i+2]]
+                print(f'        {", ".join(entries)},')
+            print('    };')
+        print('')
+        print('    static const FitEnumTable tables[] = {')
+        for ptype in self.profile_types:
+            if ptype in self.enums:
+                name, names = self.enums[ptype]
+                print(f'        {{{name.lower()}_names, {len(names)}}}, // {ptype}')
+            else: print(f'        {{nullptr, 0}}, // {ptype}')
+        print('    };')
+        print('    return tables[static_cast<int>(type)];')
+        print('}')
+        print('')
+        print('// Name of value in the table of type, nullptr if none')
+        print('inline const char* fit_enum_name(fit::Profile::Type type, FIT_UINT32 value)')
+        print('{')
+        print('    const FitEnumTable& table = fit_enum_table(type);')
+        print('    if (value < table.count && table.names[value].value == value) return table.names[value].name;')
+        print('')
+        print('    FIT_UINT16 lo = 0, hi = table.count;')
+        print('    while (lo < hi) {')
+        print('        FIT_UINT16 mid = (lo + hi) / 2;')
+        print('        if (table.names[mid].value < value) lo = mid + 1;')
+        print('        else hi = mid;')
+        print('    }')
+        print('    return (lo < table.count && table.names[lo].value == value) ? table.names[lo].name : nullptr;')
+        print('}')
+        print('')
+        print('// Enumerated profile type of a mesg field, Profile::Type::Invalid if not enumerated')
+        print('inline fit::Profile::Type fit_enum_field_type(FIT_UINT16 mesg_num, FIT_UINT8 field_num)')
+        print('{')
+        print('    struct FitEnumField { FIT_UINT32 key; fit::Profile::Type type; }; // key: mesg_num << 8 | field_num')
+        print('    static const FitEnumField fields[] = {')
+        for (num, field_num), (mesg_name, field_name, ptype) in self.fields.items():
+            print(f'        {{{num << 8 | field_num:#08x}, fit::Profile::Type::{ptype}}}, // {mesg_name}.{field_name}')
+        print('    };')
+        print('    static const FIT_UINT16 count = sizeof(fields) / sizeof(fields[0]);')
+        print('')
+        print('    FIT_UINT32 key = static_cast<FIT_UINT32>(mesg_num) << 8 | field_num;')
+        print('    FIT_UINT16 lo = 0, hi = count;')
+        print('    while (lo < hi) {')
+        print('        FIT_UINT16 mid = (lo + hi) / 2;')
+        print('        if (fields[mid].key < key) lo = mid + 1;')
+        print('        else hi = mid;')
+        print('    }')
+        print('    return (lo < count && fields[lo].key == key) ? fields[lo].type : fit::Profile::Type::Invalid;')
+        print('}')
+        print('')
+        print('#endif // defined(FITENUMS_H)')
+#}
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument('PROFILE_HPP', help='FIT SDK fit_profile.hpp')
+    parser.add_argument('PROFILE_CPP', help='FIT SDK fit_profile.cpp')
+    args = parser.parse_args()
+
+    ge = GenEnums()
+    ge.parse_profile(args.PROFILE_HPP, args.PROFILE_CPP)
+    ge.create_header()
@@ -1,4 +1,4 @@
-import os, shutil, re, yaml
+import os, shutil, re, json, hashlib, yaml
 
 # Config file sets/dictionaries. Populates ONCE automatically
 # below (on import), to re-read config call populate_config())
@@ -9,6 +9,12 @@ TAG_FIELD_EXCLUDES = set()
 TAG_FIELD_MAP = {}
 config_dir = None
 
+# Installed config files (alongside this module), no directory walks
+package_dir = os.path.dirname(os.path.abspath(__file__))
+
+# Parsed config files: path => (mtime_ns, size, parsed), unchanged files aren't re-parsed
+_parsed_cache = {}
+
 # Init global sets/dicts 
 def populate_config():
 #{
@@ -27,63 +33,79 @@ def populate_config():
     TAG_FIELD_MAP.clear()
     config_dir = None
 
-    # Get possible config directory locations
-    conda_prefix_env = os.getenv("CONDA_PREFIX")
+    # Installed config files, or local copies in PYFIT_CONFIG_DIR
+    # (seeded from the installed files when missing)
     pyfit_config_env = os.getenv("PYFIT_CONFIG_DIR")
-    parquet_config, mapping_config = None, None
-    
-    # Find base site-packages config files 
-    # or local copies in PYFIT_CONFIG_DIR 
+    parquet_config = os.path.join(package_dir, 'parquet_config.yml')
+    mapping_config = os.path.join(package_dir, 'mapping_config.yml')
+
     if pyfit_config_env:
     #{
+        parquet_config_base, mapping_config_base = parquet_config, mapping_config
         parquet_config = os.path.join(pyfit_config_env, 'parquet_config.yml')
         mapping_config = os.path.join(pyfit_config_env, 'mapping_config.yml')
-        parquet_config_base = find_file("parquet_config.yml", conda_prefix_env)
-        mapping_config_base = find_file("mapping_config.yml", conda_prefix_env)
 
-        if parquet_config_base and not os.path.isfile(parquet_config):
+        if os.path.isfile(parquet_config_base) and not os.path.isfile(parquet_config):
             shutil.copyfile(parquet_config_base, parquet_config)
 
-        if mapping_config_base and not os.path.isfile(mapping_config):
+        if os.path.isfile(mapping_config_base) and not os.path.isfile(mapping_config):
             shutil.copyfile(mapping_config_base, mapping_config)
     #}
-    elif conda_prefix_env:
-        parquet_config = find_file("parquet_config.yml", conda_prefix_env)
-        mapping_config = find_file("mapping_config.yml", conda_prefix_env)
 
-    assert parquet_config and mapping_config and \
-        os.path.isfile(parquet_config) and os.path.isfile(parquet_config), \
+    assert os.path.isfile(parquet_config) and os.path.isfile(mapping_config), \
         f"ERROR: unable to find parquet_config.yml and/or mapping_config.yml"
     config_dir = os.path.dirname(parquet_config)
 
     # Populate server with 'param : value' pairs
-    with open(parquet_config) as config_fhandle:
-        rg_comment = r"\s*\#.*"
-        rg_parameter = r"\s*(\w+)\s*:\s*(\w+).*"
-        for line in config_fhandle.readlines():            
-            if re.match(rg_comment, line): continue
-            matchobj = re.match(rg_parameter, line)
-            if matchobj: CONFIG[matchobj.group(1)] = matchobj.group(2)
+    CONFIG.update(_load_cached(parquet_config, _parse_parquet_config))
     
     # Reset all TAG map/set global members
+    mappings = _load_cached(mapping_config, _parse_mapping_config)
+    if mappings:
+        MESG_TAGS = set(mappings['MESG_TAGS'])
+        TIMESTAMP_TAGS = set(mappings['TIMESTAMP_TAGS'])
+        TAG_FIELD_EXCLUDES = set(mappings['TAG_FIELD_EXCLUDES'])
+        TAG_FIELD_MAP = dict(mappings['TAG_FIELD_MAP'])
+#}
+
+# Hash of the TCX conversion config: params_hash (fittransformer_so.config_hash, the hash of
+# the parameters FIT outputs are recorded under) and the TCX mappings. Outputs converted 
+# under another hash are stale for incremental conversion
+def config_hash(params_hash):
+    mappings = [sorted(MESG_TAGS), sorted(TIMESTAMP_TAGS), sorted(TAG_FIELD_EXCLUDES), sorted(TAG_FIELD_MAP.items())]
+    content = json.dumps([params_hash, mappings], default=str).encode()
+    return hashlib.sha1(content).hexdigest()[:16]
+
+def _load_cached(config_file, parse):
+    fstat = os.stat(config_file)
+    cached = _parsed_cache.get(config_file)
+    if cached and cached[:2] == (fstat.st_mtime_ns, fstat.st_size): 
+        return cached[2]
+
+    parsed = parse(config_file)
+    _parsed_cache[config_file] = (fstat.st_mtime_ns, fstat.st_size, parsed)
+    return parsed
+
+def _parse_parquet_config(parquet_config):
+    params = {}
+    with open(parquet_config) as config_fhandle:
+        rg_comment = re.compile(r"\s*\#.*")
+        rg_parameter = re.compile(r"\s*(\w+)\s*:\s*(\w+).*")
+        for line in config_fhandle.readlines():            
+            if rg_comment.match(line): continue
+            matchobj = rg_parameter.match(line)
+            if matchobj: params[matchobj.group(1)] = matchobj.group(2)
+    return params
+
+def _parse_mapping_config(mapping_config):
     with open(mapping_config) as mapping_fhandle:
         try:
-            mappings = yaml.safe_load(mapping_fhandle)
-            MESG_TAGS = set(mappings['MESG_TAGS'])
-            TIMESTAMP_TAGS = set(mappings['TIMESTAMP_TAGS'])
-            TAG_FIELD_EXCLUDES = set(mappings['TAG_FIELD_EXCLUDES'])
-            TAG_FIELD_MAP = mappings['TAG_FIELD_MAP']  
-            for endpoint, triplet in TAG_FIELD_MAP.items():
-                triplet = [None if item == 'None' else item for item in triplet]
-                TAG_FIELD_MAP[endpoint] = triplet
+            # LibYAML loader when available (several times faster)
+            mappings = yaml.load(mapping_fhandle, Loader=getattr(yaml, 'CSafeLoader', yaml.SafeLoader))
+            for endpoint, triplet in mappings['TAG_FIELD_MAP'].items():
+                mappings['TAG_FIELD_MAP'][endpoint] = [None if item == 'None' else item for item in triplet]
+            return mappings
         except yaml.YAMLError as exc: print(exc)
-#}
-
-def find_file(name, start_dir):
-    if start_dir is None: return None
-    for root, dirs, files in os.walk(start_dir):
-        if name in files or name in dirs: 
-            return os.path.join(root, name)
 
 # Populate on import
 populate_config()
@@ -0,0 +1,24 @@
+import argparse, pyarrow
+from pyfitparquet import fittransformer_so
+
+
+# Reader of a shared-memory ring of record batches, published by fittransformer --shm or
+# PyFitParquet.fit_to_shm from another local process. Batches are mapped, not copied: a 
+# ring slot is reused once the batch and its arrays are gone, so publishing waits while 
+# the reader holds as many batches as the ring has slots (shm_slots, parquet_config.yml).
+# Waits up to timeout_ms (-1: forever) for the ring and each batch (pyarrow raises on timeout)
+def open_ring(name, timeout_ms=-1):
+    return pyarrow.RecordBatchReader.from_stream(fittransformer_so.shm_ring_stream(name, timeout_ms))
+
+if __name__ == "__main__":
+#{
+    parser = argparse.ArgumentParser()
+    parser.add_argument('RING', help='shared-memory ring name (fittransformer --shm <ring_name> ...)')
+    parser.add_argument('--timeout-ms', type=int, default=-1, help='wait for the ring and each batch')
+    args = parser.parse_args()
+
+    nbatches, nrows = 0, 0
+    for batch in open_ring(args.RING, args.timeout_ms):
+        nbatches, nrows = nbatches + 1, nrows + batch.num_rows
+    print(f'Read {nbatches} batches, {nrows} rows')
+#}
@@ -1,4 +1,4 @@
-import os, re, pandas, pyarrow
+import os, re, zipfile, pandas, pyarrow
 import defusedxml.ElementTree as ET
 from pyfitparquet import loadconfig
 
@@ -35,18 +35,20 @@ class TcxTransformer:
                          "manufacturer_index", "manufacturer_name", "product_index", 
                          "product_name", "timestamp", "mesg_index", "mesg_name", 
                          "field_index", "field_name", "field_type", "value_string", 
-                         "value_integer", "value_float", "units"]
+                         "value_integer", "value_float", "value_enum_name", "units"]
         
         # These tags apply to entire file, thus when parsed, back-apply them to entire builder buffer
         self.file_id_tags = {'TrainingCenterDatabase-Activities-Activity-Creator-Name': self._update_manufacturer_name,
                              'TrainingCenterDatabase-Activities-Activity-Creator-ProductID': self._update_product_index }
     #}
     
-    # Serialize TCX file output to parquet
-    def tcx_to_parquet(self, tcx_fname, parquet_fname):
+    # Serialize TCX file output to parquet. tcx_fname may be gzip (.gz) or zstd (.zst)
+    # compressed, or, with zip_fname, the name of a (plain or compressed) zip member
+    def tcx_to_parquet(self, tcx_fname, parquet_fname, zip_fname=None):
     #{
         self.source_filename = os.path.basename(tcx_fname)
-        self.source_file_uri = os.path.abspath(tcx_fname)
+        self.source_file_uri = os.path.abspath(tcx_fname) if zip_fname is None \
+            else os.path.join(os.path.abspath(zip_fname), tcx_fname)
         self.init_from_config()
         status = 1
 
@@ -54,13 +56,14 @@ class TcxTransformer:
         #{
             # Parse the TCX XML-tree recursively 
             # XML parse requires NO leading whitespace
-            with open(tcx_fname) as f_handle:
-                xmlstring = f_handle.read().lstrip()
-                self.recurse_tree(ET.fromstring(xmlstring).iter())
+            xmlstring = self.read_source(tcx_fname, zip_fname).decode().lstrip()
+            self.recurse_tree(ET.fromstring(xmlstring).iter())
         
-            # Write to parquet file
+            # Write to parquet (output_format: arrow, Arrow IPC) file
             table = {ck : self.cbuilders[ck] for ck in self.colkeys if ck in self.cbuilders}
-            pandas.DataFrame(table).to_parquet(path=parquet_fname, engine='pyarrow')
+            if loadconfig.CONFIG.get('output_format') == 'arrow': pandas.DataFrame(table).to_feather(
+                parquet_fname, compression=loadconfig.CONFIG.get('ipc_compression', 'uncompressed'))
+            else: pandas.DataFrame(table).to_parquet(path=parquet_fname, engine='pyarrow')
             self.reset_state()
             status = 0
         #}
@@ -68,6 +71,19 @@ class TcxTransformer:
         return status
     #}
 
+    # Bytes of a TCX file or zip member, decompressed in memory (never extracted to disk)
+    def read_source(self, tcx_fname, zip_fname=None):
+    #{
+        compression = {'.gz': 'gzip', '.zst': 'zstd'}.get(os.path.splitext(tcx_fname)[1])
+        if zip_fname is None:
+            with pyarrow.input_stream(tcx_fname, compression='detect') as stream: return stream.read()
+
+        with zipfile.ZipFile(zip_fname) as zip_handle, zip_handle.open(tcx_fname) as member:
+            if compression is None: return member.read()
+            with pyarrow.CompressedInputStream(pyarrow.PythonFile(member, mode='r'), compression) as stream:
+                return stream.read()
+    #}
+
     # Re-read configuration file (client responsibility when desired)
     def reset_from_config(self):
         loadconfig.populate_config() 
@@ -76,7 +92,7 @@ class TcxTransformer:
     # Load from config file
     def init_from_config(self):
         self.epoch_fit_format = loadconfig.CONFIG["epoch_format"] == "FIT"
-        self.cbuilders = {ck : list() for ck in self.colkeys if loadconfig.CONFIG[ck] == "true"}
+        self.cbuilders = {ck : list() for ck in self.colkeys if loadconfig.CONFIG.get(ck) == "true"}
         self.excludeflags = {ex : loadconfig.CONFIG[ex] == "true" for ex in ["exclude_empty_values", 
                                                                              "exclude_timestamp_values"]}
     
@@ -181,6 +197,7 @@ class TcxTransformer:
         if "value_integer" in self.cbuilders: self.cbuilders["value_integer"].append(ival)
         if "value_float" in self.cbuilders: self.cbuilders["value_float"].append(fval)
         if "value_string" in self.cbuilders: self.cbuilders["value_string"].append(field_value)
+        if "value_enum_name" in self.cbuilders: self.cbuilders["value_enum_name"].append(None) # TCX has no FIT profile enums
     #}
     
     def get_field_type(self, field_value): 
@@ -1,9 +1,18 @@
-import os, re, time, argparse
-from pyfitparquet import fittransformer_so, tcxtransformer
+import os, re, time, zipfile, argparse, pyarrow, pyarrow.parquet
+from pyfitparquet import fittransformer_so, tcxtransformer, loadconfig
 
 
 class PyFitParquet:
 #{
+    # Incremental conversion manifest, in parquet_dir ('_' prefixed: not read as dataset part)
+    MANIFEST_FNAME = '_manifest.parquet'
+    MANIFEST_SCHEMA = pyarrow.schema([('source_uri', pyarrow.string()), ('size', pyarrow.int64()), 
+        ('mtime_ns', pyarrow.int64()), ('content_hash', pyarrow.string()), 
+        ('config_hash', pyarrow.string()), ('parquet_file', pyarrow.string())])
+
+    # Source file names: fit/tcx (optionally .gz/.zst compressed) and zip archives
+    SOURCE_PATTERN = re.compile('(\w+).(fit|FIT|tcx|TCX)(\.gz|\.zst)?$|(\w+).(zip|ZIP)$')
+
     def __init__(self):
         self.fit_transformer = fittransformer_so.FitTransformer()
         self.tcx_transformer = tcxtransformer.TcxTransformer()
@@ -14,12 +23,15 @@ class PyFitParquet:
         self.tcx_transformer.reset_from_config()
 
     # Serializes all fit/tcx files in data_dir, outputs into
-    # parquet_dir, which defaults to subdirectory within data_dir
-    def data_to_parquet(self, data_dir, parquet_dir=None, verbose=1):
+    # parquet_dir, which defaults to subdirectory within data_dir. 
+    # If incremental, only new or changed files are serialized (see 
+    # _incremental_to_parquet)
+    def data_to_parquet(self, data_dir, parquet_dir=None, verbose=1, incremental=False):
     #{
         if parquet_dir is None: parquet_dir = os.path.join(data_dir, 'parquet')
         assert os.path.isdir(parquet_dir) or not os.path.exists(parquet_dir), f'ERROR: {parquet_dir}' 
         if not os.path.exists(parquet_dir): os.mkdir(parquet_dir)
+        if incremental: return self._incremental_to_parquet(data_dir, parquet_dir, verbose)
 
         for file in os.listdir(data_dir):
             initial, source_uri = time.time(), os.path.join(data_dir, file)
@@ -28,39 +40,189 @@ class PyFitParquet:
                 f"{parquet_uri} in {time.time()-initial:.3f} sec")
     #}
 
-    # Serializes a single source file at source_uri to parquet
+    # Serializes a single source file at source_uri to parquet (fit/tcx files, 
+    # optionally .gz/.zst compressed, or a zip archive of them)
     def source_to_parquet(self, source_uri, parquet_dir=None):
-        source_fname = os.path.basename(source_uri)
-        if re.match('(\w+).(fit|FIT)$', source_fname):
-            return self.fit_to_parquet(source_uri, parquet_dir)
-        elif re.match('(\w+).(tcx|TCX)$', source_fname):
-            return self.tcx_to_parquet(source_uri, parquet_dir)
+        source_kind = self.source_kind(source_uri)
+        if source_kind == 'fit': return self.fit_to_parquet(source_uri, parquet_dir)
+        elif source_kind == 'tcx': return self.tcx_to_parquet(source_uri, parquet_dir)
+        elif source_kind == 'zip': return self.zip_to_parquet(source_uri, parquet_dir)
         else: return None
 
+    # 'fit', 'tcx' or 'zip' by source file name, None if not a source file
+    def source_kind(self, source_uri):
+        matchobj = self.SOURCE_PATTERN.match(os.path.basename(source_uri))
+        return (matchobj.group(2) or matchobj.group(5)).lower() if matchobj else None
+
+    # Incremental data_to_parquet. The manifest in parquet_dir records per source file its size,
+    # mtime, content hash (XXH3), the config hash and its output (zip: <parquet_dir>/<zip stem>/).
+    # Sources unchanged since the last run (same size and mtime, or else same content) under the
+    # same config are skipped; a source with the content of another converted one shares its
+    # output (converted once). Unchanged sources cost one stat each, their manifest rows are 
+    # carried over as columns. FIT sources record the hash fittransformer --batch does, so 
+    # either may update the other's manifest. Sources whose outputs would overwrite each other
+    # (a.fit and a.fit.gz, a.fit and a.tcx) fail: none of them is converted or recorded
+    def _incremental_to_parquet(self, data_dir, parquet_dir, verbose):
+    #{
+        manifest_uri = os.path.join(parquet_dir, self.MANIFEST_FNAME)
+        manifest = pyarrow.parquet.read_table(manifest_uri, schema=self.MANIFEST_SCHEMA) \
+            if os.path.isfile(manifest_uri) else self.MANIFEST_SCHEMA.empty_table()
+        previous = {name : manifest.column(name).to_pylist() for name in self.MANIFEST_SCHEMA.names}
+        previous_index = {source_uri : i for i, source_uri in enumerate(previous['source_uri'])}
+        outputs, params_hash = set(os.listdir(parquet_dir)), fittransformer_so.config_hash()
+        config_hashes = {'fit': params_hash, 'tcx': loadconfig.config_hash(params_hash)}
+        config_hashes['zip'] = config_hashes['tcx']
+
+        # Previous rows kept (indices), new rows (changed sources), outputs by content hash
+        # (built on the first changed source) and content hashes of outputs (re)written
+        kept, rows, by_content, converted, nduplicates = [], [], None, {}, 0
+        data_dir = os.path.abspath(data_dir)
+        sources = [source for source in sorted(os.scandir(data_dir), key=lambda entry: entry.name)
+                   if self.SOURCE_PATTERN.match(source.name) is not None and source.is_file()]
+
+        by_output = {}
+        for source in sources: by_output.setdefault(self._incremental_output(source.name), []).append(source.path)
+        colliding = set()
+        for output, source_uris in by_output.items():
+            if len(source_uris) < 2: continue
+            print(f"ERROR {', '.join(source_uris)} all convert to {output}, not converted")
+            colliding.update(source_uris)
+
+        for source in sources:
+        #{
+            if source.path in colliding: continue
+            fstat, i = source.stat(), previous_index.get(source.path)
+            config_hash = config_hashes[self.source_kind(source.name)]
+            if i is not None and previous['config_hash'][i] == config_hash and \
+               previous['parquet_file'][i] in outputs and previous['size'][i] == fstat.st_size and \
+               previous['mtime_ns'][i] == fstat.st_mtime_ns:
+                kept.append(i)
+                continue
+
+            if by_content is None:
+                by_content = {(h, c) : f for h, c, f in zip(previous['content_hash'], previous['config_hash'], 
+                              previous['parquet_file']) if f in outputs}
+            content_hash = f'{fittransformer_so.content_hash(source.path):016x}'
+            row = {'source_uri': source.path, 'size': fstat.st_size, 'mtime_ns': fstat.st_mtime_ns,
+                   'content_hash': content_hash, 'config_hash': config_hash, 'parquet_file': None}
+
+            if (content_hash, config_hash) in by_content:
+                row['parquet_file'] = by_content[(content_hash, config_hash)]
+                if i is None or previous['content_hash'][i] != content_hash:
+                    nduplicates += 1
+                    if verbose > 1: print(f"Duplicate {source.path} => {row['parquet_file']}")
+            else:
+                initial = time.time()
+                parquet_uri = self._incremental_source_to_parquet(source.path, parquet_dir)
+                if parquet_uri is None: continue # Failed, retried on the next run
+                if verbose > 0: print(f"Serialized {source.path} => {parquet_uri} in {time.time()-initial:.3f} sec")
+                row['parquet_file'] = os.path.basename(parquet_uri)
+                by_content[(content_hash, config_hash)] = row['parquet_file']
+                converted[row['parquet_file']] = content_hash
+            rows.append(row)
+        #}
+
+        # Sources sharing an output just overwritten with other content convert on their own
+        if converted:
+            for i in [i for i in kept if previous['parquet_file'][i] in converted]:
+                rows.append({name : previous[name][i] for name in self.MANIFEST_SCHEMA.names})
+            kept = [i for i in kept if previous['parquet_file'][i] not in converted]
+            for row in rows:
+                if converted.get(row['parquet_file'], row['content_hash']) == row['content_hash']: continue
+                parquet_uri = self._incremental_source_to_parquet(row['source_uri'], parquet_dir)
+                row['parquet_file'] = os.path.basename(parquet_uri) if parquet_uri else None
+            rows = [row for row in rows if row['parquet_file'] is not None]
+
+        if rows or len(kept) < manifest.num_rows:
+            manifest = pyarrow.concat_tables([manifest.take(pyarrow.array(kept, pyarrow.int64())), 
+                pyarrow.Table.from_pylist(rows, schema=self.MANIFEST_SCHEMA)])
+            pyarrow.parquet.write_table(manifest, manifest_uri + '.tmp')
+            os.replace(manifest_uri + '.tmp', manifest_uri)
+        if verbose > 0: print(f"Skipped {len(kept)} unchanged and {nduplicates} duplicate source files")
+    #}
+
+    # Output (file or zip directory) name in parquet_dir of the source file named source_name
+    def _incremental_output(self, source_name):
+        if self.source_kind(source_name) == 'zip': return os.path.splitext(source_name)[0]
+        return os.path.basename(self.create_parquet_uri(source_name, ''))
+
+    # Zip archives convert to a directory of their own, as fittransformer --batch does
+    def _incremental_source_to_parquet(self, source_uri, parquet_dir):
+        if self.source_kind(source_uri) != 'zip': return self.source_to_parquet(source_uri, parquet_dir)
+        stem = os.path.splitext(os.path.basename(source_uri))[0]
+        return self.zip_to_parquet(source_uri, os.path.join(parquet_dir, stem))
+
     # Serializes a single FIT file at fit_uri to parquet
     def fit_to_parquet(self, fit_uri, parquet_dir=None):
         parquet_uri = self.create_parquet_uri(fit_uri, parquet_dir)
         status = self.fit_transformer.fit_to_parquet(fit_uri, parquet_uri)
         return parquet_uri if status == 0 else None
 
+    # Serializes the fit/tcx members (optionally .gz/.zst compressed) of the zip archive at 
+    # zip_uri to <member dirs>/<member stem>.parquet files in parquet_dir, which defaults to a 
+    # directory named like the archive. FIT members convert in parallel (zip_threads in parquet_config.yml)
+    def zip_to_parquet(self, zip_uri, parquet_dir=None):
+    #{
+        if parquet_dir is None: parquet_dir = os.path.splitext(zip_uri)[0]
+        status = self.fit_transformer.zip_to_parquet(zip_uri, parquet_dir)
+
+        with zipfile.ZipFile(zip_uri) as zip_handle: members = zip_handle.namelist()
+        for member in members:
+            if not re.match('(\w+).(tcx|TCX)(\.gz|\.zst)?$', os.path.basename(member)): continue
+            member_dir = os.path.join(parquet_dir, *[d for d in os.path.dirname(member).split('/') if d not in ('', '.', '..')])
+            os.makedirs(member_dir, exist_ok=True)
+            parquet_uri = self.create_parquet_uri(member, member_dir)
+            status |= self.tcx_transformer.tcx_to_parquet(member, parquet_uri, zip_uri)
+        return parquet_dir if status == 0 else None
+    #}
+
+    # Serializes the records appended to a growing FIT file at fit_uri since the 
+    # last call (checkpoint in parquet_dir) to a new part file in parquet_dir
+    def fit_append_parquet(self, fit_uri, parquet_dir=None):
+        if parquet_dir is None: parquet_dir = os.path.dirname(fit_uri)
+        status = self.fit_transformer.fit_append_parquet(fit_uri, parquet_dir)
+        return parquet_dir if status == 0 else None
+
+    # Streams a single FIT file at fit_uri as pyarrow record batches of about batch_rows
+    # rows (main table only), decoded as they are read: consumers may stop early
+    def fit_to_reader(self, fit_uri, batch_rows=65536):
+        stream = self.fit_transformer.fit_to_stream(fit_uri, batch_rows)
+        return pyarrow.RecordBatchReader.from_stream(stream)
+
+    # Publishes FIT files as record batches of about batch_rows rows (main table only) to the
+    # shared-memory ring name, for another local process to map (pyfitparquet.shmring.open_ring).
+    # The ring is sized by the shm_slots/shm_slot_bytes config; publishing waits while its slots
+    # are full. Returns True if all files published and the reader released every batch
+    def fit_to_shm(self, fit_uris, ring_name, batch_rows=65536):
+        ring = fittransformer_so.ShmRingWriter(ring_name)
+        status = [self.fit_transformer.fit_to_shm(fit_uri, ring, batch_rows) for fit_uri in fit_uris]
+        return ring.close() and not any(status)
+
+    # Statistics (fittransformer_so.TransformStats) of the last FIT file transformed: 
+    # counters, and per-stage seconds if collect_stats (see parquet_config.yml) is true
+    def get_stats(self):
+        return self.fit_transformer.get_stats()
+
     # Serializes a single TCX file at tcx_uri to parquet    
     def tcx_to_parquet(self, tcx_uri, parquet_dir=None):
         parquet_uri = self.create_parquet_uri(tcx_uri, parquet_dir)
         status = self.tcx_transformer.tcx_to_parquet(tcx_uri, parquet_uri)
         return parquet_uri if status == 0 else None
 
-    # Returns name like source_fname but extension replaced with .parquet
+    # Returns name like source_fname but extension (and any .gz/.zst) replaced with .parquet
+    # (output_format: arrow, .arrow)
     # If parquet_dir is None, directory path of source_uri is used
     def create_parquet_uri(self, source_uri, parquet_dir=None):
         sfroot, ext = os.path.splitext(os.path.basename(source_uri))
+        if ext in ('.gz', '.zst'): sfroot, ext = os.path.splitext(sfroot)
         if parquet_dir is None: parquet_dir = os.path.dirname(source_uri)
-        return os.path.join(parquet_dir, f'{sfroot}.parquet')
+        return os.path.join(parquet_dir, sfroot + fittransformer_so.output_extension())
 #}
 
 if __name__ == "__main__":
 #{
     parser = argparse.ArgumentParser()
-    parser.add_argument('SOURCE_FILE', help='source .fit or .tcx file')
+    parser.add_argument('SOURCE_FILE', help='source .fit or .tcx file (optionally .gz/.zst), or .zip of them')
     parser.add_argument('-P', metavar='PARQUET_DIR', help='parquet output dir (defaults: ${DATA_DIR}/parquet')
     args = parser.parse_args()
 
@@ -1,6 +1,7 @@
 import pandas as pd
-import os, re, shutil, random, unittest, yaml, pyarrow
-from pyfitparquet import transformer, loadconfig
+import os, re, sys, gzip, json, time, shutil, random, zipfile, unittest, subprocess, threading, contextlib, yaml, pyarrow
+import pyarrow.compute, pyarrow.ipc, pyarrow.parquet
+from pyfitparquet import transformer, loadconfig, fittransformer_so, client, shmring
 
 class TestSerialization(unittest.TestCase):
 #{
@@ -102,6 +103,272 @@ class TestSerialization(unittest.TestCase):
             'dav_track_5k.parquet', 'new_river_50k.parquet', 
             'twin_cities_marathon.parquet'])
     #}
+
+    def test_page_index(self):
+    #{
+        # Timestamp lookups only read pages whose page index min/max admit the value
+        pfile = os.path.join(self.PARQUET_DIR, 'Bolt_GPS.parquet')
+        tseries = pyarrow.parquet.read_table(pfile, columns=['timestamp']).column(0)
+        tmax = pyarrow.compute.max(tseries.cast(pyarrow.int64())).as_py()
+        pages_read, pages_total = fittransformer_so.scan_pages(pfile, 'timestamp', str(tmax))
+        self.assertTrue(0 < pages_read < pages_total)
+        self.assertEqual(fittransformer_so.scan_pages(pfile, 'timestamp', str(tmax + 1))[0], 0)
+
+        # field_name bloom filters skip absent names (up to false positives)
+        self.assertTrue(fittransformer_so.scan_pages(pfile, 'field_name', 'power')[0] > 0)
+        absent = [fittransformer_so.scan_pages(pfile, 'field_name', f'no_such_field_{i}')[0] for i in range(20)]
+        self.assertTrue(absent.count(0) >= 15)
+    #}
+
+    def test_module_import(self):
+    #{
+        # The extension module loads on its own (no symbols left to the fittransformer executable)
+        probe = 'from pyfitparquet import fittransformer_so; fittransformer_so.FitTransformer(); ' \
+                'print(fittransformer_so.output_extension())'
+        result = subprocess.run([sys.executable, '-c', probe], capture_output=True, text=True)
+        self.assertEqual(result.returncode, 0, result.stderr)
+        self.assertIn(result.stdout.strip(), ('.parquet', '.arrow'))
+    #}
+
+    def test_reader(self):
+    #{
+        # Lazily decoded batches equal the serialized table, and may be abandoned early
+        fit_uri = os.path.join(os.path.dirname(__file__), 'fixtures', 'Bolt_GPS.fit')
+        pyfitparq = transformer.PyFitParquet()
+        streamed = pyfitparq.fit_to_reader(fit_uri, batch_rows=10000).read_all()
+        whole = pyarrow.parquet.read_table(os.path.join(self.PARQUET_DIR, 'Bolt_GPS.parquet'))
+        self.assertEqual(streamed.num_rows, whole.num_rows)
+        self.assertTrue(streamed.column('field_name').equals(whole.column('field_name')))
+
+        reader = pyfitparq.fit_to_reader(fit_uri, batch_rows=1000)
+        self.assertTrue(1000 <= reader.read_next_batch().num_rows < 2000)
+        reader.close()
+    #}
+
+    def test_shm(self):
+    #{
+        # Batches published to a shared-memory ring (twice) read back equal the serialized table
+        fit_uri = os.path.join(os.path.dirname(__file__), 'fixtures', 'Bolt_GPS.fit')
+        pyfitparq, published = transformer.PyFitParquet(), []
+        producer = threading.Thread(target=lambda: published.append(
+            pyfitparq.fit_to_shm([fit_uri, fit_uri], 'pyfitparquet_test', batch_rows=1000)))
+        producer.start()
+        streamed = shmring.open_ring('pyfitparquet_test', timeout_ms=30000).read_all()
+        producer.join()
+
+        whole = pyarrow.parquet.read_table(os.path.join(self.PARQUET_DIR, 'Bolt_GPS.parquet'))
+        self.assertEqual(published, [True])
+        self.assertEqual(streamed.num_rows, 2 * whole.num_rows)
+        self.assertTrue(streamed.slice(whole.num_rows).column('field_name').equals(whole.column('field_name')))
+    #}
+
+    def test_append(self):
+    #{
+        # A FIT file growing in 4 pieces appends part files equal to its one-shot ETL
+        fit_uri = os.path.join(os.path.dirname(__file__), 'fixtures', 'Bolt_GPS.fit')
+        grow_dir = os.path.join(self.PARQUET_DIR, 'append')
+        grow_uri = os.path.join(grow_dir, 'Bolt_GPS.fit')
+        os.mkdir(grow_dir)
+        with open(fit_uri, 'rb') as fit_file: fit_bytes = fit_file.read()
+
+        pyfitparq = transformer.PyFitParquet()
+        for i in range(1, 5):
+            with open(grow_uri, 'wb') as grow_file: grow_file.write(fit_bytes[:len(fit_bytes) * i // 4])
+            self.assertEqual(pyfitparq.fit_append_parquet(grow_uri, grow_dir), grow_dir)
+
+        parts = sorted(f for f in os.listdir(grow_dir) if f.endswith('.parquet'))
+        appended = pyarrow.concat_tables([pyarrow.parquet.read_table(os.path.join(grow_dir, f)) for f in parts])
+        whole = pyarrow.parquet.read_table(os.path.join(self.PARQUET_DIR, 'Bolt_GPS.parquet'))
+        self.assertEqual(len(parts), 4)
+        self.assertEqual(appended.num_rows, whole.num_rows)
+        for column in ['timestamp', 'field_name', 'value_string']:
+            self.assertTrue(appended.column(column).equals(whole.column(column)))
+    #}
+
+    def test_stats(self):
+    #{
+        # Counters match the output, stage seconds are collected on request
+        fit_uri = os.path.join(os.path.dirname(__file__), 'fixtures', 'Bolt_GPS.fit')
+        stats_dir = os.path.join(self.PARQUET_DIR, 'stats')
+        os.mkdir(stats_dir)
+
+        pyfitparq = transformer.PyFitParquet()
+        pyfitparq.fit_transformer.set_collect_stats(True)
+        parquet_uri = pyfitparq.fit_to_parquet(fit_uri, stats_dir)
+        stats = pyfitparq.get_stats()
+        self.assertTrue(stats.collected)
+        self.assertEqual(stats.rows, pyarrow.parquet.read_metadata(parquet_uri).num_rows)
+        self.assertEqual(stats.fit_bytes, os.path.getsize(fit_uri))
+        self.assertEqual(sum(stats.mesg_counts.values()), stats.mesgs)
+        self.assertEqual(list(stats.stage_seconds), ['other', 'open', 'integrity', 'decode', 
+            'expand', 'stringify', 'append', 'finish', 'encode', 'write'])
+        self.assertEqual(json.loads(stats.to_json())['mesg_counts'], stats.mesg_counts)
+    #}
+
+    def test_incremental(self):
+    #{
+        # Unchanged and duplicate sources are not converted again
+        fixtures_dir = os.path.join(os.path.dirname(__file__), 'fixtures')
+        data_dir = os.path.join(self.PARQUET_DIR, 'incremental')
+        os.mkdir(data_dir)
+        for fname in ['Bolt_GPS.fit', 'TeamScream.tcx']: shutil.copy(os.path.join(fixtures_dir, fname), data_dir)
+        shutil.copy(os.path.join(fixtures_dir, 'Bolt_GPS.fit'), os.path.join(data_dir, 'Bolt_GPS_copy.fit'))
+
+        pyfitparq = transformer.PyFitParquet()
+        pyfitparq.data_to_parquet(data_dir, verbose=0, incremental=True)
+        parquet_dir = os.path.join(data_dir, 'parquet')
+        self.assertEqual(sorted(os.listdir(parquet_dir)), 
+            ['Bolt_GPS.parquet', 'TeamScream.parquet', transformer.PyFitParquet.MANIFEST_FNAME])
+        mtimes = {f : os.stat(os.path.join(parquet_dir, f)).st_mtime_ns for f in os.listdir(parquet_dir)}
+
+        pyfitparq.data_to_parquet(data_dir, verbose=0, incremental=True)
+        self.assertEqual({f : os.stat(os.path.join(parquet_dir, f)).st_mtime_ns for f in os.listdir(parquet_dir)}, mtimes)
+
+        manifest = pyarrow.parquet.read_table(os.path.join(parquet_dir, transformer.PyFitParquet.MANIFEST_FNAME))
+        outputs = dict(zip([os.path.basename(f) for f in manifest.column('source_uri').to_pylist()], 
+                           manifest.column('parquet_file').to_pylist()))
+        self.assertEqual(outputs, {'Bolt_GPS.fit': 'Bolt_GPS.parquet', 'Bolt_GPS_copy.fit': 'Bolt_GPS.parquet', 
+                                   'TeamScream.tcx': 'TeamScream.parquet'})
+
+        # Sources converting to the same output (Bolt_GPS.parquet) fail and are not recorded
+        with open(os.path.join(fixtures_dir, 'Bolt_GPS.fit'), 'rb') as fit_fhandle, \
+             gzip.open(os.path.join(data_dir, 'Bolt_GPS.fit.gz'), 'wb') as gz_fhandle: gz_fhandle.write(fit_fhandle.read())
+        pyfitparq.data_to_parquet(data_dir, verbose=0, incremental=True)
+        self.assertEqual(os.stat(os.path.join(parquet_dir, 'Bolt_GPS.parquet')).st_mtime_ns, mtimes['Bolt_GPS.parquet'])
+        manifest = pyarrow.parquet.read_table(os.path.join(parquet_dir, transformer.PyFitParquet.MANIFEST_FNAME))
+        self.assertEqual(sorted(os.path.basename(f) for f in manifest.column('source_uri').to_pylist()), 
+                         ['Bolt_GPS_copy.fit', 'TeamScream.tcx'])
+    #}
+
+    @unittest.skipUnless(shutil.which('fittransformer'), 'fittransformer executable not installed')
+    def test_daemon(self):
+    #{
+        # Daemon conversions match in-process ones, errors are reported per request
+        fit_uri = os.path.join(os.path.dirname(__file__), 'fixtures', 'Bolt_GPS.fit')
+        daemon_dir = os.path.join(self.PARQUET_DIR, 'daemon')
+        socket_path = os.path.join(daemon_dir, 'fittransformer.sock')
+        os.mkdir(daemon_dir)
+
+        daemon = subprocess.Popen(['fittransformer', '--serve', socket_path, '--threads', '2'])
+        try:
+            while not os.path.exists(socket_path): time.sleep(0.05)
+            with client.FitDaemonClient(socket_path, timeout=60) as fitclient:
+                responses = fitclient.convert_many([(fit_uri, os.path.join(daemon_dir, f'Bolt_GPS_{i}.parquet')) 
+                    for i in range(4)] + [(os.path.join(daemon_dir, 'missing.fit'), None)], collect_stats=True)
+                self.assertEqual([r['status'] for r in responses], [0, 0, 0, 0, 1])
+                self.assertEqual(fitclient.stats()['jobs'], 5)
+                self.assertEqual(fitclient.shutdown()['status'], 0)
+            self.assertEqual(daemon.wait(timeout=60), 0)
+        finally:
+            if daemon.poll() is None: daemon.kill()
+
+        whole = pyarrow.parquet.read_table(os.path.join(self.PARQUET_DIR, 'Bolt_GPS.parquet'))
+        for response in responses[:4]:
+            table = pyarrow.parquet.read_table(response['parquet'])
+            self.assertEqual(response['stats']['rows'], table.num_rows)
+            self.assertTrue(table.column('value_string').equals(whole.column('value_string')))
+    #}
+
+    @unittest.skipUnless(shutil.which('fittransformer') and shutil.which('fitgen'), 
+                         'fittransformer/fitgen executables not installed')
+    def test_follow(self):
+    #{
+        # A FIT file growing in pieces under --follow is flushed to batch files holding the
+        # rows of a one-shot conversion, with no '.' prefixed (partial) batch left behind
+        follow_dir = os.path.join(self.PARQUET_DIR, 'follow')
+        os.mkdir(follow_dir)
+        full_uri, fit_uri = os.path.join(follow_dir, 'full.fit'), os.path.join(follow_dir, 'growing.fit')
+        subprocess.run(['fitgen', '--seed', '11', '--duration', '3600', '--mix', 'record,lap', full_uri], 
+                       check=True, capture_output=True)
+        with open(full_uri, 'rb') as fit_fhandle: fit_bytes = fit_fhandle.read()
+        open(fit_uri, 'wb').close()
+
+        follower = subprocess.Popen(['fittransformer', '--follow', fit_uri, os.path.join(follow_dir, 'batch'), 
+                                     '--flush-ms', '50', '--idle-seconds', '30'], stdout=subprocess.DEVNULL)
+        try:
+            with open(fit_uri, 'ab') as grow_fhandle:
+                for offset in range(0, len(fit_bytes), 2048):
+                    grow_fhandle.write(fit_bytes[offset:offset + 2048])
+                    grow_fhandle.flush()
+                    time.sleep(0.02)
+            self.assertEqual(follower.wait(timeout=60), 0)
+        finally:
+            if follower.poll() is None: follower.kill()
+
+        batches = sorted(f for f in os.listdir(follow_dir) if re.match(r'batch_\d+\.parquet$', f))
+        self.assertGreater(len(batches), 1)
+        self.assertEqual([f for f in os.listdir(follow_dir) if f.startswith('.')], [])
+        followed = pyarrow.concat_tables([pyarrow.parquet.read_table(os.path.join(follow_dir, f)) for f in batches])
+
+        pyfitparq = transformer.PyFitParquet()
+        whole = pyarrow.parquet.read_table(pyfitparq.source_to_parquet(fit_uri, follow_dir))
+        self.assertTrue(followed.equals(whole))
+    #}
+
+    @unittest.skipUnless(shutil.which('fittransformer'), 'fittransformer executable not installed')
+    def test_batch(self):
+    #{
+        # Shards convert disjoint parts of the sources, their merged manifest is incremental's
+        fixtures_dir = os.path.join(os.path.dirname(__file__), 'fixtures')
+        data_dir = os.path.join(self.PARQUET_DIR, 'batch')
+        parquet_dir = os.path.join(data_dir, 'parquet')
+        os.mkdir(data_dir)
+        for i in range(6): shutil.copy(os.path.join(fixtures_dir, 'Bolt_GPS.fit'), os.path.join(data_dir, f'Bolt_GPS_{i}.fit'))
+
+        shards = [subprocess.Popen(['fittransformer', '--batch', data_dir, parquet_dir, '--shard', f'{i}/3'], 
+            stdout=subprocess.DEVNULL) for i in range(3)]
+        self.assertEqual([shard.wait(timeout=120) for shard in shards], [0, 0, 0])
+        self.assertEqual(subprocess.run(['fittransformer', '--merge-manifests', parquet_dir], 
+            stdout=subprocess.DEVNULL).returncode, 0)
+        self.assertEqual(sorted(os.listdir(parquet_dir)), 
+            sorted([f'Bolt_GPS_{i}.parquet' for i in range(6)] + [transformer.PyFitParquet.MANIFEST_FNAME]))
+
+        manifest = pyarrow.parquet.read_table(os.path.join(parquet_dir, transformer.PyFitParquet.MANIFEST_FNAME))
+        self.assertEqual(manifest.num_rows, 6)
+        mtimes = {f : os.stat(os.path.join(parquet_dir, f)).st_mtime_ns for f in os.listdir(parquet_dir)}
+        transformer.PyFitParquet().data_to_parquet(data_dir, verbose=0, incremental=True)
+        self.assertEqual({f : os.stat(os.path.join(parquet_dir, f)).st_mtime_ns for f in os.listdir(parquet_dir)}, mtimes)
+    #}
+
+    def test_zip(self):
+    #{
+        # Zipped and gzip/zstd compressed FIT/TCX files ETL like their plain versions
+        fixtures_dir = os.path.join(os.path.dirname(__file__), 'fixtures')
+        zip_uri = os.path.join(self.PARQUET_DIR, 'sources.zip')
+        with open(os.path.join(fixtures_dir, 'Bolt_GPS.fit'), 'rb') as fit_file: fit_bytes = fit_file.read()
+        with open(os.path.join(fixtures_dir, 'TeamScream.tcx'), 'rb') as tcx_file: tcx_bytes = tcx_file.read()
+        with zipfile.ZipFile(zip_uri, 'w', zipfile.ZIP_DEFLATED) as zip_file:
+            zip_file.writestr('Bolt_GPS.fit', fit_bytes)
+            zip_file.writestr('rides/Bolt_GPS.fit.gz', gzip.compress(fit_bytes))
+            zip_file.writestr('TeamScream.tcx', tcx_bytes)
+
+        pyfitparq = transformer.PyFitParquet()
+        zip_dir = pyfitparq.source_to_parquet(zip_uri)
+        self.assertEqual(zip_dir, os.path.join(self.PARQUET_DIR, 'sources'))
+        self.assertEqual(sorted(os.listdir(zip_dir)), ['Bolt_GPS.parquet', 'TeamScream.parquet', 'rides'])
+        self.assertEqual(os.listdir(os.path.join(zip_dir, 'rides')), ['Bolt_GPS.parquet'])
+
+        # Members converting to the same output fail the archive, before anything converts
+        clash_uri = os.path.join(self.PARQUET_DIR, 'clash.zip')
+        with zipfile.ZipFile(clash_uri, 'w', zipfile.ZIP_DEFLATED) as zip_file:
+            zip_file.writestr('Bolt_GPS.fit', fit_bytes)
+            zip_file.writestr('Bolt_GPS.fit.gz', gzip.compress(fit_bytes))
+        self.assertIsNone(pyfitparq.source_to_parquet(clash_uri))
+        self.assertFalse(os.path.exists(os.path.join(self.PARQUET_DIR, 'clash', 'Bolt_GPS.parquet')))
+
+        zst_uri = os.path.join(self.PARQUET_DIR, 'Bolt_GPS_zst.fit.zst')
+        with pyarrow.output_stream(zst_uri, compression='zstd') as zst_file: zst_file.write(fit_bytes)
+        zst_parquet = pyfitparq.source_to_parquet(zst_uri)
+        self.assertEqual(zst_parquet, os.path.join(self.PARQUET_DIR, 'Bolt_GPS_zst.parquet'))
+
+        for pfile, source in [(os.path.join(zip_dir, 'Bolt_GPS.parquet'), 'Bolt_GPS.parquet'),
+            (os.path.join(zip_dir, 'rides', 'Bolt_GPS.parquet'), 'Bolt_GPS.parquet'), (zst_parquet, 'Bolt_GPS.parquet'),
+            (os.path.join(zip_dir, 'TeamScream.parquet'), 'TeamScream.parquet')]:
+            table = pyarrow.parquet.read_table(pfile)
+            whole = pyarrow.parquet.read_table(os.path.join(self.PARQUET_DIR, source))
+            for column in ['timestamp', 'field_name', 'value_string']:
+                self.assertTrue(table.column(column).equals(whole.column(column)))
+    #}
 #}
 
 class TestConfiguration(unittest.TestCase):
@@ -132,12 +399,13 @@ class TestConfiguration(unittest.TestCase):
 
         # Setup starting environment variable settings        
         assert 'CONDA_PREFIX' in os.environ, "ERROR: CONDA_PREFIX must be set"
-        parquet_config_base = loadconfig.find_file("parquet_config.yml", os.environ['CONDA_PREFIX'])
-        mapping_config_base = loadconfig.find_file("mapping_config.yml", os.environ['CONDA_PREFIX'])
-        assert parquet_config_base and mapping_config_base, "ERROR: no config in pyfitparquet install" 
+        parquet_config_base = os.path.join(loadconfig.package_dir, "parquet_config.yml")
+        mapping_config_base = os.path.join(loadconfig.package_dir, "mapping_config.yml")
+        assert os.path.isfile(parquet_config_base) and os.path.isfile(mapping_config_base), \
+            "ERROR: no config in pyfitparquet install" 
 
         cls.conda_prefix = os.environ['CONDA_PREFIX']
-        cls.conda_config_install = os.path.dirname(parquet_config_base)
+        cls.conda_config_install = loadconfig.package_dir
         if 'PYFIT_CONFIG_DIR' in os.environ: del os.environ['CONDA_PREFIX']
 
         # Setup starting local config file settings
@@ -172,41 +440,268 @@ class TestConfiguration(unittest.TestCase):
         self.assertEqual(loadconfig.config_dir, self.conda_config_install)
 
         # (2) Input: CONDA_PREFIX not set, PYFIT_CONFIG_DIR not set, no local files
-        # Expected result: assertion error, can't find config_files
+        # Expected result: loadconfig.config_dir == pyfitparquet install dir (found
+        # alongside the package, CONDA_PREFIX is not searched)
         del os.environ['CONDA_PREFIX']
-        with self.assertRaises(AssertionError):
-            loadconfig.populate_config()
+        loadconfig.populate_config()
         
-        self.assertIsNone(loadconfig.config_dir)
+        self.assertEqual(loadconfig.config_dir, self.conda_config_install)
         self.assertFalse(os.path.isfile(self.parquet_config_local))
         self.assertFalse(os.path.isfile(self.mapping_config_local))
 
         # (3) Input: CONDA_PREFIX not set, PYFIT_CONFIG_DIR is set, no local files
-        # Expected result: assertion error, can't find config_files
-        os.environ['PYFIT_CONFIG_DIR'] = os.path.dirname(__file__)
-        with self.assertRaises(AssertionError):
-            loadconfig.populate_config()
-        
-        self.assertIsNone(loadconfig.config_dir)
-        self.assertFalse(os.path.isfile(self.parquet_config_local))
-        self.assertFalse(os.path.isfile(self.mapping_config_local))
-
-        # (4) Input: CONDA_PREFIX set, PYFIT_CONFIG_DIR set, no local files
         # Expected result: loadconfig.config_dir == PYFIT_CONFIG_DIR, files copied in
-        os.environ['CONDA_PREFIX'] = self.conda_prefix
+        os.environ['PYFIT_CONFIG_DIR'] = os.path.dirname(__file__)
         loadconfig.populate_config()
 
         self.assertEqual(loadconfig.config_dir, os.environ['PYFIT_CONFIG_DIR'])
         self.assertTrue(os.path.isfile(self.parquet_config_local))
         self.assertTrue(os.path.isfile(self.mapping_config_local))
 
-        # (5) Input: CONDA_PREFIX not set, PYFIT_CONFIG_DIR set, local files exist
+        # (4) Input: CONDA_PREFIX set, PYFIT_CONFIG_DIR set, local files exist
         # Expected result: loadconfig.config_dir == PYFIT_CONFIG_DIR
-        del os.environ['CONDA_PREFIX']
+        os.environ['CONDA_PREFIX'] = self.conda_prefix
         loadconfig.populate_config()
-        self.assertEqual(loadconfig.config_dir, os.environ['PYFIT_CONFIG_DIR'])        
+        self.assertEqual(loadconfig.config_dir, os.environ['PYFIT_CONFIG_DIR'])
+
+        # (5) Input: local parquet_config.yml edited after being parsed
+        # Expected result: edit picked up on the next populate_config (not cached)
+        pconfig_map = self._read_parquet_config(self.parquet_config_local)
+        pconfig_map['mesg_index'] = not pconfig_map['mesg_index']
+        with open(self.parquet_config_local, 'w') as write_fhandle:
+            yaml.safe_dump(pconfig_map, write_fhandle)
+        loadconfig.populate_config()
+        self.assertEqual(loadconfig.CONFIG['mesg_index'], str(pconfig_map['mesg_index']).lower())
+        os.remove(self.parquet_config_local)
+    #}
+
+    def test_arrow_output(self):
+    #{
+        # Arrow IPC output (memory-mapped) holds the rows Parquet output does
+        with self._with_config() as pyfitparq:
+            parquet_uris = [pyfitparq.source_to_parquet(f, self.PARQUET_DIR) for f in self.fittcx_files]
+            for codec in ['uncompressed', 'lz4']:
+                self._set_config(pyfitparq, output_format='arrow', ipc_compression=codec)
+
+                for source_uri, parquet_uri in zip(self.fittcx_files, parquet_uris):
+                    arrow_uri = pyfitparq.source_to_parquet(source_uri, self.PARQUET_DIR)
+                    self.assertEqual(arrow_uri, os.path.splitext(parquet_uri)[0] + '.arrow')
+                    with pyarrow.memory_map(arrow_uri) as source: table = pyarrow.ipc.open_file(source).read_all()
+                    self.assertEqual(table.to_pandas().shape, pd.read_parquet(parquet_uri, engine='pyarrow').shape)
+                    os.remove(arrow_uri)
+    #}
+
+    @unittest.skipUnless(shutil.which('fitgen'), 'fitgen executable not on PATH')
+    def test_sensor_expansion(self):
+    #{
+        # expand_sensor_arrays: one high-rate row per sample, time never running backwards
+        # (HRV beats several mesgs after a record carry on from the previous beats)
+        fit_uri = os.path.join(self.PARQUET_DIR, 'sensors.fit')
+        subprocess.run(['fitgen', '--seed', '3', '--duration', '600', '--mix', 'record,hrv,accelerometer', 
+                        fit_uri], check=True, capture_output=True)
+        with self._with_config(expand_sensor_arrays=True) as pyfitparq:
+            parquet_uri = pyfitparq.source_to_parquet(fit_uri, self.PARQUET_DIR)
+        main = pyarrow.parquet.read_table(parquet_uri)
+        highrate = pyarrow.parquet.read_table(os.path.splitext(parquet_uri)[0] + '_highrate.parquet')
+        self.assertEqual(sorted(pyarrow.compute.unique(main.column('mesg_name')).to_pylist()), ['event', 'file_id', 'record'])
+
+        counts = {row['mesg_name']: row['mesg_name_count'] for row in 
+                  highrate.group_by('mesg_name').aggregate([('mesg_name', 'count')]).to_pylist()}
+        self.assertEqual(counts, {'accelerometer_data': 15000, 'hrv': 1015})
+        for mesg_name in counts:
+            tstamps = highrate.filter(pyarrow.compute.equal(highrate.column('mesg_name'), mesg_name)).column('timestamp')
+            self.assertEqual(tstamps.null_count, 0)
+            self.assertTrue(pyarrow.compute.all(pyarrow.compute.greater_equal(
+                tstamps.slice(1), tstamps.slice(0, len(tstamps) - 1))).as_py())
+    #}
+
+    @unittest.skipUnless(shutil.which('fitgen'), 'fitgen executable not on PATH')
+    def test_timestamp_unit(self):
+    #{
+        # timestamp_unit sets the timestamp type, and ms keeps timestamp_ms sub-seconds
+        # (accelerometer mesgs at 100Hz, 30 samples per mesg); the default s drops them
+        fit_uri = os.path.join(self.PARQUET_DIR, 'subsecond.fit')
+        subprocess.run(['fitgen', '--seed', '5', '--duration', '60', '--sample-hz', '100', '--mix', 
+                        'record,accelerometer', fit_uri], check=True, capture_output=True)
+        with self._with_config() as pyfitparq:
+            self.assertEqual(self._read_parquet_config(self.parquet_config_local)['timestamp_unit'], 's')
+            for unit, subsecond_rows in [('s', 0), ('ms', 29760), ('us', 29760)]:
+                self._set_config(pyfitparq, timestamp_unit=unit)
+
+                reader = pyfitparq.fit_to_reader(fit_uri)
+                self.assertEqual(reader.schema.field('timestamp').type, pyarrow.timestamp(unit))
+                table = reader.read_all()
+                tstamps = table.column('timestamp').cast(pyarrow.timestamp('us')).cast(pyarrow.int64())
+                subsecond = pyarrow.compute.not_equal(pyarrow.compute.subtract(tstamps, 
+                    pyarrow.compute.multiply(pyarrow.compute.divide(tstamps, 1000000), 1000000)), 0)
+                self.assertEqual(pyarrow.compute.sum(subsecond).as_py() or 0, subsecond_rows)
+                self.assertEqual(set(table.filter(subsecond).column('mesg_name').to_pylist()), 
+                                 {'accelerometer_data'} if subsecond_rows else set())
     #}
 
+    @unittest.skipUnless(shutil.which('fitgen'), 'fitgen executable not on PATH')
+    def test_row_group_cuts(self):
+    #{
+        # Row groups close once over row_group_bytes (uncompressed, as staged) where mesg_name
+        # changes, or anywhere once over twice the budget: alternating record/hrv mesgs cut
+        # at mesg changes, record mesgs alone only at twice the budget
+        budget = 65536
+        def staged_bytes(table):
+            nbytes = 0
+            for column in table.columns:
+                if pyarrow.types.is_string(column.type): 
+                    nbytes += (pyarrow.compute.sum(pyarrow.compute.utf8_length(column)).as_py() or 0) + 4 * len(column)
+                else: nbytes += len(column) * column.type.bit_width // 8
+            return nbytes
+
+        cuts = set()
+        with self._with_config(row_group_bytes=budget, mesg_name=True) as pyfitparq:
+            for mix in ['record,hrv', 'record']:
+                fit_uri = os.path.join(self.PARQUET_DIR, 'cuts.fit')
+                subprocess.run(['fitgen', '--seed', '13', '--duration', '3600', '--mix', mix, fit_uri], 
+                               check=True, capture_output=True)
+                pfile = pyarrow.parquet.ParquetFile(pyfitparq.source_to_parquet(fit_uri, self.PARQUET_DIR))
+                groups = [pfile.read_row_group(i) for i in range(pfile.metadata.num_row_groups)]
+                self.assertGreater(len(groups), 2)
+
+                for group, following in zip(groups, groups[1:]):
+                    nbytes, mesg_change = staged_bytes(group), \
+                        group.column('mesg_name')[-1].as_py() != following.column('mesg_name')[0].as_py()
+                    self.assertGreaterEqual(nbytes, budget)
+                    self.assertTrue(mesg_change or nbytes >= 2 * budget)
+                    cuts.add('mesg_change' if mesg_change and nbytes < 2 * budget else 'twice_budget')
+        self.assertEqual(cuts, {'mesg_change', 'twice_budget'})
+    #}
+
+    @unittest.skipUnless(shutil.which('fitgen'), 'fitgen executable not on PATH')
+    def test_parallel_decode(self):
+    #{
+        # Decoding in parallel chunks writes the same row groups and rows as decoding sequentially
+        fit_uri = os.path.join(self.PARQUET_DIR, 'parallel.fit')
+        subprocess.run(['fitgen', '--seed', '7', '--duration', '3600', '--mix', 'record,lap,monitoring',
+                        fit_uri], check=True, capture_output=True)
+        outputs = []
+        with self._with_config(decode_chunk_bytes=16384, row_group_bytes=65536) as pyfitparq:
+            for threads in (1, 4):
+                self._set_config(pyfitparq, decode_threads=threads)
+                pfile = pyarrow.parquet.ParquetFile(pyfitparq.source_to_parquet(fit_uri, self.PARQUET_DIR))
+                outputs.append(([pfile.metadata.row_group(i).num_rows for i in range(pfile.metadata.num_row_groups)],
+                                pfile.read()))
+
+        self.assertGreater(len(outputs[0][0]), 1)
+        self.assertEqual(outputs[0][0], outputs[1][0])
+        self.assertTrue(outputs[0][1].equals(outputs[1][1]))
+    #}
+
+    @unittest.skipUnless(shutil.which('fitgen'), 'fitgen executable not on PATH')
+    def test_pipeline_writer(self):
+    #{
+        # Row groups written on the background writer thread equal those written after decoding
+        # (rows, row group cuts, and a bloom filter sidecar where Arrow writes one), and a decode
+        # error after row groups were written removes the partial output
+        fit_uri = os.path.join(self.PARQUET_DIR, 'pipeline.fit')
+        subprocess.run(['fitgen', '--seed', '3', '--duration', '20000', '--mix', 'record,lap,hrv',
+                        fit_uri], check=True, capture_output=True)
+        truncated_uri = os.path.join(self.PARQUET_DIR, 'truncated.fit')
+        with open(fit_uri, 'rb') as fit_fhandle: fit_bytes = fit_fhandle.read()
+        with open(truncated_uri, 'wb') as fit_fhandle: fit_fhandle.write(fit_bytes[:len(fit_bytes) * 9 // 10])
+
+        outputs = []
+        with self._with_config(row_group_bytes=65536) as pyfitparq:
+            for pipeline in (False, True):
+                self._set_config(pyfitparq, pipeline_writer=pipeline)
+                parquet_uri = pyfitparq.source_to_parquet(fit_uri, self.PARQUET_DIR)
+                pfile = pyarrow.parquet.ParquetFile(parquet_uri)
+                bloom_uri = os.path.splitext(parquet_uri)[0] + '_bloom.parquet'
+                sidecar = pyarrow.parquet.read_table(bloom_uri) if os.path.isfile(bloom_uri) else None
+                if sidecar is not None: os.remove(bloom_uri)
+                outputs.append(([pfile.metadata.row_group(i).num_rows for i in range(pfile.metadata.num_row_groups)],
+                                pfile.read(), sidecar))
+
+                self.assertIsNone(pyfitparq.source_to_parquet(truncated_uri, self.PARQUET_DIR))
+                self.assertEqual([f for f in os.listdir(self.PARQUET_DIR) if f.startswith('truncated')], [])
+
+        self.assertGreater(len(outputs[0][0]), 1)
+        self.assertEqual(outputs[0][0], outputs[1][0])
+        self.assertTrue(outputs[0][1].equals(outputs[1][1]))
+        self.assertEqual(outputs[0][2] is None, outputs[1][2] is None)
+        if outputs[0][2] is not None: self.assertTrue(outputs[0][2].equals(outputs[1][2]))
+    #}
+
+    def test_cluster_rows(self):
+    #{
+        # cluster_rows: every row group declares the cluster keys as sorting_columns 
+        # (ascending, nulls first), and the file's rows are in that order
+        fit_uri = os.path.join(os.path.dirname(__file__), 'fixtures', 'Bolt_GPS.fit')
+        with self._with_config(cluster_rows=True, row_group_bytes=1048576) as pyfitparq:
+            pconfig_map = self._read_parquet_config(self.parquet_config_local)
+            pfile = pyarrow.parquet.ParquetFile(pyfitparq.source_to_parquet(fit_uri, self.PARQUET_DIR))
+        keys = [pconfig_map[f'cluster_key_{n}'] for n in (1, 2, 3)]
+        self.assertGreater(pfile.metadata.num_row_groups, 1)
+        for i in range(pfile.metadata.num_row_groups):
+            sorting = pfile.metadata.row_group(i).sorting_columns
+            self.assertEqual([pfile.schema_arrow.names[c.column_index] for c in sorting], keys)
+            self.assertTrue(all(not c.descending and c.nulls_first for c in sorting))
+
+        rows = pfile.read(columns=keys).to_pylist()
+        order = [tuple((row[k] is not None, row[k]) for k in keys) for row in rows]
+        self.assertTrue(all(a <= b for a, b in zip(order, order[1:])))
+    #}
+
+    def test_file_constant_columns(self):
+    #{
+        # File-constant columns (one value per row group) equal the values of the file_id 
+        # rows before them, also in a chained FIT file, whose second file_id cuts a row group
+        fixtures = os.path.join(os.path.dirname(__file__), 'fixtures')
+        fit_uri = os.path.join(self.PARQUET_DIR, 'chained.fit')
+        with open(fit_uri, 'wb') as fit_fhandle:
+            for fname in ['Who_Dares_Bolt.fit', 'Who_Dares_Whoop.fit']:
+                with open(os.path.join(fixtures, fname), 'rb') as part: fit_fhandle.write(part.read())
+        constants = ['source_filetype', 'source_filename', 'source_file_uri', 'manufacturer_index', 'product_index']
+        overrides = {column: True for column in constants + ['mesg_name', 'field_name', 'value_string']}
+        with self._with_config(exclude_empty_values=False, **overrides) as pyfitparq:
+            pfile = pyarrow.parquet.ParquetFile(pyfitparq.source_to_parquet(fit_uri, self.PARQUET_DIR))
+        rows = pfile.read().to_pylist()
+
+        # Each file_id (a run of file_id rows) starts a file segment
+        segments = []
+        for k, row in enumerate(rows):
+            if row['mesg_name'] == 'file_id' and (k == 0 or rows[k - 1]['mesg_name'] != 'file_id'): segments.append([])
+            segments[-1].append(row)
+        self.assertEqual(len(segments), 2)
+        self.assertGreaterEqual(pfile.metadata.num_row_groups, 2)
+
+        for segment in segments:
+            file_id = {row['field_name']: row['value_string'] for row in segment if row['mesg_name'] == 'file_id'}
+            product = next((v for f, v in file_id.items() if f.endswith('product')), None)
+            for row in segment:
+                self.assertEqual((row['source_filetype'], row['source_filename']), ('FIT', 'chained.fit'))
+                self.assertEqual(row['source_file_uri'], rows[0]['source_file_uri'])
+                self.assertEqual(row['manufacturer_index'], int(file_id['manufacturer']))
+                if product is not None: self.assertEqual(row['product_index'], int(product))
+    #}
+
+    @contextlib.contextmanager
+    def _with_config(self, **overrides):
+        # PyFitParquet on a fresh local parquet_config.yml with overrides set. The
+        # local file is removed and the config reloaded on exit, also when a test fails
+        os.environ['PYFIT_CONFIG_DIR'] = os.path.dirname(__file__)
+        if os.path.isfile(self.parquet_config_local): os.remove(self.parquet_config_local)
+        pyfitparq = transformer.PyFitParquet()
+        try:
+            if overrides: self._set_config(pyfitparq, **overrides)
+            yield pyfitparq
+        finally:
+            if os.path.isfile(self.parquet_config_local): os.remove(self.parquet_config_local)
+            pyfitparq.reset_from_config()
+
+    def _set_config(self, pyfitparq, **overrides):
+        # Updates the local parquet_config.yml and reloads it
+        pconfig_map = self._read_parquet_config(self.parquet_config_local)
+        pconfig_map.update(overrides)
+        with open(self.parquet_config_local, 'w') as write_fhandle: yaml.safe_dump(pconfig_map, write_fhandle)
+        pyfitparq.reset_from_config()
+
     def _read_parquet_config(self, parquet_config):
         with open(parquet_config) as pconfig_fhandle:
             pconfig_map = yaml.safe_load(pconfig_fhandle)
@@ -230,7 +725,7 @@ class TestConfiguration(unittest.TestCase):
         columns = ['source_filetype', 'source_filename', 'source_file_uri', 'manufacturer_index',
            'manufacturer_name', 'product_index', 'product_name', 'timestamp', 'mesg_index',
            'mesg_name', 'field_index', 'field_name', 'field_type', 'value_string',
-           'value_integer', 'value_float', 'units']
+           'value_integer', 'value_float', 'value_enum_name', 'units']
 
         colset = set(columns)
         if os.path.isfile(self.parquet_config_local): os.remove(self.parquet_config_local)